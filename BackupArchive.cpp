@@ -0,0 +1,446 @@
+#include "BackupArchive.h"
+#include "slot.h"
+#include "UserPrefs.h"
+#include "Storage.h"
+
+// nibble table crc32 (same polynomial and conditioning as zlib)
+static const uint32_t crcTable[16] PROGMEM = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint32_t backupCrc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    crc = ~crc;
+    while (len--) {
+        crc ^= *data++;
+        crc = pgm_read_dword(&crcTable[crc & 0x0f]) ^ (crc >> 4);
+        crc = pgm_read_dword(&crcTable[crc & 0x0f]) ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+bool isBackupFile(const char *name)
+{
+    return strncmp_P(name, PSTR("/preset_"), 8) == 0 || strcmp_P(name, PSTR(SLOTS_FILE)) == 0 ||
+           strcmp_P(name, PSTR(PREFS_FILE)) == 0 || strcmp_P(name, PSTR(PREFS_LEGACY_FILE)) == 0;
+}
+
+static void putU32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = value;
+    dst[1] = value >> 8;
+    dst[2] = value >> 16;
+    dst[3] = value >> 24;
+}
+
+static uint32_t getU32(const uint8_t *src)
+{
+    return src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static bool nextBackupFile(Dir &dir)
+{
+    while (dir.next()) {
+        String name = storageName(dir);
+        if (name.length() <= BACKUP_MAX_NAME && isBackupFile(name.c_str())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+BackupWriter::BackupWriter()
+    : state(Header), fileCount(0), fileIndex(0), total(0), remaining(0), crc(0), entryCrc(0), stagePos(0)
+{
+    // first pass only sizes the archive, the directory is walked again for the manifest and the data
+    dir = storage().openDir("/");
+    while (fileCount < BACKUP_MAX_FILES && nextBackupFile(dir)) {
+        fileCount++;
+        total += dir.fileSize();
+    }
+    dir = storage().openDir("/");
+
+    memcpy(stage, BACKUP_MAGIC, 4);
+    stage[4] = BACKUP_VERSION;
+    stage[5] = fileCount;
+    putU32(stage + 6, total);
+    stageLen = 10;
+}
+
+bool BackupWriter::nextFile()
+{
+    if (fileIndex >= fileCount || !nextBackupFile(dir)) {
+        return false;
+    }
+    fileIndex++;
+    return true;
+}
+
+void BackupWriter::stageEntry(bool withFile)
+{
+    String name = storageName(dir);
+    uint32_t size = dir.fileSize();
+    if (withFile) {
+        file = dir.openFile("r");
+        size = file ? file.size() : 0;
+        remaining = size;
+        entryCrc = 0;
+    }
+    stage[0] = name.length();
+    memcpy(stage + 1, name.c_str(), name.length());
+    putU32(stage + 1 + name.length(), size);
+    stageLen = 1 + name.length() + 4;
+    stagePos = 0;
+}
+
+void BackupWriter::stageU32(uint32_t value)
+{
+    putU32(stage, value);
+    stageLen = 4;
+    stagePos = 0;
+}
+
+size_t BackupWriter::fill(uint8_t *buffer, size_t maxLen)
+{
+    size_t len = 0;
+    while (len < maxLen && state != Done) {
+        if (stagePos < stageLen) {
+            size_t n = stageLen - stagePos;
+            if (n > maxLen - len) {
+                n = maxLen - len;
+            }
+            memcpy(buffer + len, stage + stagePos, n);
+            crc = backupCrc32(crc, stage + stagePos, n);
+            stagePos += n;
+            len += n;
+            continue;
+        }
+        switch (state) {
+            case Header:
+            case Manifest:
+                if (nextFile()) {
+                    state = Manifest;
+                    stageEntry(false);
+                    break;
+                }
+                dir = storage().openDir("/");
+                fileIndex = 0;
+                // fall through
+            case EntryCrc:
+                if (nextFile()) {
+                    state = EntryHeader;
+                    stageEntry(true);
+                } else {
+                    state = Trailer;
+                    stageU32(crc);
+                }
+                break;
+            case EntryHeader:
+                state = EntryData;
+                break;
+            case EntryData: {
+                if (remaining == 0) {
+                    file.close();
+                    state = EntryCrc;
+                    stageU32(entryCrc);
+                    break;
+                }
+                size_t n = maxLen - len;
+                if (n > remaining) {
+                    n = remaining;
+                }
+                n = file.read(buffer + len, n);
+                if (n == 0) {
+                    // file vanished or shrank, end the response early so the restore side rejects it
+                    file.close();
+                    state = Done;
+                    break;
+                }
+                crc = backupCrc32(crc, buffer + len, n);
+                entryCrc = backupCrc32(entryCrc, buffer + len, n);
+                remaining -= n;
+                len += n;
+                break;
+            }
+            case Trailer:
+                state = Done;
+                break;
+            default:
+                break;
+        }
+    }
+    return len;
+}
+
+BackupReader::BackupReader()
+    : state(Header), error(nullptr)
+{
+}
+
+void BackupReader::removeStaged()
+{
+    // restart the walk after every change, SPIFFS directories are not stable while modified
+    bool found = true;
+    while (found) {
+        found = false;
+        Dir dir = storage().openDir("/");
+        while (dir.next()) {
+            String name = storageName(dir);
+            if (name.startsWith(BACKUP_TEMP_PREFIX)) {
+                storage().remove(name);
+                found = true;
+                break;
+            }
+            if (name.startsWith(BACKUP_ASIDE_PREFIX)) {
+                // an earlier restore stopped between the renames, the original wins if it is missing
+                String target = "/" + name.substring(sizeof(BACKUP_ASIDE_PREFIX) - 1);
+                if (storage().exists(target) || !storage().rename(name, target)) {
+                    storage().remove(name);
+                }
+                found = true;
+                break;
+            }
+        }
+    }
+}
+
+void BackupReader::begin()
+{
+    if (file) {
+        file.close();
+    }
+    removeStaged();
+    state = Header;
+    fileCount = 0;
+    filesSeen = 0;
+    total = 0;
+    manifestTotal = 0;
+    remaining = 0;
+    crc = 0;
+    stageLen = 0;
+    stageNeed = 10;
+    error = nullptr;
+}
+
+void BackupReader::fail(const __FlashStringHelper *reason)
+{
+    if (state == Failed) {
+        return;
+    }
+    error = reason;
+    state = Failed;
+    if (file) {
+        file.close();
+    }
+    removeStaged();
+}
+
+// gathers stageNeed bytes, the trailer itself is not part of the checksum
+bool BackupReader::collect(const uint8_t *&data, size_t &len)
+{
+    size_t n = stageNeed - stageLen;
+    if (n > len) {
+        n = len;
+    }
+    memcpy(stage + stageLen, data, n);
+    if (state != Trailer) {
+        crc = backupCrc32(crc, data, n);
+    }
+    stageLen += n;
+    data += n;
+    len -= n;
+    return stageLen == stageNeed;
+}
+
+uint32_t BackupReader::stagedU32() const
+{
+    return getU32(stage + stageLen - 4);
+}
+
+bool BackupReader::openEntry()
+{
+    char path[sizeof(BACKUP_TEMP_PREFIX) + BACKUP_MAX_NAME];
+    const uint8_t nameLen = stage[0];
+    stage[1 + nameLen] = 0; // size was already taken out of the stage
+    if (stage[1] != '/' || !isBackupFile((const char *)stage + 1)) {
+        fail(F("unexpected file in archive"));
+        return false;
+    }
+    snprintf(path, sizeof(path), BACKUP_TEMP_PREFIX "%s", (const char *)stage + 2);
+    file = storage().open(path, "w");
+    if (!file) {
+        fail(F("could not create file"));
+        return false;
+    }
+    entryCrc = 0;
+    return true;
+}
+
+bool BackupReader::feed(const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        switch (state) {
+            case Header: {
+                if (!collect(data, len)) {
+                    return true;
+                }
+                if (memcmp(stage, BACKUP_MAGIC, 4) != 0 || stage[4] != BACKUP_VERSION) {
+                    fail(F("not a backup file"));
+                    return false;
+                }
+                fileCount = stage[5];
+                total = getU32(stage + 6);
+                FSInfo info;
+                storage().info(info);
+                if (total > info.totalBytes - info.usedBytes) {
+                    fail(F("not enough space"));
+                    return false;
+                }
+                state = fileCount ? ManifestName : Trailer;
+                stageLen = 0;
+                stageNeed = fileCount ? 1 : 4;
+                break;
+            }
+            case ManifestName:
+            case EntryName:
+                if (!collect(data, len)) {
+                    return true;
+                }
+                if (stage[0] == 0 || stage[0] > BACKUP_MAX_NAME) {
+                    fail(F("bad file name"));
+                    return false;
+                }
+                state = state == ManifestName ? ManifestSize : EntrySize;
+                stageNeed = 1 + stage[0] + 4;
+                break;
+            case ManifestSize:
+                if (!collect(data, len)) {
+                    return true;
+                }
+                manifestTotal += stagedU32();
+                stageLen = 0;
+                stageNeed = 1;
+                if (++filesSeen == fileCount) {
+                    if (manifestTotal != total) {
+                        fail(F("manifest does not match header"));
+                        return false;
+                    }
+                    filesSeen = 0;
+                    state = EntryName;
+                } else {
+                    state = ManifestName;
+                }
+                break;
+            case EntrySize:
+                if (!collect(data, len)) {
+                    return true;
+                }
+                remaining = stagedU32();
+                if (filesSeen >= fileCount || remaining > manifestTotal) {
+                    fail(F("entry does not match manifest"));
+                    return false;
+                }
+                manifestTotal -= remaining;
+                if (!openEntry()) {
+                    return false;
+                }
+                state = EntryData;
+                stageLen = 0;
+                stageNeed = 4;
+                if (remaining == 0) {
+                    state = EntryCrc;
+                }
+                break;
+            case EntryData: {
+                size_t n = len < remaining ? len : remaining;
+                if (file.write(data, n) != n) {
+                    fail(F("write failed"));
+                    return false;
+                }
+                crc = backupCrc32(crc, data, n);
+                entryCrc = backupCrc32(entryCrc, data, n);
+                remaining -= n;
+                data += n;
+                len -= n;
+                if (remaining == 0) {
+                    state = EntryCrc;
+                }
+                break;
+            }
+            case EntryCrc:
+                if (!collect(data, len)) {
+                    return true;
+                }
+                file.close();
+                if (stagedU32() != entryCrc) {
+                    fail(F("file checksum mismatch"));
+                    return false;
+                }
+                stageLen = 0;
+                if (++filesSeen == fileCount) {
+                    state = Trailer;
+                    stageNeed = 4;
+                } else {
+                    state = EntryName;
+                    stageNeed = 1;
+                }
+                break;
+            case Trailer:
+                if (!collect(data, len)) {
+                    return true;
+                }
+                if (stagedU32() != crc || manifestTotal != 0) {
+                    fail(F("archive checksum mismatch"));
+                    return false;
+                }
+                state = Done;
+                break;
+            case Done:
+                fail(F("data after end of archive"));
+                return false;
+            case Failed:
+                return false;
+        }
+    }
+    return state != Failed;
+}
+
+bool BackupReader::finish()
+{
+    if (state != Done) {
+        fail(F("incomplete archive"));
+        return false;
+    }
+    // every file checked out, swap the staged copies in
+    bool found = true;
+    while (found) {
+        found = false;
+        Dir dir = storage().openDir("/");
+        while (dir.next()) {
+            String name = storageName(dir);
+            if (name.startsWith(BACKUP_TEMP_PREFIX)) {
+                String target = "/" + name.substring(sizeof(BACKUP_TEMP_PREFIX) - 1);
+                String aside = BACKUP_ASIDE_PREFIX + target.substring(1);
+                // the original goes aside first, a failed rename must not cost it
+                const bool hadTarget = storage().exists(target);
+                storage().remove(aside);
+                if (hadTarget && !storage().rename(target, aside)) {
+                    storage().remove(name);
+                    error = F("rename failed");
+                } else if (!storage().rename(name, target)) {
+                    storage().remove(name);
+                    if (hadTarget) {
+                        storage().rename(aside, target);
+                    }
+                    error = F("rename failed");
+                } else if (hadTarget) {
+                    storage().remove(aside);
+                }
+                found = true;
+                break;
+            }
+        }
+    }
+    state = Header; // an empty request must not report success again
+    return error == nullptr;
+}
@@ -0,0 +1,106 @@
+#ifndef BACKUP_ARCHIVE_H_
+#define BACKUP_ARCHIVE_H_
+#include <Arduino.h>
+#include "FS.h"
+
+// Single file backup of all slot, preset and preference files.
+// All numbers are little endian.
+//   header:   "GBSB", <u8 version>, <u8 file count>, <u32 total payload bytes>
+//   manifest: { <u8 name length>, <name>, <u32 size> } per file
+//   entries:  { <u8 name length>, <name>, <u32 size>, <data>, <u32 crc32 of data> } per file, in manifest order
+//   trailer:  <u32 crc32 of everything before it>
+// The writer is pulled by a chunked http response, the reader is fed by the upload handler.
+#define BACKUP_MAGIC "GBSB"
+#define BACKUP_VERSION 1
+#define BACKUP_MAX_FILES 255
+#define BACKUP_TEMP_PREFIX "/~"  // restored files are staged under this prefix until the archive checks out
+#define BACKUP_ASIDE_PREFIX "/^" // originals are kept under this prefix while their staged copy is renamed in
+#define BACKUP_MAX_NAME 30       // SPIFFS allows 31 characters, one is taken by the staging or aside prefix
+
+uint32_t backupCrc32(uint32_t crc, const uint8_t *data, size_t len);
+bool isBackupFile(const char *name);
+
+class BackupWriter
+{
+private:
+    enum State : uint8_t {
+        Header,
+        Manifest,
+        EntryHeader,
+        EntryData,
+        EntryCrc,
+        Trailer,
+        Done
+    };
+    Dir dir;
+    File file;
+    State state;
+    uint8_t fileCount;
+    uint8_t fileIndex;
+    uint32_t total;
+    uint32_t remaining; // of the current entry
+    uint32_t crc;       // whole archive
+    uint32_t entryCrc;
+    uint8_t stage[1 + BACKUP_MAX_NAME + 4];
+    uint8_t stageLen;
+    uint8_t stagePos;
+
+    bool nextFile();
+    void stageEntry(bool withFile);
+    void stageU32(uint32_t value);
+
+public:
+    BackupWriter();
+    // fills at most maxLen bytes, 0 when the archive is complete
+    size_t fill(uint8_t *buffer, size_t maxLen);
+};
+
+class BackupReader
+{
+private:
+    enum State : uint8_t {
+        Header,
+        ManifestName,
+        ManifestSize,
+        EntryName,
+        EntrySize,
+        EntryData,
+        EntryCrc,
+        Trailer,
+        Done,
+        Failed
+    };
+    File file;
+    State state;
+    uint8_t fileCount;
+    uint8_t filesSeen; // manifest entries, then archive entries
+    uint32_t total;    // payload announced in the header
+    uint32_t manifestTotal;
+    uint32_t remaining;
+    uint32_t crc;
+    uint32_t entryCrc;
+    uint8_t stage[1 + BACKUP_MAX_NAME + 4];
+    uint8_t stageLen;
+    uint8_t stageNeed;
+    const __FlashStringHelper *error;
+
+    bool collect(const uint8_t *&data, size_t &len);
+    uint32_t stagedU32() const;
+    void fail(const __FlashStringHelper *reason);
+    bool openEntry();
+
+public:
+    BackupReader();
+    // starts a new restore, removes leftovers of an interrupted one
+    void begin();
+    // consumes the next part of the upload, returns false once the archive is rejected
+    bool feed(const uint8_t *data, size_t len);
+    // moves the staged files into place if the archive was complete and valid
+    bool finish();
+    const __FlashStringHelper *lastError() const
+    {
+        return error;
+    }
+    static void removeStaged();
+};
+#endif
@@ -0,0 +1,136 @@
+#include "BootProfile.h"
+#include "Storage.h"
+#include "BackupArchive.h"
+extern "C" {
+#include <user_interface.h>
+}
+
+struct BootMark
+{
+    const __FlashStringHelper *name;
+    uint32_t micros;
+};
+
+static BootMark marks[BOOT_MAX_MARKS];
+static uint8_t markCount;
+
+void bootMark(const __FlashStringHelper *name)
+{
+    if (markCount < BOOT_MAX_MARKS) {
+        marks[markCount].name = name;
+        marks[markCount].micros = micros();
+        markCount++;
+    }
+}
+
+void printBootTimeline(Print &out)
+{
+    for (uint8_t i = 0; i < markCount; i++) {
+        out.print(marks[i].micros);
+        out.print(F(" us "));
+        out.print(marks[i].name);
+        if (i + 1 < markCount) {
+            out.print(F(": "));
+            out.print(marks[i + 1].micros - marks[i].micros);
+            out.print(F(" us"));
+        }
+        out.println();
+    }
+    if (markCount == BOOT_MAX_MARKS) {
+        out.println(F("(timeline full)"));
+    }
+}
+
+#define BOOT_CACHE_HEADER_SIZE 6
+#define BOOT_CACHE_SIZE (BOOT_CACHE_HEADER_SIZE + sizeof(BootCache) + 4)
+static_assert(sizeof(BootCache) < 256, "payload length is stored in a byte");
+
+bool loadBootCache(BootCache &cache)
+{
+    memset(&cache, 0, sizeof(cache));
+    cache.lastInput = BOOT_NO_INPUT;
+    File f = storage().open(BOOT_CACHE_FILE, "r");
+    if (!f) {
+        return false;
+    }
+    uint8_t buf[BOOT_CACHE_SIZE];
+    const size_t len = f.read(buf, sizeof(buf));
+    f.close();
+    // a different payload length means a different version, just start over
+    if (len != sizeof(buf) || memcmp(buf, BOOT_CACHE_MAGIC, 4) != 0 || buf[4] != BOOT_CACHE_VERSION ||
+        buf[5] != sizeof(BootCache)) {
+        return false;
+    }
+    const uint8_t *trailer = buf + BOOT_CACHE_HEADER_SIZE + sizeof(BootCache);
+    const uint32_t crc = trailer[0] | ((uint32_t)trailer[1] << 8) | ((uint32_t)trailer[2] << 16) | ((uint32_t)trailer[3] << 24);
+    if (crc != backupCrc32(0, buf, trailer - buf)) {
+        return false;
+    }
+    memcpy(&cache, buf + BOOT_CACHE_HEADER_SIZE, sizeof(cache));
+    return true;
+}
+
+bool storeBootCache(const BootCache &cache)
+{
+    uint8_t buf[BOOT_CACHE_SIZE];
+    memcpy(buf, BOOT_CACHE_MAGIC, 4);
+    buf[4] = BOOT_CACHE_VERSION;
+    buf[5] = sizeof(BootCache);
+    memcpy(buf + BOOT_CACHE_HEADER_SIZE, &cache, sizeof(cache));
+    uint8_t *trailer = buf + BOOT_CACHE_HEADER_SIZE + sizeof(BootCache);
+    const uint32_t crc = backupCrc32(0, buf, trailer - buf);
+    for (uint8_t i = 0; i < 4; i++) {
+        trailer[i] = crc >> (8 * i);
+    }
+    // a torn write only costs one full boot, no temp file needed
+    File f = storage().open(BOOT_CACHE_FILE, "w");
+    if (!f) {
+        return false;
+    }
+    const bool complete = f.write(buf, sizeof(buf)) == sizeof(buf);
+    f.close();
+    return complete;
+}
+
+bool bootResetWasClean()
+{
+    switch (ESP.getResetInfoPtr()->reason) {
+        case REASON_DEFAULT_RST:
+        case REASON_SOFT_RESTART:
+        case REASON_DEEP_SLEEP_AWAKE:
+        case REASON_EXT_SYS_RST:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void printBootCache(Print &out, const BootCache &cache)
+{
+    out.print(F("chip: "));
+    out.print(cache.chipProduct, HEX);
+    out.print(' ');
+    out.print(cache.chipRevision, HEX);
+    out.print(F(" clockgen: "));
+    out.print(cache.extClockGen);
+    out.print(F(" options: "));
+    out.println(cache.options, HEX);
+    out.print(F("adc offsets: "));
+    if (cache.adcValid) {
+        out.print(cache.adcOffsetR, HEX);
+        out.print(' ');
+        out.print(cache.adcOffsetG, HEX);
+        out.print(' ');
+        out.println(cache.adcOffsetB, HEX);
+    } else {
+        out.println(F("none"));
+    }
+    out.print(F("last input: "));
+    if (cache.lastInput == BOOT_NO_INPUT) {
+        out.println(F("none"));
+    } else {
+        out.print(cache.lastInput == 1 ? F("RGB") : F("Component"));
+        out.print(F(" mode: "));
+        out.println(cache.lastVideoMode);
+    }
+}
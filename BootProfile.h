@@ -0,0 +1,48 @@
+#ifndef BOOT_PROFILE_H_
+#define BOOT_PROFILE_H_
+#include <Arduino.h>
+
+// Boot timeline: bootMark() starts a named phase, it lasts until the next mark.
+// Names are flash strings, a mark costs one micros() call and no allocation.
+#define BOOT_MAX_MARKS 24
+
+void bootMark(const __FlashStringHelper *name);
+void printBootTimeline(Print &out);
+
+// Results of the last good boot, reused by the next one (fast boot). Written once a
+// picture was shown, and only if something changed.
+//   "GBSC", <u8 version>, <u8 payload length>, <BootCache>, <u32 crc32 of everything before>
+// A crash or watchdog reset, different options or a different chip / clock generator fall back
+// to the full boot with all delays and an ADC calibration.
+#define BOOT_CACHE_FILE "/bootcache.bin"
+#define BOOT_CACHE_MAGIC "GBSC" // not BACKUP_MAGIC, a backup archive is no boot cache
+#define BOOT_CACHE_VERSION 1
+#define BOOT_FAST 1                    // 0 always runs the full boot
+#define BOOT_FAST_SPLASH_MS 300        // instead of 1500, wifi keeps starting up in loop()
+#define BOOT_FAST_CLOCKGEN_WAIT_MS 100 // instead of 1000
+#define BOOT_NO_INPUT 0xFF
+#define BOOT_ADC_STAMP 2 // adcValid of offsets from the current calibration, others are calibrated again
+#define BOOT_FAST_MODE_ROUNDS 4 // format change rounds for the mode the last boot ended with, instead of 8
+
+struct BootCache
+{
+    uint8_t chipProduct;
+    uint8_t chipRevision;
+    uint8_t extClockGen;
+    uint8_t options;   // user options the results depend on
+    uint8_t adcValid;  // offsets came from a successful calibration, BOOT_ADC_STAMP
+    uint8_t adcOffsetR;
+    uint8_t adcOffsetG;
+    uint8_t adcOffsetB;
+    uint8_t lastInput; // ADC_INPUT_SEL of the last stable picture, BOOT_NO_INPUT if there was none
+    uint8_t lastVideoMode; // videoStandardInput of that picture, confirmed in fewer rounds
+};
+
+// false if missing or damaged, cache holds "nothing known" then
+bool loadBootCache(BootCache &cache);
+bool storeBootCache(const BootCache &cache);
+// power on, restart, deep sleep wake or reset pin. A crash or a watchdog reset does not count.
+// After a power on the GBS may still be starting, setup() waits for its chip id either way.
+bool bootResetWasClean();
+void printBootCache(Print &out, const BootCache &cache);
+#endif
@@ -0,0 +1,309 @@
+#ifndef ESTIMATORS_H_
+#define ESTIMATORS_H_
+#include <Arduino.h>
+
+// Small filters for register measurements. No allocation, one instance per signal,
+// type and window size are template parameters so each costs only the samples it keeps.
+// Tests and the sample counts of the checks built on them: test/host/test_estimators.cpp
+
+// |a - b| <= tolerance. For uint32_t "a > b - tolerance" wraps when b < tolerance; uint8_t and
+// uint16_t promote to int and do not, there it only keeps both bounds in one place.
+template <class T, class U>
+inline bool withinTolerance(T a, T b, U tolerance)
+{
+    return (a > b ? a - b : b - a) <= (T)tolerance;
+}
+
+// mean of the last N samples, the first ones average over what is there so far
+template <class T, uint8_t N, class Sum = uint32_t>
+class MovingAverage
+{
+private:
+    T samples[N];
+    Sum sum;
+    uint8_t pos;
+    uint8_t count;
+
+public:
+    MovingAverage()
+    {
+        reset();
+    }
+    void reset()
+    {
+        sum = 0;
+        pos = 0;
+        count = 0;
+    }
+    T add(T sample)
+    {
+        if (count == N) {
+            sum -= samples[pos];
+        } else {
+            count++;
+        }
+        samples[pos] = sample;
+        sum += sample;
+        pos = (pos + 1) % N;
+        return value();
+    }
+    T value() const
+    {
+        return count ? sum / count : 0;
+    }
+    bool full() const
+    {
+        return count == N;
+    }
+};
+
+// exponential moving average, weight of a new sample 1 / 2^Shift, Shift fraction bits kept
+template <class T, uint8_t Shift, class Acc = int32_t>
+class Ema
+{
+private:
+    Acc acc;
+    bool primed;
+
+public:
+    Ema()
+    {
+        reset();
+    }
+    void reset()
+    {
+        acc = 0;
+        primed = false;
+    }
+    T add(T sample)
+    {
+        if (!primed) {
+            acc = (Acc)sample << Shift;
+            primed = true;
+        } else {
+            acc += (Acc)sample - (acc >> Shift);
+        }
+        return value();
+    }
+    T value() const
+    {
+        return (T)((acc + ((Acc)1 << (Shift - 1))) >> Shift);
+    }
+};
+
+// median of the last N samples, N odd; rejects single spikes a mean would follow
+template <class T, uint8_t N>
+class Median
+{
+    static_assert(N % 2 == 1, "median window must be odd");
+
+private:
+    T samples[N];
+    uint8_t pos;
+    uint8_t count;
+
+public:
+    Median()
+    {
+        reset();
+    }
+    void reset()
+    {
+        pos = 0;
+        count = 0;
+    }
+    T add(T sample)
+    {
+        samples[pos] = sample;
+        pos = (pos + 1) % N;
+        if (count < N) {
+            count++;
+        }
+        return value();
+    }
+    T value() const
+    {
+        T sorted[N];
+        for (uint8_t i = 0; i < count; i++) {
+            // insertion sort, N is small
+            uint8_t j = i;
+            while (j > 0 && sorted[j - 1] > samples[i]) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = samples[i];
+        }
+        return count ? sorted[count / 2] : 0;
+    }
+    bool full() const
+    {
+        return count == N;
+    }
+};
+
+// on at or above onLevel, off again only at or below offLevel
+template <class T>
+class Hysteresis
+{
+private:
+    T onLevel;
+    T offLevel;
+    bool state;
+
+public:
+    Hysteresis(T onLevel, T offLevel, bool state = false)
+        : onLevel(onLevel), offLevel(offLevel), state(state)
+    {
+    }
+    bool add(T sample)
+    {
+        if (state && sample <= offLevel) {
+            state = false;
+        } else if (!state && sample >= onLevel) {
+            state = true;
+        }
+        return state;
+    }
+    bool value() const
+    {
+        return state;
+    }
+};
+
+// Stable once Needed samples in a row stay within Tolerance of the first one (or, with
+// Chained, of the sample before: slow drift passes, jumps do not). A sample out of range
+// starts a new run from itself.
+template <class T, T Tolerance, uint8_t Needed, bool Chained = false>
+class StableRun
+{
+private:
+    T reference;
+    uint8_t run;
+    uint16_t total; // samples since reset, how long a decision took
+    bool restarted;
+
+public:
+    StableRun()
+    {
+        reset();
+    }
+    void reset()
+    {
+        run = 0;
+        total = 0;
+        restarted = false;
+    }
+    bool add(T sample)
+    {
+        if (total < 0xffff) {
+            total++;
+        }
+        if (run == 0 || !withinTolerance(sample, reference, Tolerance)) {
+            restarted = run != 0;
+            reference = sample;
+            run = 1;
+        } else {
+            if (Chained) {
+                reference = sample;
+            }
+            if (run < Needed) {
+                run++;
+            }
+        }
+        return stable();
+    }
+    bool stable() const
+    {
+        return run >= Needed;
+    }
+    // a sample was out of range since reset()
+    bool broken() const
+    {
+        return restarted;
+    }
+    T value() const
+    {
+        return reference;
+    }
+    uint16_t samples() const
+    {
+        return total;
+    }
+};
+
+// Needed true samples in a row, the first false one ends the run for good: add() until it
+// returns true or failed()
+template <uint8_t Needed>
+class RunOf
+{
+private:
+    uint8_t run;
+    bool ended;
+
+public:
+    RunOf()
+    {
+        reset();
+    }
+    void reset()
+    {
+        run = 0;
+        ended = false;
+    }
+    bool add(bool sample)
+    {
+        if (!sample) {
+            ended = true;
+        } else if (!ended && run < Needed) {
+            run++;
+        }
+        return done();
+    }
+    bool done() const
+    {
+        return !ended && run >= Needed;
+    }
+    bool failed() const
+    {
+        return ended;
+    }
+};
+
+// Follows a value, a new one is taken only after Confirm samples in a row differ from the
+// current value by more than Tolerance. add() returns true when that happens.
+template <class T, T Tolerance, uint8_t Confirm>
+class ChangeDetector
+{
+private:
+    T current;
+    uint8_t pending;
+
+public:
+    ChangeDetector(T initial)
+        : current(initial), pending(0)
+    {
+    }
+    bool add(T sample)
+    {
+        if (withinTolerance(sample, current, Tolerance)) {
+            pending = 0;
+            return false;
+        }
+        if (++pending < Confirm) {
+            return false;
+        }
+        current = sample;
+        pending = 0;
+        return true;
+    }
+    // differing samples seen, not yet confirmed
+    bool changing() const
+    {
+        return pending != 0;
+    }
+    T value() const
+    {
+        return current;
+    }
+};
+#endif
@@ -0,0 +1,145 @@
+#include "HeapTelemetry.h"
+
+static HeapTelemetry telemetry;
+static unsigned long lastSample;
+
+const HeapTelemetry &heapTelemetry()
+{
+    return telemetry;
+}
+
+static void takeSample()
+{
+    uint32_t freeHeap;
+    uint16_t maxBlock;
+    uint8_t fragmentation;
+    ESP.getHeapStats(&freeHeap, &maxBlock, &fragmentation);
+    telemetry.freeHeap = freeHeap;
+    telemetry.maxBlock = maxBlock;
+    telemetry.fragmentation = fragmentation;
+    if (telemetry.samples == 0 || freeHeap < telemetry.minFreeHeap) {
+        telemetry.minFreeHeap = freeHeap;
+    }
+    if (telemetry.samples == 0 || maxBlock < telemetry.minMaxBlock) {
+        telemetry.minMaxBlock = maxBlock;
+    }
+    if (fragmentation > telemetry.maxFragmentation) {
+        telemetry.maxFragmentation = fragmentation;
+    }
+    telemetry.samples++;
+}
+
+bool heapAvailable(HeapUser user, uint32_t reserve)
+{
+    const uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap > reserve) {
+        return true;
+    }
+    // may run in the async tcp context, that never preempts loop() on this core
+    HeapDrops &drops = telemetry.drops[(uint8_t)user];
+    drops.count++;
+    drops.lastFreeHeap = freeHeap;
+    drops.lastMillis = millis();
+    if (telemetry.samples == 0 || freeHeap < telemetry.minFreeHeap) {
+        telemetry.minFreeHeap = freeHeap;
+    }
+    return false;
+}
+
+void heapTelemetrySample()
+{
+    takeSample();
+    // scans the painted cont stack, too slow for every allocation but fine once per sample
+    telemetry.freeStack = ESP.getFreeContStack();
+    lastSample = millis();
+}
+
+void heapTelemetryTick()
+{
+    if (millis() - lastSample >= HEAP_SAMPLE_MS) {
+        heapTelemetrySample();
+    }
+}
+
+void heapTelemetryReset()
+{
+    memset(&telemetry, 0, sizeof(telemetry));
+    heapTelemetrySample();
+}
+
+const __FlashStringHelper *heapUserName(HeapUser user)
+{
+    switch (user) {
+        case HeapUser::SerialMirror:
+            return F("serial_mirror");
+        case HeapUser::WebSocketPing:
+            return F("ws_ping");
+        case HeapUser::WebCommand:
+            return F("web_command");
+        case HeapUser::WebSlot:
+            return F("web_slot");
+        case HeapUser::WebDownload:
+            return F("web_download");
+        default:
+            return F("?");
+    }
+}
+
+void printHeapTelemetry(Print &out)
+{
+    out.print(F("heap free: "));
+    out.print(telemetry.freeHeap);
+    out.print(F(" (min "));
+    out.print(telemetry.minFreeHeap);
+    out.print(F(") largest block: "));
+    out.print(telemetry.maxBlock);
+    out.print(F(" (min "));
+    out.print(telemetry.minMaxBlock);
+    out.print(F(") fragmentation: "));
+    out.print(telemetry.fragmentation);
+    out.print(F("% (max "));
+    out.print(telemetry.maxFragmentation);
+    out.println(F("%)"));
+    out.print(F("loop stack never used: "));
+    out.print(telemetry.freeStack);
+    out.print(F(" samples: "));
+    out.println(telemetry.samples);
+    for (uint8_t i = 0; i < (uint8_t)HeapUser::Count; i++) {
+        const HeapDrops &drops = telemetry.drops[i];
+        out.print(heapUserName((HeapUser)i));
+        out.print(F(" drops: "));
+        out.print(drops.count);
+        if (drops.count) {
+            out.print(F(" last at "));
+            out.print(drops.lastMillis);
+            out.print(F(" ms with "));
+            out.print(drops.lastFreeHeap);
+            out.print(F(" free"));
+        }
+        out.println();
+    }
+}
+
+size_t heapTelemetryJson(char *buf, size_t size)
+{
+    int len = snprintf_P(buf, size,
+                         PSTR("{\"samples\":%u,\"free\":%u,\"minFree\":%u,\"maxBlock\":%u,\"minMaxBlock\":%u,"
+                              "\"frag\":%u,\"maxFrag\":%u,\"stack\":%u,\"drops\":{"),
+                         (unsigned)telemetry.samples, (unsigned)telemetry.freeHeap, (unsigned)telemetry.minFreeHeap,
+                         telemetry.maxBlock, telemetry.minMaxBlock, telemetry.fragmentation,
+                         telemetry.maxFragmentation, (unsigned)telemetry.freeStack);
+    for (uint8_t i = 0; i < (uint8_t)HeapUser::Count && len > 0 && (size_t)len < size; i++) {
+        const HeapDrops &drops = telemetry.drops[i];
+        const int n = snprintf_P(buf + len, size - len, PSTR("%s\"%S\":{\"count\":%u,\"heap\":%u,\"ms\":%lu}"),
+                                 i ? "," : "", (PGM_P)heapUserName((HeapUser)i), (unsigned)drops.count,
+                                 (unsigned)drops.lastFreeHeap, drops.lastMillis);
+        len = n < 0 ? -1 : len + n;
+    }
+    if (len < 0 || (size_t)len + 3 > size) {
+        return 0;
+    }
+    buf[len++] = '}';
+    buf[len++] = '}';
+    buf[len] = 0;
+    return len;
+}
@@ -0,0 +1,55 @@
+#ifndef HEAP_TELEMETRY_H_
+#define HEAP_TELEMETRY_H_
+#include <Arduino.h>
+
+// Heap, fragmentation and loop stack telemetry. heapTelemetryTick() samples once per
+// HEAP_SAMPLE_MS and keeps the worst values seen since boot (or the last reset).
+// Code that degrades under low memory asks heapAvailable(), which also counts the
+// refusals per subsystem, so a drop can be traced back to what triggered it.
+#define HEAP_SAMPLE_MS 1000
+#define HEAP_RESERVE_SERIAL_MIRROR 20000 // websocket log mirror, the client is disconnected below this
+#define HEAP_RESERVE_WS_PING 14000       // status ping, the client is disconnected below this
+#define HEAP_RESERVE_WEB_REQUEST 10000   // web server commands and downloads are refused below this
+#define HEAP_JSON_SIZE 512               // buffer heapTelemetryJson() needs
+
+enum class HeapUser : uint8_t {
+    SerialMirror,
+    WebSocketPing,
+    WebCommand,
+    WebSlot,
+    WebDownload,
+    Count
+};
+
+struct HeapDrops
+{
+    uint32_t count;
+    uint32_t lastFreeHeap; // at the last refusal
+    unsigned long lastMillis;
+};
+
+struct HeapTelemetry
+{
+    uint32_t samples;
+    uint32_t freeHeap;
+    uint32_t minFreeHeap;
+    uint16_t maxBlock; // largest single allocation possible
+    uint16_t minMaxBlock;
+    uint8_t fragmentation; // percent
+    uint8_t maxFragmentation;
+    uint32_t freeStack; // loop() stack never touched so far, a high water mark already
+    HeapDrops drops[(uint8_t)HeapUser::Count];
+};
+
+const HeapTelemetry &heapTelemetry();
+// true if more than reserve bytes are free, a refusal is recorded against user
+bool heapAvailable(HeapUser user, uint32_t reserve);
+void heapTelemetrySample();
+void heapTelemetryTick();
+// restarts minimum / maximum tracking and drop counters
+void heapTelemetryReset();
+const __FlashStringHelper *heapUserName(HeapUser user);
+void printHeapTelemetry(Print &out);
+// one JSON object for the web ui, returns its length (0 if size is too small)
+size_t heapTelemetryJson(char *buf, size_t size);
+#endif
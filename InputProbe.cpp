@@ -0,0 +1,92 @@
+#include "InputProbe.h"
+
+#define NO_INPUT 0xff
+
+static InputProbeStats stats;
+static uint8_t lastFound = NO_INPUT;
+static bool searching;
+static uint32_t searchStart;
+
+uint8_t inputConfidence(const InputEvidence &evidence)
+{
+    return evidence.samples ? (uint32_t)evidence.stable * 100 / evidence.samples : 0;
+}
+
+bool inputConfident(const InputEvidence &evidence)
+{
+    return evidence.samples >= INPUT_PROBE_MIN_SAMPLES && inputConfidence(evidence) >= INPUT_PROBE_CONFIDENCE;
+}
+
+int8_t inputProbeDecide(const InputEvidence evidence[2])
+{
+    int8_t best = INPUT_PROBE_NONE;
+    for (uint8_t input = 0; input < 2; input++) {
+        if (evidence[input].stable < INPUT_PROBE_WEAK_STABLE) {
+            continue;
+        }
+        if (best == INPUT_PROBE_NONE || inputConfidence(evidence[input]) > inputConfidence(evidence[best])) {
+            best = input;
+        }
+    }
+    return best;
+}
+
+uint8_t inputProbeFirst(uint8_t current)
+{
+    return lastFound != NO_INPUT ? lastFound : current & 1;
+}
+
+void inputProbeStart()
+{
+    stats.passes++;
+    if (!searching) {
+        searching = true;
+        searchStart = millis();
+    }
+}
+
+void inputProbeFound(uint8_t input, uint8_t confidence)
+{
+    input &= 1;
+    lastFound = input;
+    if (!searching) {
+        return;
+    }
+    searching = false;
+    const uint32_t took = millis() - searchStart;
+    stats.found[input]++;
+    stats.lastMillis[input] = took;
+    if (took > stats.worstMillis[input]) {
+        stats.worstMillis[input] = took;
+    }
+    stats.lastConfidence[input] = confidence;
+}
+
+const InputProbeStats &inputProbeStats()
+{
+    return stats;
+}
+
+void printInputProbe(Print &out)
+{
+    out.print(F("input probe: "));
+    out.print(stats.passes);
+    out.print(F(" passes"));
+    if (searching) {
+        out.print(F(", searching for "));
+        out.print(millis() - searchStart);
+        out.print(F(" ms"));
+    }
+    out.println();
+    for (uint8_t input = 0; input < 2; input++) {
+        out.print(input == 1 ? F("  RGB: ") : F("  Component: "));
+        out.print(stats.found[input]);
+        out.print(F(" found, last "));
+        out.print(stats.lastMillis[input]);
+        out.print(F(" ms ("));
+        out.print(stats.lastConfidence[input]);
+        out.print(F("%) worst "));
+        out.print(stats.worstMillis[input]);
+        out.println(F(" ms"));
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef INPUT_PROBE_H_
+#define INPUT_PROBE_H_
+#include <Arduino.h>
+
+// Input detection in one pass over both inputs: ADC_INPUT_SEL alternates in slices, after each
+// switch has settled the stable STATUS_16 readings are counted per input. The input found last
+// gets the first slice, an input is taken as soon as it is confident, otherwise the pass ends with
+// the one that showed the most. Latency is counted from the first pass that came up empty.
+#define INPUT_PROBE_SLICE_MS 60        // on one input before switching to the other
+#define INPUT_PROBE_SETTLE_MS 20       // after a switch, not counted
+#define INPUT_PROBE_SAMPLE_MS 2        // between readings
+#define INPUT_PROBE_SLICES 8           // per pass, 480 ms for both inputs
+#define INPUT_PROBE_MIN_SAMPLES 8      // readings before an input can be confident
+#define INPUT_PROBE_CONFIDENCE 75      // percent stable readings to take an input right away
+#define INPUT_PROBE_WEAK_STABLE 2      // stable readings at the end of a pass to still take the best input
+#define INPUT_PROBE_NONE -1
+
+struct InputEvidence
+{
+    uint16_t samples;
+    uint16_t stable;
+};
+
+struct InputProbeStats
+{
+    uint32_t passes;
+    uint32_t found[2]; // per ADC_INPUT_SEL, 0 = component, 1 = RGB
+    uint32_t lastMillis[2];
+    uint32_t worstMillis[2];
+    uint8_t lastConfidence[2];
+};
+
+// percent of the readings that were stable
+uint8_t inputConfidence(const InputEvidence &evidence);
+bool inputConfident(const InputEvidence &evidence);
+// the input a pass takes, INPUT_PROBE_NONE if neither showed enough
+int8_t inputProbeDecide(const InputEvidence evidence[2]);
+// the input found last, or current if there was none yet
+uint8_t inputProbeFirst(uint8_t current);
+// around a pass
+void inputProbeStart();
+void inputProbeFound(uint8_t input, uint8_t confidence);
+const InputProbeStats &inputProbeStats();
+void printInputProbe(Print &out);
+#endif
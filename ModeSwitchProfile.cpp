@@ -0,0 +1,225 @@
+#include "ModeSwitchProfile.h"
+#include "tw.h"
+
+#define NO_STAGE 0xff
+
+static ModeSwitchProfile current;
+static ModeSwitchProfile last;
+static uint32_t worstMicros[(uint8_t)ModeStage::Count];
+static uint32_t switches;
+static uint8_t depth;
+static uint8_t runningStage = NO_STAGE;
+static uint32_t stageStart;
+static uint32_t switchStart;
+static tw::BusCounters busAtStageStart;
+
+static ModeTransition transitions[MODE_TRANSITION_HISTORY];
+static ModeTransition pending;
+static bool transitionRunning;
+static uint32_t transitionCount;
+static uint32_t transitionStartMillis;
+static uint32_t transitionStartBus;
+static uint32_t worstTransitionMillis;
+
+static uint16_t saturate16(uint32_t value)
+{
+    return value > 0xffff ? 0xffff : value;
+}
+
+static void closeStage()
+{
+    if (runningStage == NO_STAGE) {
+        return;
+    }
+    ModeStageStats &stats = current.stages[runningStage];
+    const tw::BusCounters &bus = tw::busCounters();
+    stats.micros += micros() - stageStart;
+    stats.reads = saturate16(stats.reads + bus.reads - busAtStageStart.reads);
+    stats.writes = saturate16(stats.writes + bus.writes - busAtStageStart.writes);
+    stats.bytes = saturate16(stats.bytes + bus.bytes - busAtStageStart.bytes);
+    runningStage = NO_STAGE;
+}
+
+void modeSwitchBegin(uint8_t videoMode)
+{
+    if (depth++ > 0) {
+        return;
+    }
+    memset(&current, 0, sizeof(current));
+    current.videoMode = videoMode;
+    switchStart = micros();
+    modeSwitchStage(ModeStage::Reset);
+}
+
+void modeSwitchStage(ModeStage stage)
+{
+    if (depth == 0) {
+        return;
+    }
+    closeStage();
+    runningStage = (uint8_t)stage;
+    ModeStageStats &stats = current.stages[runningStage];
+    if (stats.runs < 0xff) {
+        stats.runs++;
+    }
+    busAtStageStart = tw::busCounters();
+    stageStart = micros();
+}
+
+void modeSwitchSkip(ModeStage stage)
+{
+    ModeStageStats &stats = current.stages[(uint8_t)stage];
+    if (depth > 0 && stats.skipped < 0xff) {
+        stats.skipped++;
+    }
+}
+
+bool modeSwitchEnd(uint8_t presetID)
+{
+    if (depth == 0 || --depth > 0) {
+        return false;
+    }
+    closeStage();
+    current.totalMicros = micros() - switchStart;
+    current.presetID = presetID;
+    for (uint8_t i = 0; i < (uint8_t)ModeStage::Count; i++) {
+        if (current.stages[i].micros > worstMicros[i]) {
+            worstMicros[i] = current.stages[i].micros;
+        }
+    }
+    last = current;
+    switches++;
+    if (transitionRunning && pending.reloads < 0xff) {
+        pending.reloads++;
+    }
+    return true;
+}
+
+const ModeSwitchProfile &lastModeSwitch()
+{
+    return last;
+}
+
+uint32_t modeSwitchCount()
+{
+    return switches;
+}
+
+const __FlashStringHelper *modeStageName(ModeStage stage)
+{
+    switch (stage) {
+        case ModeStage::Reset:
+            return F("reset");
+        case ModeStage::LoadImage:
+            return F("load image");
+        case ModeStage::InputPatches:
+            return F("input patches");
+        case ModeStage::SyncProcessor:
+            return F("sync processor");
+        case ModeStage::Adc:
+            return F("adc");
+        case ModeStage::Pll:
+            return F("pll");
+        case ModeStage::Deinterlacer:
+            return F("deinterlacer");
+        case ModeStage::Settle:
+            return F("settle");
+        case ModeStage::OutputEnable:
+            return F("output enable");
+        default:
+            return F("?");
+    }
+}
+
+void printModeSwitch(Print &out)
+{
+    out.print(F("mode switch "));
+    out.print(switches);
+    out.print(F(": mode "));
+    out.print(last.videoMode);
+    out.print(F(" preset 0x"));
+    out.print(last.presetID, HEX);
+    out.print(F(" took "));
+    out.print(last.totalMicros / 1000);
+    out.println(F(" ms"));
+    for (uint8_t i = 0; i < (uint8_t)ModeStage::Count; i++) {
+        const ModeStageStats &stats = last.stages[i];
+        if (stats.runs == 0 && stats.skipped == 0) {
+            continue;
+        }
+        out.print(F("  "));
+        out.print(modeStageName((ModeStage)i));
+        out.print(F(": "));
+        out.print(stats.micros / 1000);
+        out.print(F(" ms (worst "));
+        out.print(worstMicros[i] / 1000);
+        out.print(F(") rd "));
+        out.print(stats.reads);
+        out.print(F(" wr "));
+        out.print(stats.writes);
+        out.print(F(" bytes "));
+        out.print(stats.bytes);
+        if (stats.skipped) {
+            out.print(F(" skipped "));
+            out.print(stats.skipped);
+        }
+        out.println();
+    }
+}
+
+static uint32_t busTransfers()
+{
+    const tw::BusCounters &bus = tw::busCounters();
+    return bus.reads + bus.writes;
+}
+
+void modeTransitionStart(uint8_t fromMode)
+{
+    if (transitionRunning) {
+        return;
+    }
+    memset(&pending, 0, sizeof(pending));
+    pending.fromMode = fromMode;
+    transitionStartMillis = millis();
+    transitionStartBus = busTransfers();
+    transitionRunning = true;
+}
+
+void modeTransitionEnd(uint8_t toMode)
+{
+    if (!transitionRunning) {
+        return;
+    }
+    transitionRunning = false;
+    pending.toMode = toMode;
+    pending.millis = millis() - transitionStartMillis;
+    pending.busTransfers = busTransfers() - transitionStartBus;
+    if (pending.millis > worstTransitionMillis) {
+        worstTransitionMillis = pending.millis;
+    }
+    transitions[transitionCount % MODE_TRANSITION_HISTORY] = pending;
+    transitionCount++;
+}
+
+void printModeTransitions(Print &out)
+{
+    out.print(F("transitions: "));
+    out.print(transitionCount);
+    out.print(F(" worst "));
+    out.print(worstTransitionMillis);
+    out.println(transitionRunning ? F(" ms, one running") : F(" ms"));
+    const uint32_t first = transitionCount > MODE_TRANSITION_HISTORY ? transitionCount - MODE_TRANSITION_HISTORY : 0;
+    for (uint32_t i = first; i < transitionCount; i++) {
+        const ModeTransition &t = transitions[i % MODE_TRANSITION_HISTORY];
+        out.print(F("  "));
+        out.print(t.fromMode);
+        out.print(F(" > "));
+        out.print(t.toMode);
+        out.print(F(": "));
+        out.print(t.millis);
+        out.print(F(" ms, reloads "));
+        out.print(t.reloads);
+        out.print(F(", bus "));
+        out.println(t.busTransfers);
+    }
+}
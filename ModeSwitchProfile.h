@@ -0,0 +1,72 @@
+#ifndef MODE_SWITCH_PROFILE_H_
+#define MODE_SWITCH_PROFILE_H_
+#include <Arduino.h>
+
+// A mode switch (applyPresets() and doPostPresetLoadSteps()) runs as a sequence of named
+// stages. modeSwitchStage() closes the running stage and opens the next one, a stage
+// entered more than once accumulates. Time and TV5725 bus traffic are kept per stage for
+// the last switch, the slowest time per stage since boot next to it.
+#define MODE_SWITCH_LOG 1 // print the stage table after every mode switch
+
+enum class ModeStage : uint8_t {
+    Reset,         // soft resets, preset independent state
+    LoadImage,     // preset register image
+    InputPatches,  // RGB / YPbPr, custom preset and PAL 60 fixes
+    SyncProcessor, // SP setup, SOG level, clamp and coast
+    Adc,           // offsets, gain, auto offset
+    Pll,           // display clock, PLLAD, digital and memory resets
+    Deinterlacer,  // IF, deinterlacer and VDS settings
+    Settle,        // waiting for sync and best htotal
+    OutputEnable,  // DAC, sync out and component / VGA
+    Count
+};
+
+struct ModeStageStats
+{
+    uint32_t micros;
+    uint16_t reads; // bus transfers
+    uint16_t writes;
+    uint16_t bytes;
+    uint8_t runs;    // times entered
+    uint8_t skipped; // already in the right state
+};
+
+struct ModeSwitchProfile
+{
+    ModeStageStats stages[(uint8_t)ModeStage::Count];
+    uint32_t totalMicros;
+    uint8_t videoMode; // requested source mode
+    uint8_t presetID;  // GBS_PRESET_ID afterwards
+};
+
+// nests, only the outermost begin / end pair starts and completes a profile
+void modeSwitchBegin(uint8_t videoMode);
+void modeSwitchStage(ModeStage stage);
+// counts a stage that did not have to run
+void modeSwitchSkip(ModeStage stage);
+// true once the outermost switch completed
+bool modeSwitchEnd(uint8_t presetID);
+const ModeSwitchProfile &lastModeSwitch();
+uint32_t modeSwitchCount();
+const __FlashStringHelper *modeStageName(ModeStage stage);
+void printModeSwitch(Print &out);
+
+// Source transitions as they happen: from the first sign of a changed or lost input to a
+// stable picture again, with the mode switches (preset loads) and bus traffic on the way.
+#define MODE_TRANSITION_HISTORY 8
+
+struct ModeTransition
+{
+    uint32_t millis;
+    uint32_t busTransfers; // reads + writes
+    uint8_t fromMode;      // videoStandardInput before and after
+    uint8_t toMode;
+    uint8_t reloads;
+};
+
+// ignored while a transition is already running
+void modeTransitionStart(uint8_t fromMode);
+// ignored if no transition is running
+void modeTransitionEnd(uint8_t toMode);
+void printModeTransitions(Print &out);
+#endif
@@ -11,6 +11,8 @@
 #define OLED_MENU_MAX_SUBITEMS_NUM 16 // should be less than 256
 #define OLED_MENU_MAX_ITEMS_NUM 64    // should be less than 1024
 #define OLED_MENU_MAX_DEPTH 8 // maximum levels of submenus
+#define OLED_MENU_VIRTUAL_WINDOW 4 // sub items of a virtual list that exist at the same time (at least one page)
+#define OLED_MENU_LABEL_SIZE 26 // longest label of a virtual list item, including the terminating 0
 #define OLED_MENU_REFRESH_INTERVAL_IN_MS 50 // not precise
 #define OLED_MENU_SCREEN_SAVER_REFRESH_INTERVAL_IN_MS 5000 // not precise
 #define OLED_MENU_SCROLL_LEAD_IN_TIME_IN_MS 600 // milliseconds before items start to scroll after being selected
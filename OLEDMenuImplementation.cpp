@@ -9,13 +9,16 @@
 #include "src/WebSocketsServer.h"
 #include "fonts.h"
 #include "OSDManager.h"
+#include "Storage.h"
 
 typedef TV5725<GBS_ADDR> GBS;
 extern void applyPresets(uint8_t videoMode);
 extern void setOutModeHdBypass(bool bypass);
 extern void saveUserPrefs();
+extern void flushUserPrefs();
 extern float getOutputFrameRate();
 extern void loadDefaultUserOptions();
+extern bool readSlotMeta(uint8_t index, SlotMeta &slotMeta);
 extern uint8_t getVideoMode();
 extern runTimeOptions *rto;
 extern userOptions *uopt;
@@ -44,7 +47,7 @@ bool resolutionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMen
     display->setFont(ArialMT_Plain_16);
     display->setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
     display->drawString(OLED_MENU_WIDTH / 2, 16, item->str);
-    display->drawXbm((OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
+    drawPackedXbm(display, (OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
     display->display();
     uint8_t videoMode = getVideoMode();
     PresetPreference preset = PresetPreference::Output1080P;
@@ -116,7 +119,7 @@ bool presetSelectionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
     display->setFont(ArialMT_Plain_16);
     display->setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
     display->drawString(OLED_MENU_WIDTH / 2, 16, item->str);
-    display->drawXbm((OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
+    drawPackedXbm(display, (OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
     display->display();
     uopt->presetSlot = 'A' + item->tag; // ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,
     uopt->presetPreference = PresetPreference::OutputCustomized;
@@ -135,33 +138,36 @@ bool presetSelectionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
 
     return false;
 }
+// non-empty slots in slot order, the menu only materializes the visible part of the list
+static uint8_t presetMenuSlots[SLOTS_TOTAL];
+void presetSlotProvider(OLEDMenuManager *manager, OLEDMenuItem *item, uint16_t index)
+{
+    SlotMeta slot;
+    readSlotMeta(presetMenuSlots[index], slot);
+    manager->registerWindowItem(item, slot.slot, slot.name, presetSelectionMenuHandler);
+}
 bool presetsCreationMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav, bool)
 {
-    SlotMetaArray slotsObject;
-    File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-    manager->clearSubItems(item);
-    int curNumSlot = 0;
+    uint16_t numSlots = 0;
+    File slotsBinaryFileRead = storage().open(SLOTS_FILE, "r");
     if (slotsBinaryFileRead) {
-        slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-        slotsBinaryFileRead.close();
-        for (int i; i < SLOTS_TOTAL; ++i) {
-            const SlotMeta &slot = slotsObject.slot[i];
-            if (strcmp(EMPTY_SLOT_NAME, slot.name) == 0 || !strlen(slot.name)) {
-                continue;
-            }
-            curNumSlot++;
-            if (curNumSlot > OLED_MENU_MAX_SUBITEMS_NUM) {
+        SlotMeta slot;
+        for (uint8_t i = 0; i < SLOTS_TOTAL; ++i) {
+            if (slotsBinaryFileRead.read((byte *)&slot, sizeof(slot)) != sizeof(slot)) {
                 break;
             }
-            manager->registerItem(item, slot.slot, slot.name, presetSelectionMenuHandler);
+            if (strncmp(EMPTY_SLOT_NAME, slot.name, sizeof(slot.name)) == 0 || !slot.name[0]) {
+                continue;
+            }
+            presetMenuSlots[numSlots++] = i;
         }
+        slotsBinaryFileRead.close();
     }
 
-    if (curNumSlot > OLED_MENU_MAX_SUBITEMS_NUM) {
-        manager->registerItem(item, 0, IMAGE_ITEM(TEXT_TOO_MANY_PRESETS));
-    }
-    
-    if (!item->numSubItem) {
+    if (numSlots) {
+        manager->setVirtualSubItems(item, numSlots, presetSlotProvider);
+    } else {
+        manager->clearSubItems(item);
         manager->registerItem(item, 0, IMAGE_ITEM(TEXT_NO_PRESETS));
     }
     return true;
@@ -172,6 +178,7 @@ bool resetMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav,
         // not precise
         if (millis() - oledMenuFreezeStartTime >= oledMenuFreezeTimeoutInMS) {
             manager->unfreeze();
+            flushUserPrefs();
             ESP.reset();
             return false;
         }
@@ -183,13 +190,13 @@ bool resetMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav,
     display->setColor(OLEDDISPLAY_COLOR::WHITE);
     switch (item->tag) {
         case MT_RESET_GBS:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESETTING_GBS));
+            drawPackedXbm(display, CENTER_IMAGE(TEXT_RESETTING_GBS));
             break;
         case MT_RESTORE_FACTORY:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESTORING));
+            drawPackedXbm(display, CENTER_IMAGE(TEXT_RESTORING));
             break;
         case MT_RESET_WIFI:
-            display->drawXbm(CENTER_IMAGE(TEXT_RESETTING_WIFI));
+            drawPackedXbm(display, CENTER_IMAGE(TEXT_RESETTING_WIFI));
             break;
     }
     display->display();
@@ -234,7 +241,7 @@ bool currentSettingHandler(OLEDMenuManager *manager, OLEDMenuItem *, OLEDMenuNav
             return false;
         }
         display.setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_CENTER);
-        display.drawXbm(CENTER_IMAGE(TEXT_NO_INPUT));
+        drawPackedXbm(&display, CENTER_IMAGE(TEXT_NO_INPUT));
     } else {
         // TODO translations
         boolean vsyncActive = 0;
@@ -12,6 +12,8 @@ class OLEDMenuItem;
 class OLEDMenuManager;
 enum class OLEDMenuNav;
 typedef bool (*MenuItemHandler)(OLEDMenuManager *, OLEDMenuItem *, OLEDMenuNav, bool);
+// registers sub item number "index" of a virtual list through OLEDMenuManager::registerWindowItem
+typedef void (*MenuItemProvider)(OLEDMenuManager *, OLEDMenuItem *, uint16_t);
 
 class OLEDMenuItem
 {
@@ -43,15 +45,6 @@ private:
    //          }
    //      }
    //  }
-    void clearSubItems()
-    {
-        for (int i = 0; i < this->numSubItem; ++i) {
-            subItems[i]->used = false;
-            subItems[i] = nullptr;
-        }
-        this->numSubItem = 0;
-        this->maxPageIndex = 0;
-    }
     void calculate();
 
 public:
@@ -64,7 +57,7 @@ public:
     uint8_t pageInParent;
     uint8_t maxPageIndex;
     uint8_t numSubItem = 0;
-    const uint8_t *xbmImage;
+    const uint8_t *xbmImage; // packed, see PackedXbm.h
     const char *str;
     const uint8_t *font;
     MenuItemHandler handler;
@@ -72,5 +65,12 @@ public:
     bool alwaysScrolls;
     int16_t scrollOffset;
     OLEDMenuItem *subItems[OLED_MENU_MAX_SUBITEMS_NUM];
+    // virtual lists: of numVirtual sub items only [windowStart, windowStart + OLED_MENU_VIRTUAL_WINDOW) exist
+    MenuItemProvider provider;
+    uint16_t numVirtual;
+    uint16_t windowStart;
+    // allocator bookkeeping, survives reuse
+    uint16_t nextFree;
+    uint8_t generation; // bumped whenever the item is freed
 };
 #endif
\ No newline at end of file
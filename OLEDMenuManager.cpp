@@ -8,6 +8,8 @@
 
 OLEDMenuManager::OLEDMenuManager(SSD1306Wire *display)
     : display(display)
+    , freeHead(OLED_MENU_NO_ITEM)
+    , arenaTop(0)
     , rootItem(registerItem(nullptr, 0, nullptr))
 {
     pushItem(rootItem);
@@ -16,22 +18,68 @@ OLEDMenuManager::OLEDMenuManager(SSD1306Wire *display)
 OLEDMenuItem *OLEDMenuManager::allocItem()
 {
     OLEDMenuItem *newItem = nullptr;
-    for (int i = 0; i < OLED_MENU_MAX_ITEMS_NUM; ++i) {
-        if (!this->allItems[i].used) {
-            memset(&this->allItems[i], 0, sizeof(OLEDMenuItem));
-            newItem = &this->allItems[i];
-            newItem->used = true;
-            break;
-        }
+    if (freeHead != OLED_MENU_NO_ITEM) {
+        newItem = &this->allItems[freeHead];
+        freeHead = newItem->nextFree;
+    } else if (arenaTop < OLED_MENU_MAX_ITEMS_NUM) {
+        newItem = &this->allItems[arenaTop++];
     }
     if (!newItem) {
         char msg[40];
         sprintf(msg, "Maximum number of items reached: %d", OLED_MENU_MAX_ITEMS_NUM);
         panicAndDisable(msg);
     }
+    uint8_t generation = newItem->generation;
+    memset(newItem, 0, sizeof(OLEDMenuItem));
+    newItem->generation = generation;
+    newItem->nextFree = OLED_MENU_NO_ITEM;
+    newItem->used = true;
     return newItem;
 }
 
+void OLEDMenuManager::freeItem(OLEDMenuItem *item)
+{
+    releaseSubItems(item);
+    item->used = false;
+    item->generation++; // stale pointers on the item stack can tell
+    item->nextFree = freeHead;
+    freeHead = item - this->allItems;
+}
+
+void OLEDMenuManager::releaseSubItems(OLEDMenuItem *item)
+{
+    for (int i = 0; i < item->numSubItem; ++i) {
+        freeItem(item->subItems[i]);
+        item->subItems[i] = nullptr;
+    }
+    item->numSubItem = 0;
+    item->maxPageIndex = 0;
+}
+
+void OLEDMenuManager::fillWindow(OLEDMenuItem *parent, uint16_t start)
+{
+    releaseSubItems(parent);
+    parent->windowStart = start;
+    for (uint16_t i = start; i < parent->numVirtual && i < start + OLED_MENU_VIRTUAL_WINDOW; ++i) {
+        parent->provider(this, parent, i);
+    }
+}
+
+void OLEDMenuManager::setVirtualSubItems(OLEDMenuItem *item, uint16_t count, MenuItemProvider provider)
+{
+    item->provider = provider;
+    item->numVirtual = count;
+    fillWindow(item, 0);
+}
+
+OLEDMenuItem *OLEDMenuManager::registerWindowItem(OLEDMenuItem *parent, uint16_t tag, const char *label, MenuItemHandler handler)
+{
+    char *copy = windowLabels[parent->numSubItem % OLED_MENU_VIRTUAL_WINDOW];
+    strncpy(copy, label, OLED_MENU_LABEL_SIZE - 1);
+    copy[OLED_MENU_LABEL_SIZE - 1] = '\0';
+    return registerItem(parent, tag, copy, handler);
+}
+
 OLEDMenuItem *OLEDMenuManager::registerItem(
     OLEDMenuItem *parent,
     uint16_t tag,
@@ -149,13 +197,13 @@ void OLEDMenuManager::drawOneItem(OLEDMenuItem *item, uint16_t yOffset, bool neg
             this->display->drawString(wrappingOffset, yOffset, item->str);
         }
     } else {
-        this->display->drawXbm(curScrollOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
+        drawPackedXbm(this->display, curScrollOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
         if (wrappingOffset < OLED_MENU_WIDTH) {
-            this->display->drawXbm(wrappingOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
+            drawPackedXbm(this->display, wrappingOffset, yOffset, item->imageWidth, item->imageHeight, item->xbmImage);
         }
     }
 }
-void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
+void OLEDMenuManager::renderSubItems(OLEDMenuItem *parent)
 {
     display->clear();
     drawStatusBar(itemUnderCursor == nullptr);
@@ -180,9 +228,66 @@ void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
             }
         }
     }
+}
+void OLEDMenuManager::drawSubItems(OLEDMenuItem *parent)
+{
+    renderSubItems(parent);
     display->display();
 }
 
+void OLEDMenuManager::benchmarkItem(OLEDMenuItem *parent, OLEDMenuBenchmark &result)
+{
+    // status bar first (not selectable on the main menu), then every sub item
+    for (int i = parent == rootItem ? 0 : -1; i < parent->numSubItem; ++i) {
+        resetScroll();
+        itemUnderCursor = i < 0 ? nullptr : parent->subItems[i];
+        cursor = i < 0 ? 0 : i;
+        unsigned long start = micros();
+        renderSubItems(parent);
+        unsigned long rendered = micros();
+        display->display();
+        unsigned long done = micros();
+        result.screens++;
+        result.renderMicros += rendered - start;
+        result.displayMicros += done - rendered;
+        if (done - start > result.maxFrameMicros) {
+            result.maxFrameMicros = done - start;
+        }
+        yield();
+    }
+    for (int i = 0; i < parent->numSubItem; ++i) {
+        OLEDMenuItem *subItem = parent->subItems[i];
+        if (subItem->numSubItem) {
+            pushItem(subItem);
+            benchmarkItem(subItem, result);
+            --itemSP;
+        }
+    }
+}
+
+void OLEDMenuManager::benchmark(OLEDMenuBenchmark &result)
+{
+    memset(&result, 0, sizeof(result));
+    if (disabled || state != OLEDMenuState::IDLE) {
+        return;
+    }
+    OLEDMenuItem *savedStack[OLED_MENU_MAX_DEPTH];
+    uint8_t savedGenerations[OLED_MENU_MAX_DEPTH];
+    memcpy(savedStack, itemStack, sizeof(itemStack));
+    memcpy(savedGenerations, stackGeneration, sizeof(stackGeneration));
+    const uint8_t savedSP = itemSP;
+    OLEDMenuItem *const savedItem = itemUnderCursor;
+    const uint8_t savedCursor = cursor;
+    itemSP = 1; // main menu
+    benchmarkItem(rootItem, result);
+    memcpy(itemStack, savedStack, sizeof(itemStack));
+    memcpy(stackGeneration, savedGenerations, sizeof(stackGeneration));
+    itemSP = savedSP;
+    itemUnderCursor = savedItem;
+    cursor = savedCursor;
+    resetScroll();
+}
+
 void OLEDMenuManager::goBack(bool preserveCursor)
 {
     // go back one page
@@ -213,6 +318,14 @@ void OLEDMenuManager::nextItem()
     }
     if (itemUnderCursor == nullptr) {
         // status bar is selected
+        if (parentItem->numVirtual && parentItem->windowStart != 0) {
+            fillWindow(parentItem, 0);
+        }
+        itemUnderCursor = parentItem->subItems[cursor = 0];
+    } else if (cursor == parentItem->numSubItem - 1 && parentItem->numVirtual &&
+               parentItem->windowStart + parentItem->numSubItem < parentItem->numVirtual) {
+        // end of the window, slide it forward
+        fillWindow(parentItem, parentItem->windowStart + parentItem->numSubItem);
         itemUnderCursor = parentItem->subItems[cursor = 0];
     } else if (cursor == parentItem->numSubItem - 1) {
         if (parentItem == rootItem) {
@@ -236,6 +349,17 @@ void OLEDMenuManager::prevItem()
     }
     if (itemUnderCursor == nullptr) {
         // status bar is selected
+        if (parentItem->numVirtual) {
+            uint16_t lastWindow = (parentItem->numVirtual - 1) / OLED_MENU_VIRTUAL_WINDOW * OLED_MENU_VIRTUAL_WINDOW;
+            if (parentItem->windowStart != lastWindow) {
+                fillWindow(parentItem, lastWindow);
+            }
+        }
+        cursor = parentItem->numSubItem - 1;
+        itemUnderCursor = parentItem->subItems[cursor];
+    } else if (cursor == 0 && parentItem->numVirtual && parentItem->windowStart > 0) {
+        // start of the window, slide it back
+        fillWindow(parentItem, parentItem->windowStart > OLED_MENU_VIRTUAL_WINDOW ? parentItem->windowStart - OLED_MENU_VIRTUAL_WINDOW : 0);
         cursor = parentItem->numSubItem - 1;
         itemUnderCursor = parentItem->subItems[cursor];
     } else if (cursor == 0) {
@@ -313,18 +437,19 @@ void OLEDMenuManager::drawStatusBar(bool negative)
     }
     if (peakItem() != rootItem) {
         // not on main menu, draw back button
-        this->display->drawXbm(0, 0, IMAGE_ITEM(OM_STATUS_BAR_BACK));
+        drawPackedXbm(this->display, 0, 0, IMAGE_ITEM(OM_STATUS_BAR_BACK));
     } else {
         // main menu, draw some custom info
-        this->display->drawXbm(0, 0, IMAGE_ITEM(OM_STATUS_CUSTOM));
+        drawPackedXbm(this->display, 0, 0, IMAGE_ITEM(OM_STATUS_CUSTOM));
     }
-    static uint8_t totalItems = 0;
-    uint8_t curIndex = 1;
+    static uint16_t totalItems = 0;
+    uint16_t curIndex = 1;
     this->display->setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT::TEXT_ALIGN_RIGHT);
     if (itemUnderCursor) {
-        curIndex = cursor + 1;
         // itemUnderCursor must have a parent
-        totalItems = itemUnderCursor->parent->numSubItem;
+        OLEDMenuItem *parent = itemUnderCursor->parent;
+        curIndex = parent->windowStart + cursor + 1;
+        totalItems = parent->numVirtual ? parent->numVirtual : parent->numSubItem;
         // TODO Adjust to OLED_MENU_STATUS_BAR_HEIGHT
         this->display->setFont(DejaVu_Sans_Mono_10);
         this->display->drawStringf(OLED_MENU_WIDTH, 1, statusBarBuffer, "%d/%d", curIndex, totalItems);
@@ -340,6 +465,13 @@ OLEDMenuItem *OLEDMenuManager::popItem(bool preserveCursor)
         return rootItem; // cannot pop root
     }
     OLEDMenuItem *top = itemStack[--itemSP];
+    if (top->generation != stackGeneration[itemSP]) {
+        // a handler freed the item we came from, fall back to the first entry
+        OLEDMenuItem *parent = peakItem();
+        cursor = 0;
+        itemUnderCursor = parent->numSubItem ? parent->subItems[0] : nullptr;
+        return top;
+    }
     if (preserveCursor) {
         for (int i = 0; i < top->parent->numSubItem; ++i) {
             // May need a better way. Maybe store indexes in OLEDMenuItems? But is it worth it?
@@ -6,7 +6,9 @@
 #define OLED_MENU_MANAGER_H_
 #include "OLEDMenuItem.h"
 #include "OLEDMenuConfig.h"
+#include "PackedXbm.h"
 #define IMAGE_ITEM(name) name##_WIDTH, name##_HEIGHT, name
+#define OLED_MENU_NO_ITEM 0xffff
 #define CENTER_IMAGE(name) (OLED_MENU_WIDTH - name##_WIDTH) / 2, (OLED_MENU_HEIGHT - name##_HEIGHT) / 2, name##_WIDTH, name##_HEIGHT, name
 enum class OLEDMenuState
 {
@@ -22,13 +24,24 @@ enum class OLEDMenuNav
     DOWN,
     ENTER,
 };
+struct OLEDMenuBenchmark
+{
+    uint16_t screens;        // every selectable position of every static sub menu
+    uint32_t renderMicros;   // drawing into the frame buffer
+    uint32_t displayMicros;  // pushing the frame buffer out
+    uint32_t maxFrameMicros; // worst render + display
+};
 
 class OLEDMenuManager
 {
 private:
     OLEDDisplay *const display;
     OLEDMenuItem allItems[OLED_MENU_MAX_ITEMS_NUM];
+    uint16_t freeHead; // free list through OLEDMenuItem::nextFree
+    uint16_t arenaTop; // allItems[arenaTop...] were never handed out
     OLEDMenuItem *itemStack[OLED_MENU_MAX_DEPTH];
+    uint8_t stackGeneration[OLED_MENU_MAX_DEPTH]; // generation of each item when it was pushed
+    char windowLabels[OLED_MENU_VIRTUAL_WINDOW][OLED_MENU_LABEL_SIZE]; // shared by all virtual lists, only one is shown at a time
     uint8_t itemSP;
     OLEDMenuItem *itemUnderCursor; // null means the status bar is currently selected
     OLEDMenuState state;
@@ -48,10 +61,15 @@ private:
     void resetScroll();
     void drawStatusBar(bool negative = false);
     inline void drawOneItem(OLEDMenuItem *item, uint16_t yOffset, bool negative);
+    void renderSubItems(OLEDMenuItem *parent);
     void drawSubItems(OLEDMenuItem *parent);
+    void benchmarkItem(OLEDMenuItem *parent, OLEDMenuBenchmark &result);
     inline void enterItem(OLEDMenuItem *item, OLEDMenuNav btn, bool isFirstTime);
     void nextItem();
     void prevItem();
+    void freeItem(OLEDMenuItem *item);
+    void releaseSubItems(OLEDMenuItem *item);
+    void fillWindow(OLEDMenuItem *parent, uint16_t start);
 
     void pushItem(OLEDMenuItem *item)
     {
@@ -61,6 +79,7 @@ private:
             sprintf(msg, "Maximum depth reached: %d", OLED_MENU_MAX_DEPTH);
             panicAndDisable(msg);
         }
+        stackGeneration[itemSP] = item->generation;
         itemStack[itemSP++] = item;
     }
     OLEDMenuItem *popItem(bool preserveCursor = true);
@@ -91,7 +110,7 @@ private:
         display->setColor(OLEDDISPLAY_COLOR::WHITE);
         constexpr int16_t max_x = OLED_MENU_WIDTH - OM_SCREEN_SAVER_WIDTH;
         constexpr int16_t max_y = OLED_MENU_HEIGHT - OM_SCREEN_SAVER_HEIGHT;
-        display->drawXbm(rand() % max_x, rand() % max_y, IMAGE_ITEM(OM_SCREEN_SAVER));
+        drawPackedXbm(display, rand() % max_x, rand() % max_y, IMAGE_ITEM(OM_SCREEN_SAVER));
         display->display();
     }
 
@@ -103,15 +122,24 @@ public:
     void tick(OLEDMenuNav btn);
     void goBack(bool preserveCursor = true);
     void goMain(bool preserveCursor = true);
+    // renders every static sub menu with every cursor position without calling handlers, restores the current menu afterwards
+    void benchmark(OLEDMenuBenchmark &result);
     OLEDMenuItem *const rootItem;
 
+    // frees all sub items (recursively) so they can be reused
     void clearSubItems(OLEDMenuItem *item)
     {
         if (item)
         {
-            item->clearSubItems();
+            releaseSubItems(item);
+            item->numVirtual = 0;
+            item->provider = nullptr;
         }
     }
+    // turns item into a list of "count" sub items that are created on demand by "provider", a window at a time
+    void setVirtualSubItems(OLEDMenuItem *item, uint16_t count, MenuItemProvider provider);
+    // for providers: like registerItem(), but the label is copied
+    OLEDMenuItem *registerWindowItem(OLEDMenuItem *parent, uint16_t tag, const char *label, MenuItemHandler handler = nullptr);
 
     void freeze()
     {
@@ -13,7 +13,11 @@ extern OSDManager osdManager;
 bool osdBrightness(OSDMenuConfig &config)
 {
     const int16_t STEP = 8;
-    int8_t cur =  GBS::VDS_Y_OFST::read();
+    if (!config.valueValid) {
+        config.value = (int8_t)GBS::VDS_Y_OFST::read();
+        config.valueValid = true;
+    }
+    int8_t cur = config.value;
     if (config.onChange) {
         if (config.inc) {
             cur = MIN(cur + STEP, 127);
@@ -21,7 +25,8 @@ bool osdBrightness(OSDMenuConfig &config)
             cur = MAX(-128, cur - STEP);
         }
         GBS::VDS_Y_OFST::write(cur);
-    } 
+        config.value = cur;
+    }
     config.barLength = 256 / STEP;
     config.barActiveLength = (cur + 128 + 1) / STEP;
     return true;
@@ -151,7 +156,15 @@ bool osdScaleX(OSDMenuConfig &config)
 bool osdContrast(OSDMenuConfig &config)
 {
     const uint8_t STEP = 8;
-    int16_t cur = GBS::ADC_RGCTRL::read();
+    static_assert(GBS::ADC_GGCTRL::byteOffset == GBS::ADC_RGCTRL::byteOffset + 1 &&
+                      GBS::ADC_BGCTRL::byteOffset == GBS::ADC_RGCTRL::byteOffset + 2,
+                  "gain registers must be adjacent");
+    // auto gain moves the gains behind our back
+    if (!config.valueValid || uopt->enableAutoGain == 1) {
+        config.value = GBS::ADC_RGCTRL::read();
+        config.valueValid = true;
+    }
+    int16_t cur = config.value;
     if (config.onChange) {
         if (uopt->enableAutoGain == 1) {
             uopt->enableAutoGain = 0;
@@ -164,9 +177,9 @@ bool osdContrast(OSDMenuConfig &config)
         } else {
             cur = MIN(cur + STEP, 255);
         }
-        GBS::ADC_RGCTRL::write(cur);
-        GBS::ADC_GGCTRL::write(cur);
-        GBS::ADC_BGCTRL::write(cur);
+        const uint8_t gains[3] = {(uint8_t)cur, (uint8_t)cur, (uint8_t)cur};
+        GBS::write(GBS::ADC_RGCTRL::segment, GBS::ADC_RGCTRL::byteOffset, gains, sizeof(gains));
+        config.value = cur;
     }
     config.barLength = 256 / STEP;
     config.barActiveLength = (256 - cur) / STEP;
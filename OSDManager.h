@@ -6,12 +6,21 @@
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define MIN(a, b) ((a) > (b) ? (b) : (a))
 typedef TV5725<GBS_ADDR> GBS;
+#define OSD_REG_FIRST 0x90 // all OSD registers live in S0_90 .. S0_98
+#define OSD_REG_COUNT 9
+// the least time between two applies of collected steps, a 60 Hz output frame (16.7 ms) rounded
+// down; the output rate is only known by measuring it over the test bus, so this is not one
+// frame but a lower bound: at 50 Hz (20 ms) two applies can land in one frame
+#define OSD_COMMIT_MIN_MS 16
 struct OSDMenuConfig
 {
     uint8_t barLength;
     uint8_t barActiveLength;
     bool onChange;
     bool inc;
+    // the manager keeps this between calls, a handler reads the hardware only while it is invalid
+    int16_t value;
+    bool valueValid;
 };
 typedef bool (*OSDHanlder)(OSDMenuConfig &config);
 bool osdBrightness(OSDMenuConfig &config);
@@ -81,13 +90,47 @@ private:
     OSDHanlder handlers[8];
     OSDState state;
     bool displayInColumn;
+    // model of the OSD block, everything for one frame is staged here and sent by commit()
+    uint8_t regs[OSD_REG_COUNT];
+    bool loaded;
+    int16_t values[8];
+    uint8_t valueValid; // bit per icon
+    int8_t pendingSteps;
+    unsigned long lastCommit;
+
+    template <class Reg>
+    void stage(typename Reg::Value value)
+    {
+        static_assert(Reg::segment == 0 && Reg::byteOffset >= OSD_REG_FIRST &&
+                          Reg::byteOffset < OSD_REG_FIRST + OSD_REG_COUNT,
+                      "not an OSD register");
+        tw::detail::regEncode<Reg::bitOffset, Reg::bitWidth>(value, regs + Reg::byteOffset - OSD_REG_FIRST);
+    }
+    void load()
+    {
+        GBS::read(0, OSD_REG_FIRST, regs, OSD_REG_COUNT);
+        loaded = true;
+    }
+    void commit()
+    {
+        // tail first with COMMAND_FINISH cleared, then the head up to and including the
+        // byte that sets it again, so the OSD picks up the whole frame at once
+        const uint8_t finish = GBS::OSD_COMMAND_FINISH::byteOffset - OSD_REG_FIRST;
+        stage<GBS::OSD_COMMAND_FINISH>(false);
+        GBS::write(0, OSD_REG_FIRST + finish, regs + finish, OSD_REG_COUNT - finish);
+        stage<GBS::OSD_COMMAND_FINISH>(true);
+        GBS::write(0, OSD_REG_FIRST, regs, finish + 1);
+        lastCommit = millis();
+    }
     void rstOn()
     {
-        GBS::OSD_SW_RESET::write(true);
+        stage<GBS::OSD_SW_RESET>(true);
+        GBS::write(0, GBS::OSD_SW_RESET::byteOffset, regs[GBS::OSD_SW_RESET::byteOffset - OSD_REG_FIRST]);
     }
     void rstOff()
     {
-        GBS::OSD_SW_RESET::write(false);
+        stage<GBS::OSD_SW_RESET>(false);
+        GBS::write(0, GBS::OSD_SW_RESET::byteOffset, regs[GBS::OSD_SW_RESET::byteOffset - OSD_REG_FIRST]);
     }
     uint8_t iconToRegValue(OSDIcon icon)
     {
@@ -106,9 +149,38 @@ private:
     {
         return iconToRegValue((OSDIcon)(icon));
     }
+    bool callHandler(OSDMenuConfig &config)
+    {
+        config.value = values[cursor];
+        config.valueValid = valueValid & (1 << cursor);
+        bool result = (*handlers[cursor])(config);
+        values[cursor] = config.value;
+        if (config.valueValid) {
+            valueValid |= 1 << cursor;
+        } else {
+            valueValid &= ~(1 << cursor);
+        }
+        return result;
+    }
+    void stageColors()
+    {
+        stage<GBS::OSD_MENU_BAR_BORD_COR>(OSD_BLUE);
+        stage<GBS::OSD_MENU_BAR_FONT_BGCOR>(OSD_YELLOW);
+        stage<GBS::OSD_MENU_BAR_FONT_FORCOR>(OSD_RED);
+        stage<GBS::OSD_MENU_SEL_BGCOR>(OSD_GREEN);
+        stage<GBS::OSD_MENU_SEL_FORCOR>(OSD_BLACk);
+    }
+    void stageBar(const OSDMenuConfig &config)
+    {
+        uint8_t active = 128 / config.barLength * config.barActiveLength;
+        stage<GBS::OSD_MENU_MOD_SEL>(iconToRegValue(cursor));
+        stage<GBS::OSD_BAR_LENGTH>(128);
+        stage<GBS::OSD_BAR_FOREGROUND_VALUE>(active);
+    }
 
 public:
     OSDManager()
+        : loaded(false), valueValid(0), pendingSteps(0), lastCommit(0)
     {
         memset(&this->handlers, 0, sizeof(this->handlers));
     }
@@ -120,8 +192,14 @@ public:
     void tick(OSDNav nav)
     {
         if (nav == OSDNav::IDLE) {
+            if (pendingSteps != 0 && millis() - lastCommit >= OSD_COMMIT_MIN_MS) {
+                flush();
+            }
             return;
         }
+        if (nav != OSDNav::LEFT && nav != OSDNav::RIGHT) {
+            flush();
+        }
         if (nav == OSDNav::MENU) {
             if (state == OSDState::OFF) {
                 menuOn();
@@ -134,8 +212,7 @@ public:
             if (state == OSDState::MAIN) {
                 menuOff();
             } else if (state == OSDState::SUB) {
-                menuOff();
-                menuOn();
+                leave();
             }
             return;
         }
@@ -143,8 +220,7 @@ public:
             if (state == OSDState::MAIN) {
                 enter();
             } else if (state == OSDState::SUB) {
-                menuOff();
-                menuOn();
+                leave();
             } else {
                 menuOn();
             }
@@ -167,9 +243,10 @@ public:
     }
     void resetPosition()
     {
-        auto x_start = GBS::VDS_DIS_HB_SP::read();
-        auto x_stop = GBS::VDS_DIS_HB_ST::read();
-        auto y_stop = GBS::VDS_DIS_VB_ST::read();
+        GBS::VDS_DIS_HB_ST::Value x_stop;
+        GBS::VDS_DIS_HB_SP::Value x_start;
+        GBS::VDS_DIS_VB_ST::Value y_stop;
+        GBS::Tie<GBS::VDS_DIS_HB_ST, GBS::VDS_DIS_HB_SP, GBS::VDS_DIS_VB_ST>::read(x_stop, x_start, y_stop);
         auto width = x_stop - x_start;
 
         auto x_zoom = GBS::OSD_ZOOM_5X;
@@ -189,46 +266,56 @@ public:
         uint8_t x = (x_start + width / 2 - (x_zoom * MENU_WIDTH) / 2) >> 3;
         uint8_t y = (y_stop - 64 - y_zoom * MENU_HEIGHT) >> 3;
 
-        GBS::OSD_MENU_DISP_STYLE::write(1);
-        GBS::OSD_MENU_HORI_START::write(x);
-        GBS::OSD_MENU_VER_START::write(y);
-        GBS::OSD_HORIZONTAL_ZOOM::write(x_zoom);
-        GBS::OSD_VERTICAL_ZOOM::write(y_zoom);
-        GBS::OSD_MENU_BAR_BORD_COR::write(OSD_BLUE);
-        GBS::OSD_MENU_BAR_FONT_BGCOR::write(OSD_YELLOW);
-        GBS::OSD_MENU_BAR_FONT_FORCOR::write(OSD_RED);
-        GBS::OSD_MENU_SEL_BGCOR::write(OSD_GREEN);
-        GBS::OSD_MENU_SEL_FORCOR::write(OSD_BLACk);
+        stage<GBS::OSD_MENU_DISP_STYLE>(1);
+        stage<GBS::OSD_MENU_HORI_START>(x);
+        stage<GBS::OSD_MENU_VER_START>(y);
+        stage<GBS::OSD_HORIZONTAL_ZOOM>(x_zoom);
+        stage<GBS::OSD_VERTICAL_ZOOM>(y_zoom);
+        stageColors();
     }
     void menuOn()
     {
+        // resync with whatever changed while the menu was closed
+        load();
+        valueValid = 0;
         rstOff();
-        GBS::OSD_COMMAND_FINISH::write(false);
         resetPosition();
-        // GBS::OSD_YCBCR_RGB_FORMAT::write(false);
-        GBS::OSD_MENU_ICON_SEL::write(iconToRegValue(cursor));
-        GBS::OSD_DISP_EN::write(true);
-        GBS::OSD_MENU_EN::write(true);
-        GBS::OSD_COMMAND_FINISH::write(true);
+        // stage<GBS::OSD_YCBCR_RGB_FORMAT>(false);
+        stage<GBS::OSD_MENU_MOD_SEL>(0);
+        stage<GBS::OSD_MENU_ICON_SEL>(iconToRegValue(cursor));
+        stage<GBS::OSD_DISP_EN>(true);
+        stage<GBS::OSD_MENU_EN>(true);
+        commit();
         state = OSDState::MAIN;
     }
 
     void menuOff()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
-        GBS::OSD_MENU_MOD_SEL::write(0);
-        GBS::OSD_DISP_EN::write(false);
-        GBS::OSD_MENU_EN::write(false);
+        if (!loaded) {
+            load();
+        }
+        pendingSteps = 0;
+        stage<GBS::OSD_MENU_MOD_SEL>(0);
+        stage<GBS::OSD_DISP_EN>(false);
+        stage<GBS::OSD_MENU_EN>(false);
         state = OSDState::OFF;
-        GBS::OSD_COMMAND_FINISH::write(true);
+        commit();
         rstOn();
     }
 
+    // back from a value bar to the icon row, without switching the OSD off in between
+    void leave()
+    {
+        stage<GBS::OSD_MENU_MOD_SEL>(0);
+        stageColors();
+        commit();
+        state = OSDState::MAIN;
+    }
+
     void updateCursor()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
-        GBS::OSD_MENU_ICON_SEL::write(iconToRegValue(cursor));
-        GBS::OSD_COMMAND_FINISH::write(true);
+        stage<GBS::OSD_MENU_ICON_SEL>(iconToRegValue(cursor));
+        commit();
     }
     void next()
     {
@@ -248,33 +335,45 @@ public:
     }
     void enter()
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
         OSDMenuConfig config;
         config.onChange = false;
-        bool shouldEnter = (*handlers[cursor])(config);
+        bool shouldEnter = callHandler(config);
         if (shouldEnter) {
             state = OSDState::SUB;
-            uint8_t active = 128.0 / config.barLength * config.barActiveLength;
-            GBS::OSD_MENU_MOD_SEL::write(iconToRegValue(cursor));
-            GBS::OSD_BAR_LENGTH::write(128);
-            GBS::OSD_BAR_FOREGROUND_VALUE::write(active);
-            GBS::OSD_MENU_BAR_FONT_FORCOR::write(OSD_WHITE);
-            GBS::OSD_MENU_BAR_FONT_BGCOR::write(OSD_BLACk);
+            stageBar(config);
+            stage<GBS::OSD_MENU_BAR_FONT_FORCOR>(OSD_WHITE);
+            stage<GBS::OSD_MENU_BAR_FONT_BGCOR>(OSD_BLACk);
+            commit();
         }
-        GBS::OSD_COMMAND_FINISH::write(true);
     }
+    // steps are collected and applied at most every OSD_COMMIT_MIN_MS, about once per output
+    // frame, a held or quickly turned control then moves the bar at frame rate instead of bus rate
     void submit(bool inc)
     {
-        GBS::OSD_COMMAND_FINISH::write(false);
+        if (inc && pendingSteps < 127) {
+            pendingSteps++;
+        } else if (!inc && pendingSteps > -128) {
+            pendingSteps--;
+        }
+        if (millis() - lastCommit >= OSD_COMMIT_MIN_MS) {
+            flush();
+        }
+    }
+    void flush()
+    {
+        if (pendingSteps == 0 || state != OSDState::SUB) {
+            pendingSteps = 0;
+            return;
+        }
         OSDMenuConfig config;
-        config.inc = inc;
         config.onChange = true;
-        (*handlers[cursor])(config);
-        GBS::OSD_MENU_MOD_SEL::write(iconToRegValue(cursor));
-        uint8_t active = 128 / config.barLength * config.barActiveLength;
-        GBS::OSD_BAR_LENGTH::write(128);
-        GBS::OSD_BAR_FOREGROUND_VALUE::write(active);
-        GBS::OSD_COMMAND_FINISH::write(true);
+        while (pendingSteps != 0) {
+            config.inc = pendingSteps > 0;
+            pendingSteps += config.inc ? -1 : 1;
+            callHandler(config);
+        }
+        stageBar(config);
+        commit();
     }
 };
 #endif
\ No newline at end of file
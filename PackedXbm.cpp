@@ -0,0 +1,25 @@
+#include "PackedXbm.h"
+#include "OLEDMenuConfig.h"
+
+void drawPackedXbm(OLEDDisplay *display, int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *packed)
+{
+    uint8_t row[OLED_MENU_IMAGE_MAX_ROW_BYTES];
+    const int16_t rowBytes = (width + 7) / 8;
+    const int16_t drawWidth = rowBytes > OLED_MENU_IMAGE_MAX_ROW_BYTES ? OLED_MENU_IMAGE_MAX_ROW_BYTES * 8 : width;
+    PackedXbmReader reader(packed);
+    for (int16_t r = 0; r < height; r++) {
+        uint8_t any = 0;
+        for (int16_t b = 0; b < rowBytes; b++) {
+            uint8_t bits = reader.next();
+            if (b < OLED_MENU_IMAGE_MAX_ROW_BYTES) {
+                row[b] = bits;
+                any |= bits;
+            }
+        }
+        // drawXbm only touches set bits, empty rows (most of a text image) cost nothing
+        const int16_t rowY = y + r;
+        if (any && rowY >= 0 && rowY < OLED_MENU_HEIGHT) {
+            display->drawXbm(x, rowY, drawWidth, 1, row);
+        }
+    }
+}
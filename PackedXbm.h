@@ -0,0 +1,38 @@
+#ifndef PACKED_XBM_H_
+#define PACKED_XBM_H_
+#include "SSD1306Wire.h"
+
+// XBM images run length packed by generate_translations.py (PackBits style):
+// 0x00-0x7f: the next n + 1 bytes are literals, 0x80-0xff: the next byte repeats n - 0x80 + 2 times.
+// Decoding streams straight out of flash, only one image row is ever unpacked in RAM.
+struct PackedXbmReader
+{
+    const uint8_t *src;
+    uint8_t count;
+    uint8_t value;
+    bool repeat;
+
+    explicit PackedXbmReader(const uint8_t *packed)
+        : src(packed), count(0), value(0), repeat(false)
+    {
+    }
+    uint8_t next()
+    {
+        if (count == 0) {
+            uint8_t control = pgm_read_byte(src++);
+            repeat = control & 0x80;
+            if (repeat) {
+                count = control - 0x80 + 2;
+                value = pgm_read_byte(src++);
+            } else {
+                count = control + 1;
+            }
+        }
+        count--;
+        return repeat ? value : pgm_read_byte(src++);
+    }
+};
+
+// same as OLEDDisplay::drawXbm(), for packed images
+void drawPackedXbm(OLEDDisplay *display, int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *packed);
+#endif
@@ -0,0 +1,91 @@
+#include "PresetFiles.h"
+#include "slot.h"
+
+struct PresetSource
+{
+    uint8_t videoMode;
+    char name[12];
+};
+
+// names are part of the file format, existing slots on flash use them
+static const PresetSource presetSources[PRESET_SOURCE_COUNT] PROGMEM = {
+    {1, "ntsc"},
+    {2, "pal"},
+    {3, "ntsc_480p"},
+    {4, "pal_576p"},
+    {5, "ntsc_720p"},
+    {6, "ntsc_1080p"},
+    {8, "medium_res"},
+    {14, "vga_upscale"},
+    {0, "unknown"},
+};
+
+static const char slotChars[] PROGMEM = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,";
+static_assert(sizeof(slotChars) - 1 == SLOTS_TOTAL, "one slot character per slot");
+
+void presetPathAt(char *path, uint8_t source, char slot)
+{
+    PresetSource entry;
+    memcpy_P(&entry, &presetSources[source], sizeof(entry));
+    snprintf_P(path, PRESET_PATH_SIZE, PSTR("/preset_%s.%c"), entry.name, slot);
+}
+
+bool presetPath(char *path, uint8_t videoMode, char slot)
+{
+    for (uint8_t source = 0; source < PRESET_SOURCE_COUNT; source++) {
+        if (pgm_read_byte(&presetSources[source].videoMode) == videoMode) {
+            presetPathAt(path, source, slot);
+            return true;
+        }
+    }
+    path[0] = 0;
+    return false;
+}
+
+int slotIndexOf(char slot)
+{
+    for (int i = 0; i < SLOTS_TOTAL; i++) {
+        if ((char)pgm_read_byte(&slotChars[i]) == slot) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+char slotAt(int index)
+{
+    return index >= 0 && index < SLOTS_TOTAL ? (char)pgm_read_byte(&slotChars[index]) : 0;
+}
+
+uint16_t readPresetValues(File &f, uint8_t *values, uint16_t maxValues)
+{
+    uint8_t buf[PRESET_READ_CHUNK];
+    uint16_t count = 0;
+    uint16_t value = 0; // wraps like the former atoi() + cast to uint8_t
+    bool digits = false;
+    size_t len;
+    while ((len = f.read(buf, sizeof(buf))) > 0) {
+        for (size_t i = 0; i < len; i++) {
+            const uint8_t c = buf[i];
+            if (c >= '0' && c <= '9') {
+                value = value * 10 + (c - '0');
+                digits = true;
+            } else if (c == ',' || c == '}') {
+                // the line break between the last ',' and '}' is not a value
+                if (digits && count < maxValues) {
+                    values[count++] = value;
+                }
+                value = 0;
+                digits = false;
+                if (c == '}') {
+                    return count;
+                }
+            }
+        }
+        yield(); // wifi stack
+    }
+    if (digits && count < maxValues) {
+        values[count++] = value;
+    }
+    return count;
+}
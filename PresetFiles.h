@@ -0,0 +1,23 @@
+#ifndef PRESET_FILES_H_
+#define PRESET_FILES_H_
+#include <Arduino.h>
+#include "FS.h"
+
+// Custom presets are stored per slot and source as "/preset_<source>.<slot>". Paths are
+// formatted into caller buffers, so no String is allocated on any preset or slot file access.
+#define PRESET_PATH_SIZE 24    // "/preset_vga_upscale.X" is the longest
+#define PRESET_SOURCE_COUNT 9  // sources that have their own preset file
+#define PRESET_VALUE_COUNT 432 // register values in one preset file, see savePresetToSPIFFS()
+#define PRESET_READ_CHUNK 64   // stack buffer used while parsing a preset file
+
+// path of the preset file for videoMode in slot, false for a mode without a preset file
+bool presetPath(char *path, uint8_t videoMode, char slot);
+// path by source index 0 .. PRESET_SOURCE_COUNT - 1, to walk all files of one slot
+void presetPathAt(char *path, uint8_t source, char slot);
+// slot characters in slot meta order, -1 for a character that is no slot
+int slotIndexOf(char slot);
+// slot character of a slot meta index, 0 past the last slot
+char slotAt(int index);
+// reads the "value,\r\n" list up to the closing '}', returns the number of values stored
+uint16_t readPresetValues(File &f, uint8_t *values, uint16_t maxValues);
+#endif
@@ -0,0 +1,291 @@
+#include "RamFS.h"
+#include "FSImpl.h"
+#include <memory>
+#include <vector>
+
+using namespace fs;
+
+struct RamFile
+{
+    String name;
+    std::vector<uint8_t> data;
+};
+typedef std::shared_ptr<RamFile> RamFilePtr;
+
+class RamFileImpl : public FileImpl
+{
+private:
+    RamFilePtr file; // an open file keeps its data even after it was removed
+    size_t pos;
+    bool writable;
+    bool readable;
+
+public:
+    RamFileImpl(RamFilePtr file, size_t pos, bool readable, bool writable)
+        : file(file), pos(pos), writable(writable), readable(readable)
+    {
+    }
+    size_t write(const uint8_t *buf, size_t size) override
+    {
+        if (!file || !writable) {
+            return 0;
+        }
+        if (pos + size > file->data.size()) {
+            file->data.resize(pos + size);
+        }
+        memcpy(file->data.data() + pos, buf, size);
+        pos += size;
+        return size;
+    }
+    size_t read(uint8_t *buf, size_t size) override
+    {
+        if (!file || !readable || pos >= file->data.size()) {
+            return 0;
+        }
+        if (size > file->data.size() - pos) {
+            size = file->data.size() - pos;
+        }
+        memcpy(buf, file->data.data() + pos, size);
+        pos += size;
+        return size;
+    }
+    void flush() override
+    {
+    }
+    bool seek(uint32_t offset, SeekMode mode) override
+    {
+        if (!file) {
+            return false;
+        }
+        size_t base = mode == SeekCur ? pos : (mode == SeekEnd ? file->data.size() : 0);
+        if (base + offset > file->data.size()) {
+            return false;
+        }
+        pos = base + offset;
+        return true;
+    }
+    size_t position() const override
+    {
+        return pos;
+    }
+    size_t size() const override
+    {
+        return file ? file->data.size() : 0;
+    }
+    bool truncate(uint32_t size) override
+    {
+        if (!file || !writable) {
+            return false;
+        }
+        file->data.resize(size);
+        if (pos > size) {
+            pos = size;
+        }
+        return true;
+    }
+    void close() override
+    {
+        file.reset();
+    }
+    const char *name() const override
+    {
+        return file ? file->name.c_str() : "";
+    }
+    const char *fullName() const override
+    {
+        return name();
+    }
+    bool isFile() const override
+    {
+        return (bool)file;
+    }
+    bool isDirectory() const override
+    {
+        return false;
+    }
+};
+
+class RamFSImpl;
+
+class RamDirImpl : public DirImpl
+{
+private:
+    RamFSImpl &owner;
+    String prefix;
+    int index;
+
+public:
+    RamDirImpl(RamFSImpl &owner, const char *path)
+        : owner(owner), prefix(path), index(-1)
+    {
+    }
+    FileImplPtr openFile(OpenMode openMode, AccessMode accessMode) override;
+    const char *fileName() override;
+    size_t fileSize() override;
+    bool isFile() const override
+    {
+        return index >= 0;
+    }
+    bool isDirectory() const override
+    {
+        return false;
+    }
+    bool next() override;
+    bool rewind() override
+    {
+        index = -1;
+        return true;
+    }
+};
+
+class RamFSImpl : public FSImpl
+{
+private:
+    std::vector<RamFilePtr> files;
+
+    int find(const char *path) const
+    {
+        for (size_t i = 0; i < files.size(); i++) {
+            if (files[i]->name == path) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+public:
+    friend class RamDirImpl;
+
+    bool setConfig(const FSConfig &) override
+    {
+        return true;
+    }
+    bool begin() override
+    {
+        return true;
+    }
+    void end() override
+    {
+    }
+    bool format() override
+    {
+        files.clear();
+        return true;
+    }
+    bool info(FSInfo &info) override
+    {
+        FSInfo64 info64;
+        this->info64(info64);
+        info.totalBytes = info64.totalBytes;
+        info.usedBytes = info64.usedBytes;
+        info.blockSize = info64.blockSize;
+        info.pageSize = info64.pageSize;
+        info.maxOpenFiles = info64.maxOpenFiles;
+        info.maxPathLength = info64.maxPathLength;
+        return true;
+    }
+    bool info64(FSInfo64 &info) override
+    {
+        info.totalBytes = RAMFS_SIZE;
+        info.usedBytes = 0;
+        for (size_t i = 0; i < files.size(); i++) {
+            info.usedBytes += files[i]->data.size();
+        }
+        info.blockSize = 1;
+        info.pageSize = 1;
+        info.maxOpenFiles = 255;
+        info.maxPathLength = 32;
+        return true;
+    }
+    FileImplPtr open(const char *path, OpenMode openMode, AccessMode accessMode) override
+    {
+        int i = find(path);
+        if (i < 0) {
+            if (!(openMode & OM_CREATE)) {
+                return FileImplPtr();
+            }
+            RamFilePtr file(new RamFile);
+            file->name = path;
+            files.push_back(file);
+            i = files.size() - 1;
+        }
+        if (openMode & OM_TRUNCATE) {
+            files[i]->data.clear();
+        }
+        const size_t pos = (openMode & OM_APPEND) ? files[i]->data.size() : 0;
+        return FileImplPtr(new RamFileImpl(files[i], pos, accessMode & AM_READ, accessMode & AM_WRITE));
+    }
+    bool exists(const char *path) override
+    {
+        return find(path) >= 0;
+    }
+    DirImplPtr openDir(const char *path) override
+    {
+        return DirImplPtr(new RamDirImpl(*this, path));
+    }
+    bool rename(const char *pathFrom, const char *pathTo) override
+    {
+        const int from = find(pathFrom);
+        if (from < 0 || find(pathTo) >= 0) {
+            return false;
+        }
+        files[from]->name = pathTo;
+        return true;
+    }
+    bool remove(const char *path) override
+    {
+        const int i = find(path);
+        if (i < 0) {
+            return false;
+        }
+        files.erase(files.begin() + i);
+        return true;
+    }
+    bool mkdir(const char *) override
+    {
+        return false;
+    }
+    bool rmdir(const char *) override
+    {
+        return false;
+    }
+};
+
+FileImplPtr RamDirImpl::openFile(OpenMode openMode, AccessMode accessMode)
+{
+    if (index < 0 || index >= (int)owner.files.size()) {
+        return FileImplPtr();
+    }
+    return owner.open(owner.files[index]->name.c_str(), openMode, accessMode);
+}
+
+const char *RamDirImpl::fileName()
+{
+    return index >= 0 && index < (int)owner.files.size() ? owner.files[index]->name.c_str() : "";
+}
+
+size_t RamDirImpl::fileSize()
+{
+    return index >= 0 && index < (int)owner.files.size() ? owner.files[index]->data.size() : 0;
+}
+
+bool RamDirImpl::next()
+{
+    while (++index < (int)owner.files.size()) {
+        if (owner.files[index]->name.startsWith(prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+fs::FS &ramFS()
+{
+    static fs::FS instance(newRamFSImpl());
+    return instance;
+}
+
+FSImplPtr newRamFSImpl()
+{
+    return FSImplPtr(new RamFSImpl);
+}
@@ -0,0 +1,13 @@
+#ifndef RAM_FS_H_
+#define RAM_FS_H_
+#include <Arduino.h>
+#include "FS.h"
+
+// fs::FS kept entirely in RAM. Backend for host test builds (STORAGE_RAM) and the
+// reference column of the storage benchmark. Directories are not supported, like SPIFFS.
+#define RAMFS_SIZE 65536 // reported as total size, not enforced
+
+fs::FS &ramFS();
+// another, empty instance; the host tests build their flash partition from it
+fs::FSImplPtr newRamFSImpl();
+#endif
@@ -0,0 +1,119 @@
+#include "RegisterTable.h"
+
+typedef TV5725<GBS_ADDR> GBS;
+
+#define TV5725_FIELDS_CHECK
+#include "tv5725_fields.h"
+
+uint16_t regFieldCount()
+{
+    return TV5725_FIELD_COUNT;
+}
+
+static void loadEntry(uint16_t index, RegField &field)
+{
+    RegFieldEntry entry;
+    memcpy_P(&entry, &tv5725Fields[index], sizeof(entry));
+    field.segment = entry.segment;
+    field.byteOffset = entry.byteOffset;
+    field.bitOffset = entry.bitOffset;
+    field.bitWidth = entry.bitWidth;
+    field.isSigned = entry.isSigned;
+}
+
+bool findRegField(const char *name, size_t length, RegField &field)
+{
+    if (length == 0) {
+        return false;
+    }
+    int16_t low = 0;
+    int16_t high = TV5725_FIELD_COUNT - 1;
+    while (low <= high) {
+        int16_t mid = (low + high) / 2;
+        const char *entryName = tv5725FieldNames + pgm_read_word(&tv5725Fields[mid].nameOffset);
+        int cmp = strncmp_P(name, entryName, length);
+        if (cmp == 0 && pgm_read_byte(entryName + length) != 0) {
+            cmp = -1; // name is a prefix of the entry
+        }
+        if (cmp == 0) {
+            loadEntry(mid, field);
+            return true;
+        }
+        if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return false;
+}
+
+bool findRegField(const char *name, RegField &field)
+{
+    return findRegField(name, strlen(name), field);
+}
+
+bool getRegField(uint16_t index, RegField &field, char *name, size_t nameSize)
+{
+    if (index >= TV5725_FIELD_COUNT) {
+        return false;
+    }
+    loadEntry(index, field);
+    if (name && nameSize) {
+        strncpy_P(name, tv5725FieldNames + pgm_read_word(&tv5725Fields[index].nameOffset), nameSize - 1);
+        name[nameSize - 1] = '\0';
+    }
+    return true;
+}
+
+uint32_t decodeRegField(const RegField &field, const uint8_t *data)
+{
+    const uint8_t bs = tw::detail::byteSize(field.bitOffset, field.bitWidth);
+    uint32_t value = data[0] >> field.bitOffset;
+    for (uint8_t i = 1; i < bs; i++) {
+        value |= static_cast<uint32_t>(data[i]) << (8 * i - field.bitOffset);
+    }
+    if (field.bitWidth < 32) {
+        value &= (1ul << field.bitWidth) - 1;
+    }
+    return value;
+}
+
+void encodeRegField(const RegField &field, uint32_t value, uint8_t *data)
+{
+    const uint8_t bs = tw::detail::byteSize(field.bitOffset, field.bitWidth);
+    const uint32_t mask = field.bitWidth < 32 ? (1ul << field.bitWidth) - 1 : 0xffffffff;
+    value &= mask;
+    for (uint8_t i = 0; i < bs; i++) {
+        // mask and value of this byte, lined up like in decodeRegField()
+        uint8_t byteMask, byteValue;
+        if (i == 0) {
+            byteMask = mask << field.bitOffset;
+            byteValue = value << field.bitOffset;
+        } else {
+            byteMask = mask >> (8 * i - field.bitOffset);
+            byteValue = value >> (8 * i - field.bitOffset);
+        }
+        data[i] = (data[i] & ~byteMask) | (byteValue & byteMask);
+    }
+}
+
+uint32_t readRegField(const RegField &field)
+{
+    uint8_t data[5];
+    GBS::read(field.segment, field.byteOffset, data, tw::detail::byteSize(field.bitOffset, field.bitWidth));
+    return decodeRegField(field, data);
+}
+
+void writeRegField(const RegField &field, uint32_t value)
+{
+    uint8_t data[5];
+    const uint8_t bs = tw::detail::byteSize(field.bitOffset, field.bitWidth);
+    if (field.bitOffset == 0 && field.bitWidth % 8 == 0) {
+        memset(data, 0, sizeof(data));
+    } else {
+        GBS::read(field.segment, field.byteOffset, data, bs);
+    }
+    encodeRegField(field, value, data);
+    GBS::write(field.segment, field.byteOffset, data, bs);
+}
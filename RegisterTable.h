@@ -0,0 +1,41 @@
+#ifndef REGISTER_TABLE_H_
+#define REGISTER_TABLE_H_
+#include "tv5725.h"
+
+// Runtime access to TV5725 register fields by name.
+// The table lives in tv5725_fields.h, generated from tv5725.h by generate_register_table.py.
+
+struct RegField
+{
+    uint8_t segment;
+    uint8_t byteOffset;
+    uint8_t bitOffset;
+    uint8_t bitWidth;
+    uint8_t isSigned;
+};
+
+// table entry, names are stored separately in one string pool
+struct RegFieldEntry
+{
+    uint16_t nameOffset;
+    uint8_t segment;
+    uint8_t byteOffset;
+    uint8_t bitOffset;
+    uint8_t bitWidth;
+    uint8_t isSigned;
+};
+
+uint16_t regFieldCount();
+// binary search by exact name (not necessarily zero terminated), O(log n)
+bool findRegField(const char *name, size_t length, RegField &field);
+bool findRegField(const char *name, RegField &field);
+// name and layout of the n-th field in name order, for listing
+bool getRegField(uint16_t index, RegField &field, char *name, size_t nameSize);
+
+// decode / encode a field from / into the raw bytes it covers (see tw::detail::regDecode)
+uint32_t decodeRegField(const RegField &field, const uint8_t *data);
+void encodeRegField(const RegField &field, uint32_t value, uint8_t *data);
+// read / write a field through the generic SegmentedSlave path
+uint32_t readRegField(const RegField &field);
+void writeRegField(const RegField &field, uint32_t value);
+#endif
@@ -0,0 +1,197 @@
+#include "RegisterWatch.h"
+#include "options.h"
+#include "src/WebSocketsServer.h"
+extern runTimeOptions *rto;
+extern WebSocketsServer webSocket;
+
+typedef TV5725<GBS_ADDR> GBS;
+
+RegisterWatch::RegisterWatch()
+    : nextClient(0)
+{
+    for (uint8_t i = 0; i < REGWATCH_MAX_CLIENTS; i++) {
+        clients[i].numFields = 0;
+        clients[i].numRequested = 0;
+        clients[i].acked = true;
+        pendingValid[i] = false;
+    }
+}
+
+void RegisterWatch::handleMessage(uint8_t num, const uint8_t *payload, size_t length)
+{
+    if (num >= REGWATCH_MAX_CLIENTS || length == 0 || payload[0] != 'w') {
+        return;
+    }
+    Client &req = pending[num];
+    size_t pos = 1;
+    uint32_t interval = 0;
+    while (pos < length && payload[pos] >= '0' && payload[pos] <= '9') {
+        interval = interval * 10 + (payload[pos++] - '0');
+        if (interval > 60000) {
+            interval = 60000;
+        }
+    }
+    req.interval = interval < REGWATCH_MIN_INTERVAL_MS ? REGWATCH_MIN_INTERVAL_MS : interval;
+    req.numFields = 0;
+    req.numRequested = 0;
+
+    if (pos < length && payload[pos] == ':') {
+        pos++;
+        while (pos < length && req.numRequested < REGWATCH_MAX_FIELDS) {
+            size_t end = pos;
+            while (end < length && payload[end] != ',') {
+                end++;
+            }
+            RegField field;
+            uint8_t width = 0;
+            if (findRegField(reinterpret_cast<const char *>(payload + pos), end - pos, field)) {
+                req.requestIndex[req.numFields] = req.numRequested;
+                req.fields[req.numFields++] = field;
+                width = field.bitWidth;
+            }
+            req.widths[req.numRequested++] = width;
+            pos = end + 1;
+        }
+    }
+
+    req.valid = false;
+    req.acked = false;
+    req.lastSample = 0;
+    pendingValid[num] = true;
+}
+
+void RegisterWatch::clientDisconnected(uint8_t num)
+{
+    if (num >= REGWATCH_MAX_CLIENTS) {
+        return;
+    }
+    pending[num].numFields = 0;
+    pending[num].numRequested = 0;
+    pending[num].acked = true;
+    pendingValid[num] = true;
+}
+
+// group fields into as few bus reads as possible and derive the sample interval from the bus budget
+void RegisterWatch::buildChunks(Client &client)
+{
+    uint8_t order[REGWATCH_MAX_FIELDS];
+    for (uint8_t i = 0; i < client.numFields; i++) {
+        uint8_t j = i;
+        // insertion sort by segment, then byte offset
+        while (j > 0) {
+            const RegField &a = client.fields[order[j - 1]];
+            const RegField &b = client.fields[i];
+            if (a.segment < b.segment || (a.segment == b.segment && a.byteOffset <= b.byteOffset)) {
+                break;
+            }
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    client.numChunks = 0;
+    uint16_t busBytes = 0;
+    for (uint8_t i = 0; i < client.numFields; i++) {
+        const RegField &f = client.fields[order[i]];
+        const uint8_t end = f.byteOffset + tw::detail::byteSize(f.bitOffset, f.bitWidth);
+        Chunk *c = client.numChunks ? &client.chunks[client.numChunks - 1] : nullptr;
+        if (c && c->segment == f.segment && f.byteOffset <= c->start + c->size + REGWATCH_MERGE_GAP &&
+            end - c->start <= REGWATCH_MAX_READ) {
+            if (end > c->start + c->size) {
+                c->size = end - c->start;
+            }
+        } else {
+            c = &client.chunks[client.numChunks++];
+            c->segment = f.segment;
+            c->start = f.byteOffset;
+            c->size = end - f.byteOffset;
+        }
+        client.chunkOf[order[i]] = client.numChunks - 1;
+    }
+    uint8_t lastSegment = 0xff;
+    for (uint8_t i = 0; i < client.numChunks; i++) {
+        busBytes += client.chunks[i].size + 3; // address + register, address for the read
+        if (client.chunks[i].segment != lastSegment) {
+            busBytes += 3; // segment switch
+            lastSegment = client.chunks[i].segment;
+        }
+    }
+    uint32_t minInterval = (uint32_t)busBytes * 1000 / REGWATCH_BUS_BYTES_PER_SEC;
+    if (client.interval < minInterval) {
+        client.interval = minInterval;
+    }
+}
+
+void RegisterWatch::sample(uint8_t num, Client &client)
+{
+    uint8_t frame[2 + REGWATCH_MAX_FIELDS * 5];
+    uint8_t pos = 2;
+    uint8_t changed = 0;
+    uint8_t data[REGWATCH_MAX_READ];
+
+    for (uint8_t c = 0; c < client.numChunks; c++) {
+        const Chunk &chunk = client.chunks[c];
+        GBS::read(chunk.segment, chunk.start, data, chunk.size);
+        for (uint8_t i = 0; i < client.numFields; i++) {
+            if (client.chunkOf[i] != c) {
+                continue;
+            }
+            const RegField &f = client.fields[i];
+            uint32_t value = decodeRegField(f, data + f.byteOffset - chunk.start);
+            if (client.valid && client.values[i] == value) {
+                continue;
+            }
+            client.values[i] = value;
+            frame[pos++] = client.requestIndex[i];
+            for (uint8_t b = 0; b < (f.bitWidth + 7) / 8; b++) {
+                frame[pos++] = value >> (8 * b);
+            }
+            changed++;
+        }
+    }
+    client.valid = true;
+
+    if (changed) {
+        frame[0] = 'V';
+        frame[1] = changed;
+        webSocket.sendBIN(num, frame, pos);
+    }
+}
+
+void RegisterWatch::tick()
+{
+    for (uint8_t num = 0; num < REGWATCH_MAX_CLIENTS; num++) {
+        if (pendingValid[num]) {
+            clients[num] = pending[num];
+            pendingValid[num] = false;
+            buildChunks(clients[num]);
+        }
+        Client &client = clients[num];
+        if (!client.acked) {
+            uint8_t frame[2 + REGWATCH_MAX_FIELDS];
+            frame[0] = 'W';
+            frame[1] = client.numRequested;
+            memcpy(frame + 2, client.widths, client.numRequested);
+            webSocket.sendBIN(num, frame, 2 + client.numRequested);
+            client.acked = true;
+        }
+    }
+
+    if (!rto->boardHasPower) {
+        return;
+    }
+
+    // sample at most one client per loop iteration
+    for (uint8_t i = 0; i < REGWATCH_MAX_CLIENTS; i++) {
+        uint8_t num = (nextClient + i) % REGWATCH_MAX_CLIENTS;
+        Client &client = clients[num];
+        if (client.numFields == 0 || (millis() - client.lastSample) < client.interval) {
+            continue;
+        }
+        client.lastSample = millis();
+        sample(num, client);
+        nextClient = (num + 1) % REGWATCH_MAX_CLIENTS;
+        return;
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef REGISTER_WATCH_H_
+#define REGISTER_WATCH_H_
+#include "RegisterTable.h"
+
+// Live register watches for web ui clients.
+// A client subscribes with a text frame "w<interval ms>:NAME,NAME,..." (empty name list unsubscribes).
+// The reply is a binary frame 'W', <count>, <bit width per requested name> (0 = unknown / rejected).
+// Afterwards only changed values are pushed: 'V', <count>, { <index>, <value, little endian, (width + 7) / 8 bytes> }...
+// <index> is the position of the name in the request, rejected names included, so it matches the 'W' reply.
+#define REGWATCH_MAX_CLIENTS 2         // same as WEBSOCKETS_SERVER_CLIENT_MAX
+#define REGWATCH_MAX_FIELDS 16         // per client
+#define REGWATCH_MIN_INTERVAL_MS 20    // per client
+#define REGWATCH_BUS_BYTES_PER_SEC 768 // per client I2C budget (incl. addressing), keeps the sync watcher responsive
+#define REGWATCH_MAX_READ 32           // largest batched read per segment
+#define REGWATCH_MERGE_GAP 8           // fields closer than this share one read
+
+class RegisterWatch
+{
+private:
+    struct Chunk
+    {
+        uint8_t segment;
+        uint8_t start;
+        uint8_t size;
+    };
+    struct Client
+    {
+        RegField fields[REGWATCH_MAX_FIELDS];
+        uint32_t values[REGWATCH_MAX_FIELDS];
+        Chunk chunks[REGWATCH_MAX_FIELDS];
+        uint8_t chunkOf[REGWATCH_MAX_FIELDS];
+        uint8_t requestIndex[REGWATCH_MAX_FIELDS]; // field -> position among the requested names
+        uint8_t numFields;
+        uint8_t numChunks;
+        bool valid;  // values[] hold the last pushed state
+        bool acked;  // subscription reply sent
+        uint8_t widths[REGWATCH_MAX_FIELDS]; // reply, one entry per requested name
+        uint8_t numRequested;
+        uint16_t interval;
+        unsigned long lastSample;
+    };
+    Client clients[REGWATCH_MAX_CLIENTS];
+    // subscriptions arrive in the async tcp context, hand them over to loop()
+    Client pending[REGWATCH_MAX_CLIENTS];
+    volatile bool pendingValid[REGWATCH_MAX_CLIENTS];
+    uint8_t nextClient;
+
+    static void buildChunks(Client &client);
+    void sample(uint8_t num, Client &client);
+
+public:
+    RegisterWatch();
+    // websocket callback side: parse a subscription request, no bus access
+    void handleMessage(uint8_t num, const uint8_t *payload, size_t length);
+    void clientDisconnected(uint8_t num);
+    // loop side: samples at most one client per call
+    void tick();
+};
+#endif
@@ -0,0 +1,133 @@
+#include "SSD1306PagedWire.h"
+
+SSD1306PagedWire::SSD1306PagedWire(uint8_t address, int sda, int scl)
+    : SSD1306Wire(address, sda, scl), address(address), windowStart(0), windowMicros(0), windowDiffMicros(0), windowBytes(0)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+// returns the number of bytes put on the bus
+uint8_t SSD1306PagedWire::sendPage(uint8_t page, uint8_t minX, uint8_t maxX)
+{
+    uint8_t sent = 0;
+    Wire.beginTransmission(address);
+    Wire.write(0x00); // command stream
+    Wire.write(COLUMNADDR);
+    Wire.write(minX);
+    Wire.write(maxX);
+    Wire.write(PAGEADDR);
+    Wire.write(page);
+    Wire.write(page);
+    Wire.endTransmission();
+    sent += 8;
+
+    const uint8_t *data = buffer + page * displayWidth;
+    uint8_t x = minX;
+    while (x <= maxX) {
+        uint8_t n = maxX - x + 1;
+        if (n > OLED_PAGED_MAX_DATA) {
+            n = OLED_PAGED_MAX_DATA;
+        }
+        Wire.beginTransmission(address);
+        Wire.write(0x40); // data stream
+        Wire.write(data + x, n);
+        Wire.endTransmission();
+        sent += n + 2;
+        x += n;
+    }
+    return sent;
+}
+
+void SSD1306PagedWire::account(uint32_t busMicros, uint32_t diffMicros, uint16_t bytes)
+{
+    unsigned long now = millis();
+    if (now - windowStart >= 1000) {
+        // an idle display leaves a stale window behind, it counts as zero
+        const bool stale = now - windowStart >= 2000;
+        stats.busMicrosPerSecond = stale ? 0 : windowMicros;
+        stats.diffMicrosPerSecond = stale ? 0 : windowDiffMicros;
+        stats.bytesPerSecond = stale ? 0 : windowBytes;
+        windowStart = now;
+        windowMicros = 0;
+        windowDiffMicros = 0;
+        windowBytes = 0;
+    }
+    windowMicros += busMicros;
+    windowDiffMicros += diffMicros;
+    windowBytes += bytes;
+    stats.bytes += bytes;
+    stats.busMicros += busMicros;
+    stats.diffMicros += diffMicros;
+}
+
+void SSD1306PagedWire::display(void)
+{
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    const unsigned long start = micros();
+    uint32_t busMicros = 0;
+    uint16_t bytes = 0;
+    for (uint8_t page = 0; page < displayHeight / 8; page++) {
+        const uint8_t *cur = buffer + page * displayWidth;
+        uint8_t *back = buffer_back + page * displayWidth;
+        int16_t minX = -1;
+        int16_t maxX = -1;
+        for (uint16_t x = 0; x < displayWidth; x++) {
+            if (cur[x] != back[x]) {
+                if (minX < 0) {
+                    minX = x;
+                }
+                maxX = x;
+                back[x] = cur[x];
+            }
+        }
+        if (minX >= 0) {
+            const unsigned long sendStart = micros();
+            bytes += sendPage(page, minX, maxX);
+            busMicros += micros() - sendStart;
+        }
+    }
+    const uint32_t diffMicros = micros() - start - busMicros;
+    if (bytes == 0) {
+        stats.idleFrames++;
+        account(0, diffMicros, 0);
+        return;
+    }
+    stats.frames++;
+    account(busMicros, diffMicros, bytes);
+#else
+    // without a back buffer there is nothing to compare against
+    const unsigned long start = micros();
+    SSD1306Wire::display();
+    stats.frames++;
+    account(micros() - start, 0, displayBufferSize + displayBufferSize / 16 * 2 + 8);
+#endif
+}
+
+const OLEDBusStats &SSD1306PagedWire::busStats()
+{
+    account(0, 0, 0);
+    return stats;
+}
+
+size_t SSD1306PagedWire::readPbm(uint8_t *out, size_t maxLen, size_t index) const
+{
+    static const char header[] PROGMEM = OLED_PBM_HEADER;
+    const size_t headerLen = sizeof(header) - 1;
+    size_t len = 0;
+    for (; len < maxLen && index < OLED_PBM_SIZE; len++, index++) {
+        if (index < headerLen) {
+            out[len] = pgm_read_byte(&header[index]);
+            continue;
+        }
+        // rows of 16 bytes, msb first; the frame buffer is organized in 8 pixel high pages
+        const uint16_t i = index - headerLen;
+        const uint8_t y = i / 16;
+        const uint8_t *column = buffer + (y / 8) * displayWidth + (i % 16) * 8;
+        uint8_t bits = 0;
+        for (uint8_t b = 0; b < 8; b++) {
+            bits = (bits << 1) | (((column[b] >> (y % 8)) & 1) ^ 1); // 1 is black in PBM
+        }
+        out[len] = bits;
+    }
+    return len;
+}
@@ -0,0 +1,45 @@
+#ifndef SSD1306_PAGED_WIRE_H_
+#define SSD1306_PAGED_WIRE_H_
+#include "SSD1306Wire.h"
+
+// SSD1306Wire that transmits the changed columns of each changed 8 pixel page. The library's
+// double buffered display() already skips an unchanged frame, but sends one bounding box over all
+// changed pages, so a change at the top and one at the bottom send everything in between. The OLED
+// shares the I2C bus with the TV5725, a column range per page keeps that traffic down.
+#define OLED_PAGED_MAX_DATA 31 // data bytes per transmission, stays within the 32 byte Wire buffer
+#define OLED_PBM_HEADER "P4\n128 64\n"
+#define OLED_PBM_SIZE (sizeof(OLED_PBM_HEADER) - 1 + 128 * 64 / 8)
+
+struct OLEDBusStats
+{
+    uint32_t frames;              // display() calls that sent something
+    uint32_t idleFrames;          // display() calls without changes
+    uint32_t bytes;               // total bytes on the bus, including addressing and commands
+    uint32_t busMicros;           // total time in the transfers
+    uint32_t diffMicros;          // total time comparing against the back buffer, not on the bus
+    uint32_t busMicrosPerSecond;  // time spent in the transfers during the last full second
+    uint32_t diffMicrosPerSecond; // comparing against the back buffer, not on the bus
+    uint16_t bytesPerSecond;
+};
+
+class SSD1306PagedWire : public SSD1306Wire
+{
+private:
+    uint8_t address;
+    OLEDBusStats stats;
+    unsigned long windowStart;
+    uint32_t windowMicros;
+    uint32_t windowDiffMicros;
+    uint32_t windowBytes;
+
+    uint8_t sendPage(uint8_t page, uint8_t minX, uint8_t maxX);
+    void account(uint32_t busMicros, uint32_t diffMicros, uint16_t bytes);
+
+public:
+    SSD1306PagedWire(uint8_t address, int sda, int scl);
+    void display(void) override;
+    const OLEDBusStats &busStats();
+    // current frame buffer as binary PBM (lit pixels white), for screenshots and golden images
+    size_t readPbm(uint8_t *out, size_t maxLen, size_t index) const;
+};
+#endif
@@ -0,0 +1,53 @@
+#include "SogSearch.h"
+
+static SogSearchStats stats;
+static uint32_t searchStart;
+
+void sogSearchStart()
+{
+    stats.searches++;
+    stats.lastProbes = 0;
+    searchStart = millis();
+}
+
+void sogSearchProbe()
+{
+    stats.probes++;
+    if (stats.lastProbes < 0xff) {
+        stats.lastProbes++;
+    }
+}
+
+void sogSearchEnd(uint8_t level)
+{
+    stats.lastLevel = level;
+    stats.lastMillis = millis() - searchStart;
+    if (stats.lastMillis > stats.worstMillis) {
+        stats.worstMillis = stats.lastMillis;
+    }
+}
+
+const SogSearchStats &sogSearchStats()
+{
+    return stats;
+}
+
+void printSogSearch(Print &out)
+{
+    out.print(F("sog search: "));
+    out.print(stats.searches);
+    out.print(F(" searches, "));
+    out.print(stats.probes);
+    out.println(F(" probes"));
+    if (stats.searches) {
+        out.print(F("  last: level "));
+        out.print(stats.lastLevel);
+        out.print(F(", "));
+        out.print(stats.lastProbes);
+        out.print(F(" probes, "));
+        out.print(stats.lastMillis);
+        out.print(F(" ms, worst "));
+        out.print(stats.worstMillis);
+        out.println(F(" ms"));
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef SOG_SEARCH_H_
+#define SOG_SEARCH_H_
+#include <Arduino.h>
+
+// SOG level search (searchSogLevel()): levels are probed one at a time, each probe sets the level
+// and watches the sync processor for up to SOG_PROBE_MS plus the settle and test bus checks.
+// Counted here are the probes and the time per search, what a noisy source costs.
+#define SOG_PROBE_GOOD 60   // net HSACT reads (a miss costs 3) a level needs
+#define SOG_PROBE_MS 60     // within this time
+#define SOG_SEARCH_STRIDE 4 // levels stepped down at a time while no level works yet
+
+// what the sync processor shows at one SOG level, see probeSogLevel()
+struct SogQuality
+{
+    uint16_t hsActive; // STATUS_SYNC_PROC_HSACT reads that were set
+    uint16_t hsMissed; // and those that were not (bad HS)
+    bool testBus;      // HSACT together with sync pulses on TEST_BUS_2F
+    bool spHsStable;   // STATUS_16 flags
+    bool sogBad;       // SOG bad interrupt while probing
+    uint16_t hlowMin;  // STATUS_SYNC_PROC_HLOW_LEN seen, video sliced into sync makes it jump
+    uint16_t hlowMax;
+};
+
+struct SogSearchStats
+{
+    uint32_t searches;
+    uint32_t probes; // levels probed, all searches
+    uint8_t lastProbes;
+    uint8_t lastLevel; // found by the last search, 0 if none worked
+    uint32_t lastMillis;
+    uint32_t worstMillis;
+};
+
+// around a search and per level probed
+void sogSearchStart();
+void sogSearchProbe();
+void sogSearchEnd(uint8_t level);
+const SogSearchStats &sogSearchStats();
+void printSogSearch(Print &out);
+#endif
@@ -0,0 +1,167 @@
+#include "SourceIndex.h"
+#include "Storage.h"
+#include "BackupArchive.h"
+#include <stddef.h>
+
+#define SOURCE_INDEX_SIZE (SOURCE_INDEX_HEADER_SIZE + SOURCE_INDEX_SLOTS * sizeof(SourceTuning))
+static_assert((SOURCE_INDEX_SLOTS & (SOURCE_INDEX_SLOTS - 1)) == 0, "slot count must be a power of two");
+static_assert(SOURCE_INDEX_SLOTS < 256 && SOURCE_INDEX_PROBES <= SOURCE_INDEX_SLOTS, "slots are counted in a byte");
+
+static uint32_t fnv1a(uint32_t hash, uint32_t value, uint8_t bytes)
+{
+    for (uint8_t i = 0; i < bytes; i++) {
+        hash ^= (value >> (8 * i)) & 0xff;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+uint32_t sourceFingerprintHash(const SourceFingerprint &fp)
+{
+    // field by field, struct padding must not take part
+    uint32_t hash = 2166136261UL;
+    hash = fnv1a(hash, fp.input, 1);
+    hash = fnv1a(hash, fp.csync, 1);
+    hash = fnv1a(hash, fp.videoMode, 1);
+    hash = fnv1a(hash, fp.htotal, 2);
+    hash = fnv1a(hash, fp.vtotal, 2);
+    hash = fnv1a(hash, fp.hsyncWidth, 2);
+    hash = fnv1a(hash, fp.fieldRate, 2);
+    return hash ? hash : 1;
+}
+
+static uint16_t recordCheck(const SourceTuning &tuning)
+{
+    return backupCrc32(0, (const uint8_t *)&tuning, offsetof(SourceTuning, check)) & 0xffff;
+}
+
+static void makeHeader(uint8_t *header)
+{
+    memcpy(header, SOURCE_INDEX_MAGIC, 4);
+    header[4] = SOURCE_INDEX_VERSION;
+    header[5] = SOURCE_INDEX_SLOTS;
+    header[6] = sizeof(SourceTuning);
+    header[7] = 0;
+}
+
+// an index from another version or with another layout is simply started over
+static bool openIndex(File &f, bool create)
+{
+    f = storage().open(SOURCE_INDEX_FILE, "r+");
+    if (f && f.size() == SOURCE_INDEX_SIZE) {
+        uint8_t header[SOURCE_INDEX_HEADER_SIZE];
+        uint8_t expected[SOURCE_INDEX_HEADER_SIZE];
+        makeHeader(expected);
+        if (f.read(header, sizeof(header)) == sizeof(header) && memcmp(header, expected, sizeof(header)) == 0) {
+            return true;
+        }
+    }
+    f.close();
+    if (!create) {
+        return false;
+    }
+    f = storage().open(SOURCE_INDEX_FILE, "w+");
+    if (!f) {
+        return false;
+    }
+    uint8_t buf[SOURCE_INDEX_HEADER_SIZE + sizeof(SourceTuning)];
+    makeHeader(buf);
+    bool ok = f.write(buf, SOURCE_INDEX_HEADER_SIZE) == SOURCE_INDEX_HEADER_SIZE;
+    memset(buf, 0, sizeof(buf));
+    for (uint8_t i = 0; i < SOURCE_INDEX_SLOTS && ok; i++) {
+        ok = f.write(buf, sizeof(SourceTuning)) == sizeof(SourceTuning);
+    }
+    if (!ok) {
+        f.close();
+        storage().remove(SOURCE_INDEX_FILE);
+    }
+    return ok;
+}
+
+static bool readRecord(File &f, uint8_t slot, SourceTuning &tuning)
+{
+    if (!f.seek(SOURCE_INDEX_HEADER_SIZE + slot * sizeof(SourceTuning), SeekSet) ||
+        f.read((uint8_t *)&tuning, sizeof(tuning)) != sizeof(tuning)) {
+        return false;
+    }
+    if (tuning.hash != 0 && tuning.check != recordCheck(tuning)) {
+        memset(&tuning, 0, sizeof(tuning));
+    }
+    return true;
+}
+
+bool findSourceTuning(uint32_t hash, SourceTuning &tuning)
+{
+    File f;
+    if (!openIndex(f, false)) {
+        return false;
+    }
+    bool found = false;
+    for (uint8_t probe = 0; probe < SOURCE_INDEX_PROBES; probe++) {
+        const uint8_t slot = (hash + probe) & (SOURCE_INDEX_SLOTS - 1);
+        // records are never removed, so an empty slot ends the probe sequence
+        if (!readRecord(f, slot, tuning) || tuning.hash == 0) {
+            break;
+        }
+        if (tuning.hash == hash) {
+            found = true;
+            break;
+        }
+    }
+    f.close();
+    return found;
+}
+
+bool storeSourceTuning(const SourceTuning &tuning)
+{
+    File f;
+    if (tuning.hash == 0 || !openIndex(f, true)) {
+        return false;
+    }
+    uint8_t target = tuning.hash & (SOURCE_INDEX_SLOTS - 1);
+    uint8_t leastUses = 0xff;
+    for (uint8_t probe = 0; probe < SOURCE_INDEX_PROBES; probe++) {
+        const uint8_t slot = (tuning.hash + probe) & (SOURCE_INDEX_SLOTS - 1);
+        SourceTuning existing;
+        if (!readRecord(f, slot, existing)) {
+            f.close();
+            return false;
+        }
+        if (existing.hash == 0 || existing.hash == tuning.hash) {
+            target = slot;
+            break;
+        }
+        if (existing.uses < leastUses) {
+            leastUses = existing.uses;
+            target = slot;
+        }
+    }
+    SourceTuning record = tuning;
+    record.check = recordCheck(record);
+    const bool ok = f.seek(SOURCE_INDEX_HEADER_SIZE + target * sizeof(SourceTuning), SeekSet) &&
+                    f.write((const uint8_t *)&record, sizeof(record)) == sizeof(record);
+    f.close();
+    return ok;
+}
+
+uint8_t sourceIndexCount()
+{
+    File f;
+    if (!openIndex(f, false)) {
+        return 0;
+    }
+    uint8_t count = 0;
+    SourceTuning tuning;
+    for (uint8_t slot = 0; slot < SOURCE_INDEX_SLOTS; slot++) {
+        if (readRecord(f, slot, tuning) && tuning.hash != 0) {
+            count++;
+        }
+    }
+    f.close();
+    return count;
+}
+
+bool clearSourceIndex()
+{
+    return !storage().exists(SOURCE_INDEX_FILE) || storage().remove(SOURCE_INDEX_FILE);
+}
@@ -0,0 +1,52 @@
+#ifndef SOURCE_INDEX_H_
+#define SOURCE_INDEX_H_
+#include <Arduino.h>
+
+// Tuning results per source. A stable source is identified by a fingerprint of its measured
+// timing, the hash of it keys a fixed size open addressing table on flash, so a lookup reads
+// at most SOURCE_INDEX_PROBES records and a store rewrites one in place.
+//   header: "GBSX", <u8 version>, <u8 slots>, <u8 record size>, <u8 0>
+//   then SOURCE_INDEX_SLOTS SourceTuning records, hash 0 marks an empty one
+#define SOURCE_INDEX_FILE "/sources.bin"
+#define SOURCE_INDEX_MAGIC "GBSX"
+#define SOURCE_INDEX_VERSION 1
+#define SOURCE_INDEX_SLOTS 32 // power of two
+#define SOURCE_INDEX_PROBES 4 // linear probing distance, the least used of these is replaced
+#define SOURCE_INDEX_HEADER_SIZE 8
+
+// quantized, so the usual measuring jitter still gives the same hash
+struct SourceFingerprint
+{
+    uint8_t input;       // ADC_INPUT_SEL
+    uint8_t csync;
+    uint8_t videoMode;
+    uint16_t htotal;     // sync processor, ADC clocks / 4
+    uint16_t vtotal;     // lines, the longer field of interlaced sources
+    uint16_t hsyncWidth; // ADC clocks / 4
+    uint16_t fieldRate;  // 1/20 Hz
+};
+
+struct SourceTuning
+{
+    uint32_t hash;
+    uint16_t bestHTotal; // 0 = none found
+    uint8_t presetID;    // phase and htotal only fit the preset they were found with
+    uint8_t phaseSP;
+    uint8_t phaseADC;
+    uint8_t sogLevel;
+    uint8_t gainR; // 0 = auto gain was off
+    uint8_t gainG;
+    uint8_t gainB;
+    uint8_t uses;   // saturating
+    uint16_t check; // over the bytes before, a torn write reads as an empty slot
+};
+static_assert(sizeof(SourceTuning) == 16, "record layout is part of the file format");
+
+// never 0
+uint32_t sourceFingerprintHash(const SourceFingerprint &fp);
+bool findSourceTuning(uint32_t hash, SourceTuning &tuning);
+// overwrites the record with the same hash, takes an empty slot or replaces the least used one
+bool storeSourceTuning(const SourceTuning &tuning);
+uint8_t sourceIndexCount();
+bool clearSourceIndex();
+#endif
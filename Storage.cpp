@@ -0,0 +1,418 @@
+#include "Storage.h"
+#include "RamFS.h"
+#include "BackupArchive.h"
+#ifndef STORAGE_RAM
+#include <LittleFS.h>
+#include <flash_hal.h>
+#include <flash_utils.h>
+#endif
+#include <stddef.h>
+
+fs::FS *storageFS = &ramFS(); // until storageBegin() picked the real one
+static StorageBackend backend = StorageBackend::None;
+
+String storageName(Dir &dir)
+{
+    String name = dir.fileName();
+    if (!name.startsWith("/")) {
+        name = "/" + name;
+    }
+    return name;
+}
+
+#ifndef STORAGE_RAM
+struct StashHeader
+{
+    char magic[4];
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t address;
+    uint32_t length;
+    uint32_t files;
+    uint32_t crc;
+    uint32_t headerCrc;
+};
+static_assert(sizeof(StashHeader) % 4 == 0, "flash is read and written in words");
+
+static uint32_t stashHeaderAddress()
+{
+    return FS_PHYS_ADDR - FLASH_SECTOR_SIZE;
+}
+
+// sequential writes through one chunk, each sector is erased when the writes reach it
+class StashWriter
+{
+private:
+    uint32_t words[STORAGE_STASH_CHUNK / 4];
+    uint16_t fill;
+    uint32_t address;
+    uint32_t end;
+
+public:
+    uint32_t length;
+    uint32_t crc;
+    bool ok;
+
+    StashWriter(uint32_t address, uint32_t end)
+        : fill(0), address(address), end(end), length(0), crc(0), ok(true)
+    {
+    }
+    void put(const uint8_t *data, size_t len)
+    {
+        crc = backupCrc32(crc, data, len);
+        length += len;
+        while (len > 0 && ok) {
+            size_t n = STORAGE_STASH_CHUNK - fill;
+            if (n > len) {
+                n = len;
+            }
+            memcpy((uint8_t *)words + fill, data, n);
+            fill += n;
+            data += n;
+            len -= n;
+            if (fill == STORAGE_STASH_CHUNK) {
+                flush();
+            }
+        }
+    }
+    void put32(uint32_t value)
+    {
+        const uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+        put(bytes, 4);
+    }
+    void flush()
+    {
+        if (fill == 0 || !ok) {
+            return;
+        }
+        memset((uint8_t *)words + fill, 0xff, STORAGE_STASH_CHUNK - fill);
+        if (address + STORAGE_STASH_CHUNK > end) {
+            ok = false;
+            return;
+        }
+        if (address % FLASH_SECTOR_SIZE == 0 && !ESP.flashEraseSector(address / FLASH_SECTOR_SIZE)) {
+            ok = false;
+            return;
+        }
+        ok = ESP.flashWrite(address, words, STORAGE_STASH_CHUNK);
+        address += STORAGE_STASH_CHUNK;
+        fill = 0;
+    }
+};
+
+class StashReader
+{
+private:
+    uint32_t words[STORAGE_STASH_CHUNK / 4];
+    uint32_t chunk; // address of what words holds
+    uint32_t address;
+
+public:
+    explicit StashReader(uint32_t address)
+        : chunk(UINT32_MAX), address(address)
+    {
+    }
+    bool get(uint8_t *data, size_t len)
+    {
+        while (len > 0) {
+            const uint32_t start = address - address % STORAGE_STASH_CHUNK;
+            if (start != chunk) {
+                if (!ESP.flashRead(start, words, STORAGE_STASH_CHUNK)) {
+                    return false;
+                }
+                chunk = start;
+            }
+            size_t n = STORAGE_STASH_CHUNK - (address - start);
+            if (n > len) {
+                n = len;
+            }
+            memcpy(data, (const uint8_t *)words + (address - start), n);
+            address += n;
+            data += n;
+            len -= n;
+        }
+        return true;
+    }
+    bool get32(uint32_t &value)
+    {
+        uint8_t bytes[4];
+        if (!get(bytes, 4)) {
+            return false;
+        }
+        value = bytes[0] | bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+        return true;
+    }
+};
+
+static uint32_t stashHeaderCrc(const StashHeader &header)
+{
+    return backupCrc32(0, (const uint8_t *)&header, offsetof(StashHeader, headerCrc));
+}
+
+static void clearStash()
+{
+    ESP.flashEraseSector(stashHeaderAddress() / FLASH_SECTOR_SIZE);
+}
+
+// a complete stash: the header checks out and so does the payload it describes
+static bool findStash(StashHeader &header)
+{
+    if (!ESP.flashRead(stashHeaderAddress(), (uint32_t *)&header, sizeof(header)) ||
+        memcmp(header.magic, STORAGE_STASH_MAGIC, 4) != 0 || header.version != STORAGE_STASH_VERSION ||
+        header.headerCrc != stashHeaderCrc(header) || header.address % FLASH_SECTOR_SIZE != 0 ||
+        header.address > stashHeaderAddress() || header.length > stashHeaderAddress() - header.address) {
+        return false;
+    }
+    StashReader in(header.address);
+    uint8_t buf[64];
+    uint32_t crc = 0;
+    for (uint32_t done = 0; done < header.length;) {
+        const size_t n = header.length - done < sizeof(buf) ? header.length - done : sizeof(buf);
+        if (!in.get(buf, n)) {
+            return false;
+        }
+        crc = backupCrc32(crc, buf, n);
+        done += n;
+    }
+    return crc == header.crc;
+}
+
+// copies every file of fs below the header, the header goes last
+static bool writeStash(fs::FS &fs, StashHeader &header)
+{
+    uint32_t need = 0;
+    Dir dir = fs.openDir("/");
+    while (dir.next()) {
+        need += 1 + storageName(dir).length() + 4 + dir.fileSize();
+    }
+    const uint32_t payload = (need + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE * FLASH_SECTOR_SIZE;
+    if (payload + FLASH_SECTOR_SIZE > ESP.getFreeSketchSpace()) {
+        return false;
+    }
+    // an older stash must not be mistaken for this one
+    clearStash();
+
+    memset(&header, 0, sizeof(header));
+    header.address = stashHeaderAddress() - payload;
+    StashWriter out(header.address, stashHeaderAddress());
+    uint8_t buf[STORAGE_STASH_CHUNK];
+    dir = fs.openDir("/");
+    while (dir.next() && out.ok) {
+        const String name = storageName(dir);
+        File f = dir.openFile("r");
+        if (!f || name.length() > 255) {
+            return false;
+        }
+        const uint8_t nameLength = name.length();
+        out.put(&nameLength, 1);
+        out.put((const uint8_t *)name.c_str(), nameLength);
+        uint32_t left = f.size();
+        out.put32(left);
+        while (left > 0 && out.ok) {
+            const size_t n = f.read(buf, left < sizeof(buf) ? left : sizeof(buf));
+            if (n == 0) {
+                f.close();
+                return false;
+            }
+            out.put(buf, n);
+            left -= n;
+        }
+        f.close();
+        header.files++;
+        yield();
+    }
+    out.flush();
+    if (!out.ok) {
+        return false;
+    }
+    memcpy(header.magic, STORAGE_STASH_MAGIC, 4);
+    header.version = STORAGE_STASH_VERSION;
+    header.length = out.length;
+    header.crc = out.crc;
+    header.headerCrc = stashHeaderCrc(header);
+    StashHeader check;
+    return ESP.flashWrite(stashHeaderAddress(), (uint32_t *)&header, sizeof(header)) && findStash(check);
+}
+
+static bool restoreStash(fs::FS &fs, const StashHeader &header)
+{
+    StashReader in(header.address);
+    uint8_t buf[STORAGE_STASH_CHUNK];
+    for (uint32_t i = 0; i < header.files; i++) {
+        uint8_t nameLength;
+        char name[256];
+        uint32_t left;
+        if (!in.get(&nameLength, 1) || !in.get((uint8_t *)name, nameLength) || !in.get32(left)) {
+            return false;
+        }
+        name[nameLength] = '\0';
+        File f = fs.open(name, "w");
+        if (!f) {
+            return false;
+        }
+        while (left > 0) {
+            const size_t n = left < sizeof(buf) ? left : sizeof(buf);
+            if (!in.get(buf, n) || f.write(buf, n) != n) {
+                f.close();
+                return false;
+            }
+            left -= n;
+        }
+        f.close();
+        yield();
+    }
+    return true;
+}
+
+// the stash holds everything, the partition can be formatted. A power loss from here on
+// finds the stash on the next boot and comes back here.
+static StorageBackend finishMigration(const StashHeader &stash)
+{
+    SPIFFS.end();
+    LittleFS.end();
+    if (LittleFS.format() && LittleFS.begin() && restoreStash(LittleFS, stash)) {
+        clearStash();
+        return StorageBackend::Little;
+    }
+    // put everything back where it was
+    LittleFS.end();
+    if (SPIFFS.format() && SPIFFS.begin() && restoreStash(SPIFFS, stash)) {
+        clearStash();
+        return StorageBackend::Spiffs;
+    }
+    return StorageBackend::None;
+}
+
+static bool useBackend(StorageBackend which)
+{
+    backend = which;
+    if (which == StorageBackend::Little) {
+        storageFS = &LittleFS;
+    } else if (which == StorageBackend::Spiffs) {
+        storageFS = &SPIFFS;
+    }
+    return which != StorageBackend::None;
+}
+#endif
+
+bool storageBegin()
+{
+#ifdef STORAGE_RAM
+    storageFS = &ramFS();
+    backend = StorageBackend::Ram;
+    return true;
+#else
+    // neither file system may format the partition on its own, that would wipe the other one
+    LittleFSConfig littleConfig;
+    littleConfig.setAutoFormat(false);
+    LittleFS.setConfig(littleConfig);
+    SPIFFSConfig spiffsConfig;
+    spiffsConfig.setAutoFormat(false);
+    SPIFFS.setConfig(spiffsConfig);
+
+    StashHeader stash;
+    if (findStash(stash)) {
+        // a conversion was cut short, whatever the partition holds now
+        return useBackend(finishMigration(stash));
+    }
+    if (!LittleFS.begin()) {
+        if (SPIFFS.begin()) {
+            if (!writeStash(SPIFFS, stash)) {
+                // no room for the stash, or the flash failed
+                return useBackend(StorageBackend::Spiffs);
+            }
+            return useBackend(finishMigration(stash));
+        } else if (!LittleFS.format() || !LittleFS.begin()) {
+            // blank flash that could not be formatted either
+            return useBackend(StorageBackend::None);
+        }
+    }
+    return useBackend(StorageBackend::Little);
+#endif
+}
+
+bool storageFormat()
+{
+#ifndef STORAGE_RAM
+    if (backend == StorageBackend::Spiffs) {
+        SPIFFS.end();
+        if (LittleFS.format() && LittleFS.begin()) {
+            storageFS = &LittleFS;
+            backend = StorageBackend::Little;
+            return true;
+        }
+        SPIFFS.begin();
+    }
+#endif
+    return storage().format();
+}
+
+StorageBackend storageBackend()
+{
+    return backend;
+}
+
+const __FlashStringHelper *storageBackendName(StorageBackend backend)
+{
+    switch (backend) {
+        case StorageBackend::Little:
+            return F("LittleFS");
+        case StorageBackend::Spiffs:
+            return F("SPIFFS");
+        case StorageBackend::Ram:
+            return F("RAM");
+        default:
+            return F("none");
+    }
+}
+
+bool storageBenchmark(fs::FS &fs, uint16_t rounds, StorageBenchmark &result)
+{
+    static const char renamed[] = STORAGE_BENCH_FILE "2";
+    uint8_t buf[STORAGE_BENCH_SIZE];
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+    memset(&result, 0, sizeof(result));
+    for (uint16_t round = 0; round < rounds; round++) {
+        unsigned long start = micros();
+        File f = fs.open(STORAGE_BENCH_FILE, "w");
+        result.openMicros += micros() - start;
+        if (!f) {
+            return false;
+        }
+        start = micros();
+        const bool written = f.write(buf, sizeof(buf)) == sizeof(buf);
+        f.close();
+        result.writeMicros += micros() - start;
+
+        start = micros();
+        f = fs.open(STORAGE_BENCH_FILE, "r");
+        const bool read = f && f.read(buf, sizeof(buf)) == sizeof(buf);
+        f.close();
+        result.readMicros += micros() - start;
+
+        start = micros();
+        const bool renamedOk = fs.rename(STORAGE_BENCH_FILE, renamed);
+        result.renameMicros += micros() - start;
+
+        start = micros();
+        const bool removed = fs.remove(renamed);
+        result.removeMicros += micros() - start;
+        if (!written || !read || !renamedOk || !removed) {
+            fs.remove(STORAGE_BENCH_FILE);
+            fs.remove(renamed);
+            return false;
+        }
+        yield();
+    }
+    result.rounds = rounds;
+    if (rounds) {
+        result.openMicros /= rounds;
+        result.writeMicros /= rounds;
+        result.readMicros /= rounds;
+        result.renameMicros /= rounds;
+        result.removeMicros /= rounds;
+    }
+    return true;
+}
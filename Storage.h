@@ -0,0 +1,52 @@
+#ifndef STORAGE_H_
+#define STORAGE_H_
+#include <Arduino.h>
+#include "FS.h"
+
+// Every persistent file goes through storage(). storageBegin() mounts LittleFS and converts an
+// existing SPIFFS image on first boot. The files are first copied to the end of the free sketch
+// space (where an OTA update would go), a stash the format does not touch. Its header is written
+// last and erased once LittleFS holds everything, a conversion cut short is finished from it on the
+// next boot. Images larger than the free sketch space stay on SPIFFS, a backup, format and restore
+// moves them over. STORAGE_RAM keeps everything in ramFS(), for the host tests in test/host.
+//   stash header, last sector below the file system:
+//     "GBSM", <u8 version>, 3 x <u8 0>, <u32 payload address>, <u32 payload length>,
+//     <u32 file count>, <u32 crc32 of payload>, <u32 crc32 of the header before it>
+//   payload, sectors below the header: { <u8 name length>, <name>, <u32 size>, <data> } per file
+#define STORAGE_STASH_MAGIC "GBSM"
+#define STORAGE_STASH_VERSION 1
+#define STORAGE_STASH_CHUNK 256 // flash write size, divides the sector size
+#define STORAGE_BENCH_FILE "/bench.tmp" // removed again after every round
+#define STORAGE_BENCH_SIZE 256
+
+enum class StorageBackend : uint8_t {
+    None,
+    Little,
+    Spiffs,
+    Ram
+};
+
+struct StorageBenchmark
+{
+    uint16_t rounds;
+    uint32_t openMicros; // per operation, averaged over the rounds
+    uint32_t writeMicros;
+    uint32_t readMicros;
+    uint32_t renameMicros;
+    uint32_t removeMicros;
+};
+
+extern fs::FS *storageFS;
+inline fs::FS &storage()
+{
+    return *storageFS;
+}
+bool storageBegin();
+// empties the file system, a SPIFFS partition comes back as LittleFS
+bool storageFormat();
+StorageBackend storageBackend();
+const __FlashStringHelper *storageBackendName(StorageBackend backend);
+// LittleFS lists names without the leading '/' SPIFFS has, this always adds it
+String storageName(Dir &dir);
+bool storageBenchmark(fs::FS &fs, uint16_t rounds, StorageBenchmark &result);
+#endif
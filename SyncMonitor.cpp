@@ -0,0 +1,247 @@
+#include "SyncMonitor.h"
+#include "tw.h"
+
+#define NO_PIN 0xff
+static_assert((SYNC_MONITOR_QUEUE & (SYNC_MONITOR_QUEUE - 1)) == 0, "queue size must be a power of two");
+
+static uint8_t monitorPin = NO_PIN;
+static bool paused;
+
+// written by the interrupt
+static volatile uint32_t lastEdge;
+static volatile uint32_t period; // smoothed, 0 until the first plausible edge
+static volatile uint8_t plausibleEdges;
+static volatile bool lostReported;
+static volatile uint32_t edges;
+static volatile uint32_t events;
+static volatile uint32_t overflows;
+static SyncEvent queue[SYNC_MONITOR_QUEUE];
+static volatile uint8_t queueHead; // interrupt writes here
+static volatile uint8_t queueTail; // loop reads here
+
+static SyncEvent history[SYNC_MONITOR_HISTORY];
+static uint32_t historyCount;
+static SyncMonitorStats stats;
+static uint32_t busAtWatcherStart;
+static bool lostPending; // Lost handed to the watcher, not yet confirmed
+
+static void ICACHE_RAM_ATTR push(SyncEventType type, uint32_t now, uint32_t p)
+{
+    const uint8_t next = (queueHead + 1) & (SYNC_MONITOR_QUEUE - 1);
+    if (next == queueTail) {
+        overflows++;
+        return;
+    }
+    queue[queueHead].micros = now;
+    queue[queueHead].period = p;
+    queue[queueHead].type = type;
+    queueHead = next;
+    events++;
+}
+
+static void ICACHE_RAM_ATTR vsyncEdge()
+{
+    const uint32_t now = micros();
+    const uint32_t p = now - lastEdge;
+    const bool trusted = plausibleEdges >= SYNC_MONITOR_HEALTHY_EDGES;
+    lastEdge = now;
+    edges++;
+    if (lostReported) {
+        lostReported = false;
+        plausibleEdges = 0;
+        push(SyncEventType::Returned, now, 0);
+        return;
+    }
+    if (p < SYNC_MONITOR_MIN_PERIOD) {
+        plausibleEdges = 0; // not vsync, the pin shows something else
+        return;
+    }
+    if (p > SYNC_MONITOR_MAX_PERIOD || (period != 0 && p * 100 > period * SYNC_MONITOR_DROPOUT_PERCENT)) {
+        if (trusted) {
+            push(SyncEventType::Dropout, now, p);
+        }
+        plausibleEdges = 0;
+        return;
+    }
+    if (plausibleEdges < 0xff) {
+        plausibleEdges++;
+    }
+    if (period == 0 || plausibleEdges == 1) {
+        period = p;
+        return;
+    }
+    // fields of interlaced sources differ by half a line, far below the drift limit
+    const uint32_t diff = p > period ? p - period : period - p;
+    if (diff * 100 > period * SYNC_MONITOR_DRIFT_PERCENT) {
+        if (trusted) {
+            push(SyncEventType::Timing, now, p);
+        }
+        period = p;
+        return;
+    }
+    period = period - (period >> 3) + (p >> 3);
+}
+
+void syncMonitorBegin(uint8_t pin)
+{
+    monitorPin = pin;
+    paused = false;
+    lastEdge = micros();
+    attachInterrupt(monitorPin, vsyncEdge, RISING);
+}
+
+void syncMonitorPause()
+{
+    // the pin is about to get another handler, and possibly another signal
+    paused = true;
+}
+
+void syncMonitorResume()
+{
+    if (monitorPin == NO_PIN || !paused) {
+        return;
+    }
+    noInterrupts();
+    lastEdge = micros();
+    plausibleEdges = 0; // the test bus may still show the borrowed signal for a moment
+    interrupts();
+    attachInterrupt(monitorPin, vsyncEdge, RISING);
+    paused = false;
+}
+
+bool syncMonitorPoll(uint32_t &eventMicros)
+{
+    if (monitorPin == NO_PIN || paused) {
+        return false;
+    }
+    noInterrupts();
+    if (!lostReported && period != 0 && micros() - lastEdge > SYNC_MONITOR_LOST_MS * 1000UL) {
+        lostReported = true;
+        plausibleEdges = 0;
+        push(SyncEventType::Lost, micros(), 0);
+        lostPending = true;
+    }
+    interrupts();
+
+    bool any = false;
+    while (queueTail != queueHead) {
+        const SyncEvent &event = queue[queueTail];
+        if (!any) {
+            eventMicros = event.micros;
+            any = true;
+        }
+        history[historyCount % SYNC_MONITOR_HISTORY] = event;
+        historyCount++;
+        queueTail = (queueTail + 1) & (SYNC_MONITOR_QUEUE - 1);
+    }
+    return any;
+}
+
+bool syncMonitorHealthy()
+{
+    return monitorPin != NO_PIN && !paused && plausibleEdges >= SYNC_MONITOR_HEALTHY_EDGES;
+}
+
+uint32_t syncMonitorPeriod()
+{
+    return period;
+}
+
+static uint32_t busTransfers()
+{
+    const tw::BusCounters &bus = tw::busCounters();
+    return bus.reads + bus.writes;
+}
+
+void syncMonitorWatcherStart(bool woken, uint32_t eventMicros)
+{
+    stats.watcherRuns++;
+    busAtWatcherStart = busTransfers();
+    if (woken) {
+        stats.wakeups++;
+        stats.lastReactionMicros = micros() - eventMicros;
+        if (stats.lastReactionMicros > stats.worstReactionMicros) {
+            stats.worstReactionMicros = stats.lastReactionMicros;
+        }
+    }
+}
+
+void syncMonitorWatcherDone(bool stable)
+{
+    stats.watcherBusTransfers += busTransfers() - busAtWatcherStart;
+    if (lostPending && stable) {
+        // edges stopped while the source is fine: the pin shows something else now,
+        // the monitor stays untrusted until vsync edges come back
+        stats.falseLost++;
+    }
+    lostPending = false;
+}
+
+const SyncMonitorStats &syncMonitorStats()
+{
+    stats.edges = edges;
+    stats.events = events;
+    stats.overflows = overflows;
+    return stats;
+}
+
+const __FlashStringHelper *syncEventName(SyncEventType type)
+{
+    switch (type) {
+        case SyncEventType::Lost:
+            return F("lost");
+        case SyncEventType::Dropout:
+            return F("dropout");
+        case SyncEventType::Timing:
+            return F("timing");
+        case SyncEventType::Returned:
+            return F("returned");
+        default:
+            return F("?");
+    }
+}
+
+void printSyncMonitor(Print &out)
+{
+    const SyncMonitorStats &s = syncMonitorStats();
+    if (monitorPin == NO_PIN) {
+        out.println(F("sync monitor off, polling only"));
+    } else {
+        out.print(syncMonitorHealthy() ? F("sync monitor: vsync ") : F("sync monitor: no vsync on pin, polling "));
+        out.print(period);
+        out.println(F(" us"));
+    }
+    out.print(F("edges "));
+    out.print(s.edges);
+    out.print(F(" events "));
+    out.print(s.events);
+    out.print(F(" overflows "));
+    out.print(s.overflows);
+    out.print(F(" false lost "));
+    out.println(s.falseLost);
+    out.print(F("watcher runs "));
+    out.print(s.watcherRuns);
+    out.print(F(" woken "));
+    out.print(s.wakeups);
+    out.print(F(" bus per run "));
+    out.print(s.watcherRuns ? s.watcherBusTransfers / s.watcherRuns : 0);
+    out.print(F(" reaction "));
+    out.print(s.lastReactionMicros);
+    out.print(F(" us (worst "));
+    out.print(s.worstReactionMicros);
+    out.println(F(")"));
+    const uint32_t first = historyCount > SYNC_MONITOR_HISTORY ? historyCount - SYNC_MONITOR_HISTORY : 0;
+    for (uint32_t i = first; i < historyCount; i++) {
+        const SyncEvent &event = history[i % SYNC_MONITOR_HISTORY];
+        out.print(F("  "));
+        out.print(event.micros);
+        out.print(F(" us "));
+        out.print(syncEventName(event.type));
+        if (event.period) {
+            out.print(F(" "));
+            out.print(event.period);
+            out.print(F(" us"));
+        }
+        out.println();
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef SYNC_MONITOR_H_
+#define SYNC_MONITOR_H_
+#include <Arduino.h>
+
+// Input vsync edges on the debug pin (resetDebugPort() routes the SP vsync there), timestamped
+// in an interrupt. Irregular edges or none at all queue an event and wake the sync watcher right
+// away, while a settled source lets it poll less often. The polled watcher stays in charge of
+// every decision; it also takes over alone whenever the pin does not carry vsync.
+#define SYNC_MONITOR 1               // 0 = polled sync watcher only
+#define SYNC_MONITOR_QUEUE 16        // events, power of two
+#define SYNC_MONITOR_MIN_PERIOD 9000 // us, 110 Hz, shorter edges are not vsync
+#define SYNC_MONITOR_MAX_PERIOD 25000 // us, 40 Hz
+#define SYNC_MONITOR_DROPOUT_PERCENT 150 // edge later than this share of the usual period
+#define SYNC_MONITOR_DRIFT_PERCENT 2     // period change that counts as a new timing
+#define SYNC_MONITOR_LOST_MS 60          // no edge for this long
+#define SYNC_MONITOR_HEALTHY_EDGES 8     // plausible edges in a row before the monitor is trusted
+#define SYNC_MONITOR_IDLE_MS 100         // watcher interval for a settled source, instead of 20
+#define SYNC_MONITOR_HISTORY 8           // recent events kept for printSyncMonitor()
+
+enum class SyncEventType : uint8_t {
+    Lost,     // no edges any more
+    Dropout,  // edges missing for a moment
+    Timing,   // period changed
+    Returned, // edges again after Lost
+};
+
+struct SyncEvent
+{
+    uint32_t micros;
+    uint32_t period; // us, 0 for Lost
+    SyncEventType type;
+};
+
+struct SyncMonitorStats
+{
+    uint32_t edges;
+    uint32_t events;
+    uint32_t overflows; // events lost to a full queue
+    uint32_t wakeups;   // watcher runs started by an event
+    uint32_t falseLost; // Lost while the watcher saw a stable source, the pin had no vsync
+    uint32_t lastReactionMicros; // event to watcher start
+    uint32_t worstReactionMicros;
+    uint32_t watcherRuns;
+    uint32_t watcherBusTransfers; // by the watcher, per run = watcherBusTransfers / watcherRuns
+};
+
+void syncMonitorBegin(uint8_t pin);
+// FrameSync borrows the pin for its period measurements
+void syncMonitorPause();
+void syncMonitorResume();
+// loop side: detects Lost and takes the queued events, true with the time of the
+// first one if the watcher should run now
+bool syncMonitorPoll(uint32_t &eventMicros);
+// edges arrive at a vsync rate, the watcher may idle
+bool syncMonitorHealthy();
+uint32_t syncMonitorPeriod();
+// around each runSyncWatcher(); stable tells whether the watcher saw the source stable
+void syncMonitorWatcherStart(bool woken, uint32_t eventMicros);
+void syncMonitorWatcherDone(bool stable);
+const SyncMonitorStats &syncMonitorStats();
+const __FlashStringHelper *syncEventName(SyncEventType type);
+void printSyncMonitor(Print &out);
+#endif
@@ -0,0 +1,213 @@
+#include "UserPrefs.h"
+#include "options.h"
+#include "Storage.h"
+#include "BackupArchive.h"
+#include <stddef.h>
+
+struct PrefField
+{
+    uint8_t id;       // stable, never reuse a retired one
+    uint8_t offset;   // in userOptions
+    uint8_t max;      // larger values are replaced by fallback
+    uint8_t fallback;
+    bool asciiDigit;  // legacy file stores value + '0'
+    const char *name; // PROGMEM
+};
+
+#define PREF_NAME(id, text) static const char prefName##id[] PROGMEM = text;
+PREF_NAME(1, "preset preference")
+PREF_NAME(2, "frame time lock")
+PREF_NAME(3, "preset slot")
+PREF_NAME(4, "frame lock method")
+PREF_NAME(5, "auto gain")
+PREF_NAME(6, "scanlines")
+PREF_NAME(7, "component output")
+PREF_NAME(8, "deinterlacer mode")
+PREF_NAME(9, "line filter")
+PREF_NAME(10, "peaking")
+PREF_NAME(11, "preferScalingRgbhv")
+PREF_NAME(12, "6-tap")
+PREF_NAME(13, "pal force60")
+PREF_NAME(14, "matched")
+PREF_NAME(15, "step response")
+PREF_NAME(16, "full height")
+PREF_NAME(17, "adc calibration")
+PREF_NAME(18, "scanline strength")
+PREF_NAME(19, "disable external clock generator")
+
+#define PREF_FIELD(id, member, max, fallback, ascii) \
+    {id, offsetof(userOptions, member), max, fallback, ascii, prefName##id}
+
+// ids 1 .. 19 are also the order of the legacy file
+static const PrefField prefFields[] PROGMEM = {
+    PREF_FIELD(1, presetPreference, 10, Output960P, true),
+    PREF_FIELD(2, enableFrameTimeLock, 1, 0, true),
+    PREF_FIELD(3, presetSlot, 255, 'A', false),
+    PREF_FIELD(4, frameTimeLockMethod, 1, 0, true),
+    PREF_FIELD(5, enableAutoGain, 1, 0, true),
+    PREF_FIELD(6, wantScanlines, 1, 0, true),
+    PREF_FIELD(7, wantOutputComponent, 1, 0, true),
+    PREF_FIELD(8, deintMode, 2, 0, true),
+    PREF_FIELD(9, wantVdsLineFilter, 1, 0, true),
+    PREF_FIELD(10, wantPeaking, 1, 1, true),
+    PREF_FIELD(11, preferScalingRgbhv, 1, 1, true),
+    PREF_FIELD(12, wantTap6, 1, 1, true),
+    PREF_FIELD(13, PalForce60, 1, 0, true),
+    PREF_FIELD(14, matchPresetSource, 1, 1, true),
+    PREF_FIELD(15, wantStepResponse, 1, 1, true),
+    PREF_FIELD(16, wantFullHeight, 1, 1, true),
+    PREF_FIELD(17, enableCalibrationADC, 1, 1, true),
+    PREF_FIELD(18, scanlineStrength, 0x60, 0x30, true),
+    PREF_FIELD(19, disableExternalClockGenerator, 1, 0, true),
+};
+#define PREF_FIELD_COUNT (sizeof(prefFields) / sizeof(prefFields[0]))
+
+static_assert(sizeof(userOptions) < 256, "field offsets are stored in a byte");
+static_assert(PREFS_HEADER_SIZE + PREF_FIELD_COUNT * 3 + 4 <= PREFS_MAX_SIZE, "raise PREFS_MAX_SIZE");
+
+static void readField(uint8_t index, PrefField &field)
+{
+    memcpy_P(&field, &prefFields[index], sizeof(field));
+}
+
+static void setField(userOptions &opt, const PrefField &field, uint8_t value)
+{
+    ((uint8_t *)&opt)[field.offset] = value > field.max ? field.fallback : value;
+}
+
+size_t encodeUserPrefs(const userOptions &opt, uint8_t *buf, size_t maxLen)
+{
+    const size_t size = PREFS_HEADER_SIZE + PREF_FIELD_COUNT * 3 + 4;
+    if (maxLen < size) {
+        return 0;
+    }
+    memcpy(buf, PREFS_MAGIC, 4);
+    buf[4] = PREFS_VERSION;
+    buf[5] = PREF_FIELD_COUNT;
+    buf[6] = (PREF_FIELD_COUNT * 3) & 0xff;
+    buf[7] = (PREF_FIELD_COUNT * 3) >> 8;
+    uint8_t *p = buf + PREFS_HEADER_SIZE;
+    for (uint8_t i = 0; i < PREF_FIELD_COUNT; i++) {
+        PrefField field;
+        readField(i, field);
+        *p++ = field.id;
+        *p++ = 1;
+        *p++ = ((const uint8_t *)&opt)[field.offset];
+    }
+    const uint32_t crc = backupCrc32(0, buf, p - buf);
+    for (uint8_t i = 0; i < 4; i++) {
+        *p++ = crc >> (8 * i);
+    }
+    return size;
+}
+
+bool decodeUserPrefs(const uint8_t *buf, size_t len, userOptions &opt)
+{
+    if (len < PREFS_HEADER_SIZE + 4 || memcmp(buf, PREFS_MAGIC, 4) != 0) {
+        return false;
+    }
+    const size_t payload = buf[6] | (buf[7] << 8);
+    if (PREFS_HEADER_SIZE + payload + 4 != len) {
+        return false;
+    }
+    const uint8_t *trailer = buf + PREFS_HEADER_SIZE + payload;
+    const uint32_t crc = trailer[0] | ((uint32_t)trailer[1] << 8) | ((uint32_t)trailer[2] << 16) | ((uint32_t)trailer[3] << 24);
+    if (crc != backupCrc32(0, buf, trailer - buf)) {
+        return false;
+    }
+    // a newer version only ever adds ids, so there is nothing to check it for
+    userOptions decoded = opt;
+    const uint8_t *p = buf + PREFS_HEADER_SIZE;
+    while (p + 2 <= trailer) {
+        const uint8_t id = p[0];
+        const uint8_t fieldLen = p[1];
+        p += 2;
+        if (p + fieldLen > trailer) {
+            return false;
+        }
+        for (uint8_t i = 0; i < PREF_FIELD_COUNT; i++) {
+            PrefField field;
+            readField(i, field);
+            if (field.id == id && fieldLen == 1) {
+                setField(decoded, field, p[0]);
+                break;
+            }
+        }
+        p += fieldLen;
+    }
+    opt = decoded;
+    return true;
+}
+
+static bool loadLegacyUserPrefs(userOptions &opt)
+{
+    File f = storage().open(PREFS_LEGACY_FILE, "r");
+    if (!f) {
+        return false;
+    }
+    // files written by older firmware can be shorter, the remaining fields keep their defaults
+    for (uint8_t i = 0; i < PREF_FIELD_COUNT; i++) {
+        PrefField field;
+        readField(i, field);
+        const int c = f.read();
+        if (c < 0) {
+            break;
+        }
+        setField(opt, field, field.asciiDigit ? (uint8_t)(c - '0') : (uint8_t)c);
+    }
+    f.close();
+    return true;
+}
+
+PrefsLoad loadUserPrefs(userOptions &opt)
+{
+    // a complete temp file without the real one means power was lost while swapping it in
+    if (!storage().exists(PREFS_FILE) && storage().exists(PREFS_TEMP_FILE)) {
+        storage().rename(PREFS_TEMP_FILE, PREFS_FILE);
+    }
+    // a legacy file next to a binary one came in with an old backup, it is the newer one then
+    if (loadLegacyUserPrefs(opt)) {
+        if (storeUserPrefs(opt)) {
+            storage().remove(PREFS_LEGACY_FILE);
+        }
+        return PrefsLoad::Migrated;
+    }
+    File f = storage().open(PREFS_FILE, "r");
+    if (!f) {
+        return PrefsLoad::Missing;
+    }
+    uint8_t buf[PREFS_MAX_SIZE];
+    const size_t len = f.size() <= sizeof(buf) ? f.read(buf, f.size()) : 0;
+    f.close();
+    return decodeUserPrefs(buf, len, opt) ? PrefsLoad::Loaded : PrefsLoad::Corrupt;
+}
+
+bool storeUserPrefs(const userOptions &opt)
+{
+    uint8_t buf[PREFS_MAX_SIZE];
+    const size_t len = encodeUserPrefs(opt, buf, sizeof(buf));
+    File f = storage().open(PREFS_TEMP_FILE, "w");
+    if (!f) {
+        return false;
+    }
+    const bool complete = f.write(buf, len) == len;
+    f.close();
+    if (!complete) {
+        storage().remove(PREFS_TEMP_FILE);
+        return false;
+    }
+    // the old file stays until the new one is complete
+    storage().remove(PREFS_FILE);
+    return storage().rename(PREFS_TEMP_FILE, PREFS_FILE);
+}
+
+void printUserPrefs(Print &out, const userOptions &opt)
+{
+    for (uint8_t i = 0; i < PREF_FIELD_COUNT; i++) {
+        PrefField field;
+        readField(i, field);
+        out.print(FPSTR(field.name));
+        out.print(F(" = "));
+        out.println(((const uint8_t *)&opt)[field.offset]);
+    }
+}
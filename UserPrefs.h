@@ -0,0 +1,37 @@
+#ifndef USER_PREFS_H_
+#define USER_PREFS_H_
+#include <Arduino.h>
+
+// Binary userOptions record, all numbers little endian.
+//   header:  "GBSU", <u8 version>, <u8 field count>, <u16 payload length>
+//   payload: { <u8 field id>, <u8 length>, <value> } per field
+//   trailer: <u32 crc32 of header and payload>
+// Readers skip unknown ids and keep the defaults for missing ones, so a new option
+// only needs a new id in the field table, not a new version.
+#define PREFS_FILE "/preferences.bin"
+#define PREFS_TEMP_FILE "/preferences.tmp"
+#define PREFS_LEGACY_FILE "/preferencesv2.txt" // one ascii digit per field, read once and migrated
+#define PREFS_MAGIC "GBSU"
+#define PREFS_VERSION 1
+#define PREFS_HEADER_SIZE 8
+#define PREFS_MAX_SIZE 128
+
+struct userOptions;
+
+enum class PrefsLoad : uint8_t {
+    Loaded,
+    Migrated, // came from the legacy file, already rewritten in the new format
+    Missing,
+    Corrupt
+};
+
+// encodes all known fields, returns the record size
+size_t encodeUserPrefs(const userOptions &opt, uint8_t *buf, size_t maxLen);
+// overlays the fields found in buf onto opt, false if the record is damaged (opt untouched then)
+bool decodeUserPrefs(const uint8_t *buf, size_t len, userOptions &opt);
+// fields missing from the file keep the values opt already holds
+PrefsLoad loadUserPrefs(userOptions &opt);
+// writes a temp file and swaps it in
+bool storeUserPrefs(const userOptions &opt);
+void printUserPrefs(Print &out, const userOptions &opt);
+#endif
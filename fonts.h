@@ -1,851 +1,4 @@
-const uint8_t URW_Gothic_L_Book_14[] PROGMEM = {
-    0x10, // Width: 16
-    0x12, // Height: 18
-    0x20, // First Char: 32
-    0xE0, // Numbers of Chars: 224
-
-    // Jump Table:
-    0xFF, 0xFF, 0x00, 0x04, // 32:65535
-    0x00, 0x00, 0x08, 0x04, // 33:0
-    0x00, 0x08, 0x07, 0x04, // 34:8
-    0x00, 0x0F, 0x16, 0x08, // 35:15
-    0x00, 0x25, 0x14, 0x08, // 36:37
-    0x00, 0x39, 0x20, 0x0B, // 37:57
-    0x00, 0x59, 0x1D, 0x0B, // 38:89
-    0x00, 0x76, 0x04, 0x03, // 39:118
-    0x00, 0x7A, 0x0E, 0x05, // 40:122
-    0x00, 0x88, 0x0B, 0x05, // 41:136
-    0x00, 0x93, 0x0D, 0x06, // 42:147
-    0x00, 0xA0, 0x17, 0x08, // 43:160
-    0x00, 0xB7, 0x08, 0x04, // 44:183
-    0x00, 0xBF, 0x0B, 0x05, // 45:191
-    0x00, 0xCA, 0x05, 0x04, // 46:202
-    0x00, 0xCF, 0x0D, 0x06, // 47:207
-    0x00, 0xDC, 0x14, 0x08, // 48:220
-    0x00, 0xF0, 0x0E, 0x08, // 49:240
-    0x00, 0xFE, 0x14, 0x08, // 50:254
-    0x01, 0x12, 0x14, 0x08, // 51:274
-    0x01, 0x26, 0x14, 0x08, // 52:294
-    0x01, 0x3A, 0x14, 0x08, // 53:314
-    0x01, 0x4E, 0x14, 0x08, // 54:334
-    0x01, 0x62, 0x13, 0x08, // 55:354
-    0x01, 0x75, 0x14, 0x08, // 56:373
-    0x01, 0x89, 0x14, 0x08, // 57:393
-    0x01, 0x9D, 0x05, 0x04, // 58:413
-    0x01, 0xA2, 0x08, 0x04, // 59:418
-    0x01, 0xAA, 0x17, 0x08, // 60:426
-    0x01, 0xC1, 0x17, 0x08, // 61:449
-    0x01, 0xD8, 0x17, 0x08, // 62:472
-    0x01, 0xEF, 0x13, 0x08, // 63:495
-    0x02, 0x02, 0x20, 0x0C, // 64:514
-    0x02, 0x22, 0x1D, 0x0A, // 65:546
-    0x02, 0x3F, 0x17, 0x08, // 66:575
-    0x02, 0x56, 0x20, 0x0B, // 67:598
-    0x02, 0x76, 0x1D, 0x0A, // 68:630
-    0x02, 0x93, 0x14, 0x08, // 69:659
-    0x02, 0xA7, 0x11, 0x07, // 70:679
-    0x02, 0xB8, 0x23, 0x0C, // 71:696
-    0x02, 0xDB, 0x17, 0x0A, // 72:731
-    0x02, 0xF2, 0x05, 0x03, // 73:754
-    0x02, 0xF7, 0x11, 0x07, // 74:759
-    0x03, 0x08, 0x17, 0x08, // 75:776
-    0x03, 0x1F, 0x11, 0x06, // 76:799
-    0x03, 0x30, 0x23, 0x0D, // 77:816
-    0x03, 0x53, 0x1A, 0x0A, // 78:851
-    0x03, 0x6D, 0x23, 0x0C, // 79:877
-    0x03, 0x90, 0x17, 0x08, // 80:912
-    0x03, 0xA7, 0x23, 0x0C, // 81:935
-    0x03, 0xCA, 0x17, 0x09, // 82:970
-    0x03, 0xE1, 0x14, 0x07, // 83:993
-    0x03, 0xF5, 0x0D, 0x06, // 84:1013
-    0x04, 0x02, 0x17, 0x09, // 85:1026
-    0x04, 0x19, 0x19, 0x0A, // 86:1049
-    0x04, 0x32, 0x25, 0x0D, // 87:1074
-    0x04, 0x57, 0x17, 0x09, // 88:1111
-    0x04, 0x6E, 0x16, 0x08, // 89:1134
-    0x04, 0x84, 0x14, 0x07, // 90:1156
-    0x04, 0x98, 0x0E, 0x05, // 91:1176
-    0x04, 0xA6, 0x11, 0x08, // 92:1190
-    0x04, 0xB7, 0x08, 0x05, // 93:1207
-    0x04, 0xBF, 0x17, 0x08, // 94:1215
-    0x04, 0xD6, 0x14, 0x07, // 95:1238
-    0x04, 0xEA, 0x0A, 0x05, // 96:1258
-    0x04, 0xF4, 0x1A, 0x0A, // 97:1268
-    0x05, 0x0E, 0x1A, 0x0A, // 98:1294
-    0x05, 0x28, 0x1A, 0x09, // 99:1320
-    0x05, 0x42, 0x1A, 0x0A, // 100:1346
-    0x05, 0x5C, 0x1A, 0x09, // 101:1372
-    0x05, 0x76, 0x0A, 0x04, // 102:1398
-    0x05, 0x80, 0x1A, 0x09, // 103:1408
-    0x05, 0x9A, 0x17, 0x09, // 104:1434
-    0x05, 0xB1, 0x05, 0x03, // 105:1457
-    0x05, 0xB6, 0x05, 0x03, // 106:1462
-    0x05, 0xBB, 0x14, 0x07, // 107:1467
-    0x05, 0xCF, 0x05, 0x03, // 108:1487
-    0x05, 0xD4, 0x23, 0x0D, // 109:1492
-    0x05, 0xF7, 0x17, 0x09, // 110:1527
-    0x06, 0x0E, 0x1A, 0x09, // 111:1550
-    0x06, 0x28, 0x1A, 0x0A, // 112:1576
-    0x06, 0x42, 0x1B, 0x0A, // 113:1602
-    0x06, 0x5D, 0x0A, 0x04, // 114:1629
-    0x06, 0x67, 0x0E, 0x05, // 115:1639
-    0x06, 0x75, 0x0D, 0x05, // 116:1653
-    0x06, 0x82, 0x17, 0x09, // 117:1666
-    0x06, 0x99, 0x14, 0x08, // 118:1689
-    0x06, 0xAD, 0x20, 0x0C, // 119:1709
-    0x06, 0xCD, 0x11, 0x07, // 120:1741
-    0x06, 0xDE, 0x13, 0x08, // 121:1758
-    0x06, 0xF1, 0x11, 0x06, // 122:1777
-    0x07, 0x02, 0x0B, 0x05, // 123:1794
-    0x07, 0x0D, 0x0E, 0x09, // 124:1805
-    0x07, 0x1B, 0x0B, 0x05, // 125:1819
-    0x07, 0x26, 0x17, 0x08, // 126:1830
-    0xFF, 0xFF, 0x00, 0x07, // 127:65535
-    0xFF, 0xFF, 0x00, 0x07, // 128:65535
-    0xFF, 0xFF, 0x00, 0x07, // 129:65535
-    0xFF, 0xFF, 0x00, 0x07, // 130:65535
-    0xFF, 0xFF, 0x00, 0x07, // 131:65535
-    0xFF, 0xFF, 0x00, 0x07, // 132:65535
-    0xFF, 0xFF, 0x00, 0x07, // 133:65535
-    0xFF, 0xFF, 0x00, 0x07, // 134:65535
-    0xFF, 0xFF, 0x00, 0x07, // 135:65535
-    0xFF, 0xFF, 0x00, 0x07, // 136:65535
-    0xFF, 0xFF, 0x00, 0x07, // 137:65535
-    0xFF, 0xFF, 0x00, 0x07, // 138:65535
-    0xFF, 0xFF, 0x00, 0x07, // 139:65535
-    0xFF, 0xFF, 0x00, 0x07, // 140:65535
-    0xFF, 0xFF, 0x00, 0x07, // 141:65535
-    0xFF, 0xFF, 0x00, 0x07, // 142:65535
-    0xFF, 0xFF, 0x00, 0x07, // 143:65535
-    0xFF, 0xFF, 0x00, 0x07, // 144:65535
-    0xFF, 0xFF, 0x00, 0x07, // 145:65535
-    0xFF, 0xFF, 0x00, 0x07, // 146:65535
-    0xFF, 0xFF, 0x00, 0x07, // 147:65535
-    0xFF, 0xFF, 0x00, 0x07, // 148:65535
-    0xFF, 0xFF, 0x00, 0x07, // 149:65535
-    0xFF, 0xFF, 0x00, 0x07, // 150:65535
-    0xFF, 0xFF, 0x00, 0x07, // 151:65535
-    0xFF, 0xFF, 0x00, 0x07, // 152:65535
-    0xFF, 0xFF, 0x00, 0x07, // 153:65535
-    0xFF, 0xFF, 0x00, 0x07, // 154:65535
-    0xFF, 0xFF, 0x00, 0x07, // 155:65535
-    0xFF, 0xFF, 0x00, 0x07, // 156:65535
-    0xFF, 0xFF, 0x00, 0x07, // 157:65535
-    0xFF, 0xFF, 0x00, 0x07, // 158:65535
-    0xFF, 0xFF, 0x00, 0x07, // 159:65535
-    0xFF, 0xFF, 0x00, 0x04, // 160:65535
-    0x07, 0x3D, 0x09, 0x04, // 161:1853
-    0x07, 0x46, 0x14, 0x08, // 162:1862
-    0x07, 0x5A, 0x17, 0x08, // 163:1882
-    0x07, 0x71, 0x14, 0x08, // 164:1905
-    0x07, 0x85, 0x17, 0x08, // 165:1925
-    0x07, 0x9C, 0x0E, 0x09, // 166:1948
-    0x07, 0xAA, 0x14, 0x09, // 167:1962
-    0x07, 0xBE, 0x0A, 0x05, // 168:1982
-    0x07, 0xC8, 0x1D, 0x0A, // 169:1992
-    0x07, 0xE5, 0x0E, 0x05, // 170:2021
-    0x07, 0xF3, 0x0E, 0x06, // 171:2035
-    0x08, 0x01, 0x17, 0x08, // 172:2049
-    0x08, 0x18, 0x0B, 0x05, // 173:2072
-    0x08, 0x23, 0x1D, 0x0A, // 174:2083
-    0x08, 0x40, 0x10, 0x07, // 175:2112
-    0x08, 0x50, 0x0D, 0x06, // 176:2128
-    0x08, 0x5D, 0x17, 0x08, // 177:2141
-    0x08, 0x74, 0x0E, 0x05, // 178:2164
-    0x08, 0x82, 0x0B, 0x05, // 179:2178
-    0x08, 0x8D, 0x0A, 0x05, // 180:2189
-    0x08, 0x97, 0x17, 0x09, // 181:2199
-    0x08, 0xAE, 0x14, 0x08, // 182:2222
-    0x08, 0xC2, 0x05, 0x04, // 183:2242
-    0x08, 0xC7, 0x0C, 0x05, // 184:2247
-    0x08, 0xD3, 0x08, 0x05, // 185:2259
-    0x08, 0xDB, 0x0E, 0x05, // 186:2267
-    0x08, 0xE9, 0x0E, 0x06, // 187:2281
-    0x08, 0xF7, 0x23, 0x0C, // 188:2295
-    0x09, 0x1A, 0x20, 0x0C, // 189:2330
-    0x09, 0x3A, 0x23, 0x0C, // 190:2362
-    0x09, 0x5D, 0x17, 0x08, // 191:2397
-    0x09, 0x74, 0x1D, 0x0A, // 192:2420
-    0x09, 0x91, 0x1D, 0x0A, // 193:2449
-    0x09, 0xAE, 0x1D, 0x0A, // 194:2478
-    0x09, 0xCB, 0x1D, 0x0A, // 195:2507
-    0x09, 0xE8, 0x1D, 0x0A, // 196:2536
-    0x0A, 0x05, 0x1D, 0x0A, // 197:2565
-    0x0A, 0x22, 0x26, 0x0E, // 198:2594
-    0x0A, 0x48, 0x20, 0x0B, // 199:2632
-    0x0A, 0x68, 0x14, 0x08, // 200:2664
-    0x0A, 0x7C, 0x14, 0x08, // 201:2684
-    0x0A, 0x90, 0x14, 0x08, // 202:2704
-    0x0A, 0xA4, 0x14, 0x08, // 203:2724
-    0x0A, 0xB8, 0x07, 0x03, // 204:2744
-    0x0A, 0xBF, 0x07, 0x03, // 205:2751
-    0x0A, 0xC6, 0x07, 0x03, // 206:2758
-    0x0A, 0xCD, 0x07, 0x03, // 207:2765
-    0x0A, 0xD4, 0x1D, 0x0B, // 208:2772
-    0x0A, 0xF1, 0x1A, 0x0A, // 209:2801
-    0x0B, 0x0B, 0x23, 0x0C, // 210:2827
-    0x0B, 0x2E, 0x23, 0x0C, // 211:2862
-    0x0B, 0x51, 0x23, 0x0C, // 212:2897
-    0x0B, 0x74, 0x23, 0x0C, // 213:2932
-    0x0B, 0x97, 0x23, 0x0C, // 214:2967
-    0x0B, 0xBA, 0x17, 0x08, // 215:3002
-    0x0B, 0xD1, 0x20, 0x0C, // 216:3025
-    0x0B, 0xF1, 0x17, 0x09, // 217:3057
-    0x0C, 0x08, 0x17, 0x09, // 218:3080
-    0x0C, 0x1F, 0x17, 0x09, // 219:3103
-    0x0C, 0x36, 0x17, 0x09, // 220:3126
-    0x0C, 0x4D, 0x16, 0x08, // 221:3149
-    0x0C, 0x63, 0x17, 0x08, // 222:3171
-    0x0C, 0x7A, 0x14, 0x08, // 223:3194
-    0x0C, 0x8E, 0x1A, 0x0A, // 224:3214
-    0x0C, 0xA8, 0x1A, 0x0A, // 225:3240
-    0x0C, 0xC2, 0x1A, 0x0A, // 226:3266
-    0x0C, 0xDC, 0x1A, 0x0A, // 227:3292
-    0x0C, 0xF6, 0x1A, 0x0A, // 228:3318
-    0x0D, 0x10, 0x1A, 0x0A, // 229:3344
-    0x0D, 0x2A, 0x2F, 0x10, // 230:3370
-    0x0D, 0x59, 0x17, 0x09, // 231:3417
-    0x0D, 0x70, 0x1A, 0x09, // 232:3440
-    0x0D, 0x8A, 0x1A, 0x09, // 233:3466
-    0x0D, 0xA4, 0x1A, 0x09, // 234:3492
-    0x0D, 0xBE, 0x1A, 0x09, // 235:3518
-    0x0D, 0xD8, 0x07, 0x03, // 236:3544
-    0x0D, 0xDF, 0x07, 0x03, // 237:3551
-    0x0D, 0xE6, 0x07, 0x03, // 238:3558
-    0x0D, 0xED, 0x07, 0x03, // 239:3565
-    0x0D, 0xF4, 0x1A, 0x09, // 240:3572
-    0x0E, 0x0E, 0x17, 0x09, // 241:3598
-    0x0E, 0x25, 0x1A, 0x09, // 242:3621
-    0x0E, 0x3F, 0x1A, 0x09, // 243:3647
-    0x0E, 0x59, 0x1A, 0x09, // 244:3673
-    0x0E, 0x73, 0x1A, 0x09, // 245:3699
-    0x0E, 0x8D, 0x1A, 0x09, // 246:3725
-    0x0E, 0xA7, 0x17, 0x08, // 247:3751
-    0x0E, 0xBE, 0x1A, 0x09, // 248:3774
-    0x0E, 0xD8, 0x17, 0x09, // 249:3800
-    0x0E, 0xEF, 0x17, 0x09, // 250:3823
-    0x0F, 0x06, 0x17, 0x09, // 251:3846
-    0x0F, 0x1D, 0x17, 0x09, // 252:3869
-    0x0F, 0x34, 0x13, 0x08, // 253:3892
-    0x0F, 0x47, 0x1A, 0x0A, // 254:3911
-    0x0F, 0x61, 0x13, 0x08, // 255:3937
-
-    // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x37,                                                                                                                                                                                                                                           // 33
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,                                                                                                                                                                                                                                                 // 34
-    0x80, 0x04, 0x00, 0x80, 0x3C, 0x00, 0xE0, 0x07, 0x00, 0x90, 0x04, 0x00, 0x80, 0x3C, 0x00, 0xC0, 0x07, 0x00, 0xB0, 0x04, 0x00, 0x80,                                                                                                                                                       // 35
-    0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x10, 0x31, 0x00, 0x18, 0x61, 0x00, 0x10, 0x21, 0x00, 0x10, 0x12, 0x00, 0x20, 0x1C,                                                                                                                                                                   // 36
-    0x60, 0x00, 0x00, 0x90, 0x00, 0x00, 0x90, 0x00, 0x00, 0x90, 0x30, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x1C, 0x00, 0x30, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x1C,                                                                                           // 37
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xE0, 0x32, 0x00, 0x90, 0x21, 0x00, 0x10, 0x21, 0x00, 0x90, 0x32, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x13, 0x00, 0x00, 0x20,                                                                                                             // 38
-    0x00, 0x00, 0x00, 0x70,                                                                                                                                                                                                                                                                   // 39
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x30, 0x00, 0x20, 0x40, 0x00, 0x10, 0x80,                                                                                                                                                                                                       // 40
-    0x10, 0x80, 0x00, 0x20, 0x40, 0x00, 0xC0, 0x30, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                         // 41
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x40,                                                                                                                                                                                                             // 42
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,                                                                                                                                                 // 43
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x70,                                                                                                                                                                                                                                           // 44
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,                                                                                                                                                                                                                         // 45
-    0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                             // 46
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70,                                                                                                                                                                                                             // 47
-    0xE0, 0x1F, 0x00, 0x30, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x30, 0x30, 0x00, 0xE0, 0x1F,                                                                                                                                                                   // 48
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                       // 49
-    0x00, 0x20, 0x00, 0x60, 0x30, 0x00, 0x10, 0x28, 0x00, 0x10, 0x24, 0x00, 0x10, 0x26, 0x00, 0x30, 0x23, 0x00, 0xE0, 0x21,                                                                                                                                                                   // 50
-    0x00, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x21, 0x00, 0x90, 0x21, 0x00, 0xE0, 0x11, 0x00, 0x00, 0x0E,                                                                                                                                                                   // 51
-    0x00, 0x0C, 0x00, 0x00, 0x0A, 0x00, 0x80, 0x09, 0x00, 0x40, 0x08, 0x00, 0x30, 0x08, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x08,                                                                                                                                                                   // 52
-    0x00, 0x08, 0x00, 0xF0, 0x11, 0x00, 0x90, 0x20, 0x00, 0x90, 0x20, 0x00, 0x90, 0x20, 0x00, 0x10, 0x11, 0x00, 0x00, 0x0E,                                                                                                                                                                   // 53
-    0x00, 0x0E, 0x00, 0x80, 0x11, 0x00, 0xC0, 0x20, 0x00, 0xB0, 0x20, 0x00, 0x90, 0x20, 0x00, 0x00, 0x11, 0x00, 0x00, 0x0E,                                                                                                                                                                   // 54
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x30, 0x00, 0x10, 0x0C, 0x00, 0x10, 0x03, 0x00, 0xD0, 0x00, 0x00, 0x30,                                                                                                                                                                         // 55
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xE0, 0x32, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0xE0, 0x32, 0x00, 0x00, 0x1C,                                                                                                                                                                   // 56
-    0xC0, 0x01, 0x00, 0x20, 0x02, 0x00, 0x10, 0x24, 0x00, 0x10, 0x34, 0x00, 0x10, 0x0C, 0x00, 0x20, 0x06, 0x00, 0xC0, 0x01,                                                                                                                                                                   // 57
-    0x00, 0x00, 0x00, 0x80, 0x31,                                                                                                                                                                                                                                                             // 58
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x21,                                                                                                                                                                                                                                           // 59
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x09, 0x00, 0x80, 0x08, 0x00, 0x80, 0x10, 0x00, 0x40, 0x10,                                                                                                                                                 // 60
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09,                                                                                                                                                 // 61
-    0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x80, 0x18, 0x00, 0x80, 0x08, 0x00, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02,                                                                                                                                                 // 62
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x36, 0x00, 0x30, 0x03, 0x00, 0xE0,                                                                                                                                                                         // 63
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x18, 0x00, 0x20, 0x17, 0x00, 0x90, 0x28, 0x00, 0x50, 0x28, 0x00, 0x50, 0x24, 0x00, 0x90, 0x2B, 0x00, 0x70, 0x18, 0x00, 0x60, 0x14, 0x00, 0xC0, 0x03,                                                                                           // 64
-    0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x05, 0x00, 0x70, 0x04, 0x00, 0x30, 0x04, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,                                                                                                             // 65
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0xE0, 0x32, 0x00, 0x00, 0x1E,                                                                                                                                                 // 66
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x60, 0x18, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x30, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08,                                                                                           // 67
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x60, 0x18, 0x00, 0x80, 0x07,                                                                                                             // 68
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x20,                                                                                                                                                                   // 69
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01,                                                                                                                                                                                     // 70
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x22, 0x00, 0x10, 0x22, 0x00, 0x10, 0x22, 0x00, 0x10, 0x22, 0x00, 0x20, 0x12, 0x00, 0x60, 0x0A, 0x00, 0x00, 0x06,                                                                         // 71
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x3F,                                                                                                                                                 // 72
-    0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                                             // 73
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x1F,                                                                                                                                                                                     // 74
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x80, 0x04, 0x00, 0x40, 0x08, 0x00, 0x30, 0x30, 0x00, 0x10, 0x20,                                                                                                                                                 // 75
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20,                                                                                                                                                                                     // 76
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0xF0, 0x3F,                                                                         // 77
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x30, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x3F,                                                                                                                               // 78
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 79
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x30, 0x03, 0x00, 0xE0, 0x01,                                                                                                                                                 // 80
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x0C, 0x00, 0x20, 0x14, 0x00, 0x10, 0x24, 0x00, 0x10, 0x24, 0x00, 0x10, 0x24, 0x00, 0x10, 0x28, 0x00, 0x10, 0x28, 0x00, 0x20, 0x10, 0x00, 0x60, 0x28, 0x00, 0x80, 0x27,                                                                         // 81
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x06, 0x00, 0x10, 0x1A, 0x00, 0x20, 0x32, 0x00, 0xE0, 0x01,                                                                                                                                                 // 82
-    0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x30, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x22, 0x00, 0x10, 0x32, 0x00, 0x20, 0x1C,                                                                                                                                                                   // 83
-    0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x00, 0x00, 0x10,                                                                                                                                                                                                             // 84
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x0F,                                                                                                                                                 // 85
-    0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x06, 0x00, 0x80, 0x01, 0x00, 0x70,                                                                                                                                     // 86
-    0x10, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70,                                                             // 87
-    0x00, 0x20, 0x00, 0x30, 0x30, 0x00, 0x60, 0x08, 0x00, 0x80, 0x07, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x18, 0x00, 0x10, 0x20,                                                                                                                                                 // 88
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x30,                                                                                                                                                       // 89
-    0x10, 0x20, 0x00, 0x10, 0x38, 0x00, 0x10, 0x26, 0x00, 0x10, 0x23, 0x00, 0xD0, 0x20, 0x00, 0x70, 0x20, 0x00, 0x00, 0x20,                                                                                                                                                                   // 90
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x20, 0x40, 0x00, 0x10, 0x80,                                                                                                                                                                                                       // 91
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x30,                                                                                                                                                                                     // 92
-    0x10, 0x80, 0x00, 0x30, 0x40, 0x00, 0xE0, 0x3F,                                                                                                                                                                                                                                           // 93
-    0x00, 0x08, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x01, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0C,                                                                                                                                                 // 94
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80,                                                                                                                                                                   // 95
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,                                                                                                                                                                                                                               // 96
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 97
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 98
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x01,                                                                                                                               // 99
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0xF0, 0x3F,                                                                                                                               // 100
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x14, 0x00, 0x40, 0x24, 0x00, 0x40, 0x24, 0x00, 0x40, 0x24, 0x00, 0x80, 0x34, 0x00, 0x80, 0x17, 0x00, 0x00, 0x04,                                                                                                                               // 101
-    0x40, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x50, 0x00, 0x00, 0x50,                                                                                                                                                                                                                               // 102
-    0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x80, 0xD0, 0x00, 0x40, 0x20, 0x01, 0x40, 0x20, 0x01, 0x40, 0x20, 0x01, 0x40, 0x20, 0x01, 0x80, 0x90, 0x00, 0xC0, 0x7F,                                                                                                                               // 103
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x3F,                                                                                                                                                 // 104
-    0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                                             // 105
-    0x00, 0x00, 0x01, 0xF0, 0xFF,                                                                                                                                                                                                                                                             // 106
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x09, 0x00, 0xC0, 0x30, 0x00, 0x40, 0x20,                                                                                                                                                                   // 107
-    0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                                             // 108
-    0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x3F,                                                                         // 109
-    0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3F,                                                                                                                                                 // 110
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 111
-    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 112
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                         // 113
-    0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x00, 0x00, 0x40,                                                                                                                                                                                                                               // 114
-    0x00, 0x00, 0x00, 0x80, 0x13, 0x00, 0x40, 0x22, 0x00, 0x40, 0x24, 0x00, 0x80, 0x1C,                                                                                                                                                                                                       // 115
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x40, 0x00, 0x00, 0x40,                                                                                                                                                                                                             // 116
-    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 117
-    0x40, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x01,                                                                                                                                                                   // 118
-    0x40, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x01,                                                                                           // 119
-    0x40, 0x20, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x80, 0x19, 0x00, 0xC0, 0x30,                                                                                                                                                                                     // 120
-    0x40, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x8E, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x07, 0x00, 0xC0,                                                                                                                                                                         // 121
-    0x40, 0x30, 0x00, 0x40, 0x38, 0x00, 0x40, 0x24, 0x00, 0x40, 0x23, 0x00, 0xC0, 0x20, 0x00, 0x40, 0x20,                                                                                                                                                                                     // 122
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xF0, 0xFF, 0x00, 0x10, 0x80,                                                                                                                                                                                                                         // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                       // 124
-    0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x06,                                                                                                                                                                                                                         // 125
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,                                                                                                                                                 // 126
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFE, 0x01,                                                                                                                                                                                                                                     // 161
-    0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x40, 0x04, 0x00, 0x20, 0x08, 0x00, 0x30, 0x18, 0x00, 0x20, 0x08, 0x00, 0x40, 0x04,                                                                                                                                                                   // 162
-    0x00, 0x01, 0x00, 0xE0, 0x21, 0x00, 0x30, 0x23, 0x00, 0x10, 0x3D, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x60, 0x30, 0x00, 0x00, 0x1C,                                                                                                                                                 // 163
-    0x40, 0x17, 0x00, 0x80, 0x08, 0x00, 0x40, 0x10, 0x00, 0x40, 0x10, 0x00, 0x40, 0x10, 0x00, 0x80, 0x08, 0x00, 0x40, 0x17,                                                                                                                                                                   // 164
-    0x00, 0x00, 0x00, 0xB0, 0x04, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x00, 0xE0, 0x04, 0x00, 0x90, 0x04,                                                                                                                                                 // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C,                                                                                                                                                                                                       // 166
-    0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0xE0, 0xC4, 0x00, 0x90, 0x88, 0x00, 0x10, 0x89, 0x00, 0x30, 0x91, 0x00, 0x00, 0x7E,                                                                                                                                                                   // 167
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                               // 168
-    0x80, 0x07, 0x00, 0x60, 0x08, 0x00, 0xA0, 0x17, 0x00, 0xD0, 0x2C, 0x00, 0x50, 0x28, 0x00, 0x50, 0x28, 0x00, 0x50, 0x28, 0x00, 0x90, 0x24, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08,                                                                                                             // 169
-    0x60, 0x02, 0x00, 0x90, 0x02, 0x00, 0x90, 0x02, 0x00, 0x90, 0x02, 0x00, 0xF0, 0x02,                                                                                                                                                                                                       // 170
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x80, 0x08, 0x00, 0x00, 0x06, 0x00, 0x80, 0x19,                                                                                                                                                                                                       // 171
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F,                                                                                                                                                 // 172
-    0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,                                                                                                                                                                                                                         // 173
-    0x80, 0x07, 0x00, 0x60, 0x08, 0x00, 0x20, 0x10, 0x00, 0xD0, 0x2F, 0x00, 0x50, 0x22, 0x00, 0x50, 0x22, 0x00, 0x50, 0x26, 0x00, 0x90, 0x29, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08,                                                                                                             // 174
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,                                                                                                                                                                                           // 175
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0xE0,                                                                                                                                                                                                             // 176
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0xC0, 0x2F, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x22,                                                                                                                                                 // 177
-    0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x10, 0x03, 0x00, 0x90, 0x02, 0x00, 0x60, 0x02,                                                                                                                                                                                                       // 178
-    0x20, 0x01, 0x00, 0x10, 0x02, 0x00, 0x50, 0x02, 0x00, 0xF0, 0x01,                                                                                                                                                                                                                         // 179
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08,                                                                                                                                                                                                                               // 180
-    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 181
-    0xC0, 0x00, 0x00, 0xF0, 0x01, 0x00, 0xF0, 0x01, 0x00, 0xF0, 0xFF, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0xFF,                                                                                                                                                                   // 182
-    0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                             // 183
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0xC0, 0x01,                                                                                                                                                                                                                   // 184
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x07,                                                                                                                                                                                                                                           // 185
-    0x60, 0x02, 0x00, 0x90, 0x02, 0x00, 0x90, 0x02, 0x00, 0x90, 0x02, 0x00, 0x60, 0x02,                                                                                                                                                                                                       // 186
-    0x00, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x06, 0x00, 0x80, 0x08, 0x00, 0x00, 0x07,                                                                                                                                                                                                       // 187
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10,                                                                         // 188
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x01, 0x00, 0x60, 0x00, 0x00, 0x10, 0x33, 0x00, 0x80, 0x28, 0x00, 0x80, 0x24, 0x00, 0x00, 0x23,                                                                                           // 189
-    0x20, 0x01, 0x00, 0x10, 0x02, 0x00, 0x50, 0x02, 0x00, 0xF0, 0x21, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x80, 0x11, 0x00, 0x60, 0x18, 0x00, 0x10, 0x16, 0x00, 0x00, 0x11, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10,                                                                         // 190
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x98, 0x01, 0x00, 0x0C, 0x01, 0xC0, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x60,                                                                                                                                                 // 191
-    0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0xC2, 0x05, 0x00, 0x76, 0x04, 0x00, 0x34, 0x04, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,                                                                                                             // 192
-    0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x05, 0x00, 0x74, 0x04, 0x00, 0x34, 0x04, 0x00, 0xC2, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,                                                                                                             // 193
-    0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0xC4, 0x05, 0x00, 0x74, 0x04, 0x00, 0x32, 0x04, 0x00, 0xC4, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,                                                                                                             // 194
-    0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0xC4, 0x05, 0x00, 0x74, 0x04, 0x00, 0x34, 0x04, 0x00, 0xC4, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x30,                                                                                                             // 195
-    0x00, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0xC6, 0x05, 0x00, 0x30, 0x04, 0x00, 0x76, 0x04, 0x00, 0xC0, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20,                                                                                                             // 196
-    0x00, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0xC2, 0x05, 0x00, 0x35, 0x04, 0x00, 0x37, 0x04, 0x00, 0xC0, 0x05, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20,                                                                                                             // 197
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0x80, 0x05, 0x00, 0xC0, 0x04, 0x00, 0x30, 0x04, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21,                                                       // 198
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x60, 0x18, 0x00, 0x20, 0x10, 0x00, 0x10, 0x60, 0x00, 0x10, 0xA0, 0x02, 0x10, 0xA0, 0x03, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x60, 0x18, 0x00, 0x00, 0x08,                                                                                           // 199
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x12, 0x21, 0x00, 0x14, 0x21, 0x00, 0x14, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x20,                                                                                                                                                                   // 200
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x21, 0x00, 0x14, 0x21, 0x00, 0x12, 0x21, 0x00, 0x12, 0x21, 0x00, 0x10, 0x20,                                                                                                                                                                   // 201
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x14, 0x21, 0x00, 0x12, 0x21, 0x00, 0x14, 0x21, 0x00, 0x14, 0x21, 0x00, 0x10, 0x20,                                                                                                                                                                   // 202
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x16, 0x21, 0x00, 0x10, 0x21, 0x00, 0x16, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x20,                                                                                                                                                                   // 203
-    0x02, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x04,                                                                                                                                                                                                                                                 // 204
-    0x04, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x02,                                                                                                                                                                                                                                                 // 205
-    0x04, 0x00, 0x00, 0xF2, 0x3F, 0x00, 0x04,                                                                                                                                                                                                                                                 // 206
-    0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x06,                                                                                                                                                                                                                                                 // 207
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x3F, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x60, 0x18, 0x00, 0x80, 0x07,                                                                                                             // 208
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x30, 0x00, 0x00, 0x44, 0x00, 0x00, 0x84, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x0C, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x3F,                                                                                                                               // 209
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x16, 0x20, 0x00, 0x14, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 210
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x14, 0x20, 0x00, 0x12, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 211
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x14, 0x20, 0x00, 0x12, 0x20, 0x00, 0x14, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 212
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x14, 0x20, 0x00, 0x14, 0x20, 0x00, 0x14, 0x20, 0x00, 0x14, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 213
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x16, 0x20, 0x00, 0x10, 0x20, 0x00, 0x16, 0x20, 0x00, 0x10, 0x20, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x80, 0x07,                                                                         // 214
-    0x00, 0x00, 0x00, 0xC0, 0x10, 0x00, 0x80, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x18, 0x00, 0x40, 0x10,                                                                                                                                                 // 215
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x60, 0x68, 0x00, 0x20, 0x10, 0x00, 0x10, 0x2C, 0x00, 0x10, 0x22, 0x00, 0x10, 0x21, 0x00, 0xD0, 0x20, 0x00, 0x20, 0x10, 0x00, 0x58, 0x18, 0x00, 0x80, 0x07,                                                                                           // 216
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x0F,                                                                                                                                                 // 217
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x0F,                                                                                                                                                 // 218
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x04, 0x20, 0x00, 0x02, 0x20, 0x00, 0x04, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x0F,                                                                                                                                                 // 219
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x06, 0x20, 0x00, 0x00, 0x20, 0x00, 0x06, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x0F,                                                                                                                                                 // 220
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x04, 0x03, 0x00, 0x04, 0x3C, 0x00, 0x02, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x30,                                                                                                                                                       // 221
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x07,                                                                                                                                                 // 222
-    0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x10, 0x18, 0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0xE0, 0x32, 0x00, 0x00, 0x1E,                                                                                                                                                                   // 223
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x48, 0x20, 0x00, 0x48, 0x20, 0x00, 0x50, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 224
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x48, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 225
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 226
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 227
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x70, 0x20, 0x00, 0x40, 0x20, 0x00, 0x70, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 228
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x78, 0x20, 0x00, 0x68, 0x20, 0x00, 0x50, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                               // 229
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x15, 0x00, 0x40, 0x24, 0x00, 0x40, 0x24, 0x00, 0x40, 0x24, 0x00, 0x40, 0x24, 0x00, 0x80, 0x15, 0x00, 0x00, 0x07, // 230
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x60, 0x01, 0x40, 0xE0, 0x01, 0xC0, 0x30, 0x00, 0x80, 0x11,                                                                                                                                                 // 231
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x14, 0x00, 0x48, 0x24, 0x00, 0x50, 0x24, 0x00, 0x50, 0x24, 0x00, 0x80, 0x34, 0x00, 0x80, 0x17, 0x00, 0x00, 0x04,                                                                                                                               // 232
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x14, 0x00, 0x50, 0x24, 0x00, 0x50, 0x24, 0x00, 0x48, 0x24, 0x00, 0x88, 0x34, 0x00, 0x80, 0x17, 0x00, 0x00, 0x04,                                                                                                                               // 233
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x80, 0x14, 0x00, 0x50, 0x24, 0x00, 0x50, 0x24, 0x00, 0x50, 0x24, 0x00, 0x80, 0x34, 0x00, 0x80, 0x17, 0x00, 0x00, 0x04,                                                                                                                               // 234
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x15, 0x00, 0x70, 0x24, 0x00, 0x40, 0x24, 0x00, 0x70, 0x24, 0x00, 0xC0, 0x24, 0x00, 0x80, 0x15, 0x00, 0x00, 0x06,                                                                                                                               // 235
-    0x08, 0x00, 0x00, 0xC8, 0x3F, 0x00, 0x10,                                                                                                                                                                                                                                                 // 236
-    0x10, 0x00, 0x00, 0xC8, 0x3F, 0x00, 0x08,                                                                                                                                                                                                                                                 // 237
-    0x10, 0x00, 0x00, 0xD0, 0x3F, 0x00, 0x10,                                                                                                                                                                                                                                                 // 238
-    0x30, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x30,                                                                                                                                                                                                                                                 // 239
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x60, 0x20, 0x00, 0x50, 0x20, 0x00, 0x70, 0x20, 0x00, 0x50, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 240
-    0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x90, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3F,                                                                                                                                                 // 241
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x48, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 242
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x48, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 243
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x60, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x60, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 244
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x50, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 245
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x10, 0x00, 0x70, 0x20, 0x00, 0x40, 0x20, 0x00, 0x70, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 246
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x80, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,                                                                                                                                                 // 247
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x30, 0x00, 0x40, 0x38, 0x00, 0x40, 0x24, 0x00, 0x40, 0x22, 0x00, 0xC0, 0x21, 0x00, 0xC0, 0x10, 0x00, 0x40, 0x0F,                                                                                                                               // 248
-    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x08, 0x30, 0x00, 0x08, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 249
-    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x30, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x08, 0x20, 0x00, 0x08, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 250
-    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x30, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x10, 0x20, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 251
-    0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x30, 0x00, 0x30, 0x20, 0x00, 0x00, 0x20, 0x00, 0x30, 0x20, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x3F,                                                                                                                                                 // 252
-    0x40, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x8E, 0x01, 0x10, 0xF0, 0x00, 0x08, 0x1C, 0x00, 0x08, 0x07, 0x00, 0xC0,                                                                                                                                                                         // 253
-    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x80, 0x10, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x80, 0x10, 0x00, 0x00, 0x0F,                                                                                                                               // 254
-    0x40, 0x00, 0x00, 0x80, 0x03, 0x00, 0x30, 0x9C, 0x01, 0x00, 0x70, 0x00, 0x30, 0x1C, 0x00, 0x80, 0x03, 0x00, 0xC0                                                                                                                                                                          // 255
-};
-
-const uint8_t URW_Gothic_L_Book_25[] PROGMEM = {
-    0x1D, // Width: 29
-    0x1F, // Height: 31
-    0x20, // First Char: 32
-    0xE0, // Numbers of Chars: 224
-
-    // Jump Table:
-    0xFF, 0xFF, 0x00, 0x07, // 32:65535
-    0x00, 0x00, 0x14, 0x07, // 33:0
-    0x00, 0x14, 0x1A, 0x08, // 34:20
-    0x00, 0x2E, 0x36, 0x0E, // 35:46
-    0x00, 0x64, 0x2F, 0x0E, // 36:100
-    0x00, 0x93, 0x4B, 0x13, // 37:147
-    0x00, 0xDE, 0x4B, 0x13, // 38:222
-    0x01, 0x29, 0x0E, 0x05, // 39:297
-    0x01, 0x37, 0x20, 0x09, // 40:311
-    0x01, 0x57, 0x1F, 0x09, // 41:343
-    0x01, 0x76, 0x22, 0x0B, // 42:374
-    0x01, 0x98, 0x37, 0x0F, // 43:408
-    0x01, 0xCF, 0x17, 0x07, // 44:463
-    0x01, 0xE6, 0x1F, 0x08, // 45:486
-    0x02, 0x05, 0x10, 0x07, // 46:517
-    0x02, 0x15, 0x25, 0x0B, // 47:533
-    0x02, 0x3A, 0x33, 0x0E, // 48:570
-    0x02, 0x6D, 0x24, 0x0E, // 49:621
-    0x02, 0x91, 0x34, 0x0E, // 50:657
-    0x02, 0xC5, 0x2F, 0x0E, // 51:709
-    0x02, 0xF4, 0x37, 0x0E, // 52:756
-    0x03, 0x2B, 0x33, 0x0E, // 53:811
-    0x03, 0x5E, 0x33, 0x0E, // 54:862
-    0x03, 0x91, 0x2E, 0x0E, // 55:913
-    0x03, 0xBF, 0x33, 0x0E, // 56:959
-    0x03, 0xF2, 0x32, 0x0E, // 57:1010
-    0x04, 0x24, 0x10, 0x07, // 58:1060
-    0x04, 0x34, 0x13, 0x07, // 59:1076
-    0x04, 0x47, 0x37, 0x0F, // 60:1095
-    0x04, 0x7E, 0x37, 0x0F, // 61:1150
-    0x04, 0xB5, 0x37, 0x0F, // 62:1205
-    0x04, 0xEC, 0x32, 0x0F, // 63:1260
-    0x05, 0x1E, 0x53, 0x16, // 64:1310
-    0x05, 0x71, 0x48, 0x13, // 65:1393
-    0x05, 0xB9, 0x37, 0x0E, // 66:1465
-    0x05, 0xF0, 0x4B, 0x14, // 67:1520
-    0x06, 0x3B, 0x47, 0x13, // 68:1595
-    0x06, 0x82, 0x30, 0x0D, // 69:1666
-    0x06, 0xB2, 0x2E, 0x0C, // 70:1714
-    0x06, 0xE0, 0x53, 0x16, // 71:1760
-    0x07, 0x33, 0x3C, 0x11, // 72:1843
-    0x07, 0x6F, 0x10, 0x06, // 73:1903
-    0x07, 0x7F, 0x27, 0x0C, // 74:1919
-    0x07, 0xA6, 0x38, 0x0F, // 75:1958
-    0x07, 0xDE, 0x30, 0x0C, // 76:2014
-    0x08, 0x0E, 0x54, 0x17, // 77:2062
-    0x08, 0x62, 0x44, 0x13, // 78:2146
-    0x08, 0xA6, 0x53, 0x16, // 79:2214
-    0x08, 0xF9, 0x36, 0x0F, // 80:2297
-    0x09, 0x2F, 0x54, 0x16, // 81:2351
-    0x09, 0x83, 0x36, 0x0F, // 82:2435
-    0x09, 0xB9, 0x2F, 0x0C, // 83:2489
-    0x09, 0xE8, 0x26, 0x0B, // 84:2536
-    0x0A, 0x0E, 0x3B, 0x10, // 85:2574
-    0x0A, 0x49, 0x42, 0x12, // 86:2633
-    0x0A, 0x8B, 0x5D, 0x18, // 87:2699
-    0x0A, 0xE8, 0x3C, 0x0F, // 88:2792
-    0x0B, 0x24, 0x36, 0x0F, // 89:2852
-    0x0B, 0x5A, 0x30, 0x0C, // 90:2906
-    0x0B, 0x8A, 0x20, 0x09, // 91:2954
-    0x0B, 0xAA, 0x2C, 0x0F, // 92:2986
-    0x0B, 0xD6, 0x17, 0x09, // 93:3030
-    0x0B, 0xED, 0x3B, 0x0F, // 94:3053
-    0x0C, 0x28, 0x34, 0x0D, // 95:3112
-    0x0C, 0x5C, 0x1E, 0x09, // 96:3164
-    0x0C, 0x7A, 0x40, 0x11, // 97:3194
-    0x0C, 0xBA, 0x3F, 0x11, // 98:3258
-    0x0C, 0xF9, 0x3B, 0x10, // 99:3321
-    0x0D, 0x34, 0x40, 0x11, // 100:3380
-    0x0D, 0x74, 0x3B, 0x10, // 101:3444
-    0x0D, 0xAF, 0x1A, 0x08, // 102:3503
-    0x0D, 0xC9, 0x3C, 0x11, // 103:3529
-    0x0E, 0x05, 0x38, 0x0F, // 104:3589
-    0x0E, 0x3D, 0x10, 0x05, // 105:3645
-    0x0E, 0x4D, 0x10, 0x05, // 106:3661
-    0x0E, 0x5D, 0x34, 0x0D, // 107:3677
-    0x0E, 0x91, 0x10, 0x05, // 108:3729
-    0x0E, 0xA1, 0x58, 0x17, // 109:3745
-    0x0E, 0xF9, 0x38, 0x0F, // 110:3833
-    0x0F, 0x31, 0x3B, 0x10, // 111:3889
-    0x0F, 0x6C, 0x3F, 0x11, // 112:3948
-    0x0F, 0xAB, 0x40, 0x11, // 113:4011
-    0x0F, 0xEB, 0x1E, 0x08, // 114:4075
-    0x10, 0x09, 0x23, 0x0A, // 115:4105
-    0x10, 0x2C, 0x1E, 0x08, // 116:4140
-    0x10, 0x4A, 0x38, 0x0F, // 117:4170
-    0x10, 0x82, 0x32, 0x0E, // 118:4226
-    0x10, 0xB4, 0x4E, 0x15, // 119:4276
-    0x11, 0x02, 0x2C, 0x0C, // 120:4354
-    0x11, 0x2E, 0x32, 0x0D, // 121:4398
-    0x11, 0x60, 0x28, 0x0B, // 122:4448
-    0x11, 0x88, 0x1C, 0x09, // 123:4488
-    0x11, 0xA4, 0x28, 0x11, // 124:4516
-    0x11, 0xCC, 0x1B, 0x09, // 125:4556
-    0x11, 0xE7, 0x37, 0x0F, // 126:4583
-    0xFF, 0xFF, 0x00, 0x0D, // 127:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 128:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 129:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 130:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 131:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 132:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 133:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 134:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 135:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 136:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 137:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 138:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 139:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 140:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 141:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 142:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 143:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 144:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 145:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 146:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 147:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 148:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 149:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 150:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 151:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 152:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 153:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 154:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 155:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 156:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 157:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 158:65535
-    0xFF, 0xFF, 0x00, 0x0D, // 159:65535
-    0xFF, 0xFF, 0x00, 0x07, // 160:65535
-    0x12, 0x1E, 0x14, 0x07, // 161:4638
-    0x12, 0x32, 0x2F, 0x0E, // 162:4658
-    0x12, 0x61, 0x37, 0x0E, // 163:4705
-    0x12, 0x98, 0x33, 0x0E, // 164:4760
-    0x12, 0xCB, 0x36, 0x0E, // 165:4811
-    0x13, 0x01, 0x28, 0x11, // 166:4865
-    0x13, 0x29, 0x33, 0x0F, // 167:4905
-    0x13, 0x5C, 0x1A, 0x09, // 168:4956
-    0x13, 0x76, 0x4B, 0x13, // 169:4982
-    0x13, 0xC1, 0x1F, 0x09, // 170:5057
-    0x13, 0xE0, 0x27, 0x0B, // 171:5088
-    0x14, 0x07, 0x37, 0x0F, // 172:5127
-    0x14, 0x3E, 0x1F, 0x08, // 173:5182
-    0x14, 0x5D, 0x4B, 0x13, // 174:5213
-    0x14, 0xA8, 0x26, 0x0C, // 175:5288
-    0x14, 0xCE, 0x22, 0x0A, // 176:5326
-    0x14, 0xF0, 0x38, 0x0F, // 177:5360
-    0x15, 0x28, 0x1F, 0x08, // 178:5416
-    0x15, 0x47, 0x1F, 0x08, // 179:5447
-    0x15, 0x66, 0x19, 0x09, // 180:5478
-    0x15, 0x7F, 0x38, 0x0F, // 181:5503
-    0x15, 0xB7, 0x30, 0x0E, // 182:5559
-    0x15, 0xE7, 0x0F, 0x07, // 183:5607
-    0x15, 0xF6, 0x18, 0x08, // 184:5622
-    0x16, 0x0E, 0x17, 0x08, // 185:5646
-    0x16, 0x25, 0x23, 0x09, // 186:5669
-    0x16, 0x48, 0x27, 0x0B, // 187:5704
-    0x16, 0x6F, 0x4F, 0x15, // 188:5743
-    0x16, 0xBE, 0x54, 0x15, // 189:5822
-    0x17, 0x12, 0x4F, 0x15, // 190:5906
-    0x17, 0x61, 0x34, 0x0F, // 191:5985
-    0x17, 0x95, 0x48, 0x13, // 192:6037
-    0x17, 0xDD, 0x48, 0x13, // 193:6109
-    0x18, 0x25, 0x48, 0x13, // 194:6181
-    0x18, 0x6D, 0x48, 0x13, // 195:6253
-    0x18, 0xB5, 0x48, 0x13, // 196:6325
-    0x18, 0xFD, 0x48, 0x13, // 197:6397
-    0x19, 0x45, 0x60, 0x19, // 198:6469
-    0x19, 0xA5, 0x4B, 0x14, // 199:6565
-    0x19, 0xF0, 0x30, 0x0D, // 200:6640
-    0x1A, 0x20, 0x30, 0x0D, // 201:6688
-    0x1A, 0x50, 0x30, 0x0D, // 202:6736
-    0x1A, 0x80, 0x30, 0x0D, // 203:6784
-    0x1A, 0xB0, 0x15, 0x06, // 204:6832
-    0x1A, 0xC5, 0x15, 0x06, // 205:6853
-    0x1A, 0xDA, 0x15, 0x06, // 206:6874
-    0x1A, 0xEF, 0x15, 0x06, // 207:6895
-    0x1B, 0x04, 0x4B, 0x14, // 208:6916
-    0x1B, 0x4F, 0x44, 0x13, // 209:6991
-    0x1B, 0x93, 0x53, 0x16, // 210:7059
-    0x1B, 0xE6, 0x53, 0x16, // 211:7142
-    0x1C, 0x39, 0x53, 0x16, // 212:7225
-    0x1C, 0x8C, 0x53, 0x16, // 213:7308
-    0x1C, 0xDF, 0x53, 0x16, // 214:7391
-    0x1D, 0x32, 0x37, 0x0F, // 215:7474
-    0x1D, 0x69, 0x53, 0x16, // 216:7529
-    0x1D, 0xBC, 0x3B, 0x10, // 217:7612
-    0x1D, 0xF7, 0x3B, 0x10, // 218:7671
-    0x1E, 0x32, 0x3B, 0x10, // 219:7730
-    0x1E, 0x6D, 0x3B, 0x10, // 220:7789
-    0x1E, 0xA8, 0x36, 0x0F, // 221:7848
-    0x1E, 0xDE, 0x37, 0x0F, // 222:7902
-    0x1F, 0x15, 0x33, 0x0E, // 223:7957
-    0x1F, 0x48, 0x40, 0x11, // 224:8008
-    0x1F, 0x88, 0x40, 0x11, // 225:8072
-    0x1F, 0xC8, 0x40, 0x11, // 226:8136
-    0x20, 0x08, 0x40, 0x11, // 227:8200
-    0x20, 0x48, 0x40, 0x11, // 228:8264
-    0x20, 0x88, 0x40, 0x11, // 229:8328
-    0x20, 0xC8, 0x6F, 0x1D, // 230:8392
-    0x21, 0x37, 0x3B, 0x10, // 231:8503
-    0x21, 0x72, 0x3B, 0x10, // 232:8562
-    0x21, 0xAD, 0x3B, 0x10, // 233:8621
-    0x21, 0xE8, 0x3B, 0x10, // 234:8680
-    0x22, 0x23, 0x3B, 0x10, // 235:8739
-    0x22, 0x5E, 0x12, 0x05, // 236:8798
-    0x22, 0x70, 0x11, 0x05, // 237:8816
-    0x22, 0x81, 0x12, 0x05, // 238:8833
-    0x22, 0x93, 0x12, 0x05, // 239:8851
-    0x22, 0xA5, 0x3B, 0x10, // 240:8869
-    0x22, 0xE0, 0x38, 0x0F, // 241:8928
-    0x23, 0x18, 0x3B, 0x10, // 242:8984
-    0x23, 0x53, 0x3B, 0x10, // 243:9043
-    0x23, 0x8E, 0x3B, 0x10, // 244:9102
-    0x23, 0xC9, 0x3B, 0x10, // 245:9161
-    0x24, 0x04, 0x3B, 0x10, // 246:9220
-    0x24, 0x3F, 0x33, 0x0F, // 247:9279
-    0x24, 0x72, 0x3B, 0x10, // 248:9330
-    0x24, 0xAD, 0x38, 0x0F, // 249:9389
-    0x24, 0xE5, 0x38, 0x0F, // 250:9445
-    0x25, 0x1D, 0x38, 0x0F, // 251:9501
-    0x25, 0x55, 0x38, 0x0F, // 252:9557
-    0x25, 0x8D, 0x32, 0x0D, // 253:9613
-    0x25, 0xBF, 0x3F, 0x11, // 254:9663
-    0x25, 0xFE, 0x32, 0x0D, // 255:9726
-
-    // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xCF, 0x01, 0x80, 0xFF, 0xCF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 33
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 34
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x30, 0xFE, 0x01, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x80, 0x3F, 0x06, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x30, 0x06, 0x01, 0x00, 0x30, 0xFE, 0x01, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x06, 0x00, 0x80, 0x37, 0x06, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                       // 35
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x38, 0x00, 0x80, 0x3F, 0x70, 0x00, 0x80, 0x71, 0x60, 0x00, 0xC0, 0x60, 0xC0, 0x00, 0xF0, 0x40, 0xC0, 0x03, 0xF0, 0xC0, 0xC0, 0x03, 0xC0, 0xC0, 0xC0, 0x00, 0x80, 0x81, 0x61, 0x00, 0x80, 0x87, 0x7F, 0x00, 0x00, 0x06, 0x1E,                                                                                                                                                                                                                                                                                                                                                                                                 // 36
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x73, 0x00, 0x00, 0x80, 0x61, 0x00, 0x00, 0x80, 0x61, 0x00, 0x00, 0x80, 0x61, 0x80, 0x01, 0x80, 0x73, 0xE0, 0x00, 0x00, 0x3F, 0x38, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x3C, 0xFE, 0x00, 0x00, 0x0F, 0xC6, 0x01, 0x80, 0x03, 0x83, 0x01, 0x80, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C,                                                                                                                                                                                                                         // 37
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x9E, 0xC1, 0x00, 0x00, 0xBF, 0x81, 0x01, 0x80, 0xF3, 0x80, 0x01, 0x80, 0xE1, 0x80, 0x01, 0x80, 0xC1, 0x81, 0x01, 0x80, 0xE1, 0xC3, 0x01, 0x80, 0x33, 0xC3, 0x00, 0x00, 0x3F, 0x76, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x37, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x00, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x80,                                                                                                                                                                                                                         // 38
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 39
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x78, 0xE0, 0x01, 0x00, 0x0E, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x08,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 40
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x80, 0x03, 0x00, 0x7C, 0xE0, 0x01, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 41
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x1B, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00, 0x00, 0x02,                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 42
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                 // 43
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 44
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 45
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 46
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80,                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 47
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFC, 0x3F,                                                                                                                                                                                                                                                                                                                                                                         // 48
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 49
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x1E, 0xC0, 0x01, 0x00, 0x07, 0xE0, 0x01, 0x00, 0x03, 0xB0, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x8E, 0x01, 0x80, 0x01, 0x86, 0x01, 0x80, 0x03, 0x83, 0x01, 0x00, 0xC7, 0x81, 0x01, 0x00, 0xFE, 0x80, 0x01, 0x00, 0x3C, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                   // 50
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x41, 0x80, 0x01, 0x80, 0x41, 0x80, 0x01, 0x80, 0xE1, 0x80, 0x01, 0x80, 0xE3, 0xC0, 0x01, 0x00, 0xBF, 0xE1, 0x00, 0x00, 0x9E, 0x7F, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                                                                                                                 // 51
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0xC0, 0x31, 0x00, 0x00, 0xE0, 0x30, 0x00, 0x00, 0x70, 0x30, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x80, 0x03, 0x30, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                 // 52
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x38, 0x00, 0x00, 0xFE, 0x70, 0x00, 0x80, 0x7F, 0xC0, 0x00, 0x80, 0x21, 0xC0, 0x01, 0x80, 0x31, 0x80, 0x01, 0x80, 0x31, 0x80, 0x01, 0x80, 0x31, 0x80, 0x01, 0x80, 0x31, 0x80, 0x01, 0x80, 0x61, 0xC0, 0x00, 0x80, 0xE1, 0xE0, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                         // 53
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x78, 0xC0, 0x00, 0x00, 0x3C, 0x80, 0x01, 0x00, 0x37, 0x80, 0x01, 0x80, 0x33, 0x80, 0x01, 0x80, 0x30, 0x80, 0x01, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                         // 54
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xE0, 0x01, 0x80, 0x01, 0x78, 0x00, 0x80, 0x01, 0x1E, 0x00, 0x80, 0x81, 0x07, 0x00, 0x80, 0xE1, 0x01, 0x00, 0x80, 0x79, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x80, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                       // 55
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x7F, 0x00, 0x00, 0xBF, 0xE3, 0x00, 0x00, 0xE3, 0xC1, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x00, 0xE3, 0xC1, 0x01, 0x00, 0xBF, 0xE3, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                                                                                         // 56
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x87, 0x03, 0x00, 0x00, 0x03, 0x07, 0x00, 0x80, 0x01, 0x06, 0x01, 0x80, 0x01, 0xC6, 0x01, 0x80, 0x01, 0xF6, 0x00, 0x80, 0x01, 0x3E, 0x00, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x87, 0x07, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC,                                                                                                                                                                                                                                                                                                                                                                               // 57
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC0, 0x01, 0x00, 0x70, 0xC0, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 58
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x03, 0x00, 0x70, 0xE0, 0x01, 0x00, 0x70, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 59
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0xC0,                                                                                                                                                                                                                                                                                                                                                 // 60
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18,                                                                                                                                                                                                                                                                                                                                                 // 61
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                 // 62
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0xCC, 0x01, 0x80, 0x01, 0xCE, 0x01, 0x80, 0x01, 0x07, 0x00, 0x80, 0x83, 0x01, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3C,                                                                                                                                                                                                                                                                                                                                                                               // 63
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x86, 0x67, 0x00, 0x00, 0xE2, 0xCF, 0x00, 0x00, 0x71, 0x9C, 0x00, 0x00, 0x39, 0x98, 0x01, 0x80, 0x1C, 0x18, 0x01, 0x80, 0x0C, 0x08, 0x01, 0x80, 0x0C, 0x0C, 0x01, 0x80, 0x0C, 0x0E, 0x01, 0x80, 0xD8, 0x1F, 0x01, 0x80, 0xF0, 0x98, 0x01, 0x00, 0x1D, 0x98, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x03, 0x6E, 0x00, 0x00, 0x0E, 0x07, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0x01,                                                                                                                                                                         // 64
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x1E, 0x06, 0x00, 0x80, 0x07, 0x06, 0x00, 0x80, 0x03, 0x06, 0x00, 0x80, 0x0F, 0x06, 0x00, 0x00, 0x3C, 0x06, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 65
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x00, 0xE3, 0xC1, 0x01, 0x00, 0xBF, 0xE3, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                                                                 // 66
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x04, 0x10,                                                                                                                                                                                                                         // 67
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                                                                                                 // 68
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 69
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x81, 0x01, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                       // 70
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x83, 0x01, 0x80, 0x01, 0x83, 0x01, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x07, 0x63, 0x00, 0x00, 0x0E, 0x73, 0x00, 0x00, 0x0C, 0x3F, 0x00, 0x00, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                         // 71
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                   // 72
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 73
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 74
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x18, 0x1C, 0x00, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                           // 75
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 76
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                   // 77
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                   // 78
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 79
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x00, 0x80, 0x83, 0x03, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x7C,                                                                                                                                                                                                                                                                                                                                                       // 80
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x76, 0x00, 0x00, 0x07, 0xE6, 0x00, 0x00, 0x03, 0xC6, 0x00, 0x00, 0x03, 0xC6, 0x00, 0x80, 0x01, 0x86, 0x01, 0x80, 0x01, 0x86, 0x01, 0x80, 0x01, 0x8E, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x98, 0x01, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x1C, 0xF8, 0x01, 0x00, 0xF8, 0x9F, 0x01, 0x00, 0xE0, 0x87, 0x01,                                                                                                                                                                   // 81
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x02, 0x00, 0x80, 0x01, 0x0E, 0x00, 0x80, 0x01, 0x1E, 0x00, 0x80, 0x01, 0x3A, 0x00, 0x80, 0x03, 0xE3, 0x00, 0x00, 0x87, 0xC3, 0x01, 0x00, 0xFE, 0x81, 0x01, 0x00, 0x7C,                                                                                                                                                                                                                                                                                                                                                       // 82
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x38, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x63, 0xC0, 0x00, 0x80, 0xC1, 0x80, 0x01, 0x80, 0x81, 0x80, 0x01, 0x80, 0x81, 0x80, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x03, 0xC1, 0x01, 0x00, 0x07, 0xE3, 0x00, 0x00, 0x07, 0x7E, 0x00, 0x00, 0x06, 0x3C,                                                                                                                                                                                                                                                                                                                                                                                                 // 83
-    0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 84
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                         // 85
-    0x80, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                               // 86
-    0x80, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80,                                                                                                             // 87
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0x70, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x0E, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x0F, 0x70, 0x00, 0x80, 0x03, 0xE0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                   // 88
-    0x80, 0x01, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                       // 89
-    0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0xE0, 0x01, 0x80, 0x01, 0xF0, 0x01, 0x80, 0x01, 0xBC, 0x01, 0x80, 0x01, 0x8E, 0x01, 0x80, 0x81, 0x83, 0x01, 0x80, 0xC1, 0x81, 0x01, 0x80, 0x71, 0x80, 0x01, 0x80, 0x39, 0x80, 0x01, 0x80, 0x0F, 0x80, 0x01, 0x80, 0x07, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 90
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x0C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 91
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                   // 92
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0xFC, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 93
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                         // 94
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,                                                                                                                                                                                                                                                                                                                                                                   // 95
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 96
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 97
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                 // 98
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0xC0, 0x20,                                                                                                                                                                                                                                                                                                                         // 99
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 100
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x66, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x38, 0x86, 0x01, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x77, 0x00, 0x00, 0x80, 0x17,                                                                                                                                                                                                                                                                                                                         // 101
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x80, 0x19, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x80, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 102
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x06, 0x00, 0xE0, 0x70, 0x0E, 0x00, 0x30, 0xC0, 0x18, 0x00, 0x38, 0xC0, 0x39, 0x00, 0x18, 0x80, 0x31, 0x00, 0x18, 0x80, 0x31, 0x00, 0x18, 0x80, 0x31, 0x00, 0x18, 0x80, 0x31, 0x00, 0x30, 0xC0, 0x30, 0x00, 0x30, 0xC0, 0x18, 0x00, 0xE0, 0x70, 0x1C, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x03,                                                                                                                                                                                                                                                                                                                   // 103
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 104
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFB, 0xFF, 0x01, 0x80, 0xFB, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 105
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x80, 0xFB, 0xFF, 0x1F, 0x80, 0xFB, 0xFF, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 106
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x31, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                                                   // 107
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 108
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                                           // 109
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 110
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 111
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                 // 112
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                           // 113
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 114
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0xF0, 0xE1, 0x00, 0x00, 0x38, 0xC3, 0x01, 0x00, 0x18, 0x82, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x38, 0xC4, 0x01, 0x00, 0x70, 0xFC, 0x00, 0x00, 0x60, 0x78,                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 115
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 116
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 117
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                               // 118
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x38,                                                                                                                                                                                                       // 119
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xC0, 0x39, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x39, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x18, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                   // 120
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x07, 0x20, 0x00, 0x00, 0x3E, 0x38, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                               // 121
-    0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0xE0, 0x01, 0x00, 0x18, 0xF0, 0x01, 0x00, 0x18, 0xB8, 0x01, 0x00, 0x18, 0x8E, 0x01, 0x00, 0x18, 0x87, 0x01, 0x00, 0x98, 0x81, 0x01, 0x00, 0xF8, 0x80, 0x01, 0x00, 0x78, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 122
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFD, 0x07, 0x80, 0xFF, 0xF9, 0x0F, 0x80, 0x01, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 124
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x0C, 0x80, 0xFF, 0xF9, 0x0F, 0x00, 0xFF, 0xFD, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 125
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                                 // 126
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0x3F, 0x00, 0x38, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 161
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x06, 0x18, 0x00, 0x80, 0x07, 0x78, 0x00, 0x80, 0x07, 0x78, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x18, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                 // 162
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x80, 0x01, 0x00, 0xFE, 0x80, 0x01, 0x00, 0xC7, 0x81, 0x01, 0x80, 0xC3, 0xC3, 0x01, 0x80, 0xC1, 0xFF, 0x01, 0x80, 0xC1, 0xBC, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC3, 0x80, 0x01, 0x00, 0xC3, 0xC0, 0x01, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0C, 0x7C,                                                                                                                                                                                                                                                                                                                                                 // 163
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x4F, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x90, 0x4F,                                                                                                                                                                                                                                                                                                                                                                         // 164
-    0x80, 0x01, 0x00, 0x00, 0x80, 0x63, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0x7C, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x80, 0x63, 0x06, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                       // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0xFC, 0x01, 0x80, 0x3F, 0xFC, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 166
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x03, 0x00, 0xDE, 0x0F, 0x07, 0x00, 0x7F, 0x0C, 0x0E, 0x80, 0x73, 0x18, 0x1C, 0x80, 0x61, 0x18, 0x18, 0x80, 0xC1, 0x30, 0x18, 0x80, 0xC1, 0x30, 0x18, 0x00, 0x87, 0x61, 0x0C, 0x00, 0x87, 0xF1, 0x0F, 0x00, 0x04, 0x9F, 0x07, 0x00, 0x00, 0x0E,                                                                                                                                                                                                                                                                                                                                                                         // 167
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 168
-    0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0xE3, 0xC3, 0x00, 0x00, 0xF1, 0x87, 0x00, 0x80, 0x39, 0x8E, 0x01, 0x80, 0x1C, 0x1C, 0x01, 0x80, 0x0C, 0x18, 0x01, 0x80, 0x0C, 0x18, 0x01, 0x80, 0x0C, 0x18, 0x01, 0x80, 0x0C, 0x18, 0x01, 0x80, 0x19, 0x8C, 0x01, 0x00, 0x11, 0x84, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                                                                         // 169
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x80, 0xB9, 0x01, 0x00, 0x80, 0xB0, 0x01, 0x00, 0x80, 0xB0, 0x01, 0x00, 0x00, 0x99, 0x01, 0x00, 0x80, 0xBF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 170
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x3D, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x20, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 171
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                                                                                                                 // 172
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 173
-    0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xFD, 0x9F, 0x01, 0x80, 0xFC, 0x1F, 0x01, 0x80, 0x0C, 0x01, 0x01, 0x80, 0x0C, 0x03, 0x01, 0x80, 0x0C, 0x0F, 0x01, 0x80, 0x9C, 0x1D, 0x01, 0x80, 0xF9, 0x99, 0x01, 0x00, 0xF1, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                                                                         // 174
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 175
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x80, 0xE3, 0x00, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x80, 0xE3, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 176
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0xF8, 0xBF, 0x01, 0x00, 0xF8, 0xBF, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x83, 0x01,                                                                                                                                                                                                                                                                                                                                           // 177
-    0x00, 0x06, 0x03, 0x00, 0x00, 0x83, 0x03, 0x00, 0x80, 0xC0, 0x03, 0x00, 0x80, 0x60, 0x03, 0x00, 0x80, 0x30, 0x03, 0x00, 0x80, 0x19, 0x03, 0x00, 0x00, 0x1F, 0x03, 0x00, 0x00, 0x0E, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 178
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x80, 0x08, 0x03, 0x00, 0x80, 0x08, 0x03, 0x00, 0x80, 0x0C, 0x03, 0x00, 0x80, 0x9F, 0x03, 0x00, 0x00, 0xF7, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 179
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 180
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 181
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x80, 0xFF, 0xFF, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x80, 0xFF, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                           // 182
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 183
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 184
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 185
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x80, 0xB9, 0x01, 0x00, 0x80, 0xB0, 0x01, 0x00, 0x80, 0xB0, 0x01, 0x00, 0x80, 0xB9, 0x01, 0x00, 0x00, 0x9F, 0x01, 0x00, 0x00, 0x8E, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 186
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x02,                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 187
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x80, 0x03, 0x7C, 0x00, 0x80, 0x00, 0x66, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x60,                                                                                                                                                                                                 // 188
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x87, 0x83, 0x01, 0x80, 0xC1, 0x81, 0x01, 0x00, 0x60, 0xC0, 0x01, 0x00, 0x60, 0x60, 0x01, 0x00, 0x60, 0x30, 0x01, 0x00, 0xE0, 0x18, 0x01, 0x00, 0xC0, 0x0F, 0x01, 0x00, 0x80, 0x07, 0x01,                                                                                                                                                                   // 189
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x80, 0x08, 0x03, 0x00, 0x80, 0x08, 0x03, 0x00, 0x80, 0x0C, 0x03, 0x00, 0x80, 0x9F, 0x03, 0x00, 0x00, 0xF7, 0xC1, 0x01, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x38, 0x60, 0x00, 0x00, 0x0E, 0x78, 0x00, 0x80, 0x03, 0x6E, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xC0, 0x60, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x60,                                                                                                                                                                                                 // 190
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x38, 0x0F, 0x30, 0x00, 0x38, 0x03, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                                   // 191
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x04, 0x78, 0x06, 0x00, 0x0C, 0x1E, 0x06, 0x00, 0x98, 0x07, 0x06, 0x00, 0x98, 0x03, 0x06, 0x00, 0xB0, 0x0F, 0x06, 0x00, 0x00, 0x3C, 0x06, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 192
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x06, 0x00, 0x10, 0x1E, 0x06, 0x00, 0x90, 0x07, 0x06, 0x00, 0x98, 0x03, 0x06, 0x00, 0x8C, 0x0F, 0x06, 0x00, 0x0C, 0x3C, 0x06, 0x00, 0x04, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 193
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x20, 0xE0, 0x07, 0x00, 0x10, 0x78, 0x06, 0x00, 0x18, 0x1E, 0x06, 0x00, 0x8C, 0x07, 0x06, 0x00, 0x8C, 0x03, 0x06, 0x00, 0x98, 0x0F, 0x06, 0x00, 0x18, 0x3C, 0x06, 0x00, 0x10, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 194
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x18, 0x78, 0x06, 0x00, 0x0C, 0x1E, 0x06, 0x00, 0x8C, 0x07, 0x06, 0x00, 0x98, 0x03, 0x06, 0x00, 0x98, 0x0F, 0x06, 0x00, 0x1C, 0x3C, 0x06, 0x00, 0x08, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 195
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x06, 0x00, 0x1C, 0x1E, 0x06, 0x00, 0x9C, 0x07, 0x06, 0x00, 0x80, 0x01, 0x06, 0x00, 0x9C, 0x07, 0x06, 0x00, 0x1C, 0x3E, 0x06, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                           // 196
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x3C, 0x06, 0x00, 0x1C, 0x0F, 0x06, 0x00, 0x92, 0x03, 0x06, 0x00, 0x92, 0x03, 0x06, 0x00, 0x0E, 0x0F, 0x06, 0x00, 0x00, 0x7C, 0x06, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                           // 197
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xE0, 0x06, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x1C, 0x06, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x80, 0x03, 0x06, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                           // 198
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x03, 0x80, 0x00, 0x80, 0x01, 0x80, 0x11, 0x80, 0x01, 0x80, 0x75, 0x80, 0x01, 0x80, 0x67, 0x80, 0x01, 0x80, 0x65, 0x80, 0x01, 0x80, 0x39, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x04, 0x10,                                                                                                                                                                                                                         // 199
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0xB0, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 200
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x81, 0x81, 0x01, 0x90, 0x81, 0x81, 0x01, 0x90, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x84, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 201
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0xA0, 0xFF, 0xFF, 0x01, 0x90, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x8C, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0x98, 0x81, 0x81, 0x01, 0x90, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 202
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x9C, 0x81, 0x81, 0x01, 0x9C, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x9C, 0x81, 0x81, 0x01, 0x9C, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01, 0x80, 0x81, 0x81, 0x01,                                                                                                                                                                                                                                                                                                                                                                                           // 203
-    0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x01, 0x98, 0xFF, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 204
-    0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0x01, 0x8C, 0xFF, 0xFF, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x04,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 205
-    0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x01, 0x8C, 0xFF, 0xFF, 0x01, 0x18, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 206
-    0x1C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x1C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 207
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                                                                         // 208
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x1C, 0x00, 0x00, 0x0C, 0x38, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x0C, 0xC0, 0x01, 0x00, 0x18, 0x80, 0x07, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                   // 209
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x8C, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0xB0, 0x01, 0x80, 0x01, 0xB0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 210
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x90, 0x01, 0x80, 0x01, 0xB0, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 211
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x03, 0xC0, 0x00, 0xB0, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x88, 0x01, 0x80, 0x01, 0x88, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0xB0, 0x01, 0x80, 0x01, 0x20, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 212
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x98, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x98, 0x01, 0x80, 0x01, 0x9C, 0x01, 0x80, 0x01, 0x08, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 213
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x9C, 0x01, 0x80, 0x01, 0x9C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x9C, 0x01, 0x80, 0x01, 0x9C, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 214
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x10, 0x40,                                                                                                                                                                                                                                                                                                                                                 // 215
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x0F, 0x02, 0x00, 0x3C, 0x3C, 0x07, 0x00, 0x0E, 0xF0, 0x01, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD8, 0x00, 0x80, 0x01, 0x8C, 0x01, 0x80, 0x01, 0x86, 0x01, 0x80, 0x81, 0x83, 0x01, 0x80, 0xC1, 0x81, 0x01, 0x80, 0xE1, 0x80, 0x01, 0x80, 0x31, 0x80, 0x01, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x80, 0x0F, 0x70, 0x00, 0xE0, 0x1C, 0x38, 0x00, 0x40, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                         // 216
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x04, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x80, 0x01, 0x08, 0x00, 0x80, 0x01, 0x18, 0x00, 0x80, 0x01, 0x30, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                         // 217
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x30, 0x00, 0x80, 0x01, 0x18, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x01, 0x04, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                         // 218
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x10, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x01, 0x0C, 0x00, 0x80, 0x01, 0x18, 0x00, 0x80, 0x01, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                         // 219
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x1C, 0x00, 0x80, 0x01, 0x1C, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x1C, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x1F,                                                                                                                                                                                                                                                                                                                         // 220
-    0x80, 0x01, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x10, 0xC0, 0x03, 0x00, 0x18, 0x00, 0xFF, 0x01, 0x18, 0x00, 0xFF, 0x01, 0x0C, 0xC0, 0x03, 0x00, 0x0C, 0xF0, 0x00, 0x00, 0x04, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                       // 221
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xE0, 0x03,                                                                                                                                                                                                                                                                                                                                                 // 222
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x03, 0x78, 0x00, 0x80, 0x01, 0xF0, 0x00, 0x80, 0xC1, 0xC0, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x01, 0x00, 0xE3, 0xC1, 0x01, 0x00, 0xBF, 0xE3, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                                                                                         // 223
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0xC0, 0x18, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x00, 0x19, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 224
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0xC0, 0x30, 0xC0, 0x00, 0x40, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 225
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x32, 0xC0, 0x00, 0x00, 0x1B, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x18, 0x80, 0x01, 0x80, 0x18, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x00, 0x33, 0xC0, 0x00, 0x00, 0x72, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 226
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x80, 0x30, 0xC0, 0x00, 0xC0, 0x19, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0xC0, 0x31, 0xC0, 0x00, 0x80, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 227
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x80, 0x1B, 0x80, 0x01, 0x80, 0x1B, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x80, 0x1B, 0x80, 0x01, 0x80, 0x33, 0xC0, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 228
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0xC0, 0x19, 0x80, 0x01, 0x20, 0x1A, 0x80, 0x01, 0x20, 0x1A, 0x80, 0x01, 0xC0, 0x19, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                           // 229
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x30, 0xE0, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xE0, 0x76, 0x00, 0x00, 0x70, 0xC6, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x76, 0x00, 0x00, 0xC0, 0x37, // 230
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0x30, 0x80, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x6D, 0x00, 0x18, 0x80, 0x47, 0x00, 0x18, 0x80, 0x45, 0x00, 0x18, 0x80, 0x39, 0x00, 0x30, 0x80, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0xC0, 0x20,                                                                                                                                                                                                                                                                                                                         // 231
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x66, 0x00, 0x00, 0x30, 0xC6, 0x00, 0xC0, 0x30, 0xC6, 0x00, 0xC0, 0x18, 0x86, 0x01, 0x80, 0x19, 0x86, 0x01, 0x80, 0x19, 0x86, 0x01, 0x00, 0x1B, 0x86, 0x01, 0x00, 0x38, 0x86, 0x01, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x77, 0x00, 0x00, 0x80, 0x17,                                                                                                                                                                                                                                                                                                                         // 232
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x66, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x19, 0x86, 0x01, 0x00, 0x19, 0x86, 0x01, 0x80, 0x19, 0x86, 0x01, 0xC0, 0x18, 0x86, 0x01, 0xC0, 0x38, 0x86, 0x01, 0x40, 0x30, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x77, 0x00, 0x00, 0x80, 0x17,                                                                                                                                                                                                                                                                                                                         // 233
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x66, 0x00, 0x00, 0x32, 0xC6, 0x00, 0x00, 0x33, 0xC6, 0x00, 0x00, 0x19, 0x86, 0x01, 0x80, 0x19, 0x86, 0x01, 0x80, 0x18, 0x86, 0x01, 0x80, 0x19, 0x86, 0x01, 0x00, 0x3B, 0x86, 0x01, 0x00, 0x32, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x77, 0x00, 0x00, 0x80, 0x17,                                                                                                                                                                                                                                                                                                                         // 234
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x66, 0x00, 0x00, 0x30, 0xC6, 0x00, 0x80, 0x3B, 0xC6, 0x01, 0x80, 0x1B, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x00, 0x18, 0x86, 0x01, 0x80, 0x1B, 0x86, 0x01, 0x80, 0x3B, 0x86, 0x01, 0x00, 0x30, 0xC6, 0x00, 0x00, 0x70, 0xE6, 0x00, 0x00, 0xE0, 0x77, 0x00, 0x00, 0x80, 0x17,                                                                                                                                                                                                                                                                                                                         // 235
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFF, 0x01, 0x80, 0xF9, 0xFF, 0x01, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 236
-    0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0xF9, 0xFF, 0x01, 0xC0, 0xF8, 0xFF, 0x01, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 237
-    0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0xF8, 0xFF, 0x01, 0x80, 0xF8, 0xFF, 0x01, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 238
-    0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x80, 0xFB, 0xFF, 0x01, 0x80, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 239
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x80, 0x3A, 0xC0, 0x01, 0x80, 0x1A, 0x80, 0x01, 0x80, 0x1B, 0x80, 0x01, 0x00, 0x1B, 0x80, 0x01, 0x80, 0x1F, 0x80, 0x01, 0x80, 0x3C, 0xC0, 0x01, 0x00, 0x38, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 240
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01, 0x80, 0x60, 0x00, 0x00, 0xC0, 0x31, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 241
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0xC0, 0x38, 0xC0, 0x01, 0xC0, 0x18, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x00, 0x19, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 242
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0xC0, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 243
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x32, 0xC0, 0x00, 0x00, 0x3B, 0xC0, 0x01, 0x00, 0x19, 0x80, 0x01, 0x80, 0x18, 0x80, 0x01, 0x80, 0x18, 0x80, 0x01, 0x00, 0x19, 0x80, 0x01, 0x00, 0x3B, 0xC0, 0x01, 0x00, 0x32, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 244
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x80, 0x39, 0xC0, 0x01, 0xC0, 0x18, 0x80, 0x01, 0xC0, 0x18, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0x80, 0x19, 0x80, 0x01, 0xC0, 0x39, 0xC0, 0x01, 0x80, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 245
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x80, 0x3B, 0xC0, 0x01, 0x80, 0x1B, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x80, 0x1B, 0x80, 0x01, 0x80, 0x3B, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 246
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0x33, 0x00, 0x00, 0x60, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                                         // 247
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x3F, 0x01, 0x00, 0xE0, 0xF0, 0x01, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0x18, 0x98, 0x01, 0x00, 0x18, 0x8E, 0x01, 0x00, 0x18, 0x87, 0x01, 0x00, 0x98, 0x81, 0x01, 0x00, 0xF0, 0xC0, 0x01, 0x00, 0x70, 0xC0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0xC8, 0x7F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                                         // 248
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 249
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x01, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 250
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 251
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0xF8, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 252
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x07, 0x20, 0x00, 0x00, 0x3E, 0x38, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x01, 0xC0, 0x07, 0xC0, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x3C, 0x00, 0x60, 0x80, 0x0F, 0x00, 0x40, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                               // 253
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x18, 0x80, 0x01, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x80, 0x1F,                                                                                                                                                                                                                                                                                                 // 254
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x03, 0x3E, 0x38, 0x80, 0x03, 0xF8, 0x3E, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x7C, 0x00, 0x80, 0x03, 0x0F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18                                                                                                                                                                                                                                                                                                                                                                                // 255
-};
-
+// Font for the current settings screen (OLEDMenuImplementation.cpp), the menu's others are in OLEDMenuFonts.h
 const uint8_t URW_Gothic_L_Book_20[] PROGMEM = {
     0x17, // Width: 23
     0x19, // Height: 25
@@ -1269,1837 +422,3 @@ const uint8_t URW_Gothic_L_Book_20[] PROGMEM = {
     0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xF0, 0x01,                                                                                                                                                                                                                                                 // 254
     0x00, 0x02, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0xC0, 0xE7, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0xE0, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02                                                                                                                                                                                                                                                                                                        // 255
 };
-
-#define FONT_LIB_V3
-
-const uint8_t Open_Sans_Regular_20[] PROGMEM = {
-    0x13, // Width: 19
-    0x1C, // Height: 28
-    0x20, // First Char: 32
-    0xE0, // Numbers of Chars: 224
-
-    // Jump Table:
-    0xFF, 0xFF, 0x00, 0x05, // 32:65535
-    0x00, 0x00, 0x0F, 0x05, // 33:0
-    0x00, 0x0F, 0x1A, 0x08, // 34:15
-    0x00, 0x29, 0x2F, 0x0D, // 35:41
-    0x00, 0x58, 0x27, 0x0B, // 36:88
-    0x00, 0x7F, 0x3B, 0x10, // 37:127
-    0x00, 0xBA, 0x37, 0x0F, // 38:186
-    0x00, 0xF1, 0x0A, 0x04, // 39:241
-    0x00, 0xFB, 0x14, 0x06, // 40:251
-    0x01, 0x0F, 0x13, 0x06, // 41:271
-    0x01, 0x22, 0x26, 0x0B, // 42:290
-    0x01, 0x48, 0x26, 0x0B, // 43:328
-    0x01, 0x6E, 0x0F, 0x05, // 44:366
-    0x01, 0x7D, 0x13, 0x06, // 45:381
-    0x01, 0x90, 0x0F, 0x05, // 46:400
-    0x01, 0x9F, 0x1A, 0x07, // 47:415
-    0x01, 0xB9, 0x27, 0x0B, // 48:441
-    0x01, 0xE0, 0x1B, 0x0B, // 49:480
-    0x01, 0xFB, 0x27, 0x0B, // 50:507
-    0x02, 0x22, 0x27, 0x0B, // 51:546
-    0x02, 0x49, 0x2B, 0x0B, // 52:585
-    0x02, 0x74, 0x27, 0x0B, // 53:628
-    0x02, 0x9B, 0x27, 0x0B, // 54:667
-    0x02, 0xC2, 0x26, 0x0B, // 55:706
-    0x02, 0xE8, 0x27, 0x0B, // 56:744
-    0x03, 0x0F, 0x27, 0x0B, // 57:783
-    0x03, 0x36, 0x0F, 0x05, // 58:822
-    0x03, 0x45, 0x0E, 0x05, // 59:837
-    0x03, 0x53, 0x27, 0x0B, // 60:851
-    0x03, 0x7A, 0x27, 0x0B, // 61:890
-    0x03, 0xA1, 0x26, 0x0B, // 62:929
-    0x03, 0xC7, 0x1E, 0x09, // 63:967
-    0x03, 0xE5, 0x43, 0x12, // 64:997
-    0x04, 0x28, 0x33, 0x0D, // 65:1064
-    0x04, 0x5B, 0x2F, 0x0D, // 66:1115
-    0x04, 0x8A, 0x2F, 0x0D, // 67:1162
-    0x04, 0xB9, 0x37, 0x0F, // 68:1209
-    0x04, 0xF0, 0x27, 0x0B, // 69:1264
-    0x05, 0x17, 0x26, 0x0A, // 70:1303
-    0x05, 0x3D, 0x33, 0x0F, // 71:1341
-    0x05, 0x70, 0x33, 0x0F, // 72:1392
-    0x05, 0xA3, 0x0F, 0x06, // 73:1443
-    0x05, 0xB2, 0x0C, 0x05, // 74:1458
-    0x05, 0xBE, 0x2F, 0x0C, // 75:1470
-    0x05, 0xED, 0x27, 0x0A, // 76:1517
-    0x06, 0x14, 0x3F, 0x12, // 77:1556
-    0x06, 0x53, 0x33, 0x0F, // 78:1619
-    0x06, 0x86, 0x3B, 0x10, // 79:1670
-    0x06, 0xC1, 0x2A, 0x0C, // 80:1729
-    0x06, 0xEB, 0x3B, 0x10, // 81:1771
-    0x07, 0x26, 0x2B, 0x0C, // 82:1830
-    0x07, 0x51, 0x27, 0x0B, // 83:1873
-    0x07, 0x78, 0x2A, 0x0B, // 84:1912
-    0x07, 0xA2, 0x33, 0x0F, // 85:1954
-    0x07, 0xD5, 0x2E, 0x0C, // 86:2005
-    0x08, 0x03, 0x4A, 0x13, // 87:2051
-    0x08, 0x4D, 0x2F, 0x0C, // 88:2125
-    0x08, 0x7C, 0x2A, 0x0B, // 89:2172
-    0x08, 0xA6, 0x27, 0x0B, // 90:2214
-    0x08, 0xCD, 0x18, 0x07, // 91:2253
-    0x08, 0xE5, 0x1B, 0x07, // 92:2277
-    0x09, 0x00, 0x14, 0x07, // 93:2304
-    0x09, 0x14, 0x27, 0x0B, // 94:2324
-    0x09, 0x3B, 0x24, 0x09, // 95:2363
-    0x09, 0x5F, 0x1E, 0x0C, // 96:2399
-    0x09, 0x7D, 0x23, 0x0B, // 97:2429
-    0x09, 0xA0, 0x2B, 0x0C, // 98:2464
-    0x09, 0xCB, 0x23, 0x0A, // 99:2507
-    0x09, 0xEE, 0x27, 0x0C, // 100:2542
-    0x0A, 0x15, 0x27, 0x0B, // 101:2581
-    0x0A, 0x3C, 0x1A, 0x07, // 102:2620
-    0x0A, 0x56, 0x2A, 0x0B, // 103:2646
-    0x0A, 0x80, 0x27, 0x0C, // 104:2688
-    0x0A, 0xA7, 0x0B, 0x05, // 105:2727
-    0x0A, 0xB2, 0x0C, 0x05, // 106:2738
-    0x0A, 0xBE, 0x27, 0x0B, // 107:2750
-    0x0A, 0xE5, 0x0B, 0x05, // 108:2789
-    0x0A, 0xF0, 0x43, 0x13, // 109:2800
-    0x0B, 0x33, 0x27, 0x0C, // 110:2867
-    0x0B, 0x5A, 0x2B, 0x0C, // 111:2906
-    0x0B, 0x85, 0x2B, 0x0C, // 112:2949
-    0x0B, 0xB0, 0x28, 0x0C, // 113:2992
-    0x0B, 0xD8, 0x1E, 0x08, // 114:3032
-    0x0B, 0xF6, 0x23, 0x0A, // 115:3062
-    0x0C, 0x19, 0x1B, 0x07, // 116:3097
-    0x0C, 0x34, 0x27, 0x0C, // 117:3124
-    0x0C, 0x5B, 0x26, 0x0A, // 118:3163
-    0x0C, 0x81, 0x3E, 0x10, // 119:3201
-    0x0C, 0xBF, 0x23, 0x0A, // 120:3263
-    0x0C, 0xE2, 0x26, 0x0A, // 121:3298
-    0x0D, 0x08, 0x1F, 0x09, // 122:3336
-    0x0D, 0x27, 0x1C, 0x08, // 123:3367
-    0x0D, 0x43, 0x18, 0x0B, // 124:3395
-    0x0D, 0x5B, 0x1B, 0x08, // 125:3419
-    0x0D, 0x76, 0x26, 0x0B, // 126:3446
-    0x0D, 0x9C, 0x27, 0x0C, // 127:3484
-    0x0D, 0xC3, 0x27, 0x0C, // 128:3523
-    0x0D, 0xEA, 0x27, 0x0C, // 129:3562
-    0x0E, 0x11, 0x27, 0x0C, // 130:3601
-    0x0E, 0x38, 0x27, 0x0C, // 131:3640
-    0x0E, 0x5F, 0x27, 0x0C, // 132:3679
-    0x0E, 0x86, 0x27, 0x0C, // 133:3718
-    0x0E, 0xAD, 0x27, 0x0C, // 134:3757
-    0x0E, 0xD4, 0x27, 0x0C, // 135:3796
-    0x0E, 0xFB, 0x27, 0x0C, // 136:3835
-    0x0F, 0x22, 0x27, 0x0C, // 137:3874
-    0x0F, 0x49, 0x27, 0x0C, // 138:3913
-    0x0F, 0x70, 0x27, 0x0C, // 139:3952
-    0x0F, 0x97, 0x27, 0x0C, // 140:3991
-    0x0F, 0xBE, 0x27, 0x0C, // 141:4030
-    0x0F, 0xE5, 0x27, 0x0C, // 142:4069
-    0x10, 0x0C, 0x27, 0x0C, // 143:4108
-    0x10, 0x33, 0x27, 0x0C, // 144:4147
-    0x10, 0x5A, 0x27, 0x0C, // 145:4186
-    0x10, 0x81, 0x27, 0x0C, // 146:4225
-    0x10, 0xA8, 0x27, 0x0C, // 147:4264
-    0x10, 0xCF, 0x27, 0x0C, // 148:4303
-    0x10, 0xF6, 0x27, 0x0C, // 149:4342
-    0x11, 0x1D, 0x27, 0x0C, // 150:4381
-    0x11, 0x44, 0x27, 0x0C, // 151:4420
-    0x11, 0x6B, 0x27, 0x0C, // 152:4459
-    0x11, 0x92, 0x27, 0x0C, // 153:4498
-    0x11, 0xB9, 0x27, 0x0C, // 154:4537
-    0x11, 0xE0, 0x27, 0x0C, // 155:4576
-    0x12, 0x07, 0x27, 0x0C, // 156:4615
-    0x12, 0x2E, 0x27, 0x0C, // 157:4654
-    0x12, 0x55, 0x27, 0x0C, // 158:4693
-    0x12, 0x7C, 0x27, 0x0C, // 159:4732
-    0xFF, 0xFF, 0x00, 0x05, // 160:65535
-    0x12, 0xA3, 0x10, 0x05, // 161:4771
-    0x12, 0xB3, 0x23, 0x0B, // 162:4787
-    0x12, 0xD6, 0x27, 0x0B, // 163:4822
-    0x12, 0xFD, 0x27, 0x0B, // 164:4861
-    0x13, 0x24, 0x26, 0x0B, // 165:4900
-    0x13, 0x4A, 0x18, 0x0B, // 166:4938
-    0x13, 0x62, 0x23, 0x0A, // 167:4962
-    0x13, 0x85, 0x22, 0x0C, // 168:4997
-    0x13, 0xA7, 0x3F, 0x11, // 169:5031
-    0x13, 0xE6, 0x16, 0x07, // 170:5094
-    0x13, 0xFC, 0x23, 0x0A, // 171:5116
-    0x14, 0x1F, 0x27, 0x0B, // 172:5151
-    0x14, 0x46, 0x13, 0x06, // 173:5190
-    0x14, 0x59, 0x3F, 0x11, // 174:5209
-    0x14, 0x98, 0x25, 0x0A, // 175:5272
-    0x14, 0xBD, 0x1E, 0x09, // 176:5309
-    0x14, 0xDB, 0x27, 0x0B, // 177:5339
-    0x15, 0x02, 0x17, 0x07, // 178:5378
-    0x15, 0x19, 0x16, 0x07, // 179:5401
-    0x15, 0x2F, 0x1D, 0x0C, // 180:5423
-    0x15, 0x4C, 0x27, 0x0C, // 181:5452
-    0x15, 0x73, 0x2C, 0x0D, // 182:5491
-    0x15, 0x9F, 0x0F, 0x05, // 183:5535
-    0x15, 0xAE, 0x14, 0x05, // 184:5550
-    0x15, 0xC2, 0x13, 0x07, // 185:5570
-    0x15, 0xD5, 0x1A, 0x08, // 186:5589
-    0x15, 0xEF, 0x23, 0x0A, // 187:5615
-    0x16, 0x12, 0x3B, 0x10, // 188:5650
-    0x16, 0x4D, 0x37, 0x10, // 189:5709
-    0x16, 0x84, 0x3F, 0x10, // 190:5764
-    0x16, 0xC3, 0x20, 0x09, // 191:5827
-    0x16, 0xE3, 0x33, 0x0D, // 192:5859
-    0x17, 0x16, 0x33, 0x0D, // 193:5910
-    0x17, 0x49, 0x33, 0x0D, // 194:5961
-    0x17, 0x7C, 0x33, 0x0D, // 195:6012
-    0x17, 0xAF, 0x33, 0x0D, // 196:6063
-    0x17, 0xE2, 0x33, 0x0D, // 197:6114
-    0x18, 0x15, 0x3F, 0x11, // 198:6165
-    0x18, 0x54, 0x2F, 0x0D, // 199:6228
-    0x18, 0x83, 0x27, 0x0B, // 200:6275
-    0x18, 0xAA, 0x27, 0x0B, // 201:6314
-    0x18, 0xD1, 0x27, 0x0B, // 202:6353
-    0x18, 0xF8, 0x27, 0x0B, // 203:6392
-    0x19, 0x1F, 0x0F, 0x06, // 204:6431
-    0x19, 0x2E, 0x15, 0x06, // 205:6446
-    0x19, 0x43, 0x15, 0x06, // 206:6467
-    0x19, 0x58, 0x15, 0x06, // 207:6488
-    0x19, 0x6D, 0x33, 0x0E, // 208:6509
-    0x19, 0xA0, 0x33, 0x0F, // 209:6560
-    0x19, 0xD3, 0x3B, 0x10, // 210:6611
-    0x1A, 0x0E, 0x3B, 0x10, // 211:6670
-    0x1A, 0x49, 0x3B, 0x10, // 212:6729
-    0x1A, 0x84, 0x3B, 0x10, // 213:6788
-    0x1A, 0xBF, 0x3B, 0x10, // 214:6847
-    0x1A, 0xFA, 0x23, 0x0B, // 215:6906
-    0x1B, 0x1D, 0x3B, 0x10, // 216:6941
-    0x1B, 0x58, 0x33, 0x0F, // 217:7000
-    0x1B, 0x8B, 0x33, 0x0F, // 218:7051
-    0x1B, 0xBE, 0x33, 0x0F, // 219:7102
-    0x1B, 0xF1, 0x33, 0x0F, // 220:7153
-    0x1C, 0x24, 0x2A, 0x0B, // 221:7204
-    0x1C, 0x4E, 0x2B, 0x0C, // 222:7246
-    0x1C, 0x79, 0x2B, 0x0C, // 223:7289
-    0x1C, 0xA4, 0x23, 0x0B, // 224:7332
-    0x1C, 0xC7, 0x23, 0x0B, // 225:7367
-    0x1C, 0xEA, 0x23, 0x0B, // 226:7402
-    0x1D, 0x0D, 0x23, 0x0B, // 227:7437
-    0x1D, 0x30, 0x23, 0x0B, // 228:7472
-    0x1D, 0x53, 0x23, 0x0B, // 229:7507
-    0x1D, 0x76, 0x3F, 0x11, // 230:7542
-    0x1D, 0xB5, 0x23, 0x0A, // 231:7605
-    0x1D, 0xD8, 0x27, 0x0B, // 232:7640
-    0x1D, 0xFF, 0x27, 0x0B, // 233:7679
-    0x1E, 0x26, 0x27, 0x0B, // 234:7718
-    0x1E, 0x4D, 0x27, 0x0B, // 235:7757
-    0x1E, 0x74, 0x0E, 0x05, // 236:7796
-    0x1E, 0x82, 0x12, 0x05, // 237:7810
-    0x1E, 0x94, 0x12, 0x05, // 238:7828
-    0x1E, 0xA6, 0x12, 0x05, // 239:7846
-    0x1E, 0xB8, 0x2B, 0x0C, // 240:7864
-    0x1E, 0xE3, 0x27, 0x0C, // 241:7907
-    0x1F, 0x0A, 0x2B, 0x0C, // 242:7946
-    0x1F, 0x35, 0x2B, 0x0C, // 243:7989
-    0x1F, 0x60, 0x2B, 0x0C, // 244:8032
-    0x1F, 0x8B, 0x2B, 0x0C, // 245:8075
-    0x1F, 0xB6, 0x2B, 0x0C, // 246:8118
-    0x1F, 0xE1, 0x26, 0x0B, // 247:8161
-    0x20, 0x07, 0x2B, 0x0C, // 248:8199
-    0x20, 0x32, 0x27, 0x0C, // 249:8242
-    0x20, 0x59, 0x27, 0x0C, // 250:8281
-    0x20, 0x80, 0x27, 0x0C, // 251:8320
-    0x20, 0xA7, 0x27, 0x0C, // 252:8359
-    0x20, 0xCE, 0x26, 0x0A, // 253:8398
-    0x20, 0xF4, 0x2B, 0x0C, // 254:8436
-    0x21, 0x1F, 0x26, 0x0A, // 255:8479
-
-    // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x3B, 0x00, 0x00, 0x03, 0x38,                                                                                                                                                                                                                                                                                                                                                                   // 33
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07,                                                                                                                                                                                                                                                                                                 // 34
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x22, 0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x10, 0x02,                                                                                                                                                                   // 35
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00, 0x26, 0x10, 0x00, 0x00, 0x42, 0x10, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0xC2, 0x10, 0x00, 0x00, 0x82, 0x18, 0x00, 0x00, 0x82, 0x0F, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                   // 36
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xC7, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0xFE, 0x1C, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0xCE, 0x1F, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x80, 0x0F,                                                                                           // 37
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x9E, 0x31, 0x00, 0x00, 0xF3, 0x20, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0xE1, 0x20, 0x00, 0x00, 0xB1, 0x21, 0x00, 0x00, 0x1E, 0x33, 0x00, 0x00, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x37, 0x00, 0x00, 0x80, 0x21,                                                                                                                   // 38
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                 // 39
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x00, 0x01, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                     // 40
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0xC0, 0x01, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xF0, 0x1F,                                                                                                                                                                                                                                                                                                                                           // 41
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,                                                                                                                                                                                                                         // 42
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                         // 43
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                                                                   // 44
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                           // 45
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                   // 46
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                 // 47
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0xF8, 0x07,                                                                                                                                                                                                                   // 48
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                           // 49
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x23, 0x00, 0x00, 0x81, 0x21, 0x00, 0x00, 0xE3, 0x20, 0x00, 0x00, 0x7E, 0x20, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                   // 50
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0xB3, 0x30, 0x00, 0x00, 0xBE, 0x1F, 0x00, 0x00, 0x00, 0x0F,                                                                                                                                                                                                                   // 51
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,                                                                                                                                                                                           // 52
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x61, 0x10, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x00, 0x80, 0x07,                                                                                                                                                                                                                   // 53
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x21, 0x20, 0x00, 0x00, 0x61, 0x30, 0x00, 0x00, 0xC1, 0x1F, 0x00, 0x00, 0x80, 0x0F,                                                                                                                                                                                                                   // 54
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x3C, 0x00, 0x00, 0x81, 0x0F, 0x00, 0x00, 0xE1, 0x01, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                         // 55
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x00, 0x00, 0xBE, 0x1F, 0x00, 0x00, 0xA3, 0x30, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0xC1, 0x20, 0x00, 0x00, 0xA3, 0x30, 0x00, 0x00, 0x9E, 0x1F, 0x00, 0x00, 0x08, 0x0F,                                                                                                                                                                                                                   // 56
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFE, 0x20, 0x00, 0x00, 0x83, 0x21, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x82, 0x18, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0xF8, 0x03,                                                                                                                                                                                                                   // 57
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38,                                                                                                                                                                                                                                                                                                                                                                   // 58
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x01, 0x00, 0x38, 0x70, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                                                                         // 59
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x0C, 0x0C,                                                                                                                                                                                                                   // 60
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02,                                                                                                                                                                                                                   // 61
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80,                                                                                                                                                                                                                         // 62
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x81, 0x3B, 0x00, 0x00, 0xC1, 0x38, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                         // 63
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x82, 0xC3, 0x00, 0x00, 0xE2, 0xC7, 0x00, 0x00, 0x33, 0x8C, 0x00, 0x00, 0x11, 0x88, 0x00, 0x00, 0x11, 0x88, 0x00, 0x00, 0x11, 0x86, 0x00, 0x00, 0xF1, 0xC7, 0x00, 0x00, 0x03, 0x4C, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xE0, 0x01,                                           // 64
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 65
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0xA3, 0x30, 0x00, 0x00, 0xBE, 0x1F, 0x00, 0x00, 0x00, 0x0F,                                                                                                                                                                   // 66
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x20,                                                                                                                                                                   // 67
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0x18, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                                                   // 68
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 69
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                         // 70
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x83, 0x3F,                                                                                                                                           // 71
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                           // 72
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                   // 73
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                     // 74
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                   // 75
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                   // 76
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,                                                                   // 77
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0x31, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                           // 78
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 79
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3C,                                                                                                                                                                                                 // 80
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x90, 0x01, 0x00, 0x0E, 0x1C, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 81
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x03, 0x00, 0x00, 0x43, 0x0E, 0x00, 0x00, 0x7E, 0x3C, 0x00, 0x00, 0x18, 0x30,                                                                                                                                                                                           // 82
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00, 0x3E, 0x20, 0x00, 0x00, 0x63, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0xC1, 0x20, 0x00, 0x00, 0xC1, 0x20, 0x00, 0x00, 0x81, 0x31, 0x00, 0x00, 0x81, 0x1F, 0x00, 0x00, 0x01, 0x0F,                                                                                                                                                                                                                   // 83
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                 // 84
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F,                                                                                                                                           // 85
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                         // 86
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, // 87
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                   // 88
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                 // 89
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x81, 0x23, 0x00, 0x00, 0xE1, 0x21, 0x00, 0x00, 0x79, 0x20, 0x00, 0x00, 0x1D, 0x20, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x03, 0x20,                                                                                                                                                                                                                   // 90
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,                                                                                                                                                                                                                                                                                                             // 91
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                           // 92
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                     // 93
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                   // 94
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                     // 95
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,                                                                                                                                                                                                                                                                         // 96
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x08, 0x23, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x18, 0x19, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                           // 97
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 98
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20,                                                                                                                                                                                                                                           // 99
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x30, 0x18, 0x00, 0x80, 0xFF, 0x3F,                                                                                                                                                                                                                   // 100
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x90, 0x18, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x98, 0x20, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0xE0, 0x30,                                                                                                                                                                                                                   // 101
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x80, 0x08, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x80, 0x08,                                                                                                                                                                                                                                                                                                 // 102
-    0x00, 0x00, 0x80, 0x01, 0x00, 0xE0, 0xE0, 0x03, 0x00, 0xF0, 0x2D, 0x06, 0x00, 0x18, 0x17, 0x04, 0x00, 0x08, 0x12, 0x04, 0x00, 0x08, 0x12, 0x04, 0x00, 0x08, 0x12, 0x04, 0x00, 0x38, 0x11, 0x06, 0x00, 0xF8, 0x31, 0x03, 0x00, 0x08, 0xE0, 0x03, 0x00, 0x08,                                                                                                                                                                                                 // 103
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                   // 104
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF9, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                           // 105
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x80, 0xF9, 0xFF, 0x03,                                                                                                                                                                                                                                                                                                                                                                                     // 106
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x18, 0x38, 0x00, 0x00, 0x08, 0x30,                                                                                                                                                                                                                   // 107
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                           // 108
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x3F,                                           // 109
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                   // 110
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 111
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x30, 0x18, 0x00, 0x00, 0x10, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 112
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x10, 0x30, 0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 0xF8, 0xFF, 0x07,                                                                                                                                                                                                             // 113
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                                                                         // 114
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0x88, 0x21, 0x00, 0x00, 0x88, 0x21, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x08, 0x23, 0x00, 0x00, 0x08, 0x1E, 0x00, 0x00, 0x08, 0x1E,                                                                                                                                                                                                                                           // 115
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20,                                                                                                                                                                                                                                                                                           // 116
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 117
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                         // 118
-    0x00, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x08,                                                                         // 119
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x60, 0x0E, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x60, 0x0E, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x08, 0x30,                                                                                                                                                                                                                                           // 120
-    0x00, 0x08, 0x00, 0x04, 0x00, 0x78, 0x00, 0x04, 0x00, 0xE0, 0x03, 0x04, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                         // 121
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x08, 0x3C, 0x00, 0x00, 0x08, 0x2F, 0x00, 0x00, 0x88, 0x23, 0x00, 0x00, 0xE8, 0x20, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x18, 0x20,                                                                                                                                                                                                                                                                   // 122
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x03, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01,                                                                                                                                                                                                                                                                                     // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x07,                                                                                                                                                                                                                                                                                                             // 124
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                           // 125
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0,                                                                                                                                                                                                                         // 126
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 127
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 128
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 129
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 130
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 131
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 132
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 133
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 134
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 135
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 136
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 137
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 138
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 139
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 140
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 141
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 142
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 143
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 144
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 145
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 146
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 147
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 148
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 149
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 150
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 151
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 152
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 153
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 154
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 155
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 156
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 157
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 158
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                                                                                                   // 159
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0x03, 0x00, 0x38, 0x00, 0x02,                                                                                                                                                                                                                                                                                                                                                             // 161
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x07, 0x38, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C,                                                                                                                                                                                                                                           // 162
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x00, 0x00, 0x80, 0x3C, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x83, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 163
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x08, 0x04,                                                                                                                                                                                                                   // 164
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8E, 0x04, 0x00, 0x00, 0xB8, 0x04, 0x00, 0x00, 0xE0, 0x04, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0x04, 0x00, 0x00, 0xB8, 0x04, 0x00, 0x00, 0x8E, 0x04, 0x00, 0x00, 0x03,                                                                                                                                                                                                                         // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xF8, 0x07,                                                                                                                                                                                                                                                                                                             // 166
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x30, 0x00, 0x00, 0xF7, 0x20, 0x00, 0x80, 0x9C, 0x21, 0x00, 0x80, 0x08, 0x21, 0x00, 0x80, 0x18, 0x23, 0x00, 0x80, 0x10, 0x23, 0x00, 0x80, 0xF0, 0x1F, 0x00, 0x00, 0xE0, 0x0C,                                                                                                                                                                                                                                           // 167
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                 // 168
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0xE2, 0x13, 0x00, 0x00, 0x31, 0x23, 0x00, 0x00, 0x19, 0x26, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x19, 0x26, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0xF0, 0x03,                                                                   // 169
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x7E,                                                                                                                                                                                                                                                                                                                         // 170
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x60, 0x18,                                                                                                                                                                                                                                           // 171
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                                                   // 172
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                           // 173
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0xF9, 0x27, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x89, 0x21, 0x00, 0x00, 0x79, 0x26, 0x00, 0x00, 0x22, 0x14, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0xF0, 0x03,                                                                   // 174
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                               // 175
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0C,                                                                                                                                                                                                                                                                         // 176
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0xFC, 0x17, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x40, 0x10,                                                                                                                                                                                                                   // 177
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0E, 0x01,                                                                                                                                                                                                                                                                                                                   // 178
-    0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0xEE,                                                                                                                                                                                                                                                                                                                         // 179
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,                                                                                                                                                                                                                                                                               // 180
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 181
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01,                                                                                                                                                                                     // 182
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0xC0, 0x01,                                                                                                                                                                                                                                                                                                                                                                   // 183
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                     // 184
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                           // 185
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3E,                                                                                                                                                                                                                                                                                                 // 186
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                           // 187
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x31, 0x00, 0x00, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x0E, 0x09, 0x00, 0x00, 0xC3, 0x08, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x08,                                                                                           // 188
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x31, 0x00, 0x00, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x2E, 0x28, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0xC0, 0x21,                                                                                                                   // 189
-    0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x1B, 0x31, 0x00, 0x00, 0xEE, 0x1C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x0E, 0x09, 0x00, 0x00, 0xC3, 0x08, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x08,                                                                   // 190
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x0C, 0x02, 0x00, 0x38, 0x06, 0x02, 0x00, 0xB8, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                             // 191
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x10, 0xC0, 0x01, 0x00, 0x30, 0x78, 0x01, 0x00, 0x60, 0x1E, 0x01, 0x00, 0x40, 0x03, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 192
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x40, 0x1E, 0x01, 0x00, 0x60, 0x03, 0x01, 0x00, 0x30, 0x1E, 0x01, 0x00, 0x10, 0x78, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 193
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x40, 0xC0, 0x01, 0x00, 0x60, 0x78, 0x01, 0x00, 0x30, 0x1E, 0x01, 0x00, 0x30, 0x03, 0x01, 0x00, 0x60, 0x1E, 0x01, 0x00, 0x40, 0x78, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 194
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x60, 0xC0, 0x01, 0x00, 0x10, 0x78, 0x01, 0x00, 0x30, 0x1E, 0x01, 0x00, 0x20, 0x03, 0x01, 0x00, 0x40, 0x1E, 0x01, 0x00, 0x60, 0x78, 0x01, 0x00, 0x30, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 195
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x30, 0x78, 0x01, 0x00, 0x30, 0x1E, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x30, 0x78, 0x01, 0x00, 0x30, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 196
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0xE0, 0x1F, 0x01, 0x00, 0x20, 0x03, 0x01, 0x00, 0x20, 0x1F, 0x01, 0x00, 0xE0, 0x79, 0x01, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20,                                                                                                                                           // 197
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                   // 198
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x03, 0x30, 0x04, 0x00, 0x01, 0xA0, 0x04, 0x00, 0x01, 0xE0, 0x04, 0x00, 0x01, 0xA0, 0x07, 0x00, 0x01, 0x20, 0x03, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x20,                                                                                                                                                                   // 199
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x10, 0xFF, 0x3F, 0x00, 0x30, 0x41, 0x20, 0x00, 0x60, 0x41, 0x20, 0x00, 0x40, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 200
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x20, 0x00, 0x40, 0x41, 0x20, 0x00, 0x60, 0x41, 0x20, 0x00, 0x30, 0x41, 0x20, 0x00, 0x10, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 201
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x40, 0xFF, 0x3F, 0x00, 0x60, 0x41, 0x20, 0x00, 0x30, 0x41, 0x20, 0x00, 0x30, 0x41, 0x20, 0x00, 0x60, 0x41, 0x20, 0x00, 0x40, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 202
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x30, 0xFF, 0x3F, 0x00, 0x30, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x30, 0x41, 0x20, 0x00, 0x30, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20,                                                                                                                                                                                                                   // 203
-    0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x3F, 0x00, 0x40, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                   // 204
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x3F, 0x00, 0x60, 0xFF, 0x3F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                               // 205
-    0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x3F, 0x00, 0x30, 0xFF, 0x3F, 0x00, 0x60, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                                                                                                                               // 206
-    0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                               // 207
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x41, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xF0, 0x01,                                                                                                                                           // 208
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0x0E, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x30, 0x70, 0x00, 0x00, 0x20, 0xC0, 0x00, 0x00, 0x40, 0x80, 0x03, 0x00, 0x60, 0x00, 0x06, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0x31, 0x00, 0x00, 0xFF, 0x3F,                                                                                                                                           // 209
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x10, 0x03, 0x30, 0x00, 0x30, 0x01, 0x20, 0x00, 0x60, 0x01, 0x20, 0x00, 0x40, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 210
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x40, 0x01, 0x20, 0x00, 0x60, 0x01, 0x20, 0x00, 0x30, 0x01, 0x20, 0x00, 0x10, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 211
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x03, 0x30, 0x00, 0x60, 0x01, 0x20, 0x00, 0x30, 0x01, 0x20, 0x00, 0x30, 0x01, 0x20, 0x00, 0x60, 0x01, 0x20, 0x00, 0x40, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 212
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x60, 0x03, 0x30, 0x00, 0x10, 0x01, 0x20, 0x00, 0x30, 0x01, 0x20, 0x00, 0x20, 0x01, 0x20, 0x00, 0x40, 0x01, 0x20, 0x00, 0x60, 0x03, 0x30, 0x00, 0x30, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 213
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x02, 0x10, 0x00, 0x30, 0x03, 0x30, 0x00, 0x30, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x20, 0x00, 0x30, 0x01, 0x20, 0x00, 0x30, 0x03, 0x30, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 214
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x06, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x0C, 0x06,                                                                                                                                                                                                                                           // 215
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x02, 0x1C, 0x00, 0x00, 0x03, 0x3E, 0x00, 0x00, 0x01, 0x23, 0x00, 0x00, 0xC1, 0x21, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0x31, 0x20, 0x00, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x00, 0xF9, 0x07, 0x00, 0x00, 0xE0, 0x01,                                                                                           // 216
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F,                                                                                                                                           // 217
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x60, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F,                                                                                                                                           // 218
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x60, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F,                                                                                                                                           // 219
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x30, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x0F,                                                                                                                                           // 220
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x60, 0x80, 0x3F, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                 // 221
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x0C, 0x02, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x01,                                                                                                                                                                                           // 222
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x30, 0x00, 0x80, 0xF0, 0x20, 0x00, 0x80, 0xD8, 0x21, 0x00, 0x00, 0x8F, 0x21, 0x00, 0x00, 0x07, 0x3F, 0x00, 0x00, 0x00, 0x1E,                                                                                                                                                                                           // 223
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x80, 0x08, 0x23, 0x00, 0x80, 0x09, 0x21, 0x00, 0x00, 0x0B, 0x21, 0x00, 0x00, 0x0A, 0x21, 0x00, 0x00, 0x18, 0x19, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                           // 224
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x08, 0x23, 0x00, 0x00, 0x0A, 0x21, 0x00, 0x00, 0x0B, 0x21, 0x00, 0x80, 0x09, 0x21, 0x00, 0x80, 0x18, 0x19, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                           // 225
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x0A, 0x23, 0x00, 0x00, 0x0B, 0x21, 0x00, 0x80, 0x09, 0x21, 0x00, 0x80, 0x09, 0x21, 0x00, 0x00, 0x1B, 0x19, 0x00, 0x00, 0xF2, 0x3F,                                                                                                                                                                                                                                           // 226
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x13, 0x3E, 0x00, 0x80, 0x08, 0x23, 0x00, 0x80, 0x09, 0x21, 0x00, 0x00, 0x09, 0x21, 0x00, 0x00, 0x0A, 0x21, 0x00, 0x00, 0x1B, 0x19, 0x00, 0x80, 0xF1, 0x3F,                                                                                                                                                                                                                                           // 227
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x80, 0x09, 0x23, 0x00, 0x80, 0x09, 0x21, 0x00, 0x00, 0x08, 0x21, 0x00, 0x00, 0x08, 0x21, 0x00, 0x80, 0x19, 0x19, 0x00, 0x80, 0xF1, 0x3F,                                                                                                                                                                                                                                           // 228
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x08, 0x23, 0x00, 0xC0, 0x0B, 0x21, 0x00, 0x40, 0x0A, 0x21, 0x00, 0x40, 0x0A, 0x21, 0x00, 0xC0, 0x1B, 0x19, 0x00, 0x00, 0xF0, 0x3F,                                                                                                                                                                                                                                           // 229
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x18, 0x3F, 0x00, 0x00, 0x88, 0x21, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x10, 0x00, 0x00, 0xB8, 0x1C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xB0, 0x1C, 0x00, 0x00, 0x88, 0x30, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x98, 0x20, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0xE0, 0x10,                                                                   // 230
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x10, 0x10, 0x04, 0x00, 0x08, 0xA0, 0x04, 0x00, 0x08, 0xE0, 0x04, 0x00, 0x08, 0xA0, 0x07, 0x00, 0x08, 0x20, 0x03, 0x00, 0x08, 0x20,                                                                                                                                                                                                                                           // 231
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x80, 0x90, 0x18, 0x00, 0x80, 0x89, 0x20, 0x00, 0x00, 0x8B, 0x20, 0x00, 0x00, 0x8A, 0x20, 0x00, 0x00, 0x98, 0x20, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x00, 0xE0, 0x30,                                                                                                                                                                                                                   // 232
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x90, 0x18, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x8A, 0x20, 0x00, 0x00, 0x8B, 0x20, 0x00, 0x80, 0x99, 0x20, 0x00, 0x80, 0xF0, 0x20, 0x00, 0x00, 0xE0, 0x30,                                                                                                                                                                                                                   // 233
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x92, 0x18, 0x00, 0x00, 0x8B, 0x20, 0x00, 0x80, 0x89, 0x20, 0x00, 0x80, 0x89, 0x20, 0x00, 0x00, 0x9B, 0x20, 0x00, 0x00, 0xF2, 0x20, 0x00, 0x00, 0xE0, 0x30,                                                                                                                                                                                                                   // 234
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x80, 0x91, 0x18, 0x00, 0x80, 0x89, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x00, 0x88, 0x20, 0x00, 0x80, 0x99, 0x20, 0x00, 0x80, 0xF1, 0x20, 0x00, 0x00, 0xE0, 0x30,                                                                                                                                                                                                                   // 235
-    0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xFB, 0x3F, 0x00, 0x00, 0x02,                                                                                                                                                                                                                                                                                                                                                                         // 236
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                 // 237
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0xF9, 0x3F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                 // 238
-    0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                 // 239
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x64, 0x10, 0x00, 0x80, 0x25, 0x20, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x4D, 0x30, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xE0, 0x07,                                                                                                                                                                                           // 240
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x33, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x80, 0xF1, 0x3F,                                                                                                                                                                                                                   // 241
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x80, 0x08, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 242
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x80, 0x10, 0x10, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 243
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x00, 0x0B, 0x20, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 244
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x13, 0x10, 0x00, 0x80, 0x08, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x13, 0x10, 0x00, 0x80, 0xF1, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 245
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x80, 0x11, 0x10, 0x00, 0x80, 0x09, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x80, 0x09, 0x20, 0x00, 0x80, 0x11, 0x10, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 246
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x4C, 0x06, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                         // 247
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x08, 0x2C, 0x00, 0x00, 0x08, 0x27, 0x00, 0x00, 0x88, 0x21, 0x00, 0x00, 0xE8, 0x20, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 248
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x80, 0x00, 0x30, 0x00, 0x80, 0x01, 0x20, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 249
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x03, 0x20, 0x00, 0x80, 0x01, 0x10, 0x00, 0x80, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 250
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x03, 0x20, 0x00, 0x80, 0x01, 0x20, 0x00, 0x80, 0x01, 0x20, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 251
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x80, 0x01, 0x30, 0x00, 0x80, 0x01, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x01, 0x10, 0x00, 0x80, 0x01, 0x18, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                   // 252
-    0x00, 0x08, 0x00, 0x04, 0x00, 0x78, 0x00, 0x04, 0x00, 0xE0, 0x03, 0x04, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x02, 0xF8, 0x01, 0x00, 0x03, 0x78, 0x00, 0x80, 0x01, 0x1F, 0x00, 0x80, 0xE0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                         // 253
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x30, 0x18, 0x00, 0x00, 0x10, 0x30, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x07,                                                                                                                                                                                           // 254
-    0x00, 0x08, 0x00, 0x04, 0x00, 0x78, 0x00, 0x04, 0x80, 0xE1, 0x03, 0x04, 0x80, 0x01, 0x0F, 0x02, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x78, 0x00, 0x80, 0x01, 0x1F, 0x00, 0x80, 0xE1, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x08                                                                                                                                                                                                                          // 255
-};
-
-const uint8_t Open_Sans_Regular_35[] PROGMEM = {
-    0x21, // Width: 33
-    0x31, // Height: 49
-    0x20, // First Char: 32
-    0xE0, // Numbers of Chars: 224
-
-    // Jump Table:
-    0xFF, 0xFF, 0x00, 0x09, // 32:65535
-    0x00, 0x00, 0x2F, 0x09, // 33:0
-    0x00, 0x2F, 0x4F, 0x0E, // 34:47
-    0x00, 0x7E, 0x96, 0x17, // 35:126
-    0x01, 0x14, 0x7B, 0x14, // 36:276
-    0x01, 0x8F, 0xBB, 0x1D, // 37:399
-    0x02, 0x4A, 0xAD, 0x1A, // 38:586
-    0x02, 0xF7, 0x25, 0x08, // 39:759
-    0x03, 0x1C, 0x3E, 0x0A, // 40:796
-    0x03, 0x5A, 0x3C, 0x0A, // 41:858
-    0x03, 0x96, 0x73, 0x13, // 42:918
-    0x04, 0x09, 0x7B, 0x14, // 43:1033
-    0x04, 0x84, 0x2F, 0x09, // 44:1156
-    0x04, 0xB3, 0x43, 0x0B, // 45:1203
-    0x04, 0xF6, 0x2F, 0x09, // 46:1270
-    0x05, 0x25, 0x4F, 0x0D, // 47:1317
-    0x05, 0x74, 0x7B, 0x14, // 48:1396
-    0x05, 0xEF, 0x52, 0x14, // 49:1519
-    0x06, 0x41, 0x7C, 0x14, // 50:1601
-    0x06, 0xBD, 0x7C, 0x14, // 51:1725
-    0x07, 0x39, 0x82, 0x14, // 52:1849
-    0x07, 0xBB, 0x7C, 0x14, // 53:1979
-    0x08, 0x37, 0x7C, 0x14, // 54:2103
-    0x08, 0xB3, 0x7A, 0x14, // 55:2227
-    0x09, 0x2D, 0x7C, 0x14, // 56:2349
-    0x09, 0xA9, 0x7B, 0x14, // 57:2473
-    0x0A, 0x24, 0x2F, 0x09, // 58:2596
-    0x0A, 0x53, 0x2D, 0x09, // 59:2643
-    0x0A, 0x80, 0x7C, 0x14, // 60:2688
-    0x0A, 0xFC, 0x7B, 0x14, // 61:2812
-    0x0B, 0x77, 0x7B, 0x14, // 62:2935
-    0x0B, 0xF2, 0x5E, 0x0F, // 63:3058
-    0x0C, 0x50, 0xC8, 0x1F, // 64:3152
-    0x0D, 0x18, 0x98, 0x16, // 65:3352
-    0x0D, 0xB0, 0x91, 0x17, // 66:3504
-    0x0E, 0x41, 0x8E, 0x16, // 67:3649
-    0x0E, 0xCF, 0xA5, 0x1A, // 68:3791
-    0x0F, 0x74, 0x75, 0x13, // 69:3956
-    0x0F, 0xE9, 0x74, 0x12, // 70:4073
-    0x10, 0x5D, 0x98, 0x19, // 71:4189
-    0x10, 0xF5, 0x9F, 0x1A, // 72:4341
-    0x11, 0x94, 0x28, 0x0A, // 73:4500
-    0x11, 0xBC, 0x28, 0x09, // 74:4540
-    0x11, 0xE4, 0x91, 0x15, // 75:4580
-    0x12, 0x75, 0x75, 0x12, // 76:4725
-    0x12, 0xEA, 0xC9, 0x20, // 77:4842
-    0x13, 0xB3, 0x9F, 0x1A, // 78:5043
-    0x14, 0x52, 0xAC, 0x1B, // 79:5202
-    0x14, 0xFE, 0x81, 0x15, // 80:5374
-    0x15, 0x7F, 0xAC, 0x1B, // 81:5503
-    0x16, 0x2B, 0x91, 0x16, // 82:5675
-    0x16, 0xBC, 0x75, 0x13, // 83:5820
-    0x17, 0x31, 0x80, 0x13, // 84:5937
-    0x17, 0xB1, 0x97, 0x19, // 85:6065
-    0x18, 0x48, 0x8E, 0x15, // 86:6216
-    0x18, 0xD6, 0xD5, 0x20, // 87:6358
-    0x19, 0xAB, 0x8A, 0x14, // 88:6571
-    0x1A, 0x35, 0x87, 0x14, // 89:6709
-    0x1A, 0xBC, 0x83, 0x14, // 90:6844
-    0x1B, 0x3F, 0x4C, 0x0C, // 91:6975
-    0x1B, 0x8B, 0x52, 0x0D, // 92:7051
-    0x1B, 0xDD, 0x3E, 0x0C, // 93:7133
-    0x1C, 0x1B, 0x7B, 0x13, // 94:7195
-    0x1C, 0x96, 0x6F, 0x10, // 95:7318
-    0x1D, 0x05, 0x57, 0x14, // 96:7429
-    0x1D, 0x5C, 0x6E, 0x13, // 97:7516
-    0x1D, 0xCA, 0x83, 0x15, // 98:7626
-    0x1E, 0x4D, 0x6E, 0x11, // 99:7757
-    0x1E, 0xBB, 0x7C, 0x15, // 100:7867
-    0x1F, 0x37, 0x7B, 0x14, // 101:7991
-    0x1F, 0xB2, 0x50, 0x0C, // 102:8114
-    0x20, 0x02, 0x7D, 0x13, // 103:8194
-    0x20, 0x7F, 0x7C, 0x15, // 104:8319
-    0x20, 0xFB, 0x28, 0x09, // 105:8443
-    0x21, 0x23, 0x29, 0x09, // 106:8483
-    0x21, 0x4C, 0x75, 0x12, // 107:8524
-    0x21, 0xC1, 0x28, 0x09, // 108:8641
-    0x21, 0xE9, 0xD0, 0x21, // 109:8681
-    0x22, 0xB9, 0x7C, 0x15, // 110:8889
-    0x23, 0x35, 0x82, 0x15, // 111:9013
-    0x23, 0xB7, 0x83, 0x15, // 112:9143
-    0x24, 0x3A, 0x7D, 0x15, // 113:9274
-    0x24, 0xB7, 0x57, 0x0E, // 114:9399
-    0x25, 0x0E, 0x67, 0x11, // 115:9486
-    0x25, 0x75, 0x4B, 0x0C, // 116:9589
-    0x25, 0xC0, 0x7C, 0x15, // 117:9664
-    0x26, 0x3C, 0x7A, 0x12, // 118:9788
-    0x26, 0xB6, 0xB2, 0x1B, // 119:9910
-    0x27, 0x68, 0x75, 0x12, // 120:10088
-    0x27, 0xDD, 0x7A, 0x12, // 121:10205
-    0x28, 0x57, 0x67, 0x10, // 122:10327
-    0x28, 0xBE, 0x53, 0x0D, // 123:10430
-    0x29, 0x11, 0x4C, 0x13, // 124:10513
-    0x29, 0x5D, 0x51, 0x0D, // 125:10589
-    0x29, 0xAE, 0x7B, 0x14, // 126:10670
-    0x2A, 0x29, 0x7C, 0x15, // 127:10793
-    0x2A, 0xA5, 0x7C, 0x15, // 128:10917
-    0x2B, 0x21, 0x7C, 0x15, // 129:11041
-    0x2B, 0x9D, 0x7C, 0x15, // 130:11165
-    0x2C, 0x19, 0x7C, 0x15, // 131:11289
-    0x2C, 0x95, 0x7C, 0x15, // 132:11413
-    0x2D, 0x11, 0x7C, 0x15, // 133:11537
-    0x2D, 0x8D, 0x7C, 0x15, // 134:11661
-    0x2E, 0x09, 0x7C, 0x15, // 135:11785
-    0x2E, 0x85, 0x7C, 0x15, // 136:11909
-    0x2F, 0x01, 0x7C, 0x15, // 137:12033
-    0x2F, 0x7D, 0x7C, 0x15, // 138:12157
-    0x2F, 0xF9, 0x7C, 0x15, // 139:12281
-    0x30, 0x75, 0x7C, 0x15, // 140:12405
-    0x30, 0xF1, 0x7C, 0x15, // 141:12529
-    0x31, 0x6D, 0x7C, 0x15, // 142:12653
-    0x31, 0xE9, 0x7C, 0x15, // 143:12777
-    0x32, 0x65, 0x7C, 0x15, // 144:12901
-    0x32, 0xE1, 0x7C, 0x15, // 145:13025
-    0x33, 0x5D, 0x7C, 0x15, // 146:13149
-    0x33, 0xD9, 0x7C, 0x15, // 147:13273
-    0x34, 0x55, 0x7C, 0x15, // 148:13397
-    0x34, 0xD1, 0x7C, 0x15, // 149:13521
-    0x35, 0x4D, 0x7C, 0x15, // 150:13645
-    0x35, 0xC9, 0x7C, 0x15, // 151:13769
-    0x36, 0x45, 0x7C, 0x15, // 152:13893
-    0x36, 0xC1, 0x7C, 0x15, // 153:14017
-    0x37, 0x3D, 0x7C, 0x15, // 154:14141
-    0x37, 0xB9, 0x7C, 0x15, // 155:14265
-    0x38, 0x35, 0x7C, 0x15, // 156:14389
-    0x38, 0xB1, 0x7C, 0x15, // 157:14513
-    0x39, 0x2D, 0x7C, 0x15, // 158:14637
-    0x39, 0xA9, 0x7C, 0x15, // 159:14761
-    0xFF, 0xFF, 0x00, 0x09, // 160:65535
-    0x3A, 0x25, 0x2D, 0x09, // 161:14885
-    0x3A, 0x52, 0x75, 0x14, // 162:14930
-    0x3A, 0xC7, 0x83, 0x14, // 163:15047
-    0x3B, 0x4A, 0x7C, 0x14, // 164:15178
-    0x3B, 0xC6, 0x80, 0x14, // 165:15302
-    0x3C, 0x46, 0x4C, 0x13, // 166:15430
-    0x3C, 0x92, 0x6E, 0x12, // 167:15506
-    0x3D, 0x00, 0x64, 0x14, // 168:15616
-    0x3D, 0x64, 0xBA, 0x1D, // 169:15716
-    0x3E, 0x1E, 0x43, 0x0C, // 170:15902
-    0x3E, 0x61, 0x67, 0x11, // 171:15969
-    0x3E, 0xC8, 0x7C, 0x14, // 172:16072
-    0x3F, 0x44, 0x43, 0x0B, // 173:16196
-    0x3F, 0x87, 0xBA, 0x1D, // 174:16263
-    0x40, 0x41, 0x79, 0x12, // 175:16449
-    0x40, 0xBA, 0x57, 0x0F, // 176:16570
-    0x41, 0x11, 0x7C, 0x14, // 177:16657
-    0x41, 0x8D, 0x4A, 0x0C, // 178:16781
-    0x41, 0xD7, 0x4A, 0x0C, // 179:16855
-    0x42, 0x21, 0x56, 0x14, // 180:16929
-    0x42, 0x77, 0x83, 0x16, // 181:17015
-    0x42, 0xFA, 0x84, 0x17, // 182:17146
-    0x43, 0x7E, 0x2E, 0x09, // 183:17278
-    0x43, 0xAC, 0x30, 0x08, // 184:17324
-    0x43, 0xDC, 0x35, 0x0C, // 185:17372
-    0x44, 0x11, 0x50, 0x0D, // 186:17425
-    0x44, 0x61, 0x66, 0x11, // 187:17505
-    0x44, 0xC7, 0xB4, 0x1B, // 188:17607
-    0x45, 0x7B, 0xAD, 0x1B, // 189:17787
-    0x46, 0x28, 0xBB, 0x1B, // 190:17960
-    0x46, 0xE3, 0x61, 0x0F, // 191:18147
-    0x47, 0x44, 0x98, 0x16, // 192:18244
-    0x47, 0xDC, 0x98, 0x16, // 193:18396
-    0x48, 0x74, 0x98, 0x16, // 194:18548
-    0x49, 0x0C, 0x98, 0x16, // 195:18700
-    0x49, 0xA4, 0x98, 0x16, // 196:18852
-    0x4A, 0x3C, 0x98, 0x16, // 197:19004
-    0x4A, 0xD4, 0xC9, 0x1F, // 198:19156
-    0x4B, 0x9D, 0x8E, 0x16, // 199:19357
-    0x4C, 0x2B, 0x75, 0x13, // 200:19499
-    0x4C, 0xA0, 0x75, 0x13, // 201:19616
-    0x4D, 0x15, 0x75, 0x13, // 202:19733
-    0x4D, 0x8A, 0x75, 0x13, // 203:19850
-    0x4D, 0xFF, 0x28, 0x0A, // 204:19967
-    0x4E, 0x27, 0x39, 0x0A, // 205:20007
-    0x4E, 0x60, 0x41, 0x0A, // 206:20064
-    0x4E, 0xA1, 0x41, 0x0A, // 207:20129
-    0x4E, 0xE2, 0x9E, 0x19, // 208:20194
-    0x4F, 0x80, 0x9F, 0x1A, // 209:20352
-    0x50, 0x1F, 0xAC, 0x1B, // 210:20511
-    0x50, 0xCB, 0xAC, 0x1B, // 211:20683
-    0x51, 0x77, 0xAC, 0x1B, // 212:20855
-    0x52, 0x23, 0xAC, 0x1B, // 213:21027
-    0x52, 0xCF, 0xAC, 0x1B, // 214:21199
-    0x53, 0x7B, 0x7B, 0x14, // 215:21371
-    0x53, 0xF6, 0xAC, 0x1B, // 216:21494
-    0x54, 0xA2, 0x97, 0x19, // 217:21666
-    0x55, 0x39, 0x97, 0x19, // 218:21817
-    0x55, 0xD0, 0x97, 0x19, // 219:21968
-    0x56, 0x67, 0x97, 0x19, // 220:22119
-    0x56, 0xFE, 0x87, 0x14, // 221:22270
-    0x57, 0x85, 0x82, 0x15, // 222:22405
-    0x58, 0x07, 0x8A, 0x16, // 223:22535
-    0x58, 0x91, 0x6E, 0x13, // 224:22673
-    0x58, 0xFF, 0x6E, 0x13, // 225:22783
-    0x59, 0x6D, 0x6E, 0x13, // 226:22893
-    0x59, 0xDB, 0x6E, 0x13, // 227:23003
-    0x5A, 0x49, 0x6E, 0x13, // 228:23113
-    0x5A, 0xB7, 0x6E, 0x13, // 229:23223
-    0x5B, 0x25, 0xC1, 0x1E, // 230:23333
-    0x5B, 0xE6, 0x6E, 0x11, // 231:23526
-    0x5C, 0x54, 0x7B, 0x14, // 232:23636
-    0x5C, 0xCF, 0x7B, 0x14, // 233:23759
-    0x5D, 0x4A, 0x7B, 0x14, // 234:23882
-    0x5D, 0xC5, 0x7B, 0x14, // 235:24005
-    0x5E, 0x40, 0x28, 0x09, // 236:24128
-    0x5E, 0x68, 0x3A, 0x09, // 237:24168
-    0x5E, 0xA2, 0x3B, 0x09, // 238:24226
-    0x5E, 0xDD, 0x3A, 0x09, // 239:24285
-    0x5F, 0x17, 0x83, 0x15, // 240:24343
-    0x5F, 0x9A, 0x7C, 0x15, // 241:24474
-    0x60, 0x16, 0x82, 0x15, // 242:24598
-    0x60, 0x98, 0x82, 0x15, // 243:24728
-    0x61, 0x1A, 0x82, 0x15, // 244:24858
-    0x61, 0x9C, 0x82, 0x15, // 245:24988
-    0x62, 0x1E, 0x82, 0x15, // 246:25118
-    0x62, 0xA0, 0x7B, 0x14, // 247:25248
-    0x63, 0x1B, 0x82, 0x15, // 248:25371
-    0x63, 0x9D, 0x7C, 0x15, // 249:25501
-    0x64, 0x19, 0x7C, 0x15, // 250:25625
-    0x64, 0x95, 0x7C, 0x15, // 251:25749
-    0x65, 0x11, 0x7C, 0x15, // 252:25873
-    0x65, 0x8D, 0x7A, 0x12, // 253:25997
-    0x66, 0x07, 0x83, 0x15, // 254:26119
-    0x66, 0x8A, 0x7A, 0x12, // 255:26250
-
-    // Font Data:
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 33
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 34
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                           // 35
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x80, 0xF7, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x80, 0xC1, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x01, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x01, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x1E, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x80, 0x01, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 36
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x00, 0xC0, 0x83, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xC3, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0xE0, 0x81, 0x03, 0x38, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,                                                                                                                                                             // 37
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x0E, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x07, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x0F, 0x30, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x1C, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0x38, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x78, 0x18, 0x00, 0x00, 0x00, 0x80, 0x3F, 0xF0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                 // 38
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 39
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 40
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 41
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 42
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 43
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 44
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 45
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 46
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 47
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 48
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 49
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x80, 0x37, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x60, 0x00, 0xE0, 0x31, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x3E, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0xC0, 0xC1, 0x0F, 0x30, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x30, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 50
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xC1, 0x06, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1C, 0x1E, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 51
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 52
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x38, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0x60, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 53
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x80, 0x07, 0x03, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x03, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 54
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x60, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 55
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xF3, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x0F, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x0E, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xF3, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 56
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x07, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x06, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x06, 0x0E, 0x00, 0x00, 0x00, 0x80, 0x03, 0xC3, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 57
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 58
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 59
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 60
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 61
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 62
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0F, 0x1C, 0x00, 0x00, 0x00, 0x60, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 63
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xC3, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x01, 0x7E, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x81, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xFF, 0xC1, 0x01, 0x00, 0x00, 0xE0, 0xE0, 0x80, 0x83, 0x01, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x83, 0x01, 0x00, 0x00, 0x60, 0x30, 0x00, 0x83, 0x01, 0x00, 0x00, 0x60, 0x30, 0x00, 0x83, 0x01, 0x00, 0x00, 0x60, 0x30, 0x80, 0x83, 0x01, 0x00, 0x00, 0x60, 0x30, 0x80, 0x81, 0x01, 0x00, 0x00, 0x60, 0x30, 0xF8, 0xC0, 0x01, 0x00, 0x00, 0xE0, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                               // 64
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 65
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xC1, 0x06, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1C, 0x1E, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                         // 66
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 67
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                                                                 // 68
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 69
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 70
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x06, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFE, 0x1F,                                                                                                                                                                                                                                                                                                                                                                               // 71
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                     // 72
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 73
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 74
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x07, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                         // 75
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 76
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                         // 77
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                     // 78
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 79
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x81, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 80
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xD8, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x0C, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x08, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 81
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x81, 0xF3, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xE7, 0xC1, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x81, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                         // 82
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xE1, 0x01, 0x30, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0E, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0xF0, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 83
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 84
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                     // 85
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 86
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, // 87
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 88
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 89
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0xE0, 0x37, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x33, 0x00, 0x00, 0x00, 0x60, 0x00, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x3E, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x7E, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 90
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 91
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 92
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 93
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 94
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 95
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 96
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 97
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 98
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 99
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 100
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x19, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 101
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 102
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0xE7, 0x1C, 0x00, 0x00, 0x00, 0xF0, 0xBF, 0x3F, 0x18, 0x00, 0x00, 0x00, 0x70, 0xF8, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x60, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x60, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x60, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x60, 0x18, 0x30, 0x00, 0x00, 0x00, 0x38, 0x70, 0x18, 0x30, 0x00, 0x00, 0x00, 0x78, 0x30, 0x18, 0x38, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x18, 0x18, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x38, 0x1C, 0x00, 0x00, 0x00, 0xD8, 0x07, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x00, 0xC0, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 103
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 104
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 105
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0xFF, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 106
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC1, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 107
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 108
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                               // 109
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 110
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 111
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 112
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 113
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 114
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 115
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 116
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 117
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 118
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,                                                                                                                                                                                                                   // 119
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x83, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 120
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 121
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x37, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x07, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 122
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xCF, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0x83, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 123
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 124
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x83, 0xFF, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 125
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 126
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 127
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 128
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 129
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 130
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 131
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 132
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 133
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 134
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 135
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 136
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 137
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 138
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 139
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 140
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 141
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 142
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 143
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 144
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 145
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 146
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 147
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 148
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 149
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 150
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 151
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 152
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 153
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 154
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 155
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 156
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 157
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 158
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 159
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x70,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 161
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 162
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x06, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 163
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x8F, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x8F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 164
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x8C, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x8C, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 165
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0xFE, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 166
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xE3, 0x07, 0x18, 0x00, 0x00, 0x00, 0xF0, 0xF7, 0x0F, 0x38, 0x00, 0x00, 0x00, 0x30, 0x3F, 0x1E, 0x30, 0x00, 0x00, 0x00, 0x18, 0x1E, 0x1C, 0x30, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x38, 0x30, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x30, 0x00, 0x00, 0x00, 0x18, 0x38, 0x70, 0x30, 0x00, 0x00, 0x00, 0x18, 0x38, 0x70, 0x38, 0x00, 0x00, 0x00, 0x18, 0x70, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x38, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x30, 0xE0, 0xCF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 167
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 168
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x81, 0x0F, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x3F, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x60, 0x38, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x1C, 0xC0, 0x31, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x80, 0x31, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x80, 0x31, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x80, 0x31, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x80, 0x31, 0x00, 0x00, 0x00, 0x60, 0x1C, 0xC0, 0x31, 0x00, 0x00, 0x00, 0xC0, 0x18, 0xC0, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F,                                                                                                                                                                   // 169
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 170
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x87, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x0E,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 171
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 172
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 173
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x60, 0xFC, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x06, 0x30, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x1E, 0x30, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x60, 0xF8, 0xFB, 0x30, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xE1, 0x19, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x80, 0x19, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F,                                                                                                                                                                   // 174
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 175
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 176
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 177
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 178
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 179
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 180
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 181
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 182
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 183
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 184
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 185
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 186
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x87, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 187
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x38, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x38, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x1C, 0x06, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                       // 188
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x38, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xC0, 0x83, 0x01, 0x36, 0x00, 0x00, 0x00, 0xE0, 0x80, 0x01, 0x33, 0x00, 0x00, 0x00, 0x60, 0x80, 0x81, 0x31, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30,                                                                                                                                                                                                                                                 // 189
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x0C, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x07, 0x38, 0x00, 0x00, 0x00, 0xC0, 0xE7, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x07, 0x06, 0x00, 0x00, 0x00, 0xE0, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                             // 190
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x01, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 191
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x7F, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xC3, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 192
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x03, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xE3, 0x03, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x0F, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 193
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x03, 0x7F, 0x18, 0x00, 0x00, 0x00, 0xC0, 0xC1, 0x1F, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x0F, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 194
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x01, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x80, 0xC3, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x80, 0xE3, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 195
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x03, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x80, 0x03, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 196
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                               // 197
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                         // 198
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x31, 0x00, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x33, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x1F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x1E, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                                                                                                                                                                                                                                           // 199
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x03, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x67, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 200
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x67, 0x00, 0x03, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x60, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 201
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x67, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0xC0, 0x61, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x60, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x03, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x64, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 202
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x61, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 // 203
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 204
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0xE3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 205
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xE0, 0xE1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 206
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                         // 207
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                                                                                                           // 208
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x03, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                     // 209
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 210
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 211
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x61, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 212
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC7, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x61, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0xC3, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 213
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x63, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 214
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 215
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x19, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x3C, 0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x1E, 0x30, 0x00, 0x00, 0x00, 0x60, 0x80, 0x07, 0x30, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x03, 0x30, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x01, 0x30, 0x00, 0x00, 0x00, 0x60, 0x78, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x3E, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,                                                                                                                                                                                                                                                       // 216
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                     // 217
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                     // 218
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                     // 219
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,                                                                                                                                                                                                                                                                                                                                                                                     // 220
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0xE0, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                     // 221
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 222
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x18, 0xE0, 0x03, 0x30, 0x00, 0x00, 0x00, 0x18, 0xF0, 0x07, 0x30, 0x00, 0x00, 0x00, 0x18, 0x38, 0x0F, 0x30, 0x00, 0x00, 0x00, 0x30, 0x1C, 0x1E, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x1C, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x38, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x03, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 223
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0x38, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x80, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 224
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x80, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x18, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 225
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x31, 0x70, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x70, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x80, 0xF1, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 226
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x31, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x60, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x18, 0x18, 0x00, 0x00, 0x00, 0x80, 0x39, 0x18, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 227
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x40, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x40, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 228
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0x70, 0x38, 0x30, 0x30, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x8C, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x8C, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x8C, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x8C, 0x19, 0x18, 0x18, 0x00, 0x00, 0x00, 0xF8, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x70, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 229
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x19, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F,                                                                                                                         // 230
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x38, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF0, 0x31, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF0, 0x33, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x1E, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                           // 231
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x19, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x70, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x78, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x80, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 232
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x19, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x80, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x18, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 233
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x19, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x18, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x70, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x80, 0xF1, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 234
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x40, 0xF0, 0x19, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x18, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x18, 0x30, 0x00, 0x00, 0x00, 0x40, 0xF0, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x38, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 235
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xF9, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xF9, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               // 236
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF9, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xF9, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 237
-    0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x18, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x78, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 238
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 239
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0xE3, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB8, 0x63, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x61, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0xCF, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0xBE, 0x01, 0x1E, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 240
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xE1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 241
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 242
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 243
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x71, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 244
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xC0, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x39, 0x00, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x01, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 245
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x40, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 246
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 247
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 248
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 249
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 250
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 251
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x40, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                       // 252
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x1E, 0x00, 0x00, 0x80, 0x01, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x78, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                   // 253
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01,                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                             // 254
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x30, 0x00, 0x00, 0x40, 0xC0, 0x3F, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0xFE, 0x01, 0x18, 0x00, 0x00, 0xE0, 0x00, 0xF0, 0x07, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                    // 255
-};
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
-	0x07, // Width: 7
-	0x0F, // Height: 15
-	0x20, // First Char: 32
-	0xE0, // Numbers of Chars: 224
-
-	// Jump Table:
-	0xFF, 0xFF, 0x00, 0x07,  // 32:65535
-	0x00, 0x00, 0x08, 0x07,  // 33:0
-	0x00, 0x08, 0x09, 0x07,  // 34:8
-	0x00, 0x11, 0x0D, 0x07,  // 35:17
-	0x00, 0x1E, 0x0C, 0x07,  // 36:30
-	0x00, 0x2A, 0x0E, 0x07,  // 37:42
-	0x00, 0x38, 0x0E, 0x07,  // 38:56
-	0x00, 0x46, 0x07, 0x07,  // 39:70
-	0x00, 0x4D, 0x0C, 0x07,  // 40:77
-	0x00, 0x59, 0x0A, 0x07,  // 41:89
-	0x00, 0x63, 0x0B, 0x07,  // 42:99
-	0x00, 0x6E, 0x0E, 0x07,  // 43:110
-	0x00, 0x7C, 0x08, 0x07,  // 44:124
-	0x00, 0x84, 0x0A, 0x07,  // 45:132
-	0x00, 0x8E, 0x08, 0x07,  // 46:142
-	0x00, 0x96, 0x0D, 0x07,  // 47:150
-	0x00, 0xA3, 0x0E, 0x07,  // 48:163
-	0x00, 0xB1, 0x0C, 0x07,  // 49:177
-	0x00, 0xBD, 0x0E, 0x07,  // 50:189
-	0x00, 0xCB, 0x0E, 0x07,  // 51:203
-	0x00, 0xD9, 0x0E, 0x07,  // 52:217
-	0x00, 0xE7, 0x0E, 0x07,  // 53:231
-	0x00, 0xF5, 0x0E, 0x07,  // 54:245
-	0x01, 0x03, 0x0D, 0x07,  // 55:259
-	0x01, 0x10, 0x0E, 0x07,  // 56:272
-	0x01, 0x1E, 0x0E, 0x07,  // 57:286
-	0x01, 0x2C, 0x08, 0x07,  // 58:300
-	0x01, 0x34, 0x08, 0x07,  // 59:308
-	0x01, 0x3C, 0x0E, 0x07,  // 60:316
-	0x01, 0x4A, 0x0E, 0x07,  // 61:330
-	0x01, 0x58, 0x0E, 0x07,  // 62:344
-	0x01, 0x66, 0x0D, 0x07,  // 63:358
-	0x01, 0x73, 0x0E, 0x07,  // 64:371
-	0x01, 0x81, 0x0E, 0x07,  // 65:385
-	0x01, 0x8F, 0x0E, 0x07,  // 66:399
-	0x01, 0x9D, 0x0E, 0x07,  // 67:413
-	0x01, 0xAB, 0x0E, 0x07,  // 68:427
-	0x01, 0xB9, 0x0E, 0x07,  // 69:441
-	0x01, 0xC7, 0x0D, 0x07,  // 70:455
-	0x01, 0xD4, 0x0E, 0x07,  // 71:468
-	0x01, 0xE2, 0x0E, 0x07,  // 72:482
-	0x01, 0xF0, 0x0C, 0x07,  // 73:496
-	0x01, 0xFC, 0x0C, 0x07,  // 74:508
-	0x02, 0x08, 0x0E, 0x07,  // 75:520
-	0x02, 0x16, 0x0E, 0x07,  // 76:534
-	0x02, 0x24, 0x0E, 0x07,  // 77:548
-	0x02, 0x32, 0x0E, 0x07,  // 78:562
-	0x02, 0x40, 0x0E, 0x07,  // 79:576
-	0x02, 0x4E, 0x0D, 0x07,  // 80:590
-	0x02, 0x5B, 0x0E, 0x07,  // 81:603
-	0x02, 0x69, 0x0E, 0x07,  // 82:617
-	0x02, 0x77, 0x0E, 0x07,  // 83:631
-	0x02, 0x85, 0x0D, 0x07,  // 84:645
-	0x02, 0x92, 0x0E, 0x07,  // 85:658
-	0x02, 0xA0, 0x0D, 0x07,  // 86:672
-	0x02, 0xAD, 0x0E, 0x07,  // 87:685
-	0x02, 0xBB, 0x0E, 0x07,  // 88:699
-	0x02, 0xC9, 0x0D, 0x07,  // 89:713
-	0x02, 0xD6, 0x0E, 0x07,  // 90:726
-	0x02, 0xE4, 0x0A, 0x07,  // 91:740
-	0x02, 0xEE, 0x0E, 0x07,  // 92:750
-	0x02, 0xFC, 0x08, 0x07,  // 93:764
-	0x03, 0x04, 0x0B, 0x07,  // 94:772
-	0x03, 0x0F, 0x0E, 0x07,  // 95:783
-	0x03, 0x1D, 0x09, 0x07,  // 96:797
-	0x03, 0x26, 0x0C, 0x07,  // 97:806
-	0x03, 0x32, 0x0C, 0x07,  // 98:818
-	0x03, 0x3E, 0x0C, 0x07,  // 99:830
-	0x03, 0x4A, 0x0C, 0x07,  // 100:842
-	0x03, 0x56, 0x0C, 0x07,  // 101:854
-	0x03, 0x62, 0x0B, 0x07,  // 102:866
-	0x03, 0x6D, 0x0C, 0x07,  // 103:877
-	0x03, 0x79, 0x0C, 0x07,  // 104:889
-	0x03, 0x85, 0x0C, 0x07,  // 105:901
-	0x03, 0x91, 0x0A, 0x07,  // 106:913
-	0x03, 0x9B, 0x0C, 0x07,  // 107:923
-	0x03, 0xA7, 0x0C, 0x07,  // 108:935
-	0x03, 0xB3, 0x0C, 0x07,  // 109:947
-	0x03, 0xBF, 0x0C, 0x07,  // 110:959
-	0x03, 0xCB, 0x0C, 0x07,  // 111:971
-	0x03, 0xD7, 0x0C, 0x07,  // 112:983
-	0x03, 0xE3, 0x0C, 0x07,  // 113:995
-	0x03, 0xEF, 0x0D, 0x07,  // 114:1007
-	0x03, 0xFC, 0x0C, 0x07,  // 115:1020
-	0x04, 0x08, 0x0C, 0x07,  // 116:1032
-	0x04, 0x14, 0x0C, 0x07,  // 117:1044
-	0x04, 0x20, 0x0B, 0x07,  // 118:1056
-	0x04, 0x2B, 0x0D, 0x07,  // 119:1067
-	0x04, 0x38, 0x0C, 0x07,  // 120:1080
-	0x04, 0x44, 0x0B, 0x07,  // 121:1092
-	0x04, 0x4F, 0x0C, 0x07,  // 122:1103
-	0x04, 0x5B, 0x0C, 0x07,  // 123:1115
-	0x04, 0x67, 0x08, 0x07,  // 124:1127
-	0x04, 0x6F, 0x0B, 0x07,  // 125:1135
-	0x04, 0x7A, 0x0E, 0x07,  // 126:1146
-	0x04, 0x88, 0x0E, 0x07,  // 127:1160
-	0x04, 0x96, 0x0E, 0x07,  // 128:1174
-	0x04, 0xA4, 0x0E, 0x07,  // 129:1188
-	0x04, 0xB2, 0x0E, 0x07,  // 130:1202
-	0x04, 0xC0, 0x0E, 0x07,  // 131:1216
-	0x04, 0xCE, 0x0E, 0x07,  // 132:1230
-	0x04, 0xDC, 0x0E, 0x07,  // 133:1244
-	0x04, 0xEA, 0x0E, 0x07,  // 134:1258
-	0x04, 0xF8, 0x0E, 0x07,  // 135:1272
-	0x05, 0x06, 0x0E, 0x07,  // 136:1286
-	0x05, 0x14, 0x0E, 0x07,  // 137:1300
-	0x05, 0x22, 0x0E, 0x07,  // 138:1314
-	0x05, 0x30, 0x0E, 0x07,  // 139:1328
-	0x05, 0x3E, 0x0E, 0x07,  // 140:1342
-	0x05, 0x4C, 0x0E, 0x07,  // 141:1356
-	0x05, 0x5A, 0x0E, 0x07,  // 142:1370
-	0x05, 0x68, 0x0E, 0x07,  // 143:1384
-	0x05, 0x76, 0x0E, 0x07,  // 144:1398
-	0x05, 0x84, 0x0E, 0x07,  // 145:1412
-	0x05, 0x92, 0x0E, 0x07,  // 146:1426
-	0x05, 0xA0, 0x0E, 0x07,  // 147:1440
-	0x05, 0xAE, 0x0E, 0x07,  // 148:1454
-	0x05, 0xBC, 0x0E, 0x07,  // 149:1468
-	0x05, 0xCA, 0x0E, 0x07,  // 150:1482
-	0x05, 0xD8, 0x0E, 0x07,  // 151:1496
-	0x05, 0xE6, 0x0E, 0x07,  // 152:1510
-	0x05, 0xF4, 0x0E, 0x07,  // 153:1524
-	0x06, 0x02, 0x0E, 0x07,  // 154:1538
-	0x06, 0x10, 0x0E, 0x07,  // 155:1552
-	0x06, 0x1E, 0x0E, 0x07,  // 156:1566
-	0x06, 0x2C, 0x0E, 0x07,  // 157:1580
-	0x06, 0x3A, 0x0E, 0x07,  // 158:1594
-	0x06, 0x48, 0x0E, 0x07,  // 159:1608
-	0xFF, 0xFF, 0x00, 0x07,  // 160:65535
-	0x06, 0x56, 0x08, 0x07,  // 161:1622
-	0x06, 0x5E, 0x0C, 0x07,  // 162:1630
-	0x06, 0x6A, 0x0C, 0x07,  // 163:1642
-	0x06, 0x76, 0x0E, 0x07,  // 164:1654
-	0x06, 0x84, 0x0D, 0x07,  // 165:1668
-	0x06, 0x91, 0x08, 0x07,  // 166:1681
-	0x06, 0x99, 0x0C, 0x07,  // 167:1689
-	0x06, 0xA5, 0x09, 0x07,  // 168:1701
-	0x06, 0xAE, 0x0E, 0x07,  // 169:1710
-	0x06, 0xBC, 0x0A, 0x07,  // 170:1724
-	0x06, 0xC6, 0x0E, 0x07,  // 171:1734
-	0x06, 0xD4, 0x0E, 0x07,  // 172:1748
-	0x06, 0xE2, 0x0A, 0x07,  // 173:1762
-	0x06, 0xEC, 0x0E, 0x07,  // 174:1772
-	0x06, 0xFA, 0x0B, 0x07,  // 175:1786
-	0x07, 0x05, 0x0B, 0x07,  // 176:1797
-	0x07, 0x10, 0x0E, 0x07,  // 177:1808
-	0x07, 0x1E, 0x09, 0x07,  // 178:1822
-	0x07, 0x27, 0x0B, 0x07,  // 179:1831
-	0x07, 0x32, 0x09, 0x07,  // 180:1842
-	0x07, 0x3B, 0x0E, 0x07,  // 181:1851
-	0x07, 0x49, 0x0E, 0x07,  // 182:1865
-	0x07, 0x57, 0x08, 0x07,  // 183:1879
-	0x07, 0x5F, 0x0A, 0x07,  // 184:1887
-	0x07, 0x69, 0x09, 0x07,  // 185:1897
-	0x07, 0x72, 0x0A, 0x07,  // 186:1906
-	0x07, 0x7C, 0x0E, 0x07,  // 187:1916
-	0x07, 0x8A, 0x0E, 0x07,  // 188:1930
-	0x07, 0x98, 0x0C, 0x07,  // 189:1944
-	0x07, 0xA4, 0x0E, 0x07,  // 190:1956
-	0x07, 0xB2, 0x0A, 0x07,  // 191:1970
-	0x07, 0xBC, 0x0E, 0x07,  // 192:1980
-	0x07, 0xCA, 0x0E, 0x07,  // 193:1994
-	0x07, 0xD8, 0x0E, 0x07,  // 194:2008
-	0x07, 0xE6, 0x0E, 0x07,  // 195:2022
-	0x07, 0xF4, 0x0E, 0x07,  // 196:2036
-	0x08, 0x02, 0x0E, 0x07,  // 197:2050
-	0x08, 0x10, 0x0E, 0x07,  // 198:2064
-	0x08, 0x1E, 0x0E, 0x07,  // 199:2078
-	0x08, 0x2C, 0x0E, 0x07,  // 200:2092
-	0x08, 0x3A, 0x0E, 0x07,  // 201:2106
-	0x08, 0x48, 0x0E, 0x07,  // 202:2120
-	0x08, 0x56, 0x0E, 0x07,  // 203:2134
-	0x08, 0x64, 0x0C, 0x07,  // 204:2148
-	0x08, 0x70, 0x0C, 0x07,  // 205:2160
-	0x08, 0x7C, 0x0C, 0x07,  // 206:2172
-	0x08, 0x88, 0x0C, 0x07,  // 207:2184
-	0x08, 0x94, 0x0E, 0x07,  // 208:2196
-	0x08, 0xA2, 0x0E, 0x07,  // 209:2210
-	0x08, 0xB0, 0x0E, 0x07,  // 210:2224
-	0x08, 0xBE, 0x0E, 0x07,  // 211:2238
-	0x08, 0xCC, 0x0E, 0x07,  // 212:2252
-	0x08, 0xDA, 0x0E, 0x07,  // 213:2266
-	0x08, 0xE8, 0x0E, 0x07,  // 214:2280
-	0x08, 0xF6, 0x0C, 0x07,  // 215:2294
-	0x09, 0x02, 0x0E, 0x07,  // 216:2306
-	0x09, 0x10, 0x0E, 0x07,  // 217:2320
-	0x09, 0x1E, 0x0E, 0x07,  // 218:2334
-	0x09, 0x2C, 0x0E, 0x07,  // 219:2348
-	0x09, 0x3A, 0x0E, 0x07,  // 220:2362
-	0x09, 0x48, 0x0D, 0x07,  // 221:2376
-	0x09, 0x55, 0x0D, 0x07,  // 222:2389
-	0x09, 0x62, 0x0C, 0x07,  // 223:2402
-	0x09, 0x6E, 0x0C, 0x07,  // 224:2414
-	0x09, 0x7A, 0x0C, 0x07,  // 225:2426
-	0x09, 0x86, 0x0C, 0x07,  // 226:2438
-	0x09, 0x92, 0x0C, 0x07,  // 227:2450
-	0x09, 0x9E, 0x0C, 0x07,  // 228:2462
-	0x09, 0xAA, 0x0C, 0x07,  // 229:2474
-	0x09, 0xB6, 0x0C, 0x07,  // 230:2486
-	0x09, 0xC2, 0x0C, 0x07,  // 231:2498
-	0x09, 0xCE, 0x0C, 0x07,  // 232:2510
-	0x09, 0xDA, 0x0C, 0x07,  // 233:2522
-	0x09, 0xE6, 0x0C, 0x07,  // 234:2534
-	0x09, 0xF2, 0x0C, 0x07,  // 235:2546
-	0x09, 0xFE, 0x0C, 0x07,  // 236:2558
-	0x0A, 0x0A, 0x0C, 0x07,  // 237:2570
-	0x0A, 0x16, 0x0C, 0x07,  // 238:2582
-	0x0A, 0x22, 0x0C, 0x07,  // 239:2594
-	0x0A, 0x2E, 0x0C, 0x07,  // 240:2606
-	0x0A, 0x3A, 0x0C, 0x07,  // 241:2618
-	0x0A, 0x46, 0x0C, 0x07,  // 242:2630
-	0x0A, 0x52, 0x0C, 0x07,  // 243:2642
-	0x0A, 0x5E, 0x0C, 0x07,  // 244:2654
-	0x0A, 0x6A, 0x0C, 0x07,  // 245:2666
-	0x0A, 0x76, 0x0C, 0x07,  // 246:2678
-	0x0A, 0x82, 0x0C, 0x07,  // 247:2690
-	0x0A, 0x8E, 0x0C, 0x07,  // 248:2702
-	0x0A, 0x9A, 0x0C, 0x07,  // 249:2714
-	0x0A, 0xA6, 0x0C, 0x07,  // 250:2726
-	0x0A, 0xB2, 0x0C, 0x07,  // 251:2738
-	0x0A, 0xBE, 0x0C, 0x07,  // 252:2750
-	0x0A, 0xCA, 0x0B, 0x07,  // 253:2762
-	0x0A, 0xD5, 0x0C, 0x07,  // 254:2773
-	0x0A, 0xE1, 0x0B, 0x07,  // 255:2785
-
-	// Font Data:
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0D,	// 33
-	0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,	// 34
-	0x00,0x02,0x40,0x0E,0xE0,0x03,0x50,0x0A,0xC0,0x07,0x70,0x02,0x40,	// 35
-	0x00,0x00,0xE0,0x04,0x90,0x08,0xF8,0x3F,0x10,0x09,0x20,0x07,	// 36
-	0x30,0x00,0x48,0x01,0x48,0x01,0xB0,0x06,0x80,0x09,0x40,0x09,0x00,0x06,	// 37
-	0x00,0x00,0x00,0x07,0xF0,0x0C,0xC8,0x08,0x08,0x0B,0x08,0x06,0x00,0x0B,	// 38
-	0x00,0x00,0x00,0x00,0x00,0x00,0x38,	// 39
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x1C,0x1C,0x04,0x10,	// 40
-	0x00,0x00,0x00,0x00,0x04,0x10,0x1C,0x1C,0xE0,0x03,	// 41
-	0x00,0x00,0x90,0x00,0x60,0x00,0xF8,0x01,0x60,0x00,0x90,	// 42
-	0x00,0x01,0x00,0x01,0x00,0x01,0xE0,0x0F,0x00,0x01,0x00,0x01,0x00,0x01,	// 43
-	0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x0C,	// 44
-	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 45
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,	// 46
-	0x00,0x00,0x00,0x10,0x00,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,	// 47
-	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x88,0x08,0x18,0x0C,0xE0,0x03,	// 48
-	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x00,0x08,0x00,0x08,	// 49
-	0x00,0x00,0x10,0x08,0x08,0x0C,0x08,0x0A,0x08,0x09,0x88,0x08,0x70,0x08,	// 50
-	0x00,0x00,0x10,0x04,0x08,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 51
-	0x00,0x00,0x00,0x03,0xC0,0x02,0x60,0x02,0x18,0x02,0xF8,0x0F,0x00,0x02,	// 52
-	0x00,0x00,0x78,0x04,0x48,0x08,0x48,0x08,0x48,0x08,0xC8,0x0C,0x80,0x07,	// 53
-	0x00,0x00,0xE0,0x03,0x90,0x0C,0x48,0x08,0x48,0x08,0xC8,0x0C,0x90,0x07,	// 54
-	0x00,0x00,0x08,0x00,0x08,0x08,0x08,0x06,0x88,0x01,0x78,0x00,0x18,	// 55
-	0x00,0x00,0x70,0x07,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 56
-	0x00,0x00,0xF0,0x04,0x18,0x09,0x08,0x09,0x08,0x09,0x98,0x04,0xE0,0x03,	// 57
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0C,	// 58
-	0x00,0x00,0x00,0x00,0x00,0x10,0xC0,0x0C,	// 59
-	0x00,0x00,0x80,0x01,0x80,0x01,0x40,0x02,0x40,0x02,0x40,0x02,0x20,0x04,	// 60
-	0x00,0x00,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,	// 61
-	0x00,0x00,0x20,0x04,0x40,0x02,0x40,0x02,0x40,0x02,0x80,0x01,0x80,0x01,	// 62
-	0x00,0x00,0x00,0x00,0x10,0x00,0x88,0x0D,0xC8,0x00,0x48,0x00,0x30,	// 63
-	0x00,0x00,0xC0,0x0F,0x20,0x18,0x10,0x23,0x90,0x24,0xB0,0x24,0xE0,0x07,	// 64
-	0x00,0x00,0x00,0x0C,0xC0,0x03,0x38,0x02,0x38,0x02,0xC0,0x03,0x00,0x0C,	// 65
-	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x70,0x07,	// 66
-	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,	// 67
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x04,0xE0,0x03,	// 68
-	0x00,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x88,0x08,	// 69
-	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,	// 70
-	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x08,0x08,0x08,0x88,0x08,0x90,0x07,	// 71
-	0x00,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,	// 72
-	0x00,0x00,0x08,0x08,0x08,0x08,0xF8,0x0F,0x08,0x08,0x08,0x08,	// 73
-	0x00,0x00,0x00,0x04,0x00,0x08,0x08,0x08,0x08,0x08,0xF8,0x07,	// 74
-	0x00,0x00,0xF8,0x0F,0x80,0x00,0xC0,0x00,0x20,0x03,0x10,0x06,0x08,0x08,	// 75
-	0x00,0x00,0xF8,0x0F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 76
-	0x00,0x00,0xF8,0x0F,0x30,0x00,0xC0,0x01,0xC0,0x01,0x30,0x00,0xF8,0x0F,	// 77
-	0x00,0x00,0xF8,0x0F,0x18,0x00,0xE0,0x00,0x80,0x03,0x00,0x0C,0xF8,0x0F,	// 78
-	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x0C,0xE0,0x03,	// 79
-	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x70,	// 80
-	0x00,0x00,0xE0,0x03,0x18,0x0C,0x08,0x08,0x08,0x08,0x18,0x3C,0xE0,0x07,	// 81
-	0x00,0x00,0xF8,0x0F,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x01,0x70,0x06,	// 82
-	0x00,0x00,0x70,0x04,0xC8,0x08,0x88,0x08,0x88,0x08,0x88,0x08,0x10,0x07,	// 83
-	0x08,0x00,0x08,0x00,0x08,0x00,0xF8,0x0F,0x08,0x00,0x08,0x00,0x08,	// 84
-	0x00,0x00,0xF8,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0xF8,0x07,	// 85
-	0x00,0x00,0x18,0x00,0xE0,0x01,0x00,0x0E,0x00,0x0E,0xE0,0x01,0x18,	// 86
-	0xF8,0x01,0x00,0x0E,0xC0,0x03,0x30,0x00,0xC0,0x03,0x00,0x0E,0xF8,0x01,	// 87
-	0x00,0x00,0x08,0x08,0x30,0x06,0xC0,0x01,0xC0,0x01,0x30,0x06,0x08,0x08,	// 88
-	0x08,0x00,0x10,0x00,0x60,0x00,0x80,0x0F,0x60,0x00,0x10,0x00,0x08,	// 89
-	0x00,0x00,0x08,0x0C,0x08,0x0E,0x88,0x09,0xC8,0x08,0x38,0x08,0x18,0x08,	// 90
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x1F,0x04,0x10,	// 91
-	0x00,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x10,	// 92
-	0x00,0x00,0x00,0x00,0x04,0x10,0xFC,0x1F,	// 93
-	0x20,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x20,	// 94
-	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,	// 95
-	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,	// 96
-	0x00,0x00,0x40,0x06,0x20,0x09,0x20,0x09,0x20,0x09,0xC0,0x0F,	// 97
-	0x00,0x00,0xFC,0x0F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 98
-	0x00,0x00,0xC0,0x07,0x60,0x0C,0x20,0x08,0x20,0x08,0x40,0x08,	// 99
-	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xFC,0x0F,	// 100
-	0x00,0x00,0xC0,0x07,0x60,0x09,0x20,0x09,0x20,0x09,0xC0,0x05,	// 101
-	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x24,0x00,0x24,	// 102
-	0x00,0x00,0xC0,0x07,0x20,0x28,0x20,0x48,0x20,0x48,0xE0,0x3F,	// 103
-	0x00,0x00,0xFC,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 104
-	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x0F,0x00,0x08,0x00,0x08,	// 105
-	0x00,0x00,0x00,0x00,0x20,0x40,0x20,0x40,0xE4,0x3F,	// 106
-	0x00,0x00,0xFC,0x0F,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,	// 107
-	0x00,0x00,0x04,0x00,0x04,0x00,0xFC,0x07,0x00,0x08,0x00,0x08,	// 108
-	0x00,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,0x20,0x00,0xE0,0x0F,	// 109
-	0x00,0x00,0xE0,0x0F,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x0F,	// 110
-	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 111
-	0x00,0x00,0xE0,0x7F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 112
-	0x00,0x00,0xC0,0x07,0x20,0x08,0x20,0x08,0x20,0x08,0xE0,0x7F,	// 113
-	0x00,0x00,0x00,0x00,0xE0,0x0F,0x60,0x00,0x20,0x00,0x20,0x00,0x40,	// 114
-	0x00,0x00,0xC0,0x04,0x20,0x09,0x20,0x09,0x20,0x09,0x40,0x06,	// 115
-	0x00,0x00,0x20,0x00,0x20,0x00,0xF8,0x0F,0x20,0x08,0x20,0x08,	// 116
-	0x00,0x00,0xE0,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0xE0,0x0F,	// 117
-	0x00,0x00,0x60,0x00,0x80,0x03,0x00,0x0C,0x80,0x03,0x60,	// 118
-	0x60,0x00,0x80,0x03,0x00,0x0E,0x80,0x01,0x00,0x0E,0x80,0x03,0x60,	// 119
-	0x00,0x00,0x20,0x08,0xC0,0x06,0x00,0x01,0xC0,0x06,0x20,0x08,	// 120
-	0x00,0x00,0x60,0x40,0x80,0x67,0x00,0x1C,0x80,0x03,0x60,	// 121
-	0x00,0x00,0x20,0x0C,0x20,0x0A,0x20,0x09,0xA0,0x08,0x60,0x08,	// 122
-	0x00,0x00,0x80,0x00,0x80,0x00,0x7C,0x1F,0x04,0x10,0x04,0x10,	// 123
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,	// 124
-	0x00,0x00,0x04,0x10,0x04,0x10,0x7C,0x1F,0x80,0x00,0x80,	// 125
-	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 126
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 127
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 128
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 129
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 130
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 131
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 132
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 133
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 134
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 135
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 136
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 137
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 138
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 139
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 140
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 141
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 142
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 143
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 144
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 145
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 146
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 147
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 148
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 149
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 150
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 151
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 152
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 153
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 154
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 155
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 156
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 157
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 158
-	0x00,0x00,0xF0,0x7F,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0xF0,0x7F,	// 159
-	0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x3F,	// 161
-	0x00,0x00,0xC0,0x07,0x20,0x08,0xF8,0x3F,0x20,0x08,0x40,0x04,	// 162
-	0x00,0x00,0x80,0x08,0xF0,0x0F,0x88,0x08,0x88,0x08,0x08,0x08,	// 163
-	0x00,0x00,0x20,0x04,0xC0,0x03,0x40,0x02,0x40,0x02,0xC0,0x03,0x20,0x04,	// 164
-	0x08,0x00,0x50,0x01,0x60,0x01,0x80,0x0F,0x60,0x01,0x50,0x01,0x08,	// 165
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3C,	// 166
-	0x00,0x00,0xF0,0x11,0x28,0x13,0x48,0x12,0xC8,0x14,0x88,0x0F,	// 167
-	0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,	// 168
-	0xC0,0x01,0x20,0x02,0xD0,0x05,0x50,0x05,0x50,0x05,0x20,0x02,0xC0,0x01,	// 169
-	0x00,0x00,0xE8,0x02,0xA8,0x02,0xA8,0x02,0xF0,0x02,	// 170
-	0x00,0x00,0x00,0x01,0x80,0x02,0x40,0x04,0x00,0x01,0x80,0x02,0x40,0x04,	// 171
-	0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x03,	// 172
-	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,	// 173
-	0xC0,0x01,0x20,0x02,0xD0,0x05,0xD0,0x05,0xD0,0x05,0x20,0x02,0xC0,0x01,	// 174
-	0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 175
-	0x00,0x00,0x00,0x00,0x30,0x00,0x48,0x00,0x48,0x00,0x30,	// 176
-	0x80,0x08,0x80,0x08,0x80,0x08,0xE0,0x0B,0x80,0x08,0x80,0x08,0x80,0x08,	// 177
-	0x00,0x00,0x00,0x00,0x88,0x00,0xE8,0x00,0xB8,	// 178
-	0x00,0x00,0x00,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0xD8,	// 179
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,	// 180
-	0x00,0x00,0xE0,0x7F,0x00,0x08,0x00,0x08,0x00,0x08,0xE0,0x0F,0x00,0x08,	// 181
-	0x00,0x00,0x70,0x00,0xF8,0x00,0xF8,0x00,0xF8,0x1F,0x08,0x00,0xF8,0x1F,	// 182
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,	// 183
-	0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x30,	// 184
-	0x00,0x00,0x00,0x00,0x88,0x00,0xF8,0x00,0x80,	// 185
-	0x00,0x00,0x70,0x02,0x88,0x02,0x88,0x02,0x70,0x02,	// 186
-	0x00,0x00,0x40,0x04,0x80,0x02,0x00,0x01,0x40,0x04,0x80,0x02,0x00,0x01,	// 187
-	0x44,0x02,0x7C,0x03,0x40,0x01,0x00,0x0D,0x80,0x0B,0x80,0x1F,0x00,0x08,	// 188
-	0x44,0x02,0x7C,0x03,0x40,0x01,0x00,0x11,0x80,0x1D,0x80,0x17,	// 189
-	0x00,0x02,0x44,0x03,0x54,0x01,0x54,0x0D,0xEC,0x0B,0x80,0x1F,0x00,0x08,	// 190
-	0x00,0x38,0x00,0x4C,0x00,0x44,0x60,0x43,0x00,0x20,	// 191
-	0x00,0x00,0x00,0x0C,0xC1,0x03,0x3A,0x02,0x38,0x02,0xC0,0x03,0x00,0x0C,	// 192
-	0x00,0x00,0x00,0x0C,0xC0,0x03,0x3A,0x02,0x39,0x02,0xC0,0x03,0x00,0x0C,	// 193
-	0x00,0x00,0x00,0x0C,0xC2,0x03,0x39,0x02,0x39,0x02,0xC2,0x03,0x00,0x0C,	// 194
-	0x00,0x00,0x00,0x0C,0xC3,0x03,0x39,0x02,0x3A,0x02,0xC3,0x03,0x00,0x0C,	// 195
-	0x00,0x00,0x00,0x0C,0xC2,0x03,0x38,0x02,0x38,0x02,0xC2,0x03,0x00,0x0C,	// 196
-	0x00,0x00,0x00,0x08,0x00,0x07,0xFE,0x02,0xE6,0x02,0x00,0x07,0x00,0x08,	// 197
-	0x00,0x0C,0x80,0x03,0x78,0x02,0x08,0x02,0xF8,0x0F,0x88,0x08,0x88,0x08,	// 198
-	0x00,0x00,0xE0,0x03,0x10,0x04,0x08,0x28,0x08,0x28,0x08,0x38,0x10,0x04,	// 199
-	0x00,0x00,0xF8,0x0F,0x89,0x08,0x8A,0x08,0x88,0x08,0x88,0x08,0x88,0x08,	// 200
-	0x00,0x00,0xF8,0x0F,0x88,0x08,0x8A,0x08,0x89,0x08,0x88,0x08,0x88,0x08,	// 201
-	0x00,0x00,0xF8,0x0F,0x8A,0x08,0x89,0x08,0x89,0x08,0x8A,0x08,0x88,0x08,	// 202
-	0x00,0x00,0xF8,0x0F,0x8A,0x08,0x88,0x08,0x8A,0x08,0x88,0x08,0x88,0x08,	// 203
-	0x00,0x00,0x08,0x08,0x09,0x08,0xFA,0x0F,0x08,0x08,0x08,0x08,	// 204
-	0x00,0x00,0x08,0x08,0x08,0x08,0xFA,0x0F,0x09,0x08,0x08,0x08,	// 205
-	0x00,0x00,0x08,0x08,0x0A,0x08,0xF9,0x0F,0x0A,0x08,0x08,0x08,	// 206
-	0x00,0x00,0x08,0x08,0x0A,0x08,0xF8,0x0F,0x0A,0x08,0x08,0x08,	// 207
-	0x80,0x00,0xF8,0x0F,0x88,0x08,0x88,0x08,0x08,0x08,0x10,0x04,0xE0,0x03,	// 208
-	0x00,0x00,0xF8,0x0F,0x1B,0x00,0xE1,0x00,0x82,0x03,0x03,0x0C,0xF8,0x0F,	// 209
-	0x00,0x00,0xE0,0x03,0x19,0x0C,0x0A,0x08,0x08,0x08,0x18,0x0C,0xE0,0x03,	// 210
-	0x00,0x00,0xE0,0x03,0x18,0x0C,0x0A,0x08,0x09,0x08,0x18,0x0C,0xE0,0x03,	// 211
-	0x00,0x00,0xE0,0x03,0x1A,0x0C,0x09,0x08,0x09,0x08,0x1A,0x0C,0xE0,0x03,	// 212
-	0x00,0x00,0xE0,0x03,0x1B,0x0C,0x09,0x08,0x0A,0x08,0x1B,0x0C,0xE0,0x03,	// 213
-	0x00,0x00,0xE0,0x03,0x1A,0x0C,0x08,0x08,0x08,0x08,0x1A,0x0C,0xE0,0x03,	// 214
-	0x00,0x00,0x20,0x02,0x40,0x01,0x80,0x00,0x40,0x01,0x20,0x02,	// 215
-	0x00,0x08,0xE0,0x07,0x18,0x0E,0x88,0x09,0x48,0x08,0x38,0x0C,0xF8,0x03,	// 216
-	0x00,0x00,0xF8,0x07,0x01,0x08,0x02,0x08,0x00,0x08,0x00,0x08,0xF8,0x07,	// 217
-	0x00,0x00,0xF8,0x07,0x00,0x08,0x02,0x08,0x01,0x08,0x00,0x08,0xF8,0x07,	// 218
-	0x00,0x00,0xF8,0x07,0x02,0x08,0x01,0x08,0x01,0x08,0x02,0x08,0xF8,0x07,	// 219
-	0x00,0x00,0xF8,0x07,0x02,0x08,0x00,0x08,0x00,0x08,0x02,0x08,0xF8,0x07,	// 220
-	0x08,0x00,0x10,0x00,0x60,0x00,0x82,0x0F,0x61,0x00,0x10,0x00,0x08,	// 221
-	0x00,0x00,0xF8,0x0F,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0xE0,	// 222
-	0x00,0x00,0xF8,0x0F,0xE4,0x00,0xA4,0x09,0x18,0x09,0x00,0x06,	// 223
-	0x00,0x00,0x40,0x06,0x20,0x09,0x24,0x09,0x28,0x09,0xC0,0x0F,	// 224
-	0x00,0x00,0x40,0x06,0x20,0x09,0x28,0x09,0x24,0x09,0xC0,0x0F,	// 225
-	0x00,0x00,0x40,0x06,0x28,0x09,0x24,0x09,0x24,0x09,0xC8,0x0F,	// 226
-	0x00,0x00,0x40,0x06,0x2C,0x09,0x24,0x09,0x28,0x09,0xCC,0x0F,	// 227
-	0x00,0x00,0x40,0x06,0x28,0x09,0x20,0x09,0x28,0x09,0xC0,0x0F,	// 228
-	0x00,0x00,0x40,0x06,0x26,0x09,0x29,0x09,0x29,0x09,0xC6,0x0F,	// 229
-	0x00,0x00,0x40,0x0F,0x20,0x09,0xC0,0x07,0x20,0x09,0xE0,0x09,	// 230
-	0x00,0x00,0xC0,0x07,0x60,0x0C,0x20,0x28,0x20,0x28,0x40,0x38,	// 231
-	0x00,0x00,0xC0,0x07,0x60,0x09,0x24,0x09,0x28,0x09,0xC0,0x05,	// 232
-	0x00,0x00,0xC0,0x07,0x60,0x09,0x28,0x09,0x24,0x09,0xC0,0x05,	// 233
-	0x00,0x00,0xC0,0x07,0x68,0x09,0x24,0x09,0x24,0x09,0xC8,0x05,	// 234
-	0x00,0x00,0xC0,0x07,0x68,0x09,0x20,0x09,0x28,0x09,0xC0,0x05,	// 235
-	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x0F,0x08,0x08,0x00,0x08,	// 236
-	0x00,0x00,0x20,0x08,0x20,0x08,0xE8,0x0F,0x04,0x08,0x00,0x08,	// 237
-	0x00,0x00,0x28,0x08,0x24,0x08,0xE4,0x0F,0x08,0x08,0x00,0x08,	// 238
-	0x00,0x00,0x20,0x08,0x28,0x08,0xE0,0x0F,0x08,0x08,0x00,0x08,	// 239
-	0x00,0x00,0x80,0x07,0x54,0x08,0x58,0x08,0x68,0x08,0xC0,0x07,	// 240
-	0x00,0x00,0xE0,0x0F,0x4C,0x00,0x24,0x00,0x28,0x00,0xCC,0x0F,	// 241
-	0x00,0x00,0xC0,0x07,0x20,0x08,0x24,0x08,0x28,0x08,0xC0,0x07,	// 242
-	0x00,0x00,0xC0,0x07,0x20,0x08,0x28,0x08,0x24,0x08,0xC0,0x07,	// 243
-	0x00,0x00,0xC0,0x07,0x28,0x08,0x24,0x08,0x28,0x08,0xC0,0x07,	// 244
-	0x00,0x00,0xCC,0x07,0x24,0x08,0x2C,0x08,0x28,0x08,0xCC,0x07,	// 245
-	0x00,0x00,0xC0,0x07,0x28,0x08,0x20,0x08,0x28,0x08,0xC0,0x07,	// 246
-	0x00,0x00,0x00,0x01,0x00,0x01,0x40,0x05,0x00,0x01,0x00,0x01,	// 247
-	0x00,0x00,0xC0,0x0F,0x20,0x0A,0x20,0x09,0xA0,0x08,0xE0,0x07,	// 248
-	0x00,0x00,0xE0,0x07,0x00,0x08,0x04,0x08,0x08,0x08,0xE0,0x0F,	// 249
-	0x00,0x00,0xE0,0x07,0x00,0x08,0x08,0x08,0x04,0x08,0xE0,0x0F,	// 250
-	0x00,0x00,0xE0,0x07,0x08,0x08,0x04,0x08,0x08,0x08,0xE0,0x0F,	// 251
-	0x00,0x00,0xE0,0x07,0x08,0x08,0x00,0x08,0x08,0x08,0xE0,0x0F,	// 252
-	0x00,0x00,0x60,0x40,0x80,0x67,0x08,0x1C,0x84,0x03,0x60,	// 253
-	0x00,0x00,0xFC,0x7F,0x20,0x08,0x20,0x08,0x20,0x08,0xC0,0x07,	// 254
-	0x00,0x00,0x60,0x40,0x88,0x67,0x00,0x1C,0x88,0x03,0x60	// 255
-};
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DejaVu_Sans_Mono_10[] PROGMEM = {
-	0x06, // Width: 6
-	0x0D, // Height: 13
-	0x20, // First Char: 32
-	0xE0, // Numbers of Chars: 224
-
-	// Jump Table:
-	0xFF, 0xFF, 0x00, 0x06,  // 32:65535
-	0x00, 0x00, 0x08, 0x06,  // 33:0
-	0x00, 0x08, 0x09, 0x06,  // 34:8
-	0x00, 0x11, 0x0B, 0x06,  // 35:17
-	0x00, 0x1C, 0x0C, 0x06,  // 36:28
-	0x00, 0x28, 0x0C, 0x06,  // 37:40
-	0x00, 0x34, 0x0C, 0x06,  // 38:52
-	0x00, 0x40, 0x07, 0x06,  // 39:64
-	0x00, 0x47, 0x08, 0x06,  // 40:71
-	0x00, 0x4F, 0x08, 0x06,  // 41:79
-	0x00, 0x57, 0x0B, 0x06,  // 42:87
-	0x00, 0x62, 0x0B, 0x06,  // 43:98
-	0x00, 0x6D, 0x06, 0x06,  // 44:109
-	0x00, 0x73, 0x09, 0x06,  // 45:115
-	0x00, 0x7C, 0x06, 0x06,  // 46:124
-	0x00, 0x82, 0x0B, 0x06,  // 47:130
-	0x00, 0x8D, 0x0C, 0x06,  // 48:141
-	0x00, 0x99, 0x0C, 0x06,  // 49:153
-	0x00, 0xA5, 0x0C, 0x06,  // 50:165
-	0x00, 0xB1, 0x0C, 0x06,  // 51:177
-	0x00, 0xBD, 0x0B, 0x06,  // 52:189
-	0x00, 0xC8, 0x0C, 0x06,  // 53:200
-	0x00, 0xD4, 0x0C, 0x06,  // 54:212
-	0x00, 0xE0, 0x0B, 0x06,  // 55:224
-	0x00, 0xEB, 0x0C, 0x06,  // 56:235
-	0x00, 0xF7, 0x0C, 0x06,  // 57:247
-	0x01, 0x03, 0x06, 0x06,  // 58:259
-	0x01, 0x09, 0x06, 0x06,  // 59:265
-	0x01, 0x0F, 0x0C, 0x06,  // 60:271
-	0x01, 0x1B, 0x09, 0x06,  // 61:283
-	0x01, 0x24, 0x0B, 0x06,  // 62:292
-	0x01, 0x2F, 0x09, 0x06,  // 63:303
-	0x01, 0x38, 0x0C, 0x06,  // 64:312
-	0x01, 0x44, 0x0C, 0x06,  // 65:324
-	0x01, 0x50, 0x0C, 0x06,  // 66:336
-	0x01, 0x5C, 0x0C, 0x06,  // 67:348
-	0x01, 0x68, 0x0C, 0x06,  // 68:360
-	0x01, 0x74, 0x0C, 0x06,  // 69:372
-	0x01, 0x80, 0x0B, 0x06,  // 70:384
-	0x01, 0x8B, 0x0C, 0x06,  // 71:395
-	0x01, 0x97, 0x0C, 0x06,  // 72:407
-	0x01, 0xA3, 0x0C, 0x06,  // 73:419
-	0x01, 0xAF, 0x0A, 0x06,  // 74:431
-	0x01, 0xB9, 0x0C, 0x06,  // 75:441
-	0x01, 0xC5, 0x0C, 0x06,  // 76:453
-	0x01, 0xD1, 0x0C, 0x06,  // 77:465
-	0x01, 0xDD, 0x0C, 0x06,  // 78:477
-	0x01, 0xE9, 0x0C, 0x06,  // 79:489
-	0x01, 0xF5, 0x0B, 0x06,  // 80:501
-	0x02, 0x00, 0x0C, 0x06,  // 81:512
-	0x02, 0x0C, 0x0C, 0x06,  // 82:524
-	0x02, 0x18, 0x0C, 0x06,  // 83:536
-	0x02, 0x24, 0x0B, 0x06,  // 84:548
-	0x02, 0x2F, 0x0C, 0x06,  // 85:559
-	0x02, 0x3B, 0x0B, 0x06,  // 86:571
-	0x02, 0x46, 0x0B, 0x06,  // 87:582
-	0x02, 0x51, 0x0C, 0x06,  // 88:593
-	0x02, 0x5D, 0x0B, 0x06,  // 89:605
-	0x02, 0x68, 0x0C, 0x06,  // 90:616
-	0x02, 0x74, 0x08, 0x06,  // 91:628
-	0x02, 0x7C, 0x0C, 0x06,  // 92:636
-	0x02, 0x88, 0x08, 0x06,  // 93:648
-	0x02, 0x90, 0x09, 0x06,  // 94:656
-	0x02, 0x99, 0x0C, 0x06,  // 95:665
-	0x02, 0xA5, 0x05, 0x06,  // 96:677
-	0x02, 0xAA, 0x0C, 0x06,  // 97:682
-	0x02, 0xB6, 0x0C, 0x06,  // 98:694
-	0x02, 0xC2, 0x0A, 0x06,  // 99:706
-	0x02, 0xCC, 0x0C, 0x06,  // 100:716
-	0x02, 0xD8, 0x0C, 0x06,  // 101:728
-	0x02, 0xE4, 0x09, 0x06,  // 102:740
-	0x02, 0xED, 0x0C, 0x06,  // 103:749
-	0x02, 0xF9, 0x0C, 0x06,  // 104:761
-	0x03, 0x05, 0x0C, 0x06,  // 105:773
-	0x03, 0x11, 0x08, 0x06,  // 106:785
-	0x03, 0x19, 0x0C, 0x06,  // 107:793
-	0x03, 0x25, 0x0A, 0x06,  // 108:805
-	0x03, 0x2F, 0x0C, 0x06,  // 109:815
-	0x03, 0x3B, 0x0C, 0x06,  // 110:827
-	0x03, 0x47, 0x0C, 0x06,  // 111:839
-	0x03, 0x53, 0x0C, 0x06,  // 112:851
-	0x03, 0x5F, 0x0C, 0x06,  // 113:863
-	0x03, 0x6B, 0x0B, 0x06,  // 114:875
-	0x03, 0x76, 0x0C, 0x06,  // 115:886
-	0x03, 0x82, 0x0A, 0x06,  // 116:898
-	0x03, 0x8C, 0x0C, 0x06,  // 117:908
-	0x03, 0x98, 0x0B, 0x06,  // 118:920
-	0x03, 0xA3, 0x0B, 0x06,  // 119:931
-	0x03, 0xAE, 0x0C, 0x06,  // 120:942
-	0x03, 0xBA, 0x0B, 0x06,  // 121:954
-	0x03, 0xC5, 0x0C, 0x06,  // 122:965
-	0x03, 0xD1, 0x0A, 0x06,  // 123:977
-	0x03, 0xDB, 0x08, 0x06,  // 124:987
-	0x03, 0xE3, 0x0B, 0x06,  // 125:995
-	0x03, 0xEE, 0x0B, 0x06,  // 126:1006
-	0x03, 0xF9, 0x0C, 0x06,  // 127:1017
-	0x04, 0x05, 0x0C, 0x06,  // 128:1029
-	0x04, 0x11, 0x0C, 0x06,  // 129:1041
-	0x04, 0x1D, 0x0C, 0x06,  // 130:1053
-	0x04, 0x29, 0x0C, 0x06,  // 131:1065
-	0x04, 0x35, 0x0C, 0x06,  // 132:1077
-	0x04, 0x41, 0x0C, 0x06,  // 133:1089
-	0x04, 0x4D, 0x0C, 0x06,  // 134:1101
-	0x04, 0x59, 0x0C, 0x06,  // 135:1113
-	0x04, 0x65, 0x0C, 0x06,  // 136:1125
-	0x04, 0x71, 0x0C, 0x06,  // 137:1137
-	0x04, 0x7D, 0x0C, 0x06,  // 138:1149
-	0x04, 0x89, 0x0C, 0x06,  // 139:1161
-	0x04, 0x95, 0x0C, 0x06,  // 140:1173
-	0x04, 0xA1, 0x0C, 0x06,  // 141:1185
-	0x04, 0xAD, 0x0C, 0x06,  // 142:1197
-	0x04, 0xB9, 0x0C, 0x06,  // 143:1209
-	0x04, 0xC5, 0x0C, 0x06,  // 144:1221
-	0x04, 0xD1, 0x0C, 0x06,  // 145:1233
-	0x04, 0xDD, 0x0C, 0x06,  // 146:1245
-	0x04, 0xE9, 0x0C, 0x06,  // 147:1257
-	0x04, 0xF5, 0x0C, 0x06,  // 148:1269
-	0x05, 0x01, 0x0C, 0x06,  // 149:1281
-	0x05, 0x0D, 0x0C, 0x06,  // 150:1293
-	0x05, 0x19, 0x0C, 0x06,  // 151:1305
-	0x05, 0x25, 0x0C, 0x06,  // 152:1317
-	0x05, 0x31, 0x0C, 0x06,  // 153:1329
-	0x05, 0x3D, 0x0C, 0x06,  // 154:1341
-	0x05, 0x49, 0x0C, 0x06,  // 155:1353
-	0x05, 0x55, 0x0C, 0x06,  // 156:1365
-	0x05, 0x61, 0x0C, 0x06,  // 157:1377
-	0x05, 0x6D, 0x0C, 0x06,  // 158:1389
-	0x05, 0x79, 0x0C, 0x06,  // 159:1401
-	0xFF, 0xFF, 0x00, 0x06,  // 160:65535
-	0x05, 0x85, 0x08, 0x06,  // 161:1413
-	0x05, 0x8D, 0x0A, 0x06,  // 162:1421
-	0x05, 0x97, 0x0C, 0x06,  // 163:1431
-	0x05, 0xA3, 0x0C, 0x06,  // 164:1443
-	0x05, 0xAF, 0x0B, 0x06,  // 165:1455
-	0x05, 0xBA, 0x08, 0x06,  // 166:1466
-	0x05, 0xC2, 0x0A, 0x06,  // 167:1474
-	0x05, 0xCC, 0x09, 0x06,  // 168:1484
-	0x05, 0xD5, 0x0B, 0x06,  // 169:1493
-	0x05, 0xE0, 0x0A, 0x06,  // 170:1504
-	0x05, 0xEA, 0x0A, 0x06,  // 171:1514
-	0x05, 0xF4, 0x0B, 0x06,  // 172:1524
-	0x05, 0xFF, 0x09, 0x06,  // 173:1535
-	0x06, 0x08, 0x0B, 0x06,  // 174:1544
-	0x06, 0x13, 0x09, 0x06,  // 175:1555
-	0x06, 0x1C, 0x07, 0x06,  // 176:1564
-	0x06, 0x23, 0x0C, 0x06,  // 177:1571
-	0x06, 0x2F, 0x09, 0x06,  // 178:1583
-	0x06, 0x38, 0x09, 0x06,  // 179:1592
-	0x06, 0x41, 0x07, 0x06,  // 180:1601
-	0x06, 0x48, 0x0C, 0x06,  // 181:1608
-	0x06, 0x54, 0x0C, 0x06,  // 182:1620
-	0x06, 0x60, 0x05, 0x06,  // 183:1632
-	0x06, 0x65, 0x08, 0x06,  // 184:1637
-	0x06, 0x6D, 0x09, 0x06,  // 185:1645
-	0x06, 0x76, 0x0A, 0x06,  // 186:1654
-	0x06, 0x80, 0x09, 0x06,  // 187:1664
-	0x06, 0x89, 0x0C, 0x06,  // 188:1673
-	0x06, 0x95, 0x0C, 0x06,  // 189:1685
-	0x06, 0xA1, 0x0C, 0x06,  // 190:1697
-	0x06, 0xAD, 0x0A, 0x06,  // 191:1709
-	0x06, 0xB7, 0x0C, 0x06,  // 192:1719
-	0x06, 0xC3, 0x0C, 0x06,  // 193:1731
-	0x06, 0xCF, 0x0C, 0x06,  // 194:1743
-	0x06, 0xDB, 0x0C, 0x06,  // 195:1755
-	0x06, 0xE7, 0x0C, 0x06,  // 196:1767
-	0x06, 0xF3, 0x0C, 0x06,  // 197:1779
-	0x06, 0xFF, 0x0C, 0x06,  // 198:1791
-	0x07, 0x0B, 0x0C, 0x06,  // 199:1803
-	0x07, 0x17, 0x0C, 0x06,  // 200:1815
-	0x07, 0x23, 0x0C, 0x06,  // 201:1827
-	0x07, 0x2F, 0x0C, 0x06,  // 202:1839
-	0x07, 0x3B, 0x0C, 0x06,  // 203:1851
-	0x07, 0x47, 0x0C, 0x06,  // 204:1863
-	0x07, 0x53, 0x0C, 0x06,  // 205:1875
-	0x07, 0x5F, 0x0C, 0x06,  // 206:1887
-	0x07, 0x6B, 0x0C, 0x06,  // 207:1899
-	0x07, 0x77, 0x0C, 0x06,  // 208:1911
-	0x07, 0x83, 0x0C, 0x06,  // 209:1923
-	0x07, 0x8F, 0x0C, 0x06,  // 210:1935
-	0x07, 0x9B, 0x0C, 0x06,  // 211:1947
-	0x07, 0xA7, 0x0C, 0x06,  // 212:1959
-	0x07, 0xB3, 0x0C, 0x06,  // 213:1971
-	0x07, 0xBF, 0x0C, 0x06,  // 214:1983
-	0x07, 0xCB, 0x0C, 0x06,  // 215:1995
-	0x07, 0xD7, 0x0C, 0x06,  // 216:2007
-	0x07, 0xE3, 0x0C, 0x06,  // 217:2019
-	0x07, 0xEF, 0x0C, 0x06,  // 218:2031
-	0x07, 0xFB, 0x0C, 0x06,  // 219:2043
-	0x08, 0x07, 0x0C, 0x06,  // 220:2055
-	0x08, 0x13, 0x0B, 0x06,  // 221:2067
-	0x08, 0x1E, 0x0B, 0x06,  // 222:2078
-	0x08, 0x29, 0x0C, 0x06,  // 223:2089
-	0x08, 0x35, 0x0C, 0x06,  // 224:2101
-	0x08, 0x41, 0x0C, 0x06,  // 225:2113
-	0x08, 0x4D, 0x0C, 0x06,  // 226:2125
-	0x08, 0x59, 0x0C, 0x06,  // 227:2137
-	0x08, 0x65, 0x0C, 0x06,  // 228:2149
-	0x08, 0x71, 0x0C, 0x06,  // 229:2161
-	0x08, 0x7D, 0x0C, 0x06,  // 230:2173
-	0x08, 0x89, 0x0A, 0x06,  // 231:2185
-	0x08, 0x93, 0x0C, 0x06,  // 232:2195
-	0x08, 0x9F, 0x0C, 0x06,  // 233:2207
-	0x08, 0xAB, 0x0C, 0x06,  // 234:2219
-	0x08, 0xB7, 0x0C, 0x06,  // 235:2231
-	0x08, 0xC3, 0x0C, 0x06,  // 236:2243
-	0x08, 0xCF, 0x0C, 0x06,  // 237:2255
-	0x08, 0xDB, 0x0C, 0x06,  // 238:2267
-	0x08, 0xE7, 0x0C, 0x06,  // 239:2279
-	0x08, 0xF3, 0x0C, 0x06,  // 240:2291
-	0x08, 0xFF, 0x0C, 0x06,  // 241:2303
-	0x09, 0x0B, 0x0C, 0x06,  // 242:2315
-	0x09, 0x17, 0x0C, 0x06,  // 243:2327
-	0x09, 0x23, 0x0C, 0x06,  // 244:2339
-	0x09, 0x2F, 0x0C, 0x06,  // 245:2351
-	0x09, 0x3B, 0x0C, 0x06,  // 246:2363
-	0x09, 0x47, 0x09, 0x06,  // 247:2375
-	0x09, 0x50, 0x0C, 0x06,  // 248:2384
-	0x09, 0x5C, 0x0C, 0x06,  // 249:2396
-	0x09, 0x68, 0x0C, 0x06,  // 250:2408
-	0x09, 0x74, 0x0C, 0x06,  // 251:2420
-	0x09, 0x80, 0x0C, 0x06,  // 252:2432
-	0x09, 0x8C, 0x0B, 0x06,  // 253:2444
-	0x09, 0x97, 0x0C, 0x06,  // 254:2455
-	0x09, 0xA3, 0x0B, 0x06,  // 255:2467
-
-	// Font Data:
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x02,	// 33
-	0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,	// 34
-	0x80,0x00,0xE0,0x03,0xB8,0x00,0xE0,0x03,0xB8,0x00,0x20,	// 35
-	0x00,0x00,0x60,0x02,0x50,0x02,0xF8,0x07,0x90,0x02,0x90,0x01,	// 36
-	0x38,0x00,0xA8,0x00,0x78,0x00,0xC0,0x03,0xA0,0x02,0x80,0x03,	// 37
-	0x00,0x00,0xC0,0x01,0x38,0x02,0x68,0x02,0x88,0x01,0xC0,0x02,	// 38
-	0x00,0x00,0x00,0x00,0x00,0x00,0x38,	// 39
-	0x00,0x00,0x00,0x00,0xF8,0x03,0x04,0x04,	// 40
-	0x00,0x00,0x00,0x00,0x0C,0x06,0xF0,0x01,	// 41
-	0x00,0x00,0x48,0x00,0x30,0x00,0x78,0x00,0x30,0x00,0x48,	// 42
-	0x00,0x00,0x40,0x00,0x40,0x00,0xF0,0x01,0x40,0x00,0x40,	// 43
-	0x00,0x00,0x00,0x00,0x00,0x0E,	// 44
-	0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x80,	// 45
-	0x00,0x00,0x00,0x00,0x00,0x02,	// 46
-	0x00,0x00,0x00,0x04,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,	// 47
-	0x00,0x00,0xF0,0x01,0x08,0x02,0x48,0x02,0x08,0x02,0xF0,0x01,	// 48
-	0x00,0x00,0x08,0x02,0x08,0x02,0xF8,0x03,0x00,0x02,0x00,0x02,	// 49
-	0x00,0x00,0x10,0x02,0x08,0x03,0x88,0x02,0xC8,0x02,0x70,0x02,	// 50
-	0x00,0x00,0x10,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0xB0,0x01,	// 51
-	0x00,0x00,0xC0,0x00,0xE0,0x00,0x90,0x00,0xF8,0x03,0x80,	// 52
-	0x00,0x00,0x38,0x02,0x28,0x02,0x28,0x02,0x28,0x02,0xC0,0x01,	// 53
-	0x00,0x00,0xF0,0x01,0x58,0x02,0x48,0x02,0x48,0x02,0x88,0x01,	// 54
-	0x00,0x00,0x08,0x00,0x08,0x02,0x88,0x01,0x78,0x00,0x18,	// 55
-	0x00,0x00,0xB0,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0xB0,0x01,	// 56
-	0x00,0x00,0x30,0x02,0x48,0x02,0x48,0x02,0x48,0x03,0xF0,0x01,	// 57
-	0x00,0x00,0x00,0x00,0x20,0x02,	// 58
-	0x00,0x00,0x00,0x00,0x20,0x0E,	// 59
-	0x00,0x00,0x40,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x10,0x01,	// 60
-	0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,	// 61
-	0x00,0x00,0x10,0x01,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x40,	// 62
-	0x00,0x00,0x08,0x00,0xC8,0x02,0x28,0x00,0x18,	// 63
-	0x00,0x00,0xE0,0x03,0x18,0x04,0xE8,0x0B,0x28,0x0A,0xF0,0x03,	// 64
-	0x00,0x00,0x00,0x03,0xE0,0x00,0x98,0x00,0xE0,0x00,0x00,0x03,	// 65
-	0x00,0x00,0xF8,0x03,0x48,0x02,0x48,0x02,0x48,0x02,0xB0,0x01,	// 66
-	0x00,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x08,0x02,0x18,0x03,	// 67
-	0x00,0x00,0xF8,0x03,0x08,0x02,0x08,0x02,0x18,0x03,0xF0,0x01,	// 68
-	0x00,0x00,0xF8,0x03,0x48,0x02,0x48,0x02,0x48,0x02,0x48,0x02,	// 69
-	0x00,0x00,0xF8,0x03,0x48,0x00,0x48,0x00,0x48,0x00,0x48,	// 70
-	0x00,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x48,0x02,0xD0,0x03,	// 71
-	0x00,0x00,0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,	// 72
-	0x00,0x00,0x08,0x02,0x08,0x02,0xF8,0x03,0x08,0x02,0x08,0x02,	// 73
-	0x00,0x00,0x00,0x01,0x08,0x02,0x08,0x02,0xF8,0x01,	// 74
-	0x00,0x00,0xF8,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,	// 75
-	0x00,0x00,0xF8,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,	// 76
-	0x00,0x00,0xF8,0x03,0x30,0x00,0x40,0x00,0x30,0x00,0xF8,0x03,	// 77
-	0x00,0x00,0xF8,0x03,0x30,0x00,0x40,0x00,0x80,0x01,0xF8,0x03,	// 78
-	0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,	// 79
-	0x00,0x00,0xF8,0x03,0x48,0x00,0x48,0x00,0x48,0x00,0x30,	// 80
-	0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x06,0xF0,0x05,	// 81
-	0x00,0x00,0xF8,0x03,0x48,0x00,0x48,0x00,0xC8,0x00,0xB0,0x01,	// 82
-	0x00,0x00,0x30,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0x90,0x01,	// 83
-	0x00,0x00,0x08,0x00,0x08,0x00,0xF8,0x03,0x08,0x00,0x08,	// 84
-	0x00,0x00,0xF8,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0xF8,0x01,	// 85
-	0x00,0x00,0x18,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,	// 86
-	0x38,0x00,0xC0,0x03,0x70,0x00,0x70,0x00,0xC0,0x03,0x38,	// 87
-	0x00,0x00,0x08,0x02,0xB0,0x01,0x40,0x00,0xB0,0x01,0x08,0x02,	// 88
-	0x00,0x00,0x08,0x00,0x30,0x00,0xC0,0x03,0x30,0x00,0x08,	// 89
-	0x00,0x00,0x08,0x02,0x88,0x03,0x48,0x02,0x38,0x02,0x08,0x02,	// 90
-	0x00,0x00,0x00,0x00,0xFC,0x07,0x04,0x04,	// 91
-	0x00,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x04,	// 92
-	0x00,0x00,0x00,0x00,0x04,0x04,0xFC,0x07,	// 93
-	0x20,0x00,0x10,0x00,0x08,0x00,0x10,0x00,0x20,	// 94
-	0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,	// 95
-	0x00,0x00,0x04,0x00,0x08,	// 96
-	0x00,0x00,0x20,0x03,0xA0,0x02,0xA0,0x02,0xA0,0x02,0xC0,0x03,	// 97
-	0x00,0x00,0xFC,0x03,0x20,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,	// 98
-	0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,	// 99
-	0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,0xFC,0x03,	// 100
-	0x00,0x00,0xC0,0x01,0xA0,0x02,0xA0,0x02,0xA0,0x02,0xC0,0x02,	// 101
-	0x00,0x00,0x20,0x00,0xF8,0x03,0x24,0x00,0x24,	// 102
-	0x00,0x00,0xC0,0x01,0x20,0x0A,0x20,0x0A,0x20,0x0A,0xE0,0x07,	// 103
-	0x00,0x00,0xFC,0x03,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x03,	// 104
-	0x00,0x00,0x00,0x02,0x20,0x02,0xE4,0x03,0x00,0x02,0x00,0x02,	// 105
-	0x00,0x00,0x20,0x08,0x20,0x08,0xE4,0x07,	// 106
-	0x00,0x00,0xFC,0x03,0x80,0x00,0xC0,0x00,0x20,0x01,0x00,0x02,	// 107
-	0x04,0x00,0x04,0x00,0xFC,0x01,0x00,0x02,0x00,0x02,	// 108
-	0x00,0x00,0xE0,0x03,0x20,0x00,0xE0,0x03,0x20,0x00,0xE0,0x03,	// 109
-	0x00,0x00,0xE0,0x03,0x40,0x00,0x20,0x00,0x20,0x00,0xC0,0x03,	// 110
-	0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,	// 111
-	0x00,0x00,0xE0,0x0F,0x20,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,	// 112
-	0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x02,0x20,0x02,0xE0,0x0F,	// 113
-	0x00,0x00,0x00,0x00,0xE0,0x03,0x20,0x00,0x20,0x00,0x60,	// 114
-	0x00,0x00,0x40,0x02,0xA0,0x02,0xA0,0x02,0xA0,0x02,0xA0,0x01,	// 115
-	0x00,0x00,0x20,0x00,0xF8,0x03,0x20,0x02,0x20,0x02,	// 116
-	0x00,0x00,0xE0,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0xE0,0x03,	// 117
-	0x00,0x00,0x20,0x00,0xC0,0x01,0x00,0x02,0xC0,0x01,0x20,	// 118
-	0x00,0x00,0x60,0x00,0x80,0x03,0x40,0x00,0x80,0x03,0x60,	// 119
-	0x00,0x00,0x20,0x02,0x60,0x03,0x80,0x00,0x60,0x03,0x20,0x02,	// 120
-	0x00,0x00,0x20,0x08,0xC0,0x08,0x00,0x07,0xC0,0x00,0x20,	// 121
-	0x00,0x00,0x20,0x02,0x20,0x03,0xA0,0x02,0x60,0x02,0x20,0x02,	// 122
-	0x00,0x00,0x40,0x00,0x40,0x00,0xBC,0x07,0x04,0x04,	// 123
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x0F,	// 124
-	0x00,0x00,0x00,0x00,0x04,0x04,0xBC,0x07,0x40,0x00,0x40,	// 125
-	0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x80,	// 126
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 127
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 128
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 129
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 130
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 131
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 132
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 133
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 134
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 135
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 136
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 137
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 138
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 139
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 140
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 141
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 142
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 143
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 144
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 145
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 146
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 147
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 148
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 149
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 150
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 151
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 152
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 153
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 154
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 155
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 156
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 157
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 158
-	0x00,0x00,0xF8,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,0x0F,	// 159
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x0F,	// 161
-	0x00,0x00,0xC0,0x01,0x20,0x02,0xF0,0x0F,0x20,0x02,	// 162
-	0x00,0x00,0x40,0x02,0xF0,0x03,0x48,0x02,0x48,0x02,0x08,0x02,	// 163
-	0x00,0x00,0x10,0x01,0xE0,0x00,0xA0,0x00,0xE0,0x00,0x10,0x01,	// 164
-	0x00,0x00,0xA8,0x00,0xB0,0x00,0xC0,0x03,0xB0,0x00,0xA8,	// 165
-	0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x0F,	// 166
-	0x00,0x00,0xD8,0x04,0xA8,0x04,0x68,0x05,0xC8,0x06,	// 167
-	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,	// 168
-	0xE0,0x00,0x18,0x03,0x68,0x02,0x98,0x02,0x98,0x03,0xE0,	// 169
-	0x00,0x00,0x78,0x01,0x58,0x01,0x58,0x01,0x78,0x01,	// 170
-	0x00,0x00,0xC0,0x00,0x20,0x01,0xC0,0x00,0x20,0x01,	// 171
-	0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xC0,	// 172
-	0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x80,	// 173
-	0xE0,0x00,0x18,0x03,0xF8,0x02,0x78,0x02,0xB8,0x03,0xE0,	// 174
-	0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x08,	// 175
-	0x00,0x00,0x38,0x00,0x28,0x00,0x38,	// 176
-	0x00,0x00,0x40,0x02,0x40,0x02,0xF0,0x03,0x40,0x02,0x40,0x02,	// 177
-	0x00,0x00,0x00,0x00,0x48,0x00,0x68,0x00,0x58,	// 178
-	0x00,0x00,0x00,0x00,0x48,0x00,0x58,0x00,0x68,	// 179
-	0x00,0x00,0x00,0x00,0x08,0x00,0x04,	// 180
-	0x00,0x00,0xE0,0x0F,0x00,0x02,0x00,0x02,0x00,0x02,0xE0,0x03,	// 181
-	0x00,0x00,0x30,0x00,0x78,0x00,0xF8,0x07,0x08,0x00,0xF8,0x07,	// 182
-	0x00,0x00,0x00,0x00,0xC0,	// 183
-	0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0C,	// 184
-	0x00,0x00,0x00,0x00,0x48,0x00,0x78,0x00,0x40,	// 185
-	0x00,0x00,0x30,0x01,0x48,0x01,0x48,0x01,0x30,0x01,	// 186
-	0x00,0x00,0x20,0x01,0xC0,0x00,0x20,0x01,0xC0,	// 187
-	0x80,0x00,0xA4,0x00,0xFC,0x06,0x60,0x06,0x40,0x0F,0x00,0x04,	// 188
-	0x80,0x00,0xA4,0x00,0xFC,0x00,0x60,0x09,0x40,0x0D,0x00,0x0B,	// 189
-	0x80,0x00,0xA4,0x00,0xEC,0x06,0x74,0x06,0x40,0x0F,0x00,0x04,	// 190
-	0x00,0x00,0x00,0x0C,0x00,0x0A,0xA0,0x09,0x00,0x08,	// 191
-	0x00,0x00,0x00,0x03,0xE1,0x00,0x9A,0x00,0xE0,0x00,0x00,0x03,	// 192
-	0x00,0x00,0x00,0x03,0xE0,0x00,0x9A,0x00,0xE1,0x00,0x00,0x03,	// 193
-	0x00,0x00,0x00,0x03,0xE2,0x00,0x99,0x00,0xE2,0x00,0x00,0x03,	// 194
-	0x00,0x00,0x00,0x03,0xE3,0x00,0x9A,0x00,0xE1,0x00,0x00,0x03,	// 195
-	0x00,0x00,0x00,0x03,0xE2,0x00,0x98,0x00,0xE2,0x00,0x00,0x03,	// 196
-	0x00,0x00,0x00,0x03,0xE6,0x00,0x9A,0x00,0xE6,0x00,0x00,0x03,	// 197
-	0x00,0x03,0xE0,0x00,0x98,0x00,0xF8,0x03,0x48,0x02,0x48,0x02,	// 198
-	0x00,0x00,0xF0,0x01,0x18,0x0B,0x08,0x0E,0x08,0x02,0x18,0x03,	// 199
-	0x00,0x00,0xF8,0x03,0x49,0x02,0x4A,0x02,0x48,0x02,0x48,0x02,	// 200
-	0x00,0x00,0xF8,0x03,0x48,0x02,0x4A,0x02,0x49,0x02,0x48,0x02,	// 201
-	0x00,0x00,0xF8,0x03,0x4A,0x02,0x49,0x02,0x4A,0x02,0x48,0x02,	// 202
-	0x00,0x00,0xF8,0x03,0x4A,0x02,0x48,0x02,0x4A,0x02,0x48,0x02,	// 203
-	0x00,0x00,0x08,0x02,0x09,0x02,0xFA,0x03,0x08,0x02,0x08,0x02,	// 204
-	0x00,0x00,0x08,0x02,0x08,0x02,0xFA,0x03,0x09,0x02,0x08,0x02,	// 205
-	0x00,0x00,0x08,0x02,0x0A,0x02,0xF9,0x03,0x0A,0x02,0x08,0x02,	// 206
-	0x00,0x00,0x08,0x02,0x0A,0x02,0xF8,0x03,0x0A,0x02,0x08,0x02,	// 207
-	0x40,0x00,0xF8,0x03,0x48,0x02,0x08,0x02,0x18,0x03,0xF0,0x01,	// 208
-	0x00,0x00,0xF8,0x03,0x33,0x00,0x42,0x00,0x81,0x01,0xF8,0x03,	// 209
-	0x00,0x00,0xF0,0x01,0x09,0x02,0x0A,0x02,0x08,0x02,0xF0,0x01,	// 210
-	0x00,0x00,0xF0,0x01,0x08,0x02,0x0A,0x02,0x09,0x02,0xF0,0x01,	// 211
-	0x00,0x00,0xF0,0x01,0x0A,0x02,0x09,0x02,0x0A,0x02,0xF0,0x01,	// 212
-	0x00,0x00,0xF0,0x01,0x0B,0x02,0x0A,0x02,0x09,0x02,0xF0,0x01,	// 213
-	0x00,0x00,0xF0,0x01,0x0A,0x02,0x08,0x02,0x0A,0x02,0xF0,0x01,	// 214
-	0x00,0x00,0x20,0x02,0x40,0x01,0x80,0x00,0x40,0x01,0x20,0x02,	// 215
-	0x00,0x02,0xF0,0x01,0x88,0x02,0x48,0x02,0x28,0x02,0xF8,0x01,	// 216
-	0x00,0x00,0xF8,0x01,0x01,0x02,0x02,0x02,0x00,0x02,0xF8,0x01,	// 217
-	0x00,0x00,0xF8,0x01,0x00,0x02,0x02,0x02,0x01,0x02,0xF8,0x01,	// 218
-	0x00,0x00,0xF8,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0xF8,0x01,	// 219
-	0x00,0x00,0xF8,0x01,0x02,0x02,0x00,0x02,0x02,0x02,0xF8,0x01,	// 220
-	0x00,0x00,0x08,0x00,0x30,0x00,0xC2,0x03,0x31,0x00,0x08,	// 221
-	0x00,0x00,0xF8,0x03,0x90,0x00,0x90,0x00,0x90,0x00,0x60,	// 222
-	0x00,0x00,0xF8,0x03,0x04,0x00,0x74,0x02,0x98,0x02,0x80,0x03,	// 223
-	0x00,0x00,0x24,0x03,0xA8,0x02,0xA0,0x02,0xA0,0x02,0xC0,0x03,	// 224
-	0x00,0x00,0x20,0x03,0xA8,0x02,0xA4,0x02,0xA0,0x02,0xC0,0x03,	// 225
-	0x00,0x00,0x28,0x03,0xA4,0x02,0xA8,0x02,0xA0,0x02,0xC0,0x03,	// 226
-	0x00,0x00,0x28,0x03,0xA4,0x02,0xA8,0x02,0xA4,0x02,0xC0,0x03,	// 227
-	0x00,0x00,0x20,0x03,0xA4,0x02,0xA0,0x02,0xA4,0x02,0xC0,0x03,	// 228
-	0x00,0x00,0x20,0x03,0xAE,0x02,0xAA,0x02,0xAE,0x02,0xC0,0x03,	// 229
-	0x00,0x00,0xA0,0x03,0xA0,0x02,0xC0,0x01,0xA0,0x02,0xE0,0x02,	// 230
-	0x00,0x00,0xC0,0x01,0x20,0x02,0x20,0x0A,0x20,0x0E,	// 231
-	0x00,0x00,0xC4,0x01,0xA8,0x02,0xA0,0x02,0xA0,0x02,0xC0,0x02,	// 232
-	0x00,0x00,0xC0,0x01,0xA8,0x02,0xA4,0x02,0xA0,0x02,0xC0,0x02,	// 233
-	0x00,0x00,0xC8,0x01,0xA4,0x02,0xA8,0x02,0xA0,0x02,0xC0,0x02,	// 234
-	0x00,0x00,0xC0,0x01,0xA4,0x02,0xA0,0x02,0xA4,0x02,0xC0,0x02,	// 235
-	0x00,0x00,0x04,0x02,0x28,0x02,0xE0,0x03,0x00,0x02,0x00,0x02,	// 236
-	0x00,0x00,0x00,0x02,0x28,0x02,0xE4,0x03,0x00,0x02,0x00,0x02,	// 237
-	0x00,0x00,0x08,0x02,0x24,0x02,0xE8,0x03,0x00,0x02,0x00,0x02,	// 238
-	0x00,0x00,0x00,0x02,0x24,0x02,0xE0,0x03,0x04,0x02,0x00,0x02,	// 239
-	0x00,0x00,0xC0,0x01,0x2C,0x02,0x28,0x02,0x38,0x02,0xE0,0x01,	// 240
-	0x00,0x00,0xE8,0x03,0x44,0x00,0x28,0x00,0x24,0x00,0xC0,0x03,	// 241
-	0x00,0x00,0xC4,0x01,0x28,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,	// 242
-	0x00,0x00,0xC0,0x01,0x28,0x02,0x24,0x02,0x20,0x02,0xC0,0x01,	// 243
-	0x00,0x00,0xC0,0x01,0x28,0x02,0x24,0x02,0x28,0x02,0xC0,0x01,	// 244
-	0x00,0x00,0xC8,0x01,0x24,0x02,0x2C,0x02,0x28,0x02,0xC4,0x01,	// 245
-	0x00,0x00,0xC0,0x01,0x24,0x02,0x20,0x02,0x24,0x02,0xC0,0x01,	// 246
-	0x40,0x00,0x40,0x00,0x50,0x01,0x40,0x00,0x40,	// 247
-	0x00,0x00,0xC0,0x03,0x20,0x03,0xA0,0x02,0x60,0x02,0xE0,0x01,	// 248
-	0x00,0x00,0xE4,0x01,0x08,0x02,0x00,0x02,0x00,0x02,0xE0,0x03,	// 249
-	0x00,0x00,0xE0,0x01,0x08,0x02,0x04,0x02,0x00,0x02,0xE0,0x03,	// 250
-	0x00,0x00,0xE0,0x01,0x08,0x02,0x04,0x02,0x08,0x02,0xE0,0x03,	// 251
-	0x00,0x00,0xE0,0x01,0x04,0x02,0x00,0x02,0x04,0x02,0xE0,0x03,	// 252
-	0x00,0x00,0x20,0x08,0xC8,0x08,0x04,0x07,0xC0,0x00,0x20,	// 253
-	0x00,0x00,0xFC,0x0F,0x20,0x02,0x20,0x02,0x20,0x02,0xC0,0x01,	// 254
-	0x00,0x00,0x20,0x08,0xC4,0x08,0x00,0x07,0xC4,0x00,0x20	// 255
-};
@@ -16,6 +16,7 @@
 #endif
 
 #include <ESP8266WiFi.h>
+#include "SyncMonitor.h"
 
 // FS_DEBUG:      full verbose debug over serial
 // FS_DEBUG_LED:  just blink LED (off = adjust phase, on = normal phase)
@@ -37,6 +38,7 @@ namespace MeasurePeriod {
     void _risingEdgeISR_measure();
 
     void start() {
+        syncMonitorPause(); // takes over the pin until the sample is done
         startTime = 0;
         stopTime = 0;
         armed = 0;
@@ -46,9 +48,7 @@ namespace MeasurePeriod {
     void ICACHE_RAM_ATTR _risingEdgeISR_prepare()
     {
         noInterrupts();
-        //startTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(startTime));
+        startTime = ESP.getCycleCount(); // inline, the same rsr ccount
         detachInterrupt(DEBUG_IN_PIN);
         armed = 1;
         attachInterrupt(DEBUG_IN_PIN, _risingEdgeISR_measure, RISING);
@@ -58,9 +58,7 @@ namespace MeasurePeriod {
     void ICACHE_RAM_ATTR _risingEdgeISR_measure()
     {
         noInterrupts();
-        //stopTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(stopTime));
+        stopTime = ESP.getCycleCount(); // inline, the same rsr ccount
         detachInterrupt(DEBUG_IN_PIN);
         interrupts();
     }
@@ -136,6 +134,7 @@ private:
         }
         *start = MeasurePeriod::startTime;
         *stop = MeasurePeriod::stopTime;
+        syncMonitorResume();
         ESP.wdtEnable(0);
         WiFi.setSleepMode(WIFI_NONE_SLEEP);
 
@@ -303,6 +302,13 @@ public:
         delayLock = 0;
     }
 
+    // htotal came from an earlier init() for the same source and preset
+    static void assumeReady()
+    {
+        syncLockReady = true;
+        delayLock = 0;
+    }
+
     static uint16_t init()
     {
         uint32_t bestHTotal = 0;
@@ -384,6 +390,7 @@ public:
         }
         *start = MeasurePeriod::startTime;
         *stop = MeasurePeriod::stopTime;
+        syncMonitorResume();
         ESP.wdtEnable(0);
         WiFi.setSleepMode(WIFI_NONE_SLEEP);
 
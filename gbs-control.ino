@@ -20,7 +20,7 @@
 #include <Wire.h>
 #include "tv5725.h"
 #include "osd.h"
-#include "SSD1306Wire.h"
+#include "SSD1306PagedWire.h"
 #include "images.h"
 
 #define HAVE_BUTTONS 0
@@ -30,7 +30,7 @@
 static inline void writeBytes(uint8_t slaveRegister, uint8_t *values, uint8_t numValues);
 const uint8_t *loadPresetFromSPIFFS(byte forVideoMode);
 
-SSD1306Wire display(0x3c, D2, D1); //inits I2C address & pins for OLED
+SSD1306PagedWire display(0x3c, D2, D1); //inits I2C address & pins for OLED, only sends changed pages
 const int pin_clk = 14;            //D5 = GPIO14 (input of one direction for encoder)
 const int pin_data = 13;           //D7 = GPIO13	(input of one direction for encoder)
 const int pin_switch = 0;          //D3 = GPIO0 pulled HIGH, else boot fail (middle push button for encoder)
@@ -86,6 +86,21 @@ volatile int oled_sub_pointer = 0;
 // See 3rdparty/WebSockets for unmodified source and license
 #include "src/WebSockets.h"
 #include "src/WebSocketsServer.h"
+#include "RegisterTable.h"
+#include "RegisterWatch.h"
+#include "BackupArchive.h"
+#include "UserPrefs.h"
+#include "Storage.h"
+#include "PresetFiles.h"
+#include "RamFS.h"
+#include "HeapTelemetry.h"
+#include "BootProfile.h"
+#include "SourceIndex.h"
+#include "ModeSwitchProfile.h"
+#include "SyncMonitor.h"
+#include "Estimators.h"
+#include "InputProbe.h"
+#include "SogSearch.h"
 
 // Optional:
 // ESP8266-ping library to aid debugging WiFi issues, install via Arduino library manager
@@ -139,6 +154,44 @@ DNSServer dnsServer;
 WebSocketsServer webSocket(81);
 //AsyncWebSocket webSocket("/ws");
 PersWiFiManager persWM(server, dnsServer);
+RegisterWatch registerWatch;
+BackupReader backupReader;
+
+// saveUserPrefs() only marks the preferences dirty, they go to flash once changes stop coming in
+#define PREFS_QUIET_MS 2000      // write after this long without further changes
+#define PREFS_MAX_DELAY_MS 20000 // but no later than this after the first pending change
+#define PREFS_RETRY_MAX_MS 60000 // a failed write is retried after the quiet period, doubled per failure up to this
+struct UserPrefsState
+{
+    bool dirty;
+    unsigned long firstChange;
+    unsigned long lastChange;
+    uint32_t writes;
+    uint32_t avoided; // saves that were merged into an already pending write
+    uint8_t failures; // writes failed in a row
+} userPrefs;
+
+// results of the last good boot, see BootProfile.h
+struct BootState
+{
+    BootCache cache;   // what this boot found, stored after the first picture
+    BootCache stored;  // what was on flash, to skip writing an unchanged cache
+    bool fast;         // stored results are used, shortened delays
+    bool pictureShown; // first stable picture since boot
+} boot;
+
+// tuning of the current source, see SourceIndex.h
+struct SourceState
+{
+    SourceTuning tuning; // from the index or learned, hash set once fingerprinted
+    bool fingerprinted;  // measured since the last preset load
+    bool known;          // tuning came from the index and was applied
+    bool stored;         // learned tuning was written back
+    bool htotalFromLast; // best htotal was taken from the lastHash entry, before fingerprinting
+    uint8_t videoMode;   // videoStandardInput when fingerprinted
+    uint32_t lastHash;   // fingerprint from before the last reset, preset loads mostly keep the source
+    uint8_t lastVideoMode;
+} source;
 
 #define DEBUG_IN_PIN D6 // marked "D12/MISO/D6" (Wemos D1) or D6 (Lolin NodeMCU)
 // SCL = D1 (Lolin), D15 (Wemos D1) // ESP8266 Arduino default map: SCL
@@ -154,27 +207,6 @@ PersWiFiManager persWM(server, dnsServer);
 // but only "D7" and "D6" have been tested so far
 #define digitalRead(x) ((GPIO_REG_READ(GPIO_IN_ADDRESS) >> x) & 1)
 
-// feed the current measurement, get back the moving average
-uint8_t getMovingAverage(uint8_t item)
-{
-    static const uint8_t sz = 16;
-    static uint8_t arr[sz] = {0};
-    static uint8_t pos = 0;
-
-    arr[pos] = item;
-    if (pos < (sz - 1)) {
-        pos++;
-    } else {
-        pos = 0;
-    }
-
-    uint16_t sum = 0;
-    for (uint8_t i = 0; i < sz; i++) {
-        sum += arr[i];
-    }
-    return sum >> 4; // for array size 16
-}
-
 struct MenuAttrs
 {
     static const int8_t shiftDelta = 4;
@@ -200,8 +232,6 @@ struct userOptions *uopt = &uopts;
 struct adcOptions adcopts;
 struct adcOptions *adco = &adcopts;
 
-String slotIndexMap = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,";
-
 char serialCommand;               // Serial / Web Server commands
 char userCommand;               // Serial / Web Server commands
 static uint8_t lastSegment = 0xFF; // GBS segment for direct access
@@ -213,7 +243,7 @@ class SerialMirror : public Stream
 {
     size_t write(const uint8_t *data, size_t size)
     {
-        if (ESP.getFreeHeap() > 20000) {
+        if (heapAvailable(HeapUser::SerialMirror, HEAP_RESERVE_SERIAL_MIRROR)) {
             webSocket.broadcastTXT(data, size);
         } else {
             webSocket.disconnect();
@@ -224,7 +254,7 @@ class SerialMirror : public Stream
 
     size_t write(const char *data, size_t size)
     {
-        if (ESP.getFreeHeap() > 20000) {
+        if (heapAvailable(HeapUser::SerialMirror, HEAP_RESERVE_SERIAL_MIRROR)) {
             webSocket.broadcastTXT(data, size);
         } else {
             webSocket.disconnect();
@@ -235,7 +265,7 @@ class SerialMirror : public Stream
 
     size_t write(uint8_t data)
     {
-        if (ESP.getFreeHeap() > 20000) {
+        if (heapAvailable(HeapUser::SerialMirror, HEAP_RESERVE_SERIAL_MIRROR)) {
             webSocket.broadcastTXT(&data, 1);
         } else {
             webSocket.disconnect();
@@ -246,7 +276,7 @@ class SerialMirror : public Stream
 
     size_t write(char data)
     {
-        if (ESP.getFreeHeap() > 20000) {
+        if (heapAvailable(HeapUser::SerialMirror, HEAP_RESERVE_SERIAL_MIRROR)) {
             webSocket.broadcastTXT(&data, 1);
         } else {
             webSocket.disconnect();
@@ -1341,25 +1371,76 @@ boolean optimizePhaseSP()
     return 1;
 }
 
-void optimizeSogLevel()
+// Sets the level and measures it: HSACT has to hold (a quarter of the reads missing can never
+// pass, so that ends the probe early), HLOW_LEN has to stay put, then sync pulses on the test bus,
+// the STATUS_16 flags and no SOG bad interrupt. Expects the test bus on the SP, see searchSogLevel().
+SogQuality probeSogLevel(uint8_t level)
 {
-    if (rto->boardHasPower == false) // checkBoardPower is too invasive now
-    {
-        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
-        return;
-    }
-    if (rto->videoStandardInput == 15 || GBS::SP_SOG_MODE::read() != 1 || rto->syncTypeCsync == false) {
-        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
-        return;
+    SogQuality quality;
+    memset(&quality, 0, sizeof(quality));
+    sogSearchProbe();
+    setAndUpdateSogLevel(level);
+    delay(8); // time for sog to settle
+    resetInterruptSogBadBit();
+
+    quality.hlowMin = quality.hlowMax = GBS::STATUS_SYNC_PROC_HLOW_LEN::read();
+    uint8_t reads = 0;
+    unsigned long timeout = millis();
+    while (quality.hsActive < SOG_PROBE_GOOD + 3 * quality.hsMissed && (millis() - timeout) < SOG_PROBE_MS) {
+        if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+            quality.hsActive++;
+        } else {
+            quality.hsMissed++;
+            if (quality.hsMissed >= 8 && 3 * quality.hsMissed >= quality.hsActive) {
+                break;
+            }
+        }
+        if ((++reads & 7) == 0) {
+            uint16_t hlow = GBS::STATUS_SYNC_PROC_HLOW_LEN::read();
+            if (hlow < quality.hlowMin) {
+                quality.hlowMin = hlow;
+            } else if (hlow > quality.hlowMax) {
+                quality.hlowMax = hlow;
+            }
+        }
     }
 
-    if (rto->inputIsYpBpR) {
-        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 14;
-    } else {
-        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13; // similar to yuv, allow variations
+    if (quality.hsActive >= SOG_PROBE_GOOD + 3 * quality.hsMissed && GBS::TEST_BUS_2F::read() > 0) {
+        delay(20);
+        quality.testBus = true;
+        for (uint8_t a = 0; a < 50; a++) {
+            if (GBS::STATUS_SYNC_PROC_HSACT::read() == 0 || GBS::TEST_BUS_2F::read() == 0) {
+                quality.testBus = false;
+                break;
+            }
+        }
     }
-    setAndUpdateSogLevel(rto->currentLevelSOG);
+    quality.spHsStable = getStatus16SpHsStable();
+    quality.sogBad = GBS::STATUS_INT_SOG_BAD::read() == 1;
+    return quality;
+}
+
+// Stricter than the old test (HSACT and TEST_BUS_2F only): HLOW_LEN has to hold still and
+// STATUS_16 has to show stable HS without a SOG bad interrupt. Levels where video just starts
+// to get sliced into sync used to pass, so the level found can be lower than before.
+boolean sogLevelWorks(uint8_t level)
+{
+    SogQuality quality = probeSogLevel(level);
+    // a few clocks of jitter, about 1/8 of the pulse
+    boolean hlowStable = quality.hlowMax - quality.hlowMin <= quality.hlowMax / 8 + 4;
+    return quality.testBus && hlowStable && quality.spHsStable && !quality.sogBad;
+}
 
+// Highest level in 1..top that works, 0 if none does. Assumes the working levels form one range:
+// above it sync pulses get lost, below it video gets sliced into sync. A level the index has for
+// this source is taken as soon as it works, before the source is fingerprinted again (after a
+// preset load or a lost source) that is the entry of the last fingerprint. Otherwise the last level
+// found is checked along with the one above, and failing that levels are tried from the top
+// SOG_SEARCH_STRIDE apart until one works, and the last step is bisected. A handful of probes
+// instead of one per level.
+uint8_t searchSogLevel(uint8_t top)
+{
+    sogSearchStart();
     uint8_t debug_backup = GBS::TEST_BUS_SEL::read();
     uint8_t debug_backup_SP = GBS::TEST_BUS_SP_SEL::read();
     if (debug_backup != 0xa) {
@@ -1370,64 +1451,61 @@ void optimizeSogLevel()
         GBS::TEST_BUS_SP_SEL::write(0x0f);
         delay(1);
     }
-
     GBS::TEST_BUS_EN::write(1);
 
-    delay(100);
-    while (1) {
-        uint16_t syncGoodCounter = 0;
-        unsigned long timeout = millis();
-        while ((millis() - timeout) < 60) {
-            if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
-                syncGoodCounter++;
-                if (syncGoodCounter >= 60) {
-                    break;
-                }
-            } else if (syncGoodCounter >= 4) {
-                syncGoodCounter -= 3;
+    uint8_t works = 0;      // highest level seen working
+    uint8_t fails = top + 1; // lowest level above it seen failing
+    bool cached = source.known && source.tuning.sogLevel > 0;
+    uint8_t hint = cached ? source.tuning.sogLevel : rto->thisSourceMaxLevelSOG;
+    SourceTuning last;
+    if (!cached && !source.fingerprinted && source.lastHash != 0 && findSourceTuning(source.lastHash, last) &&
+        last.sogLevel > 0) {
+        // not measured yet, fingerprinting needs working sync. The level belongs to the source, not the preset.
+        cached = true;
+        hint = last.sogLevel;
+    }
+    if (hint >= 1 && hint <= top && sogLevelWorks(hint)) {
+        works = hint;
+        if (cached) {
+            fails = works + 1; // done
+        } else if (works < top) {
+            // usually the same source again, then the level above fails
+            if (sogLevelWorks(works + 1)) {
+                works++;
+            } else {
+                fails = works + 1;
             }
         }
-
-        if (syncGoodCounter >= 60) {
-            syncGoodCounter = 0;
-            //if (getVideoMode() != 0) {
-            if (GBS::TEST_BUS_2F::read() > 0) {
-                delay(20);
-                for (int a = 0; a < 50; a++) {
-                    syncGoodCounter++;
-                    if (GBS::STATUS_SYNC_PROC_HSACT::read() == 0 || GBS::TEST_BUS_2F::read() == 0) {
-                        syncGoodCounter = 0;
-                        break;
-                    }
-                }
-                if (syncGoodCounter >= 49) {
-                    //SerialM.print("OK @SOG "); SerialM.println(rto->currentLevelSOG); printInfo();
-                    break; // found, exit
-                } else {
-                    //Serial.print(" inner test failed syncGoodCounter: "); Serial.println(syncGoodCounter);
-                }
-            } else { // getVideoMode() == 0
-                     //Serial.print("sog-- syncGoodCounter: "); Serial.println(syncGoodCounter);
+    }
+    if (works == 0) {
+        // a level that fails here may be below the range, only trust the ones from the top down
+        int8_t level = top;
+        while (1) {
+            if (sogLevelWorks(level)) {
+                works = level;
+                break;
+            }
+            fails = level;
+            if (level == 1) {
+                break;
             }
-        } else { // syncGoodCounter < 40
-                 //Serial.print("outer test failed syncGoodCounter: "); Serial.println(syncGoodCounter);
+            level = level > SOG_SEARCH_STRIDE ? level - SOG_SEARCH_STRIDE : 1;
         }
-
-        if (rto->currentLevelSOG >= 2) {
-            rto->currentLevelSOG -= 1;
-            setAndUpdateSogLevel(rto->currentLevelSOG);
-            delay(8); // time for sog to settle
-        } else {
-            rto->currentLevelSOG = 13; // leave at default level
-            setAndUpdateSogLevel(rto->currentLevelSOG);
-            delay(8);
-            break; // break and exit
+        // a range narrower than the stride fell between the steps, try the ones skipped
+        for (level = top - 1; works == 0 && level > 1; level--) {
+            if ((top - level) % SOG_SEARCH_STRIDE != 0 && sogLevelWorks(level)) {
+                works = level;
+                fails = level + 1;
+            }
         }
     }
-
-    rto->thisSourceMaxLevelSOG = rto->currentLevelSOG;
-    if (rto->thisSourceMaxLevelSOG == 0) {
-        rto->thisSourceMaxLevelSOG = 1; // fail safe
+    while (works > 0 && fails - works > 1) {
+        uint8_t middle = (works + fails) / 2;
+        if (sogLevelWorks(middle)) {
+            works = middle;
+        } else {
+            fails = middle;
+        }
     }
 
     if (debug_backup != 0xa) {
@@ -1436,218 +1514,277 @@ void optimizeSogLevel()
     if (debug_backup_SP != 0x0f) {
         GBS::TEST_BUS_SP_SEL::write(debug_backup_SP);
     }
+    sogSearchEnd(works);
+    return works;
+}
+
+void optimizeSogLevel()
+{
+    if (rto->boardHasPower == false) // checkBoardPower is too invasive now
+    {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
+        return;
+    }
+    if (rto->videoStandardInput == 15 || GBS::SP_SOG_MODE::read() != 1 || rto->syncTypeCsync == false) {
+        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG = 13;
+        return;
+    }
+
+    // 14 for yuv, 13 for rgb is similar, allow variations
+    uint8_t top = rto->inputIsYpBpR ? 14 : 13;
+    setAndUpdateSogLevel(top);
+    delay(100);
+
+    uint8_t level = searchSogLevel(top);
+    if (level == 0) {
+        level = 13; // leave at default level
+    }
+    if (level != rto->currentLevelSOG) {
+        setAndUpdateSogLevel(level);
+        delay(8);
+    }
+    rto->thisSourceMaxLevelSOG = level;
+}
+
+// One time sliced pass over both inputs, the input found last first. Leaves the chosen input selected,
+// otherwise the one to start with next time.
+int8_t probeInputs(InputEvidence evidence[2])
+{
+    memset(evidence, 0, 2 * sizeof(InputEvidence));
+    const uint8_t first = inputProbeFirst(GBS::ADC_INPUT_SEL::read());
+    uint8_t input = first;
+    inputProbeStart();
+    for (uint8_t slice = 0; slice < INPUT_PROBE_SLICES; slice++) {
+        GBS::ADC_INPUT_SEL::write(input);
+        handleWiFi(0);
+        unsigned long sliceStart = millis();
+        delay(INPUT_PROBE_SETTLE_MS);
+        while (millis() - sliceStart < INPUT_PROBE_SLICE_MS) {
+            evidence[input].samples++;
+            if (getStatus16SpHsStable()) {
+                evidence[input].stable++;
+            }
+            delay(INPUT_PROBE_SAMPLE_MS);
+        }
+        if (inputConfident(evidence[input])) {
+            inputProbeFound(input, inputConfidence(evidence[input]));
+            return input;
+        }
+        input = !input; // can only be 1 or 0
+    }
+
+    int8_t best = inputProbeDecide(evidence);
+    GBS::ADC_INPUT_SEL::write(best == INPUT_PROBE_NONE ? first : best);
+    if (best != INPUT_PROBE_NONE) {
+        delay(INPUT_PROBE_SETTLE_MS);
+        inputProbeFound(best, inputConfidence(evidence[best]));
+    }
+    return best;
 }
 
 // GBS boards have 2 potential sync sources:
 // - RCA connectors
 // - VGA input / 5 pin RGBS header / 8 pin VGA header (all 3 are shared electrically)
-// This routine looks for sync on the currently active input. If it finds it, the input is returned.
-// If it doesn't find sync, it switches the input and returns 0, so that an active input will be found eventually.
+// This routine looks for sync on both inputs in one pass, see InputProbe.h. If it finds it, the input is
+// selected and returned. If it doesn't find sync, it returns 0, the next run looks again.
 uint8_t detectAndSwitchToActiveInput()
 { // if any
-    uint8_t currentInput = GBS::ADC_INPUT_SEL::read();
-    unsigned long timeout = millis();
-    while (millis() - timeout < 450) {
-        delay(10);
-        handleWiFi(0);
+    InputEvidence evidence[2];
+    int8_t activeInput = probeInputs(evidence);
+    if (activeInput == INPUT_PROBE_NONE) {
+        return 0;
+    }
+    uint8_t currentInput = activeInput;
+    SerialM.print(F("Activity detected, input: "));
+    if (currentInput == 1)
+        SerialM.print("RGB");
+    else
+        SerialM.print(F("Component"));
+    SerialM.print(F(" ("));
+    SerialM.print(inputConfidence(evidence[currentInput]));
+    SerialM.println(F("%)"));
 
-        boolean stable = getStatus16SpHsStable();
-        if (stable) {
-            currentInput = GBS::ADC_INPUT_SEL::read();
-            SerialM.print(F("Activity detected, input: "));
-            if (currentInput == 1)
-                SerialM.println("RGB");
-            else
-                SerialM.println(F("Component"));
+    if (currentInput == 1) { // RGBS or RGBHV
+        boolean vsyncActive = 0;
+        rto->inputIsYpBpR = false; // declare for MD
+        rto->currentLevelSOG = 13; // test startup with MD and MS separately!
+        setAndUpdateSogLevel(rto->currentLevelSOG);
+
+        unsigned long timeOutStart = millis();
+        // vsync test
+        // 360ms good up to 5_34 SP_V_TIMER_VAL = 0x0b
+        while (!vsyncActive && ((millis() - timeOutStart) < 360)) {
+            vsyncActive = GBS::STATUS_SYNC_PROC_VSACT::read();
+            handleWiFi(0); // wifi stack
+            delay(1);
+        }
 
-            if (currentInput == 1) { // RGBS or RGBHV
-                boolean vsyncActive = 0;
-                rto->inputIsYpBpR = false; // declare for MD
-                rto->currentLevelSOG = 13; // test startup with MD and MS separately!
-                setAndUpdateSogLevel(rto->currentLevelSOG);
+        // if VSync is active, it's RGBHV or RGBHV with CSync on HS pin
+        if (vsyncActive) {
+            SerialM.println(F("VSync: present"));
+            GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely than EDTV
+            boolean hsyncActive = 0;
 
-                unsigned long timeOutStart = millis();
-                // vsync test
-                // 360ms good up to 5_34 SP_V_TIMER_VAL = 0x0b
-                while (!vsyncActive && ((millis() - timeOutStart) < 360)) {
-                    vsyncActive = GBS::STATUS_SYNC_PROC_VSACT::read();
-                    handleWiFi(0); // wifi stack
-                    delay(1);
+            timeOutStart = millis();
+            while (!hsyncActive && millis() - timeOutStart < 400) {
+                hsyncActive = GBS::STATUS_SYNC_PROC_HSACT::read();
+                handleWiFi(0); // wifi stack
+                delay(1);
+            }
+
+            if (hsyncActive) {
+                SerialM.print(F("HSync: present"));
+                // The HSync and SOG pins are setup to detect CSync, if present
+                // (SOG mode on, coasting setup, debug bus setup, etc)
+                // SP_H_PROTECT is needed for CSync with a VS source present as well
+                GBS::SP_H_PROTECT::write(1);
+                delay(120);
+
+                short decodeSuccess = 0;
+                for (int i = 0; i < 3; i++) {
+                    // no success if: no signal at all (returns 0.0f), no embedded VSync (returns ~18.5f)
+                    // todo: this takes a while with no csync present
+                    rto->syncTypeCsync = 1; // temporary for test
+                    float sfr = getSourceFieldRate(1);
+                    rto->syncTypeCsync = 0; // undo
+                    if (sfr > 40.0f)
+                        decodeSuccess++; // properly decoded vsync from 40 to xx Hz
+                }
+
+                if (decodeSuccess >= 2) {
+                    SerialM.println(F(" (with CSync)"));
+                    GBS::SP_PRE_COAST::write(0x10); // increase from 9 to 16 (EGA 364)
+                    delay(40);
+                    rto->syncTypeCsync = true;
+                } else {
+                    SerialM.println();
+                    rto->syncTypeCsync = false;
                 }
 
-                // if VSync is active, it's RGBHV or RGBHV with CSync on HS pin
-                if (vsyncActive) {
-                    SerialM.println(F("VSync: present"));
-                    GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely than EDTV
-                    boolean hsyncActive = 0;
+                // check for 25khz, all regular SOG modes first // update: only check for mode 8
+                // MD reg for medium res starts at 0x2C and needs 16 loops to ramp to max of 0x3C (vt 360 .. 496)
+                // if source is HS+VS, can't detect via MD unit, need to set 5_11=0x92 and look at vt: counter
+                for (uint8_t i = 0; i < 16; i++) {
+                    //printInfo();
+                    uint8_t innerVideoMode = getVideoMode();
+                    if (innerVideoMode == 8) {
+                        setAndUpdateSogLevel(rto->currentLevelSOG);
+                        rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                        SerialM.println(F("med res"));
 
-                    timeOutStart = millis();
-                    while (!hsyncActive && millis() - timeOutStart < 400) {
-                        hsyncActive = GBS::STATUS_SYNC_PROC_HSACT::read();
-                        handleWiFi(0); // wifi stack
-                        delay(1);
+                        return 1;
                     }
+                    // update 25khz detection
+                    GBS::MD_HD1250P_CNTRL::write(GBS::MD_HD1250P_CNTRL::read() + 1);
+                    //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
+                    delay(30);
+                }
 
-                    if (hsyncActive) {
-                        SerialM.print(F("HSync: present"));
-                        // The HSync and SOG pins are setup to detect CSync, if present
-                        // (SOG mode on, coasting setup, debug bus setup, etc)
-                        // SP_H_PROTECT is needed for CSync with a VS source present as well
-                        GBS::SP_H_PROTECT::write(1);
-                        delay(120);
-
-                        short decodeSuccess = 0;
-                        for (int i = 0; i < 3; i++) {
-                            // no success if: no signal at all (returns 0.0f), no embedded VSync (returns ~18.5f)
-                            // todo: this takes a while with no csync present
-                            rto->syncTypeCsync = 1; // temporary for test
-                            float sfr = getSourceFieldRate(1);
-                            rto->syncTypeCsync = 0; // undo
-                            if (sfr > 40.0f)
-                                decodeSuccess++; // properly decoded vsync from 40 to xx Hz
-                        }
-
-                        if (decodeSuccess >= 2) {
-                            SerialM.println(F(" (with CSync)"));
-                            GBS::SP_PRE_COAST::write(0x10); // increase from 9 to 16 (EGA 364)
-                            delay(40);
-                            rto->syncTypeCsync = true;
-                        } else {
-                            SerialM.println();
-                            rto->syncTypeCsync = false;
-                        }
-
-                        // check for 25khz, all regular SOG modes first // update: only check for mode 8
-                        // MD reg for medium res starts at 0x2C and needs 16 loops to ramp to max of 0x3C (vt 360 .. 496)
-                        // if source is HS+VS, can't detect via MD unit, need to set 5_11=0x92 and look at vt: counter
-                        for (uint8_t i = 0; i < 16; i++) {
-                            //printInfo();
-                            uint8_t innerVideoMode = getVideoMode();
-                            if (innerVideoMode == 8) {
-                                setAndUpdateSogLevel(rto->currentLevelSOG);
-                                rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
-                                SerialM.println(F("med res"));
-
-                                return 1;
-                            }
-                            // update 25khz detection
-                            GBS::MD_HD1250P_CNTRL::write(GBS::MD_HD1250P_CNTRL::read() + 1);
-                            //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
-                            delay(30);
-                        }
+                rto->videoStandardInput = 15;
+                // exception: apply preset here, not later in syncwatcher
+                applyPresets(rto->videoStandardInput);
+                delay(100);
 
-                        rto->videoStandardInput = 15;
-                        // exception: apply preset here, not later in syncwatcher
-                        applyPresets(rto->videoStandardInput);
-                        delay(100);
+                return 3;
+            } else {
+                // need to continue looking
+                SerialM.println(F("but no HSync!"));
+            }
+        }
 
-                        return 3;
-                    } else {
-                        // need to continue looking
-                        SerialM.println(F("but no HSync!"));
+        if (!vsyncActive) { // then do RGBS check
+            rto->syncTypeCsync = true;
+            GBS::MD_SEL_VGA60::write(0); // EDTV60 more likely than VGA60
+            uint16_t testCycle = 0;
+            timeOutStart = millis();
+            while ((millis() - timeOutStart) < 6000) {
+                delay(2);
+                if (getVideoMode() > 0) {
+                    if (getVideoMode() != 8) { // if it's mode 8, need to set stuff first
+                        return 1;
                     }
                 }
-
-                if (!vsyncActive) { // then do RGBS check
-                    rto->syncTypeCsync = true;
-                    GBS::MD_SEL_VGA60::write(0); // EDTV60 more likely than VGA60
-                    uint16_t testCycle = 0;
-                    timeOutStart = millis();
-                    while ((millis() - timeOutStart) < 6000) {
-                        delay(2);
-                        if (getVideoMode() > 0) {
-                            if (getVideoMode() != 8) { // if it's mode 8, need to set stuff first
-                                return 1;
-                            }
-                        }
-                        testCycle++;
-                        // post coast 18 can mislead occasionally (SNES 239 mode)
-                        // but even then it still detects the video mode pretty well
-                        if ((testCycle % 150) == 0) {
-                            if (rto->currentLevelSOG == 1) {
-                                rto->currentLevelSOG = 2;
-                            } else {
-                                rto->currentLevelSOG += 2;
-                            }
-                            if (rto->currentLevelSOG >= 15) {
-                                rto->currentLevelSOG = 1;
-                            }
-                            setAndUpdateSogLevel(rto->currentLevelSOG);
-                        }
-
-                        // new: check for 25khz, use regular scaling route for those
-                        if (getVideoMode() == 8) {
-                            rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
-                            setAndUpdateSogLevel(rto->currentLevelSOG);
-                            rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
-                            SerialM.println(F("med res"));
-                            return 1;
-                        }
-
-                        uint8_t currentMedResLineCount = GBS::MD_HD1250P_CNTRL::read();
-                        if (currentMedResLineCount < 0x3c) {
-                            GBS::MD_HD1250P_CNTRL::write(currentMedResLineCount + 1);
-                        } else {
-                            GBS::MD_HD1250P_CNTRL::write(0x33);
-                        }
-                        //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
+                testCycle++;
+                // post coast 18 can mislead occasionally (SNES 239 mode)
+                // but even then it still detects the video mode pretty well
+                if ((testCycle % 150) == 0) {
+                    if (rto->currentLevelSOG == 1) {
+                        rto->currentLevelSOG = 2;
+                    } else {
+                        rto->currentLevelSOG += 2;
+                    }
+                    if (rto->currentLevelSOG >= 15) {
+                        rto->currentLevelSOG = 1;
                     }
+                    setAndUpdateSogLevel(rto->currentLevelSOG);
+                }
 
-                    //rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
-                    //setAndUpdateSogLevel(rto->currentLevelSOG);
+                // new: check for 25khz, use regular scaling route for those
+                if (getVideoMode() == 8) {
+                    rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
+                    setAndUpdateSogLevel(rto->currentLevelSOG);
+                    rto->medResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                    SerialM.println(F("med res"));
+                    return 1;
+                }
 
-                    return 1; //anyway, let later stage deal with it
+                uint8_t currentMedResLineCount = GBS::MD_HD1250P_CNTRL::read();
+                if (currentMedResLineCount < 0x3c) {
+                    GBS::MD_HD1250P_CNTRL::write(currentMedResLineCount + 1);
+                } else {
+                    GBS::MD_HD1250P_CNTRL::write(0x33);
                 }
+                //Serial.println(GBS::MD_HD1250P_CNTRL::read(), HEX);
+            }
 
-                GBS::SP_SOG_MODE::write(1);
-                resetSyncProcessor();
-                resetModeDetect(); // there was some signal but we lost it. MD is stuck anyway, so reset
-                delay(40);
-            } else if (currentInput == 0) { // YUV
-                uint16_t testCycle = 0;
-                rto->inputIsYpBpR = true;    // declare for MD
-                GBS::MD_SEL_VGA60::write(0); // EDTV more likely than VGA 640x480
+            //rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 13;
+            //setAndUpdateSogLevel(rto->currentLevelSOG);
 
-                unsigned long timeOutStart = millis();
-                while ((millis() - timeOutStart) < 6000) {
-                    delay(2);
-                    if (getVideoMode() > 0) {
-                        return 2;
-                    }
+            return 1; //anyway, let later stage deal with it
+        }
 
-                    testCycle++;
-                    if ((testCycle % 180) == 0) {
-                        if (rto->currentLevelSOG == 1) {
-                            rto->currentLevelSOG = 2;
-                        } else {
-                            rto->currentLevelSOG += 2;
-                        }
-                        if (rto->currentLevelSOG >= 16) {
-                            rto->currentLevelSOG = 1;
-                        }
-                        setAndUpdateSogLevel(rto->currentLevelSOG);
-                        rto->thisSourceMaxLevelSOG = rto->currentLevelSOG;
-                    }
+        GBS::SP_SOG_MODE::write(1);
+        resetSyncProcessor();
+        resetModeDetect(); // there was some signal but we lost it. MD is stuck anyway, so reset
+        delay(40);
+    } else if (currentInput == 0) { // YUV
+        uint16_t testCycle = 0;
+        rto->inputIsYpBpR = true;    // declare for MD
+        GBS::MD_SEL_VGA60::write(0); // EDTV more likely than VGA 640x480
+
+        unsigned long timeOutStart = millis();
+        while ((millis() - timeOutStart) < 6000) {
+            delay(2);
+            if (getVideoMode() > 0) {
+                return 2;
+            }
+
+            testCycle++;
+            if ((testCycle % 180) == 0) {
+                if (rto->currentLevelSOG == 1) {
+                    rto->currentLevelSOG = 2;
+                } else {
+                    rto->currentLevelSOG += 2;
+                }
+                if (rto->currentLevelSOG >= 16) {
+                    rto->currentLevelSOG = 1;
                 }
-
-                rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 14;
                 setAndUpdateSogLevel(rto->currentLevelSOG);
-
-                return 2; //anyway, let later stage deal with it
+                rto->thisSourceMaxLevelSOG = rto->currentLevelSOG;
             }
-
-            SerialM.println(" lost..");
-            rto->currentLevelSOG = 2;
-            setAndUpdateSogLevel(rto->currentLevelSOG);
         }
 
-        GBS::ADC_INPUT_SEL::write(!currentInput); // can only be 1 or 0
-        delay(200);
+        rto->currentLevelSOG = rto->thisSourceMaxLevelSOG = 14;
+        setAndUpdateSogLevel(rto->currentLevelSOG);
 
-        return 0; // don't do the check on the new input here, wait till next run
+        return 2; //anyway, let later stage deal with it
     }
 
-    return 0;
+    SerialM.println(" lost..");
+    rto->currentLevelSOG = 2;
+    setAndUpdateSogLevel(rto->currentLevelSOG);
+
+    return 0; // don't probe again here, wait till next run
 }
 
 uint8_t inputAndSyncDetect()
@@ -2705,15 +2842,11 @@ boolean runAutoBestHTotal()
         //Serial.println("running");
         //unsigned long startTime = millis();
 
-        boolean stableNow = 1;
-
-        for (uint8_t i = 0; i < 64; i++) {
-            if (!getStatus16SpHsStable()) {
-                stableNow = 0;
-                //Serial.println("prevented: !getStatus16SpHsStable");
-                break;
-            }
+        // each check stops at the first unstable read
+        RunOf<64> syncBefore;
+        while (!syncBefore.add(getStatus16SpHsStable()) && !syncBefore.failed()) {
         }
+        boolean stableNow = syncBefore.done();
 
         if (stableNow) {
             if (GBS::STATUS_INT_SOG_BAD::read()) {
@@ -2750,12 +2883,11 @@ boolean runAutoBestHTotal()
                     //Serial.println("prevented_5 INT_SOG_BAD!");
                     stableNow = false;
                 }
-                for (uint8_t i = 0; i < 16; i++) {
-                    if (!getStatus16SpHsStable()) {
-                        stableNow = 0;
-                        //Serial.println("prevented_5: !getStatus16SpHsStable");
-                        break;
-                    }
+                RunOf<16> syncAfter;
+                while (!syncAfter.add(getStatus16SpHsStable()) && !syncAfter.failed()) {
+                }
+                if (!syncAfter.done()) {
+                    stableNow = false;
                 }
                 resetInterruptSogBadBit();
 
@@ -2769,14 +2901,11 @@ boolean runAutoBestHTotal()
                 }
 
                 if (stableNow) {
-                    for (uint8_t i = 0; i < 24; i++) {
+                    RunOf<24> syncSettled;
+                    do {
                         delay(1);
-                        if (!getStatus16SpHsStable()) {
-                            stableNow = false;
-                            //Serial.println("prevented_3!");
-                            break;
-                        }
-                    }
+                    } while (!syncSettled.add(getStatus16SpHsStable()) && !syncSettled.failed());
+                    stableNow = syncSettled.done();
                 }
 
                 if (bestHTotal > 0 && stableNow) {
@@ -3209,8 +3338,17 @@ uint32_t getPllRate()
 #define AUTO_GAIN_INIT 0x48
 
 void doPostPresetLoadSteps()
+{
+    modeSwitchBegin(rto->videoStandardInput);
+    runPostPresetLoadStages();
+    finishModeSwitch();
+}
+
+void runPostPresetLoadStages()
 {
     //unsigned long postLoadTimer = millis();
+    resetSourceState();
+    modeSwitchStage(ModeStage::InputPatches);
 
     // adco->r_gain gets applied if uopt->enableAutoGain is set.
     if (uopt->enableAutoGain) {
@@ -3247,6 +3385,7 @@ void doPostPresetLoadSteps()
     GBS::ADC_UNUSED_67::write(0); // clear temp storage
     GBS::PAD_CKIN_ENZ::write(0);  // 0 = clock input enable (pin40)
 
+    modeSwitchStage(ModeStage::SyncProcessor);
     if (!rto->isCustomPreset) {
         prepareSyncProcessor(); // todo: handle modes 14 and 15 better, now that they support scaling
     }
@@ -3298,6 +3437,7 @@ void doPostPresetLoadSteps()
     GBS::SP_NO_CLAMP_REG::write(1); // (keep) clamp disabled, to be enabled when position determined
     GBS::OUT_SYNC_CNTRL::write(1);  // prepare sync out to PAD
 
+    modeSwitchStage(ModeStage::Adc);
     // auto offset adc prep
     GBS::ADC_AUTO_OFST_PRD::write(1);   // by line (0 = by frame)
     GBS::ADC_AUTO_OFST_DELAY::write(0); // sample delay 0 (1 to 4 pipes)
@@ -3349,6 +3489,7 @@ void doPostPresetLoadSteps()
     rto->sourceDisconnected = false; // this must be true if we reached here (no syncwatcher operation)
     rto->boardHasPower = true;       //same
 
+    modeSwitchStage(ModeStage::Deinterlacer);
     if (rto->presetID == 0x06 || rto->presetID == 0x16) {
         rto->isCustomPreset = 0; // override so it applies section 2 deinterlacer settings
     }
@@ -3601,6 +3742,7 @@ void doPostPresetLoadSteps()
         rto->isCustomPreset = GBS::GBS_PRESET_CUSTOM::read(); // override back
     }
 
+    modeSwitchStage(ModeStage::SyncProcessor);
     resetDebugPort();
 
     boolean avoidAutoBest = 0;
@@ -3617,6 +3759,7 @@ void doPostPresetLoadSteps()
 
     latchPLLAD(); // besthtotal reliable with this (EDTV modes, possibly others)
 
+    modeSwitchStage(ModeStage::InputPatches);
     if (rto->isCustomPreset) {
         // patch in segments not covered in custom preset files (currently seg 2)
         if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4 || rto->videoStandardInput == 8) {
@@ -3657,6 +3800,7 @@ void doPostPresetLoadSteps()
 
     //freezeVideo();
 
+    modeSwitchStage(ModeStage::Adc);
     GBS::ADC_TEST_04::write(0x02);    // 5_04
     GBS::ADC_TEST_0C::write(0x12);    // 5_0c 1 4
     GBS::ADC_TA_05_CTRL::write(0x02); // 5_05
@@ -3702,6 +3846,7 @@ void doPostPresetLoadSteps()
     // 5_06 + 5_08 will be the target center value, 5_07 sets general offset
     // s3s3as00 s3s3bs00 s3s3cs00
 
+    modeSwitchStage(ModeStage::Deinterlacer);
     if (uopt->wantVdsLineFilter) {
         GBS::VDS_D_RAM_BYPS::write(0);
     } else {
@@ -3735,6 +3880,7 @@ void doPostPresetLoadSteps()
         GBS::VDS_UV_STEP_BYPS::write(1);
     }
 
+    modeSwitchStage(ModeStage::Pll);
     // transfer preset's display clock to ext. gen
     externalClockGenResetClock();
 
@@ -3743,6 +3889,7 @@ void doPostPresetLoadSteps()
     FrameSync::cleanup();
     rto->syncLockFailIgnore = 16;
 
+    modeSwitchStage(ModeStage::Settle);
     // undo eventual rto->useHdmiSyncFix (not using this method atm)
     GBS::VDS_SYNC_EN::write(0);
     GBS::VDS_FLOCK_EN::write(0);
@@ -3781,7 +3928,9 @@ void doPostPresetLoadSteps()
                             ok = 1;
                     }
                     if (ok) { // else leave it for later
-                        runAutoBestHTotal();
+                        if (!applyLastSourceHTotal()) {
+                            runAutoBestHTotal();
+                        }
                         delay(1); // wifi
                         break;
                     }
@@ -3808,6 +3957,7 @@ void doPostPresetLoadSteps()
         GBS::PAD_SYNC_OUT_ENZ::write(0); // sync out
     }
 
+    modeSwitchStage(ModeStage::Deinterlacer);
     // late adjustments that require some delay time first
     if (!rto->isCustomPreset) {
         if (videoStandardInputIsPalNtscSd() && !rto->outModeHdBypass) {
@@ -3832,6 +3982,7 @@ void doPostPresetLoadSteps()
     GBS::VDS_FRAME_NO::write(1);  // 3_1f 0-3
     GBS::VDS_FR_SELECT::write(1); // 3_1b, 3_1c, 3_1d, 3_1e
 
+    modeSwitchStage(ModeStage::Pll);
     // noise starts here!
     resetDigital();
 
@@ -3868,6 +4019,7 @@ void doPostPresetLoadSteps()
         ResetSDRAM();
     }
 
+    modeSwitchStage(ModeStage::SyncProcessor);
     setAndUpdateSogLevel(rto->currentLevelSOG); // use this to cycle SP / ADPLL latches
 
     if (rto->presetID != 0x06 && rto->presetID != 0x16) {
@@ -3880,16 +4032,31 @@ void doPostPresetLoadSteps()
     GBS::SP_CS_CLP_ST::write(32);
     GBS::SP_CS_CLP_SP::write(48); // same as reset parameters
 
-    if (!uopt->wantOutputComponent) {
-        GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out if needed
+    // the preset image usually comes with DAC and sync out on already (no HDMI sync fix),
+    // one read of 0_44..0_49 then saves the five read-modify-writes
+    typedef GBS::Tie<GBS::DAC_RGBS_PWDNZ, GBS::DAC_RGBS_SPD, GBS::DAC_RGBS_S0ENZ, GBS::DAC_RGBS_S1EN,
+                     GBS::PAD_SYNC_OUT_ENZ>
+        OutputRegs;
+    GBS::DAC_RGBS_PWDNZ::Value pwdnz, spd, s0enz, s1en, syncOutEnz;
+    OutputRegs::read(pwdnz, spd, s0enz, s1en, syncOutEnz);
+    const bool outputOn = pwdnz == 1 && spd == 0 && s0enz == 0 && s1en == 1 &&
+                          (uopt->wantOutputComponent || syncOutEnz == 0);
+    if (outputOn) {
+        modeSwitchSkip(ModeStage::OutputEnable);
+    } else {
+        modeSwitchStage(ModeStage::OutputEnable);
+        if (!uopt->wantOutputComponent) {
+            GBS::PAD_SYNC_OUT_ENZ::write(0); // enable sync out if needed
+        }
+        GBS::DAC_RGBS_PWDNZ::write(1); // DAC on if needed
+        GBS::DAC_RGBS_SPD::write(0);   // 0_45 2 DAC_SVM power down disable, somehow less jailbars
+        GBS::DAC_RGBS_S0ENZ::write(0); //
+        GBS::DAC_RGBS_S1EN::write(1);  // these 2 also help
     }
-    GBS::DAC_RGBS_PWDNZ::write(1); // DAC on if needed
-    GBS::DAC_RGBS_SPD::write(0);   // 0_45 2 DAC_SVM power down disable, somehow less jailbars
-    GBS::DAC_RGBS_S0ENZ::write(0); //
-    GBS::DAC_RGBS_S1EN::write(1);  // these 2 also help
 
     rto->useHdmiSyncFix = 0; // reset flag
 
+    modeSwitchStage(ModeStage::SyncProcessor);
     GBS::SP_H_PROTECT::write(0);
     if (rto->videoStandardInput >= 5) {
         GBS::SP_DIS_SUB_COAST::write(1); // might not disable it at all soon
@@ -3916,6 +4083,7 @@ void doPostPresetLoadSteps()
         rto->videoStandardInput = 14;
     }
 
+    modeSwitchStage(ModeStage::Settle);
     if (GBS::GBS_OPTION_SCALING_RGBHV::read() == 0) {
         unsigned long timeout = millis();
         while ((!getStatus16SpHsStable()) && (millis() - timeout < 2002)) {
@@ -3942,6 +4110,7 @@ void doPostPresetLoadSteps()
         }
     }
 
+    modeSwitchStage(ModeStage::SyncProcessor);
     // early attempt
     updateClampPosition();
     if (rto->clampPositionIsSet) {
@@ -3969,6 +4138,7 @@ void doPostPresetLoadSteps()
     GBS::INTERRUPT_CONTROL_00::write(0xff); // reset irq status
     GBS::INTERRUPT_CONTROL_00::write(0x00);
 
+    modeSwitchStage(ModeStage::OutputEnable);
     OutputComponentOrVGA();
 
     // presetPreference 10 means the user prefers bypass mode at startup
@@ -4064,6 +4234,13 @@ void doPostPresetLoadSteps()
 
 // TODO replace result with VideoStandardInput enum
 void applyPresets(uint8_t result)
+{
+    modeSwitchBegin(result);
+    applyPresetStages(result);
+    finishModeSwitch();
+}
+
+void applyPresetStages(uint8_t result)
 {
     if (!rto->boardHasPower) {
         SerialM.println(F("GBS board not responding!"));
@@ -4233,6 +4410,7 @@ void applyPresets(uint8_t result)
         return false;
     };
 
+    modeSwitchStage(ModeStage::LoadImage);
     if (result == 1 || result == 3 || result == 8 || result == 9 || result == 14) {
         // NTSC input
         if (uopt->presetPreference == 0) {
@@ -4315,12 +4493,25 @@ void applyPresets(uint8_t result)
     rto->videoStandardInput = result;
     if (waitExtra) {
         // extra time needed for digital resets, so that autobesthtotal works first attempt
-        //Serial.println("waitExtra 400ms");
-        delay(400); // min ~ 300
+        // only modes that run it in doPostPresetLoadSteps() wait, the others get it much later
+        if (result >= 1 && result <= 4 && GBS::GBS_OPTION_SCALING_RGBHV::read() == 0) {
+            modeSwitchStage(ModeStage::Settle);
+            //Serial.println("waitExtra 400ms");
+            delay(400); // min ~ 300
+        } else {
+            modeSwitchSkip(ModeStage::Settle);
+        }
     }
     doPostPresetLoadSteps();
 }
 
+void finishModeSwitch()
+{
+    if (modeSwitchEnd(rto->presetID) && MODE_SWITCH_LOG) {
+        printModeSwitch(SerialM);
+    }
+}
+
 void unfreezeVideo()
 {
     /*if (rto->videoIsFrozen == true) {
@@ -4840,7 +5031,7 @@ void updateCoastPosition(boolean autoCoast)
     for (uint8_t i = 0; i < 8; i++) {
         // psx jitters between 427, 428
         uint16_t thisInHlength = GBS::HPERIOD_IF::read();
-        if ((thisInHlength > (prevInHlength - 3)) && (thisInHlength < (prevInHlength + 3))) {
+        if (withinTolerance(thisInHlength, prevInHlength, 2)) {
             accInHlength += thisInHlength;
         } else {
             return;
@@ -4944,7 +5135,7 @@ void updateClampPosition()
             thisInHlength = GBS::HPERIOD_IF::read();
         else
             thisInHlength = GBS::STATUS_SYNC_PROC_HTOTAL::read();
-        if ((thisInHlength > (prevInHlength - 3)) && (thisInHlength < (prevInHlength + 3))) {
+        if (withinTolerance(thisInHlength, prevInHlength, 2)) {
             accInHlength += thisInHlength;
         } else {
             //Serial.println("updateClampPosition unstable");
@@ -5739,6 +5930,7 @@ void printInfo()
     static char print[121]; // Increase if compiler complains about sprintf
     static uint8_t clearIrqCounter = 0;
     static uint8_t lockCounterPrevious = 0;
+    static MovingAverage<uint8_t, 16> lockCounterAverage;
     uint8_t lockCounter = 0;
 
     int32_t wifi = 0;
@@ -5797,7 +5989,7 @@ void printInfo()
             }
         }
     }
-    lockCounterPrevious = getMovingAverage(lockCounter);
+    lockCounterPrevious = lockCounterAverage.add(lockCounter);
 }
 
 void stopWire()
@@ -5875,19 +6067,16 @@ void runSyncWatcher()
     if (rto->outModeHdBypass && status16SpHsStable) {
         if (videoStandardInputIsPalNtscSd()) {
             if (millis() - lastLineCountMeasure > 765) {
-                thisStableLineCount = GBS::STATUS_SYNC_PROC_VTOTAL::read();
-                for (uint8_t i = 0; i < 3; i++) {
+                StableRun<uint16_t, 3, 4> lineCount;
+                lineCount.add(GBS::STATUS_SYNC_PROC_VTOTAL::read());
+                while (!lineCount.stable() && !lineCount.broken()) {
                     delay(2);
-                    if (GBS::STATUS_SYNC_PROC_VTOTAL::read() < (thisStableLineCount - 3) ||
-                        GBS::STATUS_SYNC_PROC_VTOTAL::read() > (thisStableLineCount + 3)) {
-                        thisStableLineCount = 0;
-                        break;
-                    }
+                    lineCount.add(GBS::STATUS_SYNC_PROC_VTOTAL::read());
                 }
+                thisStableLineCount = lineCount.stable() ? lineCount.value() : 0;
 
                 if (thisStableLineCount != 0) {
-                    if (thisStableLineCount < (activeStableLineCount - 3) ||
-                        thisStableLineCount > (activeStableLineCount + 3)) {
+                    if (!withinTolerance(thisStableLineCount, activeStableLineCount, 3)) {
                         activeStableLineCount = thisStableLineCount;
                         if (activeStableLineCount < 230 || activeStableLineCount > 340) {
                             // only doing NTSC/PAL currently, an unusual line count probably means a format change
@@ -5962,8 +6151,12 @@ void runSyncWatcher()
 
             if (badHsActive >= 17) {
                 if (rto->currentLevelSOG >= 2) {
-                    rto->currentLevelSOG -= 1;
-                    setAndUpdateSogLevel(rto->currentLevelSOG);
+                    // the next working level down right away, not one step per window
+                    uint8_t level = searchSogLevel(rto->currentLevelSOG - 1);
+                    if (level == 0) {
+                        level = rto->currentLevelSOG - 1;
+                    }
+                    setAndUpdateSogLevel(level);
                     delay(30);
                     updateSpDynamic(0);
                     badHsActive = 0;
@@ -5993,6 +6186,7 @@ void runSyncWatcher()
         rto->continousStableCounter = 0;
         lastVsyncLock = millis(); // best reset this
         if (rto->noSyncCounter == 1) {
+            modeTransitionStart(rto->videoStandardInput);
             freezeVideo();
             return; // do nothing else
         }
@@ -6173,6 +6367,9 @@ void runSyncWatcher()
         if (newVideoModeCounter < 255) {
             newVideoModeCounter++;
             rto->continousStableCounter = 0; // usually already 0, but occasionally not
+            if (newVideoModeCounter == 1) {
+                modeTransitionStart(rto->videoStandardInput);
+            }
             if (newVideoModeCounter > 1) {   // help debug a few commits worth
                 if (newVideoModeCounter == 2) {
                     SerialM.println();
@@ -6192,7 +6389,7 @@ void runSyncWatcher()
             }
         }
 
-        if (newVideoModeCounter >= 8) {
+        if (newVideoModeCounter >= (bootExpectsMode(detectedVideoMode) ? BOOT_FAST_MODE_ROUNDS : 8)) {
             uint8_t vidModeReadout = 0;
             SerialM.print(F("\nFormat change:"));
             for (int a = 0; a < 30; a++) {
@@ -6273,6 +6470,7 @@ void runSyncWatcher()
             rto->phaseIsSet = false;
             FrameSync::reset(uopt->frameTimeLockMethod);
             doFullRestore = 1;
+            resetSourceState(); // may be another source with the same mode
             SerialM.println();
         }
 
@@ -6299,6 +6497,13 @@ void runSyncWatcher()
             LEDON;
         }
 
+        if (rto->continousStableCounter == 36 && rto->applyPresetDoneStage == 0) {
+            // came back without a new preset, else the post preset steps end the transition
+            modeTransitionEnd(rto->videoStandardInput);
+        }
+
+        runSourceIndex();
+
         if (!rto->phaseIsSet) {
             if (rto->continousStableCounter >= 10 && rto->continousStableCounter < 61) {
                 // added < 61 to make a window, else sources with little pll lock hammer this
@@ -6457,14 +6662,19 @@ void runSyncWatcher()
             boolean needPostAdjust = 0;
             static uint16_t activePresetLineCount = 0;
             // is the source in range for scaling RGBHV and is it currently in mode 15?
-            uint16 sourceLines = GBS::STATUS_SYNC_PROC_VTOTAL::read(); // if sourceLines = 0, might be in some reset state
+            // median of three reads: a single glitched one does not start a 300 ms check below
+            Median<uint16_t, 3> lineCount;
+            for (uint8_t i = 0; i < 3; i++) {
+                lineCount.add(GBS::STATUS_SYNC_PROC_VTOTAL::read());
+            }
+            uint16 sourceLines = lineCount.value(); // if sourceLines = 0, might be in some reset state
             if ((sourceLines <= 535 && sourceLines != 0) && rto->videoStandardInput == 15) {
                 uint16_t firstDetectedSourceLines = sourceLines;
                 boolean moveOn = 1;
                 for (int i = 0; i < 30; i++) { // not the best check, but we don't want to try if this is not stable (usually is though)
                     sourceLines = GBS::STATUS_SYNC_PROC_VTOTAL::read();
                     // range needed for interlace
-                    if ((sourceLines < firstDetectedSourceLines - 3) || (sourceLines > firstDetectedSourceLines + 3)) {
+                    if (!withinTolerance(sourceLines, firstDetectedSourceLines, 3)) {
                         moveOn = 0;
                         break;
                     }
@@ -6614,7 +6824,7 @@ void runSyncWatcher()
                     boolean moveOn = 1;
                     for (int i = 0; i < 30; i++) {
                         sourceLines = GBS::STATUS_SYNC_PROC_VTOTAL::read();
-                        if ((sourceLines < firstDetectedSourceLines - 3) || (sourceLines > firstDetectedSourceLines + 3)) {
+                        if (!withinTolerance(sourceLines, firstDetectedSourceLines, 3)) {
                             moveOn = 0;
                             break;
                         }
@@ -6720,7 +6930,7 @@ void runSyncWatcher()
                 for (int i = 0; i < 30; i++) {
                     sourceLines = GBS::STATUS_SYNC_PROC_VTOTAL::read();
                     // range needed for interlace
-                    if ((sourceLines < firstDetectedSourceLines - 3) || (sourceLines > firstDetectedSourceLines + 3)) {
+                    if (!withinTolerance(sourceLines, firstDetectedSourceLines, 3)) {
                         moveOn = 0;
                         break;
                     }
@@ -6827,7 +7037,7 @@ void runSyncWatcher()
             }
 
             uint32_t currentPllRate = 0;
-            static uint32_t oldPllRate = 10;
+            static ChangeDetector<uint32_t, 3, 2> pllRate(10);
 
             // how fast is the PLL running? needed to set charge pump and gain
             // typical: currentPllRate: 1560, currentPllRate: 3999 max seen the pll reach: 5008 for 1280x1024@75
@@ -6835,16 +7045,15 @@ void runSyncWatcher()
                 currentPllRate = getPllRate();
                 //Serial.println(currentPllRate);
                 if (currentPllRate > 100 && currentPllRate < 7500) {
-                    if ((currentPllRate < (oldPllRate - 3)) || (currentPllRate > (oldPllRate + 3))) {
+                    pllRate.add(currentPllRate);
+                    if (pllRate.changing()) {
                         delay(40);
                         if (GBS::STATUS_INT_SOG_BAD::read() == 1)
                             delay(100);
                         currentPllRate = getPllRate(); // test again, guards against random spurs
                         // but don't force currentPllRate to = 0 if these inner checks fail,
                         // prevents csync <> hvsync changes
-                        if ((currentPllRate < (oldPllRate - 3)) || (currentPllRate > (oldPllRate + 3))) {
-                            oldPllRate = currentPllRate; // okay, it changed
-                        }
+                        pllRate.add(currentPllRate); // taken if it is off again
                     }
                 } else {
                     currentPllRate = 0;
@@ -6984,7 +7193,51 @@ boolean checkBoardPower()
     //return 1;
 }
 
-void calibrateAdcOffset()
+// ADC offset calibration: with no input the readout has to stay below 7. Higher offsets bring it
+// down, so per channel the lowest offset that does is bisected, all three channels in the same
+// rounds so one settle delay serves them all. The old code parked the channels it was not
+// measuring at offset 0x7F. With DEC_MATRIX_BYPS set the test bus carries only the channel
+// DEC_TEST_SEL picks, so the others are left at their current bisection step instead; that is
+// what lets the rounds share the settle delay.
+// Each channel's result is then confirmed with one long probe, as many readings as the old code
+// wanted on target; an offset that fails it is stepped up until one holds, like the old code did.
+#define ADC_OFFSET_FIRST 0x3D    // lowest offset tried
+#define ADC_OFFSET_LIMIT 0x52    // none below this works: calibration failed
+#define ADC_OFFSET_SAMPLES 64    // TEST_BUS readings per bisection probe
+#define ADC_OFFSET_CONFIRM 1500  // TEST_BUS readings confirming the result of a channel
+#define ADC_OFFSET_SETTLE_MS 10  // after writing the offsets
+
+// the channel DEC_TEST_SEL puts on the test bus (1 G, 2 R, 3 B) stays on target for all
+// samples: no more than 3 misses in a row
+boolean adcOffsetOnTarget(uint8_t channel, uint16_t samples)
+{
+    GBS::DEC_TEST_SEL::write(channel);
+    delay(1);
+    uint8_t missTargetCounter = 0;
+    for (uint16_t i = 0; i < samples; i++) {
+        uint16_t readout16 = GBS::TEST_BUS::read() & 0x7fff;
+        // readout16 is unsigned, always >= 0
+        if (readout16 < 7) {
+            missTargetCounter = 0;
+        } else if (missTargetCounter++ > 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void writeAdcOffset(uint8_t channel, uint8_t offset)
+{
+    if (channel == 1) {
+        GBS::ADC_GOFCTRL::write(offset);
+    } else if (channel == 2) {
+        GBS::ADC_ROFCTRL::write(offset);
+    } else {
+        GBS::ADC_BOFCTRL::write(offset);
+    }
+}
+
+bool calibrateAdcOffset()
 {
     GBS::PAD_BOUT_EN::write(0);          // disable output to pin for test
     GBS::PLL648_CONTROL_01::write(0xA5); // display clock to adc = 162mhz
@@ -7002,85 +7255,65 @@ void calibrateAdcOffset()
     GBS::TEST_BUS_EN::write(1);
     resetDigital();
 
-    uint16_t hitTargetCounter = 0;
-    uint16_t readout16 = 0;
-    uint8_t missTargetCounter = 0;
-    uint8_t readout = 0;
-
     GBS::ADC_RGCTRL::write(0x7F);
     GBS::ADC_GGCTRL::write(0x7F);
     GBS::ADC_BGCTRL::write(0x7F);
-    GBS::ADC_ROFCTRL::write(0x7F);
-    GBS::ADC_GOFCTRL::write(0x3D); // start
-    GBS::ADC_BOFCTRL::write(0x7F);
-    GBS::DEC_TEST_SEL::write(1); // 5_1f = 0x1c
-
-    //unsigned long overallTimer = millis();
-    unsigned long startTimer = 0;
-    for (uint8_t i = 0; i < 3; i++) {
-        missTargetCounter = 0;
-        hitTargetCounter = 0;
-        delay(20);
-        startTimer = millis();
-
-        // loop breaks either when the timer runs out, or hitTargetCounter reaches target
-        while ((millis() - startTimer) < 800) {
-            readout16 = GBS::TEST_BUS::read() & 0x7fff;
-            //Serial.println(readout16, HEX);
-            // readout16 is unsigned, always >= 0
-            if (readout16 < 7) {
-                hitTargetCounter++;
-                missTargetCounter = 0;
-            } else if (missTargetCounter++ > 2) {
-                if (i == 0) {
-                    GBS::ADC_GOFCTRL::write(GBS::ADC_GOFCTRL::read() + 1); // incr. offset
-                    readout = GBS::ADC_GOFCTRL::read();
-                    Serial.print(" G: ");
-                } else if (i == 1) {
-                    GBS::ADC_ROFCTRL::write(GBS::ADC_ROFCTRL::read() + 1);
-                    readout = GBS::ADC_ROFCTRL::read();
-                    Serial.print(" R: ");
-                } else if (i == 2) {
-                    GBS::ADC_BOFCTRL::write(GBS::ADC_BOFCTRL::read() + 1);
-                    readout = GBS::ADC_BOFCTRL::read();
-                    Serial.print(" B: ");
-                }
-                Serial.print(readout, HEX);
-
-                if (readout >= 0x52) {
-                    // some kind of failure
-                    break;
-                }
 
-                delay(10);
-                hitTargetCounter = 0;
-                missTargetCounter = 0;
-                startTimer = millis(); // extend timer
-            }
-            if (hitTargetCounter > 1500) {
-                break;
+    unsigned long overallTimer = millis();
+    // per channel (index = DEC_TEST_SEL - 1): offsets at or below low fail, high works
+    uint8_t low[3], high[3];
+    for (uint8_t c = 0; c < 3; c++) {
+        low[c] = ADC_OFFSET_FIRST - 1;
+        high[c] = ADC_OFFSET_LIMIT;
+    }
+    while (1) {
+        boolean searching = false;
+        for (uint8_t c = 0; c < 3; c++) {
+            if (high[c] - low[c] > 1) {
+                writeAdcOffset(c + 1, (low[c] + high[c]) / 2);
+                searching = true;
             }
         }
-        if (i == 0) {
-            // G done, prep R
-            adco->g_off = GBS::ADC_GOFCTRL::read();
-            GBS::ADC_GOFCTRL::write(0x7F);
-            GBS::ADC_ROFCTRL::write(0x3D);
-            GBS::DEC_TEST_SEL::write(2); // 5_1f = 0x2c
+        if (!searching) {
+            break;
         }
-        if (i == 1) {
-            adco->r_off = GBS::ADC_ROFCTRL::read();
-            GBS::ADC_ROFCTRL::write(0x7F);
-            GBS::ADC_BOFCTRL::write(0x3D);
-            GBS::DEC_TEST_SEL::write(3); // 5_1f = 0x3c
+        delay(ADC_OFFSET_SETTLE_MS);
+        for (uint8_t c = 0; c < 3; c++) {
+            if (high[c] - low[c] > 1) {
+                uint8_t middle = (low[c] + high[c]) / 2;
+                if (adcOffsetOnTarget(c + 1, ADC_OFFSET_SAMPLES)) {
+                    high[c] = middle;
+                } else {
+                    low[c] = middle;
+                }
+            }
         }
-        if (i == 2) {
-            adco->b_off = GBS::ADC_BOFCTRL::read();
+    }
+    for (uint8_t c = 0; c < 3; c++) {
+        writeAdcOffset(c + 1, high[c]);
+    }
+    delay(ADC_OFFSET_SETTLE_MS);
+    for (uint8_t c = 0; c < 3; c++) {
+        while (high[c] < ADC_OFFSET_LIMIT && !adcOffsetOnTarget(c + 1, ADC_OFFSET_CONFIRM)) {
+            writeAdcOffset(c + 1, ++high[c]);
+            delay(ADC_OFFSET_SETTLE_MS);
         }
-        Serial.println("");
     }
+    adco->g_off = high[0];
+    adco->r_off = high[1];
+    adco->b_off = high[2];
+    Serial.print(" G: ");
+    Serial.print(adco->g_off, HEX);
+    Serial.print(" R: ");
+    Serial.print(adco->r_off, HEX);
+    Serial.print(" B: ");
+    Serial.print(adco->b_off, HEX);
+    Serial.print(" (");
+    Serial.print(millis() - overallTimer);
+    Serial.println(" ms)");
 
-    if (readout >= 0x52) {
+    boolean failed = high[0] >= ADC_OFFSET_LIMIT || high[1] >= ADC_OFFSET_LIMIT || high[2] >= ADC_OFFSET_LIMIT;
+    if (failed) {
         // there was a problem; revert
         adco->r_off = adco->g_off = adco->b_off = 0x40;
     }
@@ -7089,7 +7322,7 @@ void calibrateAdcOffset()
     GBS::ADC_ROFCTRL::write(adco->r_off);
     GBS::ADC_BOFCTRL::write(adco->b_off);
 
-    //Serial.println(millis() - overallTimer);
+    return !failed;
 }
 
 void loadDefaultUserOptions()
@@ -7191,6 +7424,7 @@ void ICACHE_RAM_ATTR isrRotaryEncoderPushForNewMenu()
 
 void setup()
 {
+    bootMark(F("display"));
     display.init();                 //inits OLED on I2C bus
     display.flipScreenVertically(); //orientation fix for OLED
 
@@ -7208,6 +7442,7 @@ void setup()
     attachInterrupt(digitalPinToInterrupt(pin_clk), isrRotaryEncoder, FALLING);
 #endif
 
+    bootMark(F("wire + web server"));
     rto->webServerEnabled = true;
     rto->webServerStarted = false; // make sure this is set
 
@@ -7298,17 +7533,60 @@ void setup()
     userCommand = '@';
 
     pinMode(DEBUG_IN_PIN, INPUT);
+#if SYNC_MONITOR
+    syncMonitorBegin(DEBUG_IN_PIN);
+#endif
     pinMode(LED_BUILTIN, OUTPUT);
     LEDON; // enable the LED, lets users know the board is starting up
 
     //Serial.setDebugOutput(true); // if you want simple wifi debug info
 
-    // delay 1 of 2
-    unsigned long initDelay = millis();
-    // upped from < 500 to < 1500, allows more time for wifi and GBS startup
-    while (millis() - initDelay < 1500) {
-        display.drawXbm(2, 2, gbsicon_width, gbsicon_height, gbsicon_bits);
-        display.display();
+    bootMark(F("file system + preferences"));
+    // file system (web page, custom presets, ect)
+    if (!storageBegin()) {
+        SerialM.println(F("file system mount failed! ((1M FS) selected?)"));
+    } else {
+        SerialM.print(F("file system: "));
+        SerialM.println(storageBackendName(storageBackend()));
+        // load user preferences, the legacy text file is converted on first boot
+        loadDefaultUserOptions();
+        switch (loadUserPrefs(*uopt)) {
+            case PrefsLoad::Loaded:
+                break;
+            case PrefsLoad::Migrated:
+                SerialM.println(F("preferences converted to binary format"));
+                break;
+            case PrefsLoad::Corrupt:
+            case PrefsLoad::Missing:
+                SerialM.println(F("no valid preferences file, create new"));
+                loadDefaultUserOptions();
+                saveUserPrefs();
+                flushUserPrefs(); // if this fails, there must be a spiffs problem
+                break;
+        }
+        // slot metadata is prepared here, so the web handlers never have to create it
+        if (!initSlotsFile()) {
+            SerialM.println(F("slots file init failed"));
+        }
+    }
+    // a failed load leaves boot.stored empty, it is still compared against later
+    const bool haveBootCache = loadBootCache(boot.stored);
+    boot.fast = BOOT_FAST && haveBootCache && bootResetWasClean() && boot.stored.options == bootOptionsKey();
+    boot.cache = boot.stored;
+    boot.cache.options = bootOptionsKey();
+    SerialM.println(boot.fast ? F("fast boot") : F("full boot"));
+
+    // delay 1 of 2
+    bootMark(F("splash delay"));
+    unsigned long initDelay = millis();
+    // upped from < 500 to < 1500, allows more time for wifi and GBS startup
+    // a fast boot only waits for the GBS: it has to answer with the chip id it had last time,
+    // up to the full splash time. After a power on it may take longer than BOOT_FAST_SPLASH_MS.
+    const unsigned long splashTime = boot.fast ? BOOT_FAST_SPLASH_MS : 1500;
+    while (millis() - initDelay < splashTime ||
+           (boot.fast && millis() - initDelay < 1500 && GBS::CHIP_ID_PRODUCT::read() != boot.stored.chipProduct)) {
+        display.drawXbm(2, 2, gbsicon_width, gbsicon_height, gbsicon_bits);
+        display.display();
         handleWiFi(0);
         delay(1);
     }
@@ -7319,97 +7597,7 @@ void setup()
     GBS::PLLAD_VCORST::write(1);
     GBS::PLLAD_PDZ::write(0); // AD PLL off
 
-    // file system (web page, custom presets, ect)
-    if (!SPIFFS.begin()) {
-        SerialM.println(F("SPIFFS mount failed! ((1M SPIFFS) selected?)"));
-    } else {
-        // load user preferences file
-        File f = SPIFFS.open("/preferencesv2.txt", "r");
-        if (!f) {
-            SerialM.println(F("no preferences file yet, create new"));
-            loadDefaultUserOptions();
-            saveUserPrefs(); // if this fails, there must be a spiffs problem
-        } else {
-            //on a fresh / spiffs not formatted yet MCU:  userprefs.txt open ok //result = 207
-            uopt->presetPreference = (PresetPreference)(f.read() - '0'); // #1
-            if (uopt->presetPreference > 10)
-                uopt->presetPreference = Output960P; // fresh spiffs ?
-
-            uopt->enableFrameTimeLock = (uint8_t)(f.read() - '0');
-            if (uopt->enableFrameTimeLock > 1)
-                uopt->enableFrameTimeLock = 0;
-
-            uopt->presetSlot = lowByte(f.read());
-
-            uopt->frameTimeLockMethod = (uint8_t)(f.read() - '0');
-            if (uopt->frameTimeLockMethod > 1)
-                uopt->frameTimeLockMethod = 0;
-
-            uopt->enableAutoGain = (uint8_t)(f.read() - '0');
-            if (uopt->enableAutoGain > 1)
-                uopt->enableAutoGain = 0;
-
-            uopt->wantScanlines = (uint8_t)(f.read() - '0');
-            if (uopt->wantScanlines > 1)
-                uopt->wantScanlines = 0;
-
-            uopt->wantOutputComponent = (uint8_t)(f.read() - '0');
-            if (uopt->wantOutputComponent > 1)
-                uopt->wantOutputComponent = 0;
-
-            uopt->deintMode = (uint8_t)(f.read() - '0');
-            if (uopt->deintMode > 2)
-                uopt->deintMode = 0;
-
-            uopt->wantVdsLineFilter = (uint8_t)(f.read() - '0');
-            if (uopt->wantVdsLineFilter > 1)
-                uopt->wantVdsLineFilter = 0;
-
-            uopt->wantPeaking = (uint8_t)(f.read() - '0');
-            if (uopt->wantPeaking > 1)
-                uopt->wantPeaking = 1;
-
-            uopt->preferScalingRgbhv = (uint8_t)(f.read() - '0');
-            if (uopt->preferScalingRgbhv > 1)
-                uopt->preferScalingRgbhv = 1;
-
-            uopt->wantTap6 = (uint8_t)(f.read() - '0');
-            if (uopt->wantTap6 > 1)
-                uopt->wantTap6 = 1;
-
-            uopt->PalForce60 = (uint8_t)(f.read() - '0');
-            if (uopt->PalForce60 > 1)
-                uopt->PalForce60 = 0;
-
-            uopt->matchPresetSource = (uint8_t)(f.read() - '0'); // #14
-            if (uopt->matchPresetSource > 1)
-                uopt->matchPresetSource = 1;
-
-            uopt->wantStepResponse = (uint8_t)(f.read() - '0'); // #15
-            if (uopt->wantStepResponse > 1)
-                uopt->wantStepResponse = 1;
-
-            uopt->wantFullHeight = (uint8_t)(f.read() - '0'); // #16
-            if (uopt->wantFullHeight > 1)
-                uopt->wantFullHeight = 1;
-
-            uopt->enableCalibrationADC = (uint8_t)(f.read() - '0'); // #17
-            if (uopt->enableCalibrationADC > 1)
-                uopt->enableCalibrationADC = 1;
-
-            uopt->scanlineStrength = (uint8_t)(f.read() - '0'); // #18
-            if (uopt->scanlineStrength > 0x60)
-                uopt->enableCalibrationADC = 0x30;
-
-            uopt->disableExternalClockGenerator = (uint8_t)(f.read() - '0'); // #19
-            if (uopt->disableExternalClockGenerator > 1)
-                uopt->disableExternalClockGenerator = 0;
-
-            f.close();
-        }
-    }
-
-
+    bootMark(F("clock generator"));
     GBS::PAD_CKIN_ENZ::write(1); // disable to prevent startup spike damage
     externalClockGenDetectAndInitialize();
     // library may change i2c clock or pins, so restart
@@ -7419,8 +7607,10 @@ void setup()
     GBS::STATUS_00::read();
 
     // delay 2 of 2
+    bootMark(F("wifi delay"));
     initDelay = millis();
-    while (millis() - initDelay < 1000) {
+    const unsigned long wifiTime = boot.fast ? BOOT_FAST_CLOCKGEN_WAIT_MS : 1000;
+    while (millis() - initDelay < wifiTime) {
         handleWiFi(0);
         delay(1);
     }
@@ -7439,6 +7629,7 @@ void setup()
     GBS::STATUS_00::read();
     GBS::STATUS_00::read();
 
+    bootMark(F("board power"));
     boolean powerOrWireIssue = 0;
     if (!checkBoardPower()) {
         stopWire(); // sets pinmodes SDA, SCL to INPUT
@@ -7487,6 +7678,7 @@ void setup()
             Serial.println(F("no ext clockgen"));
         }
 
+        bootMark(F("chip reset"));
         zeroAll();
         setResetParameters();
         prepareSyncProcessor();
@@ -7498,11 +7690,38 @@ void setup()
         SerialM.print(" ");
         SerialM.println(revisionId, HEX);
 
+        // the stored results belong to this hardware only
+        if (boot.fast && (boot.stored.chipProduct != productId || boot.stored.chipRevision != revisionId ||
+                          boot.stored.extClockGen != rto->extClockGenDetected)) {
+            SerialM.println(F("hardware changed, full boot"));
+            boot.fast = false;
+        }
+        boot.cache.chipProduct = productId;
+        boot.cache.chipRevision = revisionId;
+        boot.cache.extClockGen = rto->extClockGenDetected;
+
+        bootMark(F("adc calibration"));
         if (uopt->enableCalibrationADC) {
             // enabled by default
-            calibrateAdcOffset();
+            if (boot.fast && boot.stored.adcValid == BOOT_ADC_STAMP) {
+                adco->r_off = boot.stored.adcOffsetR;
+                adco->g_off = boot.stored.adcOffsetG;
+                adco->b_off = boot.stored.adcOffsetB;
+                GBS::ADC_GOFCTRL::write(adco->g_off);
+                GBS::ADC_ROFCTRL::write(adco->r_off);
+                GBS::ADC_BOFCTRL::write(adco->b_off);
+            } else {
+                boot.cache.adcValid = calibrateAdcOffset() ? BOOT_ADC_STAMP : 0;
+                boot.cache.adcOffsetR = adco->r_off;
+                boot.cache.adcOffsetG = adco->g_off;
+                boot.cache.adcOffsetB = adco->b_off;
+            }
         }
         setResetParameters();
+        if (boot.fast && boot.stored.lastInput != BOOT_NO_INPUT) {
+            // input detection alternates between the two inputs, start with the one used last
+            GBS::ADC_INPUT_SEL::write(boot.stored.lastInput);
+        }
 
         delay(4); // help wifi (presets are unloaded now)
         handleWiFi(1);
@@ -7537,6 +7756,184 @@ void setup()
     if (Serial.available()) {
         discardSerialRxData();
     }
+    bootMark(F("loop"));
+}
+
+// the boot cache depends on these, other options can change freely
+uint8_t bootOptionsKey()
+{
+    return uopt->disableExternalClockGenerator | (uopt->enableCalibrationADC << 1);
+}
+
+// on a fast boot the first source is most likely the one the last boot ended with
+bool bootExpectsMode(uint8_t videoMode)
+{
+    return boot.fast && !boot.pictureShown && boot.stored.lastInput == (rto->inputIsYpBpR ? 0 : 1) &&
+           boot.stored.lastVideoMode == videoMode;
+}
+
+// called once output is enabled after a preset, the first time completes the boot
+void bootPictureShown()
+{
+    if (boot.pictureShown) {
+        return;
+    }
+    boot.pictureShown = true;
+    bootMark(F("first picture"));
+    boot.cache.lastInput = rto->inputIsYpBpR ? 0 : 1;
+    boot.cache.lastVideoMode = rto->videoStandardInput;
+    if (memcmp(&boot.cache, &boot.stored, sizeof(BootCache)) != 0 && storeBootCache(boot.cache)) {
+        boot.stored = boot.cache;
+    }
+}
+
+void resetSourceState()
+{
+    const bool measured = source.tuning.hash != 0;
+    const uint32_t lastHash = measured ? source.tuning.hash : source.lastHash;
+    const uint8_t lastVideoMode = measured ? source.videoMode : source.lastVideoMode;
+    memset(&source, 0, sizeof(source));
+    source.lastHash = lastHash;
+    source.lastVideoMode = lastVideoMode;
+}
+
+// After a preset load the source is usually the one fingerprinted before it, and the fingerprint
+// needs a few stable syncwatcher rounds. Its stored htotal for this preset saves the search right
+// away; runSourceIndex() undoes it should the fingerprint turn out different.
+bool applyLastSourceHTotal()
+{
+    SourceTuning last;
+    if (source.fingerprinted || source.lastHash == 0 || source.lastVideoMode != rto->videoStandardInput ||
+        rto->extClockGenDetected || !findSourceTuning(source.lastHash, last) || last.presetID != rto->presetID ||
+        last.bestHTotal == 0 || !applyBestHTotal(last.bestHTotal)) {
+        return false;
+    }
+    FrameSync::assumeReady();
+    rto->syncLockFailIgnore = 16;
+    source.htotalFromLast = true;
+    return true;
+}
+
+// timing that tells sources apart, quantized by the SourceFingerprint fields
+uint32_t measureSourceFingerprint()
+{
+    SourceFingerprint fp;
+    memset(&fp, 0, sizeof(fp));
+    fp.input = GBS::ADC_INPUT_SEL::read();
+    fp.csync = rto->syncTypeCsync;
+    fp.videoMode = rto->videoStandardInput;
+    fp.htotal = GBS::STATUS_SYNC_PROC_HTOTAL::read() >> 2;
+    fp.hsyncWidth = GBS::STATUS_SYNC_PROC_HLOW_LEN::read() >> 2;
+    for (uint8_t i = 0; i < 4; i++) {
+        // spans a few fields, interlaced sources alternate between two lengths
+        uint16_t vtotal = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+        if (vtotal > fp.vtotal) {
+            fp.vtotal = vtotal;
+        }
+        delay(9);
+    }
+    fp.fieldRate = (uint16_t)(getSourceFieldRate(0) * 20.0f + 0.5f);
+    return sourceFingerprintHash(fp);
+}
+
+// what the syncwatcher would otherwise search for over the next seconds
+void applySourceTuning(const SourceTuning &tuning)
+{
+    rto->phaseSP = tuning.phaseSP;
+    rto->phaseADC = tuning.phaseADC;
+    if (rto->syncTypeCsync && tuning.sogLevel > 0) {
+        rto->thisSourceMaxLevelSOG = tuning.sogLevel;
+        setAndUpdateSogLevel(tuning.sogLevel); // latches the phases as well
+    } else {
+        setAndLatchPhaseSP();
+        setAndLatchPhaseADC();
+    }
+    rto->phaseIsSet = 1;
+
+    if (uopt->enableAutoGain == 1 && tuning.gainR != 0) {
+        // auto gain keeps adjusting from here
+        adco->r_gain = tuning.gainR;
+        adco->g_gain = tuning.gainG;
+        adco->b_gain = tuning.gainB;
+        GBS::ADC_RGCTRL::write(adco->r_gain);
+        GBS::ADC_GGCTRL::write(adco->g_gain);
+        GBS::ADC_BGCTRL::write(adco->b_gain);
+    }
+
+    if (tuning.bestHTotal > 0 && rto->autoBestHtotalEnabled && !rto->extClockGenDetected && !FrameSync::ready()) {
+        if (applyBestHTotal(tuning.bestHTotal)) {
+            FrameSync::assumeReady();
+            rto->syncLockFailIgnore = 16;
+        }
+    }
+}
+
+// runs in the syncwatcher while the source is stable: looks the source up once,
+// learns its tuning once the searches finished
+void runSourceIndex()
+{
+    if (rto->outModeHdBypass || rto->videoStandardInput == 0 || rto->videoStandardInput > 14) {
+        return;
+    }
+
+    if (!source.fingerprinted) {
+        if (rto->continousStableCounter < 8) {
+            return;
+        }
+        source.fingerprinted = true;
+        const uint32_t hash = measureSourceFingerprint();
+        source.videoMode = rto->videoStandardInput;
+        if (source.htotalFromLast && hash != source.lastHash) {
+            // another source after all, the syncwatcher searches htotal again
+            FrameSync::resetWithoutRecalculation();
+            source.htotalFromLast = false;
+        }
+        source.known = findSourceTuning(hash, source.tuning) && source.tuning.presetID == rto->presetID;
+        if (source.known) {
+            applySourceTuning(source.tuning);
+        } else {
+            memset(&source.tuning, 0, sizeof(source.tuning));
+            source.tuning.hash = hash;
+        }
+        SerialM.print(source.known ? F("known source ") : F("new source "));
+        SerialM.println(hash, HEX);
+        return;
+    }
+
+    // by now phase, htotal and the first auto gain rounds are done
+    if (source.stored || rto->continousStableCounter < 255 || !rto->phaseIsSet ||
+        (rto->autoBestHtotalEnabled && !FrameSync::ready())) {
+        return;
+    }
+    source.stored = true;
+    SourceTuning learned = source.tuning;
+    learned.presetID = rto->presetID;
+    learned.phaseSP = rto->phaseSP;
+    learned.phaseADC = rto->phaseADC;
+    learned.sogLevel = rto->syncTypeCsync ? rto->currentLevelSOG : 0;
+    learned.bestHTotal = 0;
+    if (rto->autoBestHtotalEnabled && !rto->extClockGenDetected) {
+        learned.bestHTotal = GBS::VDS_HSYNC_RST::read();
+    }
+    learned.gainR = learned.gainG = learned.gainB = 0;
+    if (uopt->enableAutoGain == 1) {
+        learned.gainR = GBS::ADC_RGCTRL::read();
+        learned.gainG = GBS::ADC_GGCTRL::read();
+        learned.gainB = GBS::ADC_BGCTRL::read();
+    }
+    // a known source that settled where it was last time costs no flash write, its use count
+    // only goes up with the stores that change something
+    if (source.known && learned.presetID == source.tuning.presetID && learned.phaseSP == source.tuning.phaseSP &&
+        learned.phaseADC == source.tuning.phaseADC && learned.sogLevel == source.tuning.sogLevel &&
+        learned.bestHTotal == source.tuning.bestHTotal && learned.gainR == source.tuning.gainR &&
+        learned.gainG == source.tuning.gainG && learned.gainB == source.tuning.gainB) {
+        return;
+    }
+    if (learned.uses < 255) {
+        learned.uses++;
+    }
+    storeSourceTuning(learned);
+    source.tuning = learned;
 }
 
 #if HAVE_BUTTONS
@@ -7711,7 +8108,7 @@ void updateWebSocketData()
             }
 
             // send ping and stats
-            if (ESP.getFreeHeap() > 14000) {
+            if (heapAvailable(HeapUser::WebSocketPing, HEAP_RESERVE_WS_PING)) {
                 webSocket.broadcastTXT(toSend, MESSAGE_LEN);
             } else {
                 webSocket.disconnect();
@@ -7786,6 +8183,11 @@ void loop()
 #endif
 
     handleWiFi(0); // WiFi + OTA + WS + MDNS, checks for server enabled + started
+    if (rto->webServerEnabled && rto->webServerStarted) {
+        registerWatch.tick(); // live register watches, bus budget limited
+    }
+    handleUserPrefs(); // deferred preferences write
+    heapTelemetryTick();
 
     // is there a command from Terminal or web ui?
     // Serial takes precedence
@@ -8590,6 +8992,138 @@ void loop()
                     SerialM.println("abort");
                 }
             } break;
+            case 'I': {
+                // OLED share of the I2C bus
+                const OLEDBusStats &oled = display.busStats();
+                SerialM.print(F("OLED bus: "));
+                SerialM.print(oled.busMicrosPerSecond);
+                SerialM.print(F(" us/s, diff "));
+                SerialM.print(oled.diffMicrosPerSecond);
+                SerialM.print(F(" us/s, "));
+                SerialM.print(oled.bytesPerSecond);
+                SerialM.print(F(" bytes/s, frames sent: "));
+                SerialM.print(oled.frames);
+                SerialM.print(F(" unchanged: "));
+                SerialM.print(oled.idleFrames);
+                SerialM.print(F(" total bytes: "));
+                SerialM.println(oled.bytes);
+            } break;
+            case 'B': {
+                // file system latency, the active backend next to the RAM reference
+                fs::FS *backends[2] = {&storage(), &ramFS()};
+                const __FlashStringHelper *names[2] = {storageBackendName(storageBackend()), F("RAM")};
+                for (uint8_t i = 0; i < 2; i++) {
+                    StorageBenchmark bench;
+                    SerialM.print(names[i]);
+                    if (!storageBenchmark(*backends[i], 20, bench)) {
+                        SerialM.println(F(": failed"));
+                        continue;
+                    }
+                    SerialM.print(F(": open "));
+                    SerialM.print(bench.openMicros);
+                    SerialM.print(F(" us write "));
+                    SerialM.print(bench.writeMicros);
+                    SerialM.print(F(" us read "));
+                    SerialM.print(bench.readMicros);
+                    SerialM.print(F(" us rename "));
+                    SerialM.print(bench.renameMicros);
+                    SerialM.print(F(" us remove "));
+                    SerialM.print(bench.removeMicros);
+                    SerialM.println(F(" us"));
+                }
+            } break;
+            case 'Q':
+                // boot timeline and what the next boot will reuse
+                printBootTimeline(SerialM);
+                SerialM.println(boot.fast ? F("fast boot") : F("full boot"));
+                printBootCache(SerialM, boot.stored);
+                break;
+            case '&':
+                // vsync interrupt monitor, watcher wakeups and bus use
+                printSyncMonitor(SerialM);
+                break;
+            case 'O':
+                // stage times and bus traffic of the last mode switch, latency of recent source changes
+                // and of input detection and the SOG level search
+                printModeSwitch(SerialM);
+                printModeTransitions(SerialM);
+                printInputProbe(SerialM);
+                printSogSearch(SerialM);
+                break;
+            case 'U':
+                // per source tuning index
+                SerialM.print(F("sources: "));
+                SerialM.print(sourceIndexCount());
+                SerialM.print(F(" of "));
+                SerialM.println(SOURCE_INDEX_SLOTS);
+                SerialM.print(source.known ? F("current: known ") : F("current: new "));
+                SerialM.println(source.tuning.hash, HEX);
+                break;
+            case '=':
+                // forget all sources, the next stable picture is searched from scratch
+                clearSourceIndex();
+                resetSourceState();
+                SerialM.println(F("source index cleared"));
+                break;
+            case 'H':
+                // heap, fragmentation, loop stack and low memory drops per subsystem
+                heapTelemetrySample();
+                printHeapTelemetry(SerialM);
+                break;
+#if USE_NEW_OLED_MENU
+            case '@': {
+                // render every static OLED menu screen once, measures drawing and bus cost
+                OLEDMenuBenchmark bench;
+                const OLEDBusStats before = display.busStats();
+                oledMenu.benchmark(bench);
+                const OLEDBusStats &after = display.busStats();
+                SerialM.print(F("OLED menu screens: "));
+                SerialM.print(bench.screens);
+                SerialM.print(F(" render: "));
+                SerialM.print(bench.renderMicros);
+                SerialM.print(F(" us display: "));
+                SerialM.print(bench.displayMicros);
+                SerialM.print(F(" us (bus "));
+                SerialM.print(after.busMicros - before.busMicros);
+                SerialM.print(F(" us, diff "));
+                SerialM.print(after.diffMicros - before.diffMicros);
+                SerialM.print(F(" us) worst frame: "));
+                SerialM.print(bench.maxFrameMicros);
+                SerialM.print(F(" us bus bytes: "));
+                SerialM.println(after.bytes - before.bytes);
+                SerialM.print(F("OLED menu images: "));
+                SerialM.print(OLED_MENU_IMAGES_PACKED_SIZE);
+                SerialM.print(F(" bytes flash, "));
+                SerialM.print(OLED_MENU_IMAGES_RAW_SIZE);
+                SerialM.println(F(" unpacked"));
+            } break;
+#endif
+            case '?': {
+                // access any register field by name: "?VDS_VSYNC_RST" reads, "?VDS_VSYNC_RST=1234" writes
+                char line[40];
+                size_t len = Serial.readBytesUntil('\n', line, sizeof(line) - 1);
+                while (len > 0 && (line[len - 1] == '\r' || line[len - 1] == ' ')) {
+                    len--;
+                }
+                line[len] = '\0';
+                char *assign = strchr(line, '=');
+                RegField field;
+                if (!findRegField(line, assign ? (size_t)(assign - line) : len, field)) {
+                    SerialM.println(F("unknown register"));
+                    break;
+                }
+                if (assign) {
+                    *assign = '\0';
+                    writeRegField(field, strtoul(assign + 1, NULL, 0));
+                }
+                SerialM.print(line);
+                SerialM.print(F(" (S"));
+                SerialM.print(field.segment);
+                SerialM.print("_");
+                SerialM.print(field.byteOffset, HEX);
+                SerialM.print(F(") value: "));
+                SerialM.println(readRegField(field));
+            } break;
             case 'x': {
                 uint16_t if_hblank_scale_stop = GBS::IF_HBIN_SP::read();
                 GBS::IF_HBIN_SP::write(if_hblank_scale_stop + 1);
@@ -8682,7 +9216,7 @@ void loop()
         uint16_t htotal = GBS::STATUS_SYNC_PROC_HTOTAL::read();
         uint16_t pllad = GBS::PLLAD_MD::read();
 
-        if (((htotal > (pllad - 3)) && (htotal < (pllad + 3)))) {
+        if (withinTolerance(htotal, pllad, 2)) {
             uint8_t debug_backup = GBS::TEST_BUS_SEL::read();
             if (debug_backup != 0x0) {
                 GBS::TEST_BUS_SEL::write(0x0);
@@ -8730,18 +9264,30 @@ void loop()
     //}
 
     // syncwatcher polls SP status. when necessary, initiates adjustments or preset changes
-    if (rto->sourceDisconnected == false && rto->syncWatcherEnabled == true && (millis() - lastTimeSyncWatcher) > 20) {
+    // vsync events wake it early, a settled source with a working sync monitor lets it poll less
+    uint32_t syncEventMicros = 0;
+    const bool syncEvent = syncMonitorPoll(syncEventMicros);
+    uint16_t syncWatcherInterval = 20;
+    if (syncMonitorHealthy() && rto->continousStableCounter == 255 && !videoStandardInputIsPalNtscSd()) {
+        // SD sources keep the regular interval, the deinterlacer switching counts on it
+        syncWatcherInterval = SYNC_MONITOR_IDLE_MS;
+    }
+    if (rto->sourceDisconnected == false && rto->syncWatcherEnabled == true &&
+        (syncEvent || (millis() - lastTimeSyncWatcher) > syncWatcherInterval)) {
+        syncMonitorWatcherStart(syncEvent, syncEventMicros);
         runSyncWatcher();
+        syncMonitorWatcherDone(rto->noSyncCounter == 0 && rto->continousStableCounter > 0);
         lastTimeSyncWatcher = millis();
 
         // auto adc gain
         if (uopt->enableAutoGain == 1 && !rto->sourceDisconnected && rto->videoStandardInput > 0 && rto->clampPositionIsSet && rto->noSyncCounter == 0 && rto->continousStableCounter > 90 && rto->boardHasPower) {
             uint16_t htotal = GBS::STATUS_SYNC_PROC_HTOTAL::read();
             uint16_t pllad = GBS::PLLAD_MD::read();
-            if (((htotal > (pllad - 3)) && (htotal < (pllad + 3)))) {
+            if (withinTolerance(htotal, pllad, 2)) {
                 uint8_t debugRegBackup = 0, debugPinBackup = 0;
                 debugPinBackup = GBS::PAD_BOUT_EN::read();
                 debugRegBackup = GBS::TEST_BUS_SEL::read();
+                syncMonitorPause();            // no vsync on the pin meanwhile
                 GBS::PAD_BOUT_EN::write(0);    // disable output to pin for test
                 GBS::DEC_TEST_SEL::write(1);   // luma and G channel
                 GBS::TEST_BUS_SEL::write(0xb); // decimation
@@ -8750,6 +9296,7 @@ void loop()
                 }
                 GBS::TEST_BUS_SEL::write(debugRegBackup);
                 GBS::PAD_BOUT_EN::write(debugPinBackup); // debug output pin back on
+                syncMonitorResume();
             }
         }
     }
@@ -8761,7 +9308,7 @@ void loop()
             if ((rto->continousStableCounter % 5) == 0) { // 5, 10, 15, .., 255
                 uint16_t htotal = GBS::STATUS_SYNC_PROC_HTOTAL::read();
                 uint16_t pllad = GBS::PLLAD_MD::read();
-                if (((htotal > (pllad - 3)) && (htotal < (pllad + 3)))) {
+                if (withinTolerance(htotal, pllad, 2)) {
                     runAutoBestHTotal();
                 }
             }
@@ -8828,6 +9375,8 @@ void loop()
                 externalClockGenSyncInOutRate();
             }
             rto->applyPresetDoneStage = 0;
+            bootPictureShown();
+            modeTransitionEnd(rto->videoStandardInput);
         }
     } else if (rto->applyPresetDoneStage == 1 && (rto->continousStableCounter > 35)) {
         // 3rd chance
@@ -8839,6 +9388,8 @@ void loop()
         // sync clocks now
         externalClockGenSyncInOutRate();
         rto->applyPresetDoneStage = 0; // timeout
+        bootPictureShown();
+        modeTransitionEnd(rto->videoStandardInput);
     }
 
     if (rto->applyPresetDoneStage == 10) {
@@ -8924,7 +9475,7 @@ void loop()
 
 #if defined(ESP8266)
 #include "webui_html.h"
-// gzip -c9 webui.html > webui_html && xxd -i webui_html > webui_html.h && rm webui_html && sed -i -e 's/unsigned char webui_html\[]/const uint8_t webui_html[] PROGMEM/' webui_html.h && sed -i -e 's/unsigned int webui_html_len/const unsigned int webui_html_len/' webui_html.h
+// generated by public/scripts/html2h.sh (gzip -c9n webui.html, xxd -i, plus WEBUI_HTML_HASH)
 
 void handleType2Command(char argument)
 {
@@ -8946,6 +9497,7 @@ void handleType2Command(char argument)
             webSocket.close();
             loadDefaultUserOptions();
             saveUserPrefs();
+            flushUserPrefs();
             Serial.println(F("options set to defaults, restarting"));
             delay(60);
             ESP.reset(); // don't use restart(), messes up websocket reconnects
@@ -9006,59 +9558,26 @@ void handleType2Command(char argument)
             break;
         case 'a':
             webSocket.close();
+            flushUserPrefs();
             Serial.println(F("restart"));
             delay(60);
             ESP.reset(); // don't use restart(), messes up websocket reconnects
             break;
         case 'e': // print files on spiffs
         {
-            Dir dir = SPIFFS.openDir("/");
+            Dir dir = storage().openDir("/");
             while (dir.next()) {
-                SerialM.print(dir.fileName());
+                SerialM.print(storageName(dir));
                 SerialM.print(" ");
                 SerialM.println(dir.fileSize());
                 delay(1); // wifi stack
             }
+            SerialM.print(F("preferences writes: "));
+            SerialM.print(userPrefs.writes);
+            SerialM.print(F(" avoided: "));
+            SerialM.println(userPrefs.avoided);
             ////
-            File f = SPIFFS.open("/preferencesv2.txt", "r");
-            if (!f) {
-                SerialM.println(F("failed opening preferences file"));
-            } else {
-                SerialM.print(F("preset preference = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("frame time lock = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("preset slot = "));
-                SerialM.println((uint8_t)(f.read()));
-                SerialM.print(F("frame lock method = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("auto gain = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("scanlines = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("component output = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("deinterlacer mode = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("line filter = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("peaking = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("preferScalingRgbhv = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("6-tap = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("pal force60 = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("matched = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("step response = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("disable external clock generator = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-
-                f.close();
-            }
+            printUserPrefs(SerialM, *uopt);
         } break;
         case 'f':
         case 'g':
@@ -9275,6 +9794,7 @@ void handleType2Command(char argument)
             break;
         case 'u':
             // restart to attempt wifi station mode connect
+            flushUserPrefs();
             delay(30);
             WiFi.mode(WIFI_STA);
             WiFi.hostname(device_hostname_partial); // _full
@@ -9484,23 +10004,36 @@ void handleType2Command(char argument)
     }
 }
 
-//void webSocketEvent(uint8_t num, uint8_t type, uint8_t * payload, size_t length) {
-//  switch (type) {
-//  case WStype_DISCONNECTED:
-//    //Serial.print("WS: #"); Serial.print(num); Serial.print(" disconnected,");
-//    //Serial.print(" remaining: "); Serial.println(webSocket.connectedClients());
-//  break;
-//  case WStype_CONNECTED:
-//    //Serial.print("WS: #"); Serial.print(num); Serial.print(" connected, ");
-//    //Serial.print(" total: "); Serial.println(webSocket.connectedClients());
-//    updateWebSocketData();
-//  break;
-//  case WStype_PONG:
-//    //Serial.print("p");
-//    updateWebSocketData();
-//  break;
-//  }
-//}
+void webSocketEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length)
+{
+    switch (type) {
+        case WStype_DISCONNECTED:
+            registerWatch.clientDisconnected(num);
+            break;
+        case WStype_TEXT:
+            registerWatch.handleMessage(num, payload, length);
+            break;
+        default:
+            break;
+    }
+}
+
+// The web ui is streamed from flash in small pieces (no heap headroom needed) and tagged with
+// its build time content hash. Browsers always revalidate and usually only get a 304.
+void sendWebUi(AsyncWebServerRequest *request)
+{
+    static const char etag[] = "\"" WEBUI_HTML_HASH "\"";
+    AsyncWebServerResponse *response;
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, "text/html", webui_html, webui_html_len);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
 
 WiFiEventHandler disconnectedEventHandler;
 
@@ -9529,15 +10062,11 @@ void startWebserver()
 
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
         //Serial.println("sending web page");
-        if (ESP.getFreeHeap() > 10000) {
-            AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", webui_html, webui_html_len);
-            response->addHeader("Content-Encoding", "gzip");
-            request->send(response);
-        }
+        sendWebUi(request);
     });
 
     server.on("/sc", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (ESP.getFreeHeap() > 10000) {
+        if (heapAvailable(HeapUser::WebCommand, HEAP_RESERVE_WEB_REQUEST)) {
             int params = request->params();
             //Serial.print("got serial request params: ");
             //Serial.println(params);
@@ -9556,7 +10085,7 @@ void startWebserver()
     });
 
     server.on("/uc", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (ESP.getFreeHeap() > 10000) {
+        if (heapAvailable(HeapUser::WebCommand, HEAP_RESERVE_WEB_REQUEST)) {
             int params = request->params();
             //Serial.print("got user request params: ");
             //Serial.println(params);
@@ -9589,45 +10118,38 @@ void startWebserver()
     });
 
     server.on("/bin/slots.bin", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (ESP.getFreeHeap() > 10000) {
-            SlotMetaArray slotsObject;
-            File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-
-            if (!slotsBinaryFileRead) {
-                File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-                for (int i = 0; i < SLOTS_TOTAL; i++) {
-                    slotsObject.slot[i].slot = i;
-                    slotsObject.slot[i].presetID = 0;
-                    slotsObject.slot[i].scanlines = 0;
-                    slotsObject.slot[i].scanlinesStrength = 0;
-                    slotsObject.slot[i].wantVdsLineFilter = false;
-                    slotsObject.slot[i].wantStepResponse = true;
-                    slotsObject.slot[i].wantPeaking = true;
-                    char emptySlotName[25] = "Empty                   ";
-                    strncpy(slotsObject.slot[i].name, emptySlotName, 25);
-                }
-                slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileWrite.close();
-            } else {
-                slotsBinaryFileRead.close();
-            }
-
-            request->send(SPIFFS, "/slots.bin", "application/octet-stream");
+        if (storage().exists(SLOTS_FILE)) {
+            request->send(storage(), SLOTS_FILE, "application/octet-stream");
+            return;
         }
+        // no slots file (SPIFFS just formatted): stream empty records without touching flash
+        request->send(request->beginResponse("application/octet-stream", sizeof(SlotMetaArray),
+            [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                size_t len = 0;
+                while (len < maxLen && index + len < sizeof(SlotMetaArray)) {
+                    SlotMeta meta;
+                    initSlotMeta(meta, (index + len) / sizeof(SlotMeta));
+                    size_t offset = (index + len) % sizeof(SlotMeta);
+                    size_t n = sizeof(SlotMeta) - offset;
+                    if (n > maxLen - len) {
+                        n = maxLen - len;
+                    }
+                    memcpy(buffer + len, (uint8_t *)&meta + offset, n);
+                    len += n;
+                }
+                return len;
+            }));
     });
 
     server.on("/slot/set", HTTP_GET, [](AsyncWebServerRequest *request) {
         bool result = false;
 
-        if (ESP.getFreeHeap() > 10000) {
+        if (heapAvailable(HeapUser::WebSlot, HEAP_RESERVE_WEB_REQUEST)) {
             int params = request->params();
 
             if (params > 0) {
                 AsyncWebParameter *slotParam = request->getParam(0);
-                String slotParamValue = slotParam->value();
-                char slotValue[2];
-                slotParamValue.toCharArray(slotValue, sizeof(slotValue));
-                uopt->presetSlot = (uint8_t)slotValue[0];
+                uopt->presetSlot = (uint8_t)slotParam->value().c_str()[0];
                 uopt->presetPreference = OutputCustomized;
                 saveUserPrefs();
                 result = true;
@@ -9640,64 +10162,34 @@ void startWebserver()
     server.on("/slot/save", HTTP_GET, [](AsyncWebServerRequest *request) {
         bool result = false;
 
-        if (ESP.getFreeHeap() > 10000) {
+        if (heapAvailable(HeapUser::WebSlot, HEAP_RESERVE_WEB_REQUEST)) {
             int params = request->params();
 
             if (params > 0) {
-                SlotMetaArray slotsObject;
-                File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-
-                if (slotsBinaryFileRead) {
-                    slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-                    slotsBinaryFileRead.close();
-                } else {
-                    File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-
-                    for (int i = 0; i < SLOTS_TOTAL; i++) {
-                        slotsObject.slot[i].slot = i;
-                        slotsObject.slot[i].presetID = 0;
-                        slotsObject.slot[i].scanlines = 0;
-                        slotsObject.slot[i].scanlinesStrength = 0;
-                        slotsObject.slot[i].wantVdsLineFilter = false;
-                        slotsObject.slot[i].wantStepResponse = true;
-                        slotsObject.slot[i].wantPeaking = true;
-                        char emptySlotName[25] = "Empty                   ";
-                        strncpy(slotsObject.slot[i].name, emptySlotName, 25);
-                    }
-
-                    slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                    slotsBinaryFileWrite.close();
-                }
-
                 // index param
                 AsyncWebParameter *slotIndexParam = request->getParam(0);
-                String slotIndexString = slotIndexParam->value();
-                uint8_t slotIndex = lowByte(slotIndexString.toInt());
+                uint8_t slotIndex = lowByte(slotIndexParam->value().toInt());
                 if (slotIndex >= SLOTS_TOTAL) {
                     goto fail;
                 }
 
                 // name param
                 AsyncWebParameter *slotNameParam = request->getParam(1);
-                String slotName = slotNameParam->value();
 
+                SlotMeta slotMeta;
                 char emptySlotName[25] = "                        ";
-                strncpy(slotsObject.slot[slotIndex].name, emptySlotName, 25);
-
-                slotsObject.slot[slotIndex].slot = slotIndex;
-                slotName.toCharArray(slotsObject.slot[slotIndex].name, sizeof(slotsObject.slot[slotIndex].name));
-                slotsObject.slot[slotIndex].presetID = rto->presetID;
-                slotsObject.slot[slotIndex].scanlines = uopt->wantScanlines;
-                slotsObject.slot[slotIndex].scanlinesStrength = uopt->scanlineStrength;
-                slotsObject.slot[slotIndex].wantVdsLineFilter = uopt->wantVdsLineFilter;
-                slotsObject.slot[slotIndex].wantStepResponse = uopt->wantStepResponse;
-                slotsObject.slot[slotIndex].wantPeaking = uopt->wantPeaking;
+                strncpy(slotMeta.name, emptySlotName, 25);
 
-                File slotsBinaryOutputFile = SPIFFS.open(SLOTS_FILE, "w");
-                slotsBinaryOutputFile.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryOutputFile.close();
+                slotMeta.slot = slotIndex;
+                slotNameParam->value().toCharArray(slotMeta.name, sizeof(slotMeta.name));
+                slotMeta.presetID = rto->presetID;
+                slotMeta.scanlines = uopt->wantScanlines;
+                slotMeta.scanlinesStrength = uopt->scanlineStrength;
+                slotMeta.wantVdsLineFilter = uopt->wantVdsLineFilter;
+                slotMeta.wantStepResponse = uopt->wantStepResponse;
+                slotMeta.wantPeaking = uopt->wantPeaking;
 
-                result = true;
+                result = writeSlotMeta(slotIndex, slotMeta);
             }
         }
 
@@ -9720,59 +10212,59 @@ void startWebserver()
             else
             {
                 Ascii8 slot = uopt->presetSlot;
-                Ascii8 nextSlot;
-                auto currentSlot = slotIndexMap.indexOf(slot);
+                const int currentSlot = slotIndexOf(slot);
+                if (currentSlot < 0) {
+                    goto fail;
+                }
 
-                SlotMetaArray slotsObject;
-                File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-                slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileRead.close();
-                String slotName = slotsObject.slot[currentSlot].name;
+                SlotMeta slotMeta;
+                readSlotMeta(currentSlot, slotMeta);
+                char slotName[sizeof(slotMeta.name)];
+                memcpy(slotName, slotMeta.name, sizeof(slotName));
+                slotName[sizeof(slotName) - 1] = 0;
 
                 // remove preset files
-                SPIFFS.remove("/preset_ntsc." + String((char)slot));
-                SPIFFS.remove("/preset_pal." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_480p." + String((char)slot));
-                SPIFFS.remove("/preset_pal_576p." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_720p." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_1080p." + String((char)slot));
-                SPIFFS.remove("/preset_medium_res." + String((char)slot));
-                SPIFFS.remove("/preset_vga_upscale." + String((char)slot));
-                SPIFFS.remove("/preset_unknown." + String((char)slot));
-                
+                char path[PRESET_PATH_SIZE];
+                char nextPath[PRESET_PATH_SIZE];
+                for (uint8_t source = 0; source < PRESET_SOURCE_COUNT; source++) {
+                    presetPathAt(path, source, slot);
+                    storage().remove(path);
+                }
+
+                // one open slots file for the whole shift
+                initSlotsFile();
+                File slots = storage().open(SLOTS_FILE, "r+");
                 uint8_t loopCount = 0;
                 uint8_t flag = 1;
                 while (flag != 0)
                 {
-                    slot = slotIndexMap[currentSlot + loopCount];
-                    nextSlot = slotIndexMap[currentSlot + loopCount + 1];
+                    slot = slotAt(currentSlot + loopCount);
+                    const char nextSlot = slotAt(currentSlot + loopCount + 1);
                     flag = 0;
-                    flag += SPIFFS.rename("/preset_ntsc." + String((char)(nextSlot)), "/preset_ntsc." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_pal." + String((char)(nextSlot)), "/preset_pal." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_480p." + String((char)(nextSlot)), "/preset_ntsc_480p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_pal_576p." + String((char)(nextSlot)), "/preset_pal_576p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_720p." + String((char)(nextSlot)), "/preset_ntsc_720p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_1080p." + String((char)(nextSlot)), "/preset_ntsc_1080p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_medium_res." + String((char)(nextSlot)), "/preset_medium_res." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_vga_upscale." + String((char)(nextSlot)), "/preset_vga_upscale." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_unknown." + String((char)(nextSlot)), "/preset_unknown." + String((char)slot));
-
-                    slotsObject.slot[currentSlot + loopCount].slot = slotsObject.slot[currentSlot + loopCount + 1].slot;
-                    slotsObject.slot[currentSlot + loopCount].presetID = slotsObject.slot[currentSlot + loopCount + 1].presetID;
-                    slotsObject.slot[currentSlot + loopCount].scanlines = slotsObject.slot[currentSlot + loopCount + 1].scanlines;
-                    slotsObject.slot[currentSlot + loopCount].scanlinesStrength = slotsObject.slot[currentSlot + loopCount + 1].scanlinesStrength;
-                    slotsObject.slot[currentSlot + loopCount].wantVdsLineFilter = slotsObject.slot[currentSlot + loopCount + 1].wantVdsLineFilter;
-                    slotsObject.slot[currentSlot + loopCount].wantStepResponse = slotsObject.slot[currentSlot + loopCount + 1].wantStepResponse;
-                    slotsObject.slot[currentSlot + loopCount].wantPeaking = slotsObject.slot[currentSlot + loopCount + 1].wantPeaking;
-                    // slotsObject.slot[currentSlot + loopCount].name = slotsObject.slot[currentSlot + loopCount + 1].name;
-                    strncpy(slotsObject.slot[currentSlot + loopCount].name, slotsObject.slot[currentSlot + loopCount + 1].name, 25);
+                    for (uint8_t source = 0; source < PRESET_SOURCE_COUNT; source++) {
+                        presetPathAt(nextPath, source, nextSlot);
+                        presetPathAt(path, source, slot);
+                        flag += storage().rename(nextPath, path);
+                    }
+
+                    // move the next record down, one record in memory at a time
+                    if (currentSlot + loopCount + 1 < SLOTS_TOTAL) {
+                        readSlotMeta(slots, currentSlot + loopCount + 1, slotMeta);
+                    } else {
+                        initSlotMeta(slotMeta, currentSlot + loopCount);
+                    }
+                    writeSlotMeta(slots, currentSlot + loopCount, slotMeta);
                     loopCount++;
+                    if (currentSlot + loopCount >= SLOTS_TOTAL) {
+                        break;
+                    }
                 }
-
-                File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-                slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileWrite.close();
-                SerialM.println("Preset \"" + slotName + "\" removed");
+                if (slots) {
+                    slots.close();
+                }
+                SerialM.print(F("Preset \""));
+                SerialM.print(slotName);
+                SerialM.println(F("\" removed"));
                 result = true;
             }
         }
@@ -9790,21 +10282,25 @@ void startWebserver()
         [](AsyncWebServerRequest *request) { request->send(200, "application/json", "true"); },
         [](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
             if (!index) {
-                request->_tempFile = SPIFFS.open("/" + filename, "w");
+                request->_tempFile = storage().open("/" + filename, "w");
             }
             if (len) {
                 request->_tempFile.write(data, len);
             }
             if (final) {
                 request->_tempFile.close();
+                if (("/" + filename).equals(PREFS_FILE) || ("/" + filename).equals(PREFS_LEGACY_FILE)) {
+                    discardUserPrefs();
+                }
             }
         });
 
     server.on("/spiffs/download", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (ESP.getFreeHeap() > 10000) {
+        if (heapAvailable(HeapUser::WebDownload, HEAP_RESERVE_WEB_REQUEST)) {
             int params = request->params();
             if (params > 0) {
-                request->send(SPIFFS, request->getParam(0)->value(), String(), true);
+                flushUserPrefs();
+                request->send(storage(), request->getParam(0)->value(), String(), true);
             } else {
                 request->send(200, "application/json", "false");
             }
@@ -9814,29 +10310,104 @@ void startWebserver()
     });
 
     server.on("/spiffs/dir", HTTP_GET, [](AsyncWebServerRequest *request) {
-        if (ESP.getFreeHeap() > 10000) {
-            Dir dir = SPIFFS.openDir("/");
-            String output = "[";
-
-            while (dir.next()) {
-                output += "\"";
-                output += dir.fileName();
-                output += "\",";
-                delay(1); // wifi stack
-            }
+        // json array of file names, produced one entry per refill instead of one big String
+        struct DirStream
+        {
+            Dir dir;
+            char entry[40]; // separator + quoted name (SPIFFS names are max. 31 chars)
+            uint8_t entryLen;
+            uint8_t entryPos;
+            bool first;
+            bool done;
+        };
+        std::shared_ptr<DirStream> ds(new DirStream);
+        ds->dir = storage().openDir("/");
+        ds->entryLen = ds->entryPos = 0;
+        ds->first = true;
+        ds->done = false;
+
+        request->send(request->beginChunkedResponse("application/json",
+            [ds](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                size_t len = 0;
+                while (len < maxLen) {
+                    if (ds->entryPos == ds->entryLen) {
+                        if (ds->done) {
+                            break;
+                        }
+                        int n;
+                        if (ds->dir.next()) {
+                            n = snprintf(ds->entry, sizeof(ds->entry), "%c\"%s\"", ds->first ? '[' : ',', storageName(ds->dir).c_str());
+                        } else {
+                            n = snprintf(ds->entry, sizeof(ds->entry), "%s", ds->first ? "[]" : "]");
+                            ds->done = true;
+                        }
+                        ds->first = false;
+                        ds->entryLen = n < (int)sizeof(ds->entry) ? n : sizeof(ds->entry) - 1;
+                        ds->entryPos = 0;
+                    }
+                    buffer[len++] = ds->entry[ds->entryPos++];
+                }
+                return len;
+            }));
+    });
 
-            output += "]";
+    server.on("/spiffs/backup", HTTP_GET, [](AsyncWebServerRequest *request) {
+        // one archive of all slots, presets and preferences, read from flash as the response drains
+        flushUserPrefs();
+        std::shared_ptr<BackupWriter> writer(new BackupWriter);
+        AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream",
+            [writer](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                return writer->fill(buffer, maxLen);
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"gbs-control.backup.bin\"");
+        request->send(response);
+    });
 
-            output.replace(",]", "]");
+    server.on(
+        "/spiffs/restore", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            if (backupReader.finish()) {
+                discardUserPrefs(); // pending changes must not overwrite the restored preferences
+                request->send(200, "application/json", "true");
+            } else {
+                request->send(400, "text/plain", backupReader.lastError());
+            }
+        },
+        [](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+            // checked and staged while uploading, finish() swaps the files in
+            if (!index) {
+                backupReader.begin();
+            }
+            if (len) {
+                backupReader.feed(data, len);
+            }
+        });
 
-            request->send(200, "application/json", output);
-            return;
-        }
-        request->send(200, "application/json", "false");
+    server.on("/oled.pbm", HTTP_GET, [](AsyncWebServerRequest *request) {
+        // screenshot of the OLED frame buffer
+        request->send(request->beginResponse("image/x-portable-bitmap", OLED_PBM_SIZE,
+            [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                return display.readPbm(buffer, maxLen, index);
+            }));
     });
 
     server.on("/spiffs/format", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(200, "application/json", SPIFFS.format() ? "true" : "false");
+        request->send(200, "application/json", storageFormat() ? "true" : "false");
+    });
+
+    server.on("/gbs/heap", HTTP_GET, [](AsyncWebServerRequest *request) {
+        // "?reset" restarts the minimum / maximum tracking, to look at one feature at a time
+        if (request->hasParam("reset")) {
+            heapTelemetryReset();
+        } else {
+            heapTelemetrySample();
+        }
+        char json[HEAP_JSON_SIZE];
+        if (heapTelemetryJson(json, sizeof(json))) {
+            request->send(200, "application/json", json);
+        } else {
+            request->send(500);
+        }
     });
 
     server.on("/wifi/status", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -9845,18 +10416,11 @@ void startWebserver()
     });
 
     server.on("/gbs/restore-filters", HTTP_GET, [](AsyncWebServerRequest *request) {
-        SlotMetaArray slotsObject;
-        File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
+        SlotMeta slotMeta;
         bool result = false;
-        if (slotsBinaryFileRead) {
-            slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-            slotsBinaryFileRead.close();
-            auto currentSlot = slotIndexMap.indexOf(uopt->presetSlot);
-            if (currentSlot == -1) {
-                goto fail;
-            }
-
-            uopt->wantScanlines = slotsObject.slot[currentSlot].scanlines;
+        int currentSlot = slotIndexOf(uopt->presetSlot);
+        if (currentSlot != -1 && readSlotMeta(currentSlot, slotMeta)) {
+            uopt->wantScanlines = slotMeta.scanlines;
 
             SerialM.print(F("slot: "));
             SerialM.println(uopt->presetSlot);
@@ -9869,18 +10433,17 @@ void startWebserver()
             }
             saveUserPrefs();
 
-            uopt->scanlineStrength = slotsObject.slot[currentSlot].scanlinesStrength;
-            uopt->wantVdsLineFilter = slotsObject.slot[currentSlot].wantVdsLineFilter;
-            uopt->wantStepResponse = slotsObject.slot[currentSlot].wantStepResponse;
-            uopt->wantPeaking = slotsObject.slot[currentSlot].wantPeaking;
+            uopt->scanlineStrength = slotMeta.scanlinesStrength;
+            uopt->wantVdsLineFilter = slotMeta.wantVdsLineFilter;
+            uopt->wantStepResponse = slotMeta.wantStepResponse;
+            uopt->wantPeaking = slotMeta.wantPeaking;
             result = true;
         }
 
-        fail:
         request->send(200, "application/json", result ? "true" : "false");
     });
 
-    //webSocket.onEvent(webSocketEvent);
+    webSocket.onEvent(webSocketEvent);
 
     persWM.setConnectNonBlock(true);
     if (WiFi.SSID().length() == 0) {
@@ -9940,8 +10503,8 @@ void initUpdateOTA()
         else // U_SPIFFS
             type = "filesystem";
 
-        // NOTE: if updating SPIFFS this would be the place to unmount SPIFFS using SPIFFS.end()
-        SPIFFS.end();
+        // NOTE: if updating the file system this would be the place to unmount it
+        storage().end();
         SerialM.println("Start updating " + type);
     });
     ArduinoOTA.onEnd([]() {
@@ -9977,52 +10540,17 @@ void StrClear(char *str, uint16_t length)
 
 const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
 {
-    static uint8_t preset[432];
-    String s = "";
-    Ascii8 slot = 0;
+    static uint8_t preset[PRESET_VALUE_COUNT];
+    Ascii8 slot = uopt->presetSlot;
+    char path[PRESET_PATH_SIZE];
     File f;
 
-    f = SPIFFS.open("/preferencesv2.txt", "r");
-    if (f) {
-        SerialM.println(F("preferencesv2.txt opened"));
-        uint8_t result[3];
-        result[0] = f.read(); // todo: move file cursor manually
-        result[1] = f.read();
-        result[2] = f.read();
-
-        f.close();
-        slot = result[2];
-    } else {
-        // file not found, we don't know what preset to load
-        SerialM.println(F("please select a preset slot first!")); // say "slot" here to make people save usersettings
-        if (forVideoMode == 2 || forVideoMode == 4)
-            return pal_240p;
-        else
-            return ntsc_240p;
-    }
-
     SerialM.print(F("loading from preset slot "));
     SerialM.print((char)slot);
     SerialM.print(": ");
 
-    if (forVideoMode == 1) {
-        f = SPIFFS.open("/preset_ntsc." + String((char)slot), "r");
-    } else if (forVideoMode == 2) {
-        f = SPIFFS.open("/preset_pal." + String((char)slot), "r");
-    } else if (forVideoMode == 3) {
-        f = SPIFFS.open("/preset_ntsc_480p." + String((char)slot), "r");
-    } else if (forVideoMode == 4) {
-        f = SPIFFS.open("/preset_pal_576p." + String((char)slot), "r");
-    } else if (forVideoMode == 5) {
-        f = SPIFFS.open("/preset_ntsc_720p." + String((char)slot), "r");
-    } else if (forVideoMode == 6) {
-        f = SPIFFS.open("/preset_ntsc_1080p." + String((char)slot), "r");
-    } else if (forVideoMode == 8) {
-        f = SPIFFS.open("/preset_medium_res." + String((char)slot), "r");
-    } else if (forVideoMode == 14) {
-        f = SPIFFS.open("/preset_vga_upscale." + String((char)slot), "r");
-    } else if (forVideoMode == 0) {
-        f = SPIFFS.open("/preset_unknown." + String((char)slot), "r");
+    if (presetPath(path, forVideoMode, slot)) {
+        f = storage().open(path, "r");
     }
 
     if (!f) {
@@ -10031,19 +10559,13 @@ const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
             return pal_240p;
         else
             return ntsc_240p;
-    } else {
-        SerialM.println(f.name());
-        s = f.readStringUntil('}');
-        f.close();
     }
-
-    char *tmp;
-    uint16_t i = 0;
-    tmp = strtok(&s[0], ",");
-    while (tmp) {
-        preset[i++] = (uint8_t)atoi(tmp);
-        tmp = strtok(NULL, ",");
-        yield(); // wifi stack
+    SerialM.println(f.name());
+    const uint16_t count = readPresetValues(f, preset, sizeof(preset));
+    f.close();
+    if (count != sizeof(preset)) {
+        SerialM.print(F("preset file is incomplete, values: "));
+        SerialM.println(count);
     }
 
     return preset;
@@ -10052,46 +10574,15 @@ const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
 void savePresetToSPIFFS()
 {
     uint8_t readout = 0;
+    char path[PRESET_PATH_SIZE];
     File f;
-    Ascii8 slot = 0;
-
-    // first figure out if the user has set a preferenced slot
-    f = SPIFFS.open("/preferencesv2.txt", "r");
-    if (f) {
-        uint8_t result[3];
-        result[0] = f.read(); // todo: move file cursor manually
-        result[1] = f.read();
-        result[2] = f.read();
-
-        f.close();
-        slot = result[2]; // got the slot to save to now
-    } else {
-        // file not found, we don't know where to save this preset
-        SerialM.println(F("please select a preset slot first!"));
-        return;
-    }
+    Ascii8 slot = uopt->presetSlot;
 
     SerialM.print(F("saving to preset slot "));
-    SerialM.println(String((char)slot));
-
-    if (rto->videoStandardInput == 1) {
-        f = SPIFFS.open("/preset_ntsc." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 2) {
-        f = SPIFFS.open("/preset_pal." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 3) {
-        f = SPIFFS.open("/preset_ntsc_480p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 4) {
-        f = SPIFFS.open("/preset_pal_576p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 5) {
-        f = SPIFFS.open("/preset_ntsc_720p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 6) {
-        f = SPIFFS.open("/preset_ntsc_1080p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 8) {
-        f = SPIFFS.open("/preset_medium_res." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 14) {
-        f = SPIFFS.open("/preset_vga_upscale." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 0) {
-        f = SPIFFS.open("/preset_unknown." + String((char)slot), "w");
+    SerialM.println((char)slot);
+
+    if (presetPath(path, rto->videoStandardInput, slot)) {
+        f = storage().open(path, "w");
     }
 
     if (!f) {
@@ -10166,35 +10657,145 @@ void savePresetToSPIFFS()
     }
 }
 
-void saveUserPrefs()
+// slot metadata lives in SLOTS_FILE as SLOTS_TOTAL consecutive SlotMeta records,
+// accessed one record at a time so no handler needs the whole SlotMetaArray
+void initSlotMeta(SlotMeta &slotMeta, uint8_t index)
 {
-    File f = SPIFFS.open("/preferencesv2.txt", "w");
+    strncpy(slotMeta.name, EMPTY_SLOT_NAME, sizeof(slotMeta.name));
+    slotMeta.presetID = 0;
+    slotMeta.scanlines = 0;
+    slotMeta.scanlinesStrength = 0;
+    slotMeta.slot = index;
+    slotMeta.wantVdsLineFilter = false;
+    slotMeta.wantStepResponse = true;
+    slotMeta.wantPeaking = true;
+}
+
+// creates SLOTS_FILE with empty records if it is missing or truncated, called at boot
+bool initSlotsFile()
+{
+    File f = storage().open(SLOTS_FILE, "r");
+    if (f) {
+        size_t size = f.size();
+        f.close();
+        if (size == sizeof(SlotMetaArray)) {
+            return true;
+        }
+    }
+    f = storage().open(SLOTS_FILE, "w");
     if (!f) {
-        SerialM.println(F("saveUserPrefs: open file failed"));
+        return false;
+    }
+    SlotMeta slotMeta;
+    for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+        initSlotMeta(slotMeta, i);
+        f.write((const uint8_t *)&slotMeta, sizeof(slotMeta));
+    }
+    f.close();
+    return true;
+}
+
+// record access through an open SLOTS_FILE, for handlers that touch many records
+bool readSlotMeta(File &f, uint8_t index, SlotMeta &slotMeta)
+{
+    if (index >= SLOTS_TOTAL || !f || !f.seek(index * sizeof(SlotMeta), SeekSet) ||
+        f.read((uint8_t *)&slotMeta, sizeof(slotMeta)) != sizeof(slotMeta)) {
+        initSlotMeta(slotMeta, index);
+        return false;
+    }
+    return true;
+}
+
+bool writeSlotMeta(File &f, uint8_t index, const SlotMeta &slotMeta)
+{
+    return index < SLOTS_TOTAL && f && f.seek(index * sizeof(SlotMeta), SeekSet) &&
+           f.write((const uint8_t *)&slotMeta, sizeof(slotMeta)) == sizeof(slotMeta);
+}
+
+bool readSlotMeta(uint8_t index, SlotMeta &slotMeta)
+{
+    File f = storage().open(SLOTS_FILE, "r");
+    bool ok = readSlotMeta(f, index, slotMeta);
+    if (f) {
+        f.close();
+    }
+    return ok;
+}
+
+bool writeSlotMeta(uint8_t index, const SlotMeta &slotMeta)
+{
+    if (index >= SLOTS_TOTAL || !initSlotsFile()) {
+        return false;
+    }
+    File f = storage().open(SLOTS_FILE, "r+");
+    bool ok = writeSlotMeta(f, index, slotMeta);
+    if (f) {
+        f.close();
+    }
+    return ok;
+}
+
+// only marks the preferences as changed, handleUserPrefs() writes them once things settle down
+void saveUserPrefs()
+{
+    if (userPrefs.dirty) {
+        userPrefs.avoided++;
+    } else {
+        userPrefs.dirty = true;
+        userPrefs.firstChange = millis();
+    }
+    userPrefs.lastChange = millis();
+}
+
+// writes pending preferences now, before a reboot or when something reads the file directly
+void flushUserPrefs()
+{
+    if (!userPrefs.dirty) {
         return;
     }
-    f.write(uopt->presetPreference + '0'); // #1
-    f.write(uopt->enableFrameTimeLock + '0');
-    f.write(uopt->presetSlot);
-    f.write(uopt->frameTimeLockMethod + '0');
-    f.write(uopt->enableAutoGain + '0');
-    f.write(uopt->wantScanlines + '0');
-    f.write(uopt->wantOutputComponent + '0');
-    f.write(uopt->deintMode + '0');
-    f.write(uopt->wantVdsLineFilter + '0');
-    f.write(uopt->wantPeaking + '0');
-    f.write(uopt->preferScalingRgbhv + '0');
-    f.write(uopt->wantTap6 + '0');
-    f.write(uopt->PalForce60 + '0');
-    f.write(uopt->matchPresetSource + '0');             // #14
-    f.write(uopt->wantStepResponse + '0');              // #15
-    f.write(uopt->wantFullHeight + '0');                // #16
-    f.write(uopt->enableCalibrationADC + '0');          // #17
-    f.write(uopt->scanlineStrength + '0');              // #18
-    f.write(uopt->disableExternalClockGenerator + '0'); // #19
+    if (storeUserPrefs(*uopt)) {
+        userPrefs.writes++;
+        userPrefs.dirty = false;
+        userPrefs.failures = 0;
+    } else {
+        SerialM.println(F("saveUserPrefs: write failed"));
+        // start over, handleUserPrefs() backs off before the next attempt
+        userPrefs.firstChange = userPrefs.lastChange = millis();
+        if (userPrefs.failures < 255) {
+            userPrefs.failures++;
+        }
+    }
+}
 
+// forgets pending changes, the file on flash was replaced from elsewhere (restore)
+void discardUserPrefs()
+{
+    userPrefs.dirty = false;
+    userPrefs.failures = 0;
+}
 
-    f.close();
+void handleUserPrefs()
+{
+    if (!userPrefs.dirty) {
+        return;
+    }
+    unsigned long now = millis();
+    if (userPrefs.failures) {
+        unsigned long retry = PREFS_QUIET_MS;
+        for (uint8_t i = 0; i < userPrefs.failures && retry < PREFS_RETRY_MAX_MS; i++) {
+            retry <<= 1;
+        }
+        if (retry > PREFS_RETRY_MAX_MS) {
+            retry = PREFS_RETRY_MAX_MS;
+        }
+        if (now - userPrefs.firstChange >= retry) {
+            flushUserPrefs();
+        }
+        return;
+    }
+    if (now - userPrefs.lastChange >= PREFS_QUIET_MS || now - userPrefs.firstChange >= PREFS_MAX_DELAY_MS) {
+        flushUserPrefs();
+    }
 }
 
 #endif
@@ -10674,6 +11275,7 @@ void settingsMenuOLED()
                 display.display();
             }
             webSocket.close();
+            flushUserPrefs();
             delay(60);
             ESP.reset();
             oled_selectOption = 0;
@@ -10691,6 +11293,7 @@ void settingsMenuOLED()
             webSocket.close();
             loadDefaultUserOptions();
             saveUserPrefs();
+            flushUserPrefs();
             delay(60);
             ESP.reset();
             oled_selectOption = 1;
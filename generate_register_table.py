@@ -0,0 +1,98 @@
+import os.path
+import re
+import sys
+from argparse import ArgumentParser
+
+# Generates tv5725_fields.h, a name sorted reflection table of all register
+# fields typedef'd in tv5725.h (see RegisterTable.h for the lookup functions).
+# Run after changing tv5725.h. "--check" exits with 1 if the table is stale.
+
+TYPEDEF_RE = re.compile(
+    r"^\s*typedef\s+(UReg|Register)<\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,"
+    r"\s*(\d+)\s*,\s*(\d+)\s*(?:,\s*tw::Signage::(SIGNED|UNSIGNED)\s*)?>\s*(\w+)\s*;"
+)
+
+
+def parse_fields(header):
+    fields = []
+    with open(header, encoding="utf-8") as f:
+        for line in f:
+            m = TYPEDEF_RE.match(line)
+            if not m:
+                continue
+            kind, seg, byte, bit, width, signage, name = m.groups()
+            fields.append({
+                "name": name,
+                "segment": int(seg, 0),
+                "byte": int(byte, 0),
+                "bit": int(bit),
+                "width": int(width),
+                "signed": 1 if (kind == "Register" and signage == "SIGNED") else 0,
+            })
+    # strcmp order, required by the binary search in RegisterTable.cpp
+    fields.sort(key=lambda f: f["name"].encode("ascii"))
+    for a, b in zip(fields, fields[1:]):
+        if a["name"] == b["name"]:
+            sys.exit("duplicate register name: " + a["name"])
+    return fields
+
+
+def render(fields):
+    out = []
+    out.append("// generated by generate_register_table.py from tv5725.h, do not edit")
+    out.append("#ifndef TV5725_FIELDS_H_")
+    out.append("#define TV5725_FIELDS_H_")
+    out.append("")
+    out.append("#define TV5725_FIELD_COUNT %d" % len(fields))
+    out.append("")
+    offsets = []
+    pos = 0
+    out.append("static const char tv5725FieldNames[] PROGMEM =")
+    for f in fields:
+        offsets.append(pos)
+        pos += len(f["name"]) + 1
+        out.append('    "%s\\0"' % f["name"])
+    out.append("    ;")
+    out.append("")
+    out.append("static constexpr RegFieldEntry tv5725Fields[TV5725_FIELD_COUNT] PROGMEM = {")
+    for f, offset in zip(fields, offsets):
+        out.append("    {%d, 0x%02X, 0x%02X, %d, %d, %d}, // %s" % (
+            offset, f["segment"], f["byte"], f["bit"], f["width"], f["signed"], f["name"]))
+    out.append("};")
+    out.append("")
+    out.append("#ifdef TV5725_FIELDS_CHECK")
+    out.append("// fails to compile if tv5725.h changed without regenerating this table")
+    for f in fields:
+        out.append("static_assert(GBS::%s::segment == 0x%02X && GBS::%s::byteOffset == 0x%02X && "
+                   "GBS::%s::bitOffset == %d && GBS::%s::bitWidth == %d, \"%s\");" % (
+                       f["name"], f["segment"], f["name"], f["byte"],
+                       f["name"], f["bit"], f["name"], f["width"], f["name"]))
+    out.append("#endif")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = ArgumentParser()
+    parser.add_argument("--header", default=os.path.join(here, "tv5725.h"))
+    parser.add_argument("--output", default=os.path.join(here, "tv5725_fields.h"))
+    parser.add_argument("--check", action="store_true", help="only verify the output is up to date")
+    args = parser.parse_args()
+
+    text = render(parse_fields(args.header))
+    if args.check:
+        current = open(args.output, encoding="utf-8").read() if os.path.exists(args.output) else ""
+        if current != text:
+            print("%s is out of date, run generate_register_table.py" % args.output)
+            sys.exit(1)
+        print("%s is up to date" % args.output)
+        return
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    print("%s generated" % args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -202,10 +202,73 @@ def collect(lang):
 template = """
 #define %(name)s_WIDTH %(width)s
 #define %(name)s_HEIGHT %(height)s
+// %(raw)d bytes packed to %(packed)d
 const unsigned char %(name)s [] PROGMEM = {
 %(array)s
 };
 """
+
+
+def pack(data):
+    """PackBits style run length encoding, decoded by PackedXbmReader (PackedXbm.h).
+    0x00-0x7f: the next n + 1 bytes are literals
+    0x80-0xff: the next byte repeats n - 0x80 + 2 times
+    """
+    out = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 3:
+            flush()
+            out.append(0x80 + run - 2)
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def write_header(fp, images):
+    """images: list of (tag, width, height, xbm bytes)"""
+    raw_total = 0
+    packed_total = 0
+    max_row_bytes = 0
+    fp.write('#ifndef OLED_MENU_TRANSLATIONS_H_\n')
+    fp.write('#define OLED_MENU_TRANSLATIONS_H_\n')
+    fp.write('// generated by generate_translations.py, images are packed (see PackedXbm.h)\n')
+    for tag, width, height, byte_array in images:
+        packed = pack(byte_array)
+        raw_total += len(byte_array)
+        packed_total += len(packed)
+        max_row_bytes = max(max_row_bytes, (width + 7) // 8)
+        tmp_str = ""
+        i = 0
+        while i < len(packed):
+            end = min(i + 16, len(packed))
+            tmp_str += ','.join([hex(x) for x in packed[i:end]]) + ',\n'
+            i = end
+        fp.write(template % {'array': tmp_str, 'width': width, 'height': height, 'name': tag,
+                             'raw': len(byte_array), 'packed': len(packed)})
+    fp.write('\n#define OLED_MENU_IMAGES_RAW_SIZE %d\n' % raw_total)
+    fp.write('#define OLED_MENU_IMAGES_PACKED_SIZE %d\n' % packed_total)
+    fp.write('#define OLED_MENU_IMAGE_MAX_ROW_BYTES %d\n' % max_row_bytes)
+    fp.write('#endif')
+    print(f"Images: {raw_total} bytes packed to {packed_total} bytes")
+
+
 if __name__ == '__main__':
     parser = ArgumentParser()
     parser.add_argument('lang', help='Language code', nargs='?')
@@ -240,26 +303,14 @@ if __name__ == '__main__':
         except (OSError, FileNotFoundError):
             raise FileNotFoundError(f"Font does not exist: {font}") from None
 
+    images = []
+    for tag, (text, size) in tags_map.items():
+        if not size:
+            size = DEFAULT_FONT_SIZE
+        font = fonts_map.get(size, default_font)
+        font = ImageFont.truetype(font, size=size)
+        width, height, byte_array = convert(text, font)
+        images.append((tag, width, height, byte_array))
     with open(args.output, 'w') as fp:
-        fp.write('#ifndef OLED_MENU_TRANSLATIONS_H_\n')
-        fp.write('#define OLED_MENU_TRANSLATIONS_H_\n')
-        for tag, (text, size) in tags_map.items():
-            if not size:
-                size = DEFAULT_FONT_SIZE
-            font = fonts_map.get(size, default_font)
-            font = ImageFont.truetype(font, size=size)
-            width, height, byte_array = convert(text, font)
-            tmp_str = ""
-            i = 0
-            while i < len(byte_array):
-                if i + 16 < len(byte_array):
-                    end = i + 16
-                else:
-                    end = len(byte_array)
-                tmp_str += ','.join([hex(x)
-                                     for x in byte_array[i:end]]) + ',\n'
-                i = end
-            fp.write(template % {'array': tmp_str,
-                                 'width': width, 'height': height, 'name': tag})
-        fp.write('#endif')
-        print(f"Finished. Output file: {pathlib.Path(args.output).absolute()}")
+        write_header(fp, images)
+    print(f"Finished. Output file: {pathlib.Path(args.output).absolute()}")
@@ -1,7 +1,11 @@
 #!/usr/bin/env bash
 
 cd ../..
-gzip -c9 webui.html > webui_html && xxd -i webui_html > webui_html.h && rm webui_html && sed -i -e 's/unsigned char webui_html\[]/const uint8_t webui_html[] PROGMEM/' webui_html.h && sed -i -e 's/unsigned int webui_html_len/const unsigned int webui_html_len/' webui_html.h
+# -n: no file name / timestamp in the gzip header, so the same page always gets the same hash (ETag)
+gzip -c9n webui.html > webui_html && xxd -i webui_html > webui_html.h && sed -i -e 's/unsigned char webui_html\[]/const uint8_t webui_html[] PROGMEM/' webui_html.h && sed -i -e 's/unsigned int webui_html_len/const unsigned int webui_html_len/' webui_html.h
+# content hash, used as strong ETag
+echo "#define WEBUI_HTML_HASH \"$(sha1sum webui_html | cut -c1-16)\"" >> webui_html.h
+rm webui_html
 rm -fv webui_html.h-e
 
-echo "webui_html.h GENERATED";
\ No newline at end of file
+echo "webui_html.h GENERATED";
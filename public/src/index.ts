@@ -728,65 +728,67 @@ const readLocalFile = (file: File) => {
 /** backup / restore */
 
 const doBackup = () => {
-  let backupFiles: string[];
-  let done = 0;
-  let total = 0;
-  fetch("/spiffs/dir")
-    .then((r) => r.json())
-    .then((files: string[]) => {
-      backupFiles = files;
-      total = files.length;
-      const funcs = files.map((path: string) => () => {
-        return fetch(`/spiffs/download?file=${path}&${+new Date()}`).then(
-          (response) => {
-            GBSControl.ui.progressBackup.setAttribute(
-              "gbs-progress",
-              `${done}/${total}`
-            );
-            done++;
-            return checkFetchResponseStatus(response) && response.arrayBuffer();
-          }
-        );
-      });
-
-      return serial(funcs);
+  // the firmware streams a single archive (manifest + crc per file)
+  GBSControl.ui.progressBackup.setAttribute("gbs-progress", `...`);
+  fetch(`/spiffs/backup?${+new Date()}`)
+    .then((response) => checkFetchResponseStatus(response) && response.blob())
+    .then((blob: Blob) => {
+      downloadBlob(blob, `gbs-control.backup-${+new Date()}.bin`);
+      GBSControl.ui.progressBackup.setAttribute("gbs-progress", ``);
     })
-    .then((files: ArrayBuffer[]) => {
-      const headerDescriptor = files.reduce((acc, f, index) => {
-        acc[backupFiles[index]] = f.byteLength;
-        return acc;
-      }, {});
-
-      const backupFilesJSON = JSON.stringify(headerDescriptor);
-      const backupFilesJSONSize = backupFilesJSON.length;
-
-      const mainHeader = [
-        (backupFilesJSONSize >> 24) & 255, // size
-        (backupFilesJSONSize >> 16) & 255, // size
-        (backupFilesJSONSize >> 8) & 255, // size
-        (backupFilesJSONSize >> 0) & 255,
-      ];
-
-      const outputArray: number[] = [
-        ...mainHeader,
-        ...backupFilesJSON.split("").map((c) => c.charCodeAt(0)),
-        ...files.reduce((acc, f, index) => {
-          acc = acc.concat(Array.from(new Uint8Array(f)));
-          return acc;
-        }, []),
-      ];
-
-      downloadBlob(
-        new Blob([new Uint8Array(outputArray)]),
-        `gbs-control.backup-${+new Date()}.bin`
-      );
+    .catch(() => {
       GBSControl.ui.progressBackup.setAttribute("gbs-progress", ``);
+      gbsAlert("Backup failed").catch(() => {});
+    });
+};
+
+const restartAfterRestore = () => {
+  GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
+  loadUser("a").then(() => {
+    gbsAlert(
+      "Restarting GBSControl.\nPlease wait until wifi reconnects then click OK"
+    )
+      .then(() => {
+        window.location.reload();
+      })
+      .catch(() => {});
+  });
+};
+
+const doRestoreArchive = (file: ArrayBuffer) => {
+  const formData = new FormData();
+  formData.append(
+    "file",
+    new Blob([file], { type: "application/octet-stream" }),
+    "backup.bin"
+  );
+  GBSControl.ui.progressRestore.setAttribute("gbs-progress", `...`);
+  fetch("/spiffs/restore", {
+    method: "POST",
+    body: formData,
+  })
+    .then((response) =>
+      response.ok
+        ? restartAfterRestore()
+        : response.text().then((reason) => {
+            GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
+            gbsAlert(`Restore failed: ${reason}`).catch(() => {});
+          })
+    )
+    .catch(() => {
+      GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
+      gbsAlert("Restore failed").catch(() => {});
     });
 };
 
 const doRestore = (file: ArrayBuffer) => {
   const { backupInput } = GBSControl.ui;
   const fileBuffer = new Uint8Array(file);
+  if (String.fromCharCode(...Array.from(fileBuffer.slice(0, 4))) === "GBSB") {
+    doRestoreArchive(file);
+    return;
+  }
+  // older backups: json header, files restored one by one
   const headerCheck = fileBuffer.slice(4, 6);
 
   if (headerCheck[0] !== 0x7b || headerCheck[1] !== 0x22) {
@@ -842,18 +844,7 @@ const doRestore = (file: ArrayBuffer) => {
     });
   });
 
-  serial(funcs).then(() => {
-    GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
-    loadUser("a").then(() => {
-      gbsAlert(
-        "Restarting GBSControl.\nPlease wait until wifi reconnects then click OK"
-      )
-        .then(() => {
-          window.location.reload();
-        })
-        .catch(() => {});
-    });
-  });
+  serial(funcs).then(restartAfterRestore);
 };
 
 const downloadBlob = (blob: Blob, name = "file.txt") => {
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# Turns a sketch into a C++ file the way the Arduino builder does: Arduino.h first, then a
+# prototype for every function defined at file scope, ahead of the first definition.
+#   ino2cpp.py gbs-control.ino out.cpp
+import re
+import sys
+
+NOT_FUNCTIONS = ('struct', 'class', 'enum', 'union', 'namespace', 'typedef', 'extern')
+
+
+def strip_defaults(params):
+    # "int a = 1, char *b = nullptr" -> "int a, char *b", nested parentheses left alone
+    out, depth, skipping = [], 0, False
+    for c in params:
+        if c in '([{<':
+            depth += 1
+        elif c in ')]}>':
+            depth -= 1
+        if depth == 0 and c == '=':
+            skipping = True
+            continue
+        if depth == 0 and c == ',':
+            skipping = False
+        if not skipping:
+            out.append(c)
+    return ''.join(out)
+
+
+def prototype(text):
+    text = ' '.join(text.split())
+    if not text.endswith(')') and not re.search(r'\)\s*(const|override|noexcept)$', text):
+        return None
+    if text.split(' ')[0] in NOT_FUNCTIONS or '(' not in text:
+        return None
+    head = text[:text.index('(')]
+    if '=' in head or not re.search(r'[A-Za-z_][A-Za-z_0-9:~]*\s*$', head) or ' ' not in head.strip():
+        return None
+    open_paren = text.index('(')
+    close_paren = text.rindex(')')
+    return text[:open_paren + 1] + strip_defaults(text[open_paren + 1:close_paren]) + text[close_paren:] + ';'
+
+
+def scan(src):
+    """(line to put the prototypes at, [(conditions, prototype)])"""
+    protos = []
+    first = None
+    last_include = None
+    conds = []  # per open #if: the directives of it seen so far
+    depth = 0
+    stmt, stmt_line = [], None
+    i, line, n = 0, 1, len(src)
+    at_line_start = True
+    while i < n:
+        c = src[i]
+        if at_line_start and c in ' \t':
+            i += 1
+            continue
+        if at_line_start and c == '#':
+            end = i
+            while True:
+                end = src.find('\n', end)
+                if end < 0:
+                    end = n
+                    break
+                if src[end - 1] != '\\':
+                    break
+                end += 1
+            directive = src[i:end]
+            word = re.match(r'#\s*(\w+)', directive)
+            word = word.group(1) if word else ''
+            if word == 'include' and first is None and not conds:
+                last_include = line
+            if word in ('if', 'ifdef', 'ifndef'):
+                conds.append([directive.replace('\\\n', ' ')])
+            elif word in ('elif', 'else'):
+                conds[-1].append(directive.replace('\\\n', ' '))
+            elif word == 'endif':
+                conds.pop()
+            line += directive.count('\n')
+            i = end
+            if depth == 0:
+                stmt, stmt_line = [], None
+            continue
+        at_line_start = False
+        if c == '\n':
+            line += 1
+            at_line_start = True
+            if depth == 0 and stmt:
+                stmt.append(' ')
+            i += 1
+            continue
+        if src.startswith('//', i):
+            i = src.find('\n', i)
+            i = n if i < 0 else i
+            continue
+        if src.startswith('/*', i):
+            end = src.find('*/', i) + 2
+            line += src.count('\n', i, end)
+            i = end
+            continue
+        if c in '"\'':
+            j = i + 1
+            while src[j] != c:
+                j += 2 if src[j] == '\\' else 1
+            if depth == 0:
+                stmt.append(src[i:j + 1])
+            i = j + 1
+            continue
+        if c == '{':
+            if depth == 0:
+                proto = prototype(''.join(stmt))
+                if proto:
+                    if first is None:
+                        first = stmt_line
+                    protos.append(([list(f) for f in conds], proto))
+                stmt, stmt_line = [], None
+            depth += 1
+        elif c == '}':
+            depth -= 1
+            if depth == 0:
+                stmt, stmt_line = [], None
+        elif depth == 0:
+            if c == ';':
+                stmt, stmt_line = [], None
+            else:
+                if stmt_line is None and not c.isspace():
+                    stmt_line = line
+                stmt.append(c)
+        i += 1
+    # headers included there call sketch functions too (framesync.h), so the prototypes go in
+    # front of the last include above the first definition
+    return last_include or first, protos
+
+
+def main():
+    ino, out = sys.argv[1], sys.argv[2]
+    src = open(ino).read()
+    first, protos = scan(src)
+    lines = src.split('\n')
+    decl = []
+    for conds, proto in protos:
+        for frame in conds:
+            decl.extend(frame)
+        decl.append(proto)
+        decl.extend(['#endif'] * len(conds))
+    with open(out, 'w') as f:
+        f.write('#include <Arduino.h>\n#line 1 "%s"\n' % ino)
+        f.write('\n'.join(lines[:first - 1]) + '\n')
+        f.write('\n'.join(decl) + '\n')
+        f.write('#line %d "%s"\n' % (first, ino))
+        f.write('\n'.join(lines[first - 1:]))
+
+
+if __name__ == '__main__':
+    main()
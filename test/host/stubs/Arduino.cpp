@@ -0,0 +1,754 @@
+#include <Arduino.h>
+#include <flash_hal.h>
+#include <flash_utils.h>
+#include "host.h"
+#include <ctype.h>
+#include <deque>
+#include <vector>
+
+static uint64_t nowMicros;
+static void (*timeHook)(uint64_t);
+static uint8_t pins[32];
+
+struct PinSignal
+{
+    uint32_t (*period)();
+    uint64_t nextEdge; // 0 while the pin is flat
+    void (*handler)();
+};
+static PinSignal signals[32];
+static bool spinning; // watchdog off, the firmware waits for a handler to detach itself
+
+uint64_t hostNowMicros()
+{
+    return nowMicros;
+}
+
+// edges start on a multiple of the period, so runs repeat
+static void scheduleEdges()
+{
+    for (PinSignal &s : signals) {
+        if (s.period && s.nextEdge == 0) {
+            const uint32_t period = s.period();
+            if (period) {
+                s.nextEdge = (nowMicros / period + 1) * period;
+            }
+        }
+    }
+}
+
+// the pin with the first edge up to until, or -1
+static int nextEdgePin(uint64_t until)
+{
+    int pin = -1;
+    for (int i = 0; i < 32; i++) {
+        const uint64_t edge = signals[i].nextEdge;
+        if (edge && edge <= until && (pin < 0 || edge < signals[pin].nextEdge)) {
+            pin = i;
+        }
+    }
+    return pin;
+}
+
+void hostAdvanceMicros(uint64_t us)
+{
+    const uint64_t target = nowMicros + us;
+    scheduleEdges();
+    for (int pin = nextEdgePin(target); pin >= 0; pin = nextEdgePin(target)) {
+        PinSignal &s = signals[pin];
+        // a handler may have run the clock further already, it never goes back
+        nowMicros = std::max(nowMicros, s.nextEdge);
+        const uint32_t period = s.period();
+        s.nextEdge = period ? s.nextEdge + period : 0;
+        if (period && s.handler) {
+            s.handler();
+        }
+    }
+    nowMicros = std::max(nowMicros, target);
+    if (timeHook) {
+        timeHook(nowMicros);
+    }
+}
+
+void hostPinSignal(uint8_t pin, uint32_t (*period)())
+{
+    signals[pin & 31].period = period;
+    signals[pin & 31].nextEdge = 0;
+}
+
+void hostSetTimeHook(void (*hook)(uint64_t))
+{
+    timeHook = hook;
+}
+
+unsigned long millis()
+{
+    return nowMicros / 1000;
+}
+
+unsigned long micros()
+{
+    return nowMicros;
+}
+
+void delay(unsigned long ms)
+{
+    // in 1 ms steps, so the simulators see what a polling loop would see
+    for (unsigned long i = 0; i < ms; i++) {
+        hostAdvanceMicros(1000);
+    }
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    hostAdvanceMicros(us);
+}
+
+void yield()
+{
+}
+
+void optimistic_yield(uint32_t)
+{
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    pins[pin & 31] = value;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pins[pin & 31];
+}
+
+uint32_t hostGpioIn()
+{
+    uint32_t in = 0;
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        in |= (uint32_t)(pins[pin] & 1) << pin;
+    }
+    return in;
+}
+
+int analogRead(uint8_t)
+{
+    return 0;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int)
+{
+    PinSignal &s = signals[pin & 31];
+    s.handler = handler;
+    if (!spinning || !s.period) {
+        return;
+    }
+    scheduleEdges();
+    if (s.nextEdge) {
+        hostAdvanceMicros(s.nextEdge - nowMicros);
+    }
+    if (!s.handler) {
+        spinning = false; // the last handler of the wait detached, the spin sees its flag
+    }
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    signals[pin & 31].handler = nullptr;
+}
+
+static uint32_t randomState = 1;
+
+long random(long howBig)
+{
+    if (howBig <= 0) {
+        return 0;
+    }
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 8) % howBig;
+}
+
+long random(long howSmall, long howBig)
+{
+    return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+    randomState = seed ? seed : 1;
+}
+
+// String
+
+static std::string numberToString(unsigned long long value, unsigned char base, bool negative)
+{
+    if (base < 2) {
+        base = 10;
+    }
+    std::string digits;
+    do {
+        const unsigned d = value % base;
+        digits.insert(digits.begin(), d < 10 ? '0' + d : 'A' + d - 10);
+        value /= base;
+    } while (value);
+    if (negative) {
+        digits.insert(digits.begin(), '-');
+    }
+    return digits;
+}
+
+static std::string floatToString(double value, unsigned char decimals)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    return buf;
+}
+
+String::String(unsigned char value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(int value, unsigned char base)
+    : s(base == 10 ? numberToString(value < 0 ? -(long long)value : value, 10, value < 0) : numberToString((unsigned int)value, base, false)) {}
+String::String(unsigned int value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(long value, unsigned char base)
+    : s(base == 10 ? numberToString(value < 0 ? -(long long)value : value, 10, value < 0) : numberToString((unsigned long)value, base, false)) {}
+String::String(unsigned long value, unsigned char base) : s(numberToString(value, base, false)) {}
+String::String(float value, unsigned char decimals) : s(floatToString(value, decimals)) {}
+String::String(double value, unsigned char decimals) : s(floatToString(value, decimals)) {}
+
+bool String::equalsIgnoreCase(const String &rhs) const
+{
+    if (s.size() != rhs.s.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)rhs.s[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+    const size_t i = s.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::indexOf(const String &str, unsigned int from) const
+{
+    const size_t i = s.find(str.s, from);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::lastIndexOf(char c) const
+{
+    const size_t i = s.rfind(c);
+    return i == std::string::npos ? -1 : (int)i;
+}
+
+String String::substring(unsigned int from) const
+{
+    return from >= s.size() ? String() : String(s.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (from > to) {
+        std::swap(from, to);
+    }
+    if (from >= s.size()) {
+        return String();
+    }
+    return String(s.substr(from, to - from));
+}
+
+void String::replace(const String &find, const String &replacement)
+{
+    if (find.s.empty()) {
+        return;
+    }
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), replacement.s);
+        pos += replacement.s.size();
+    }
+}
+
+void String::remove(unsigned int index)
+{
+    if (index < s.size()) {
+        s.erase(index);
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+    if (index < s.size()) {
+        s.erase(index, count);
+    }
+}
+
+void String::toLowerCase()
+{
+    for (size_t i = 0; i < s.size(); i++) {
+        s[i] = tolower((unsigned char)s[i]);
+    }
+}
+
+void String::toUpperCase()
+{
+    for (size_t i = 0; i < s.size(); i++) {
+        s[i] = toupper((unsigned char)s[i]);
+    }
+}
+
+void String::trim()
+{
+    size_t start = 0;
+    while (start < s.size() && isspace((unsigned char)s[start])) {
+        start++;
+    }
+    size_t end = s.size();
+    while (end > start && isspace((unsigned char)s[end - 1])) {
+        end--;
+    }
+    s = s.substr(start, end - start);
+}
+
+void String::getBytes(unsigned char *buf, unsigned int size, unsigned int index) const
+{
+    if (!size) {
+        return;
+    }
+    unsigned int n = 0;
+    for (; index + n < s.size() && n + 1 < size; n++) {
+        buf[n] = s[index + n];
+    }
+    buf[n] = 0;
+}
+
+String operator+(const String &lhs, const String &rhs)
+{
+    return String(lhs.str() + rhs.str());
+}
+
+String operator+(const String &lhs, const char *rhs)
+{
+    return String(lhs.str() + rhs);
+}
+
+String operator+(const char *lhs, const String &rhs)
+{
+    return String(lhs + rhs.str());
+}
+
+String operator+(const String &lhs, char rhs)
+{
+    return String(lhs.str() + rhs);
+}
+
+String operator+(const String &lhs, int rhs)
+{
+    return lhs + String(rhs);
+}
+
+String operator+(const String &lhs, unsigned int rhs)
+{
+    return lhs + String(rhs);
+}
+
+String operator+(const String &lhs, long rhs)
+{
+    return lhs + String(rhs);
+}
+
+String operator+(const String &lhs, unsigned long rhs)
+{
+    return lhs + String(rhs);
+}
+
+String operator+(const String &lhs, double rhs)
+{
+    return lhs + String(rhs);
+}
+
+String operator+(const String &lhs, const __FlashStringHelper *rhs)
+{
+    return lhs + reinterpret_cast<const char *>(rhs);
+}
+
+// Print
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--) {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    const int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return len > 0 ? write(reinterpret_cast<const uint8_t *>(buf), len < (int)sizeof(buf) ? len : sizeof(buf) - 1) : 0;
+}
+
+size_t Print::printNumber(unsigned long n, uint8_t base)
+{
+    const std::string digits = numberToString(n, base, false);
+    return write(digits.c_str());
+}
+
+size_t Print::printFloat(double number, uint8_t digits)
+{
+    return write(floatToString(number, digits).c_str());
+}
+
+size_t Print::print(const __FlashStringHelper *str)
+{
+    return write(reinterpret_cast<const char *>(str));
+}
+
+size_t Print::print(const String &str)
+{
+    return write(str.c_str(), str.length());
+}
+
+size_t Print::print(const char *str)
+{
+    return write(str);
+}
+
+size_t Print::print(char c)
+{
+    return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+    return print((unsigned long)value, base);
+}
+
+size_t Print::print(int value, int base)
+{
+    return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+    return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base)
+{
+    if (base == 10 && value < 0) {
+        return print('-') + printNumber(-(unsigned long)value, 10);
+    }
+    return printNumber(base == 10 ? value : (unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::print(long long value, int base)
+{
+    return print((long)value, base);
+}
+
+size_t Print::print(unsigned long long value, int base)
+{
+    return print((unsigned long)value, base);
+}
+
+size_t Print::print(double value, int digits)
+{
+    return printFloat(value, digits);
+}
+
+size_t Print::println()
+{
+    return write("\r\n");
+}
+
+// Stream
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length)
+{
+    size_t n = 0;
+    while (n < length && available()) {
+        buffer[n++] = read();
+    }
+    return n;
+}
+
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length)
+{
+    size_t n = 0;
+    while (n < length && available()) {
+        const int c = read();
+        if (c == terminator) {
+            break;
+        }
+        buffer[n++] = c;
+    }
+    return n;
+}
+
+String Stream::readString()
+{
+    String out;
+    while (available()) {
+        out += (char)read();
+    }
+    return out;
+}
+
+String Stream::readStringUntil(char terminator)
+{
+    String out;
+    while (available()) {
+        const int c = read();
+        if (c == terminator) {
+            break;
+        }
+        out += (char)c;
+    }
+    return out;
+}
+
+long Stream::parseInt()
+{
+    while (available() && !isdigit(peek()) && peek() != '-') {
+        read();
+    }
+    bool negative = false;
+    if (available() && peek() == '-') {
+        negative = true;
+        read();
+    }
+    long value = 0;
+    while (available() && isdigit(peek())) {
+        value = value * 10 + read() - '0';
+    }
+    return negative ? -value : value;
+}
+
+// formats
+
+int hostVsnprintfP(char *buf, size_t size, const char *format, va_list args)
+{
+    std::string f = format;
+    for (size_t i = 0; i + 1 < f.size(); i++) {
+        if (f[i] != '%') {
+            continue;
+        }
+        // skip flags, width and precision
+        size_t j = i + 1;
+        while (j < f.size() && strchr("-+ #0123456789.*l", f[j])) {
+            j++;
+        }
+        if (j < f.size() && f[j] == 'S') {
+            f[j] = 's';
+        }
+        i = j;
+    }
+    return vsnprintf(buf, size, f.c_str(), args);
+}
+
+int hostSnprintfP(char *buf, size_t size, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int n = hostVsnprintfP(buf, size, format, args);
+    va_end(args);
+    return n;
+}
+
+// Serial
+
+const String emptyString;
+HardwareSerial Serial;
+static std::deque<uint8_t> serialIn;
+static std::string serialOut;
+static const bool echoSerial = getenv("HOST_ECHO_SERIAL") != nullptr;
+
+void hostSerialInput(const char *text)
+{
+    while (*text) {
+        serialIn.push_back(*text++);
+    }
+}
+
+std::string &hostSerialOutput()
+{
+    return serialOut;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    serialOut += (char)c;
+    if (echoSerial) {
+        fputc(c, stdout);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    serialOut.append(reinterpret_cast<const char *>(buffer), size);
+    if (echoSerial) {
+        fwrite(buffer, 1, size, stdout);
+    }
+    return size;
+}
+
+int HardwareSerial::available()
+{
+    return serialIn.size();
+}
+
+int HardwareSerial::read()
+{
+    if (serialIn.empty()) {
+        return -1;
+    }
+    const int c = serialIn.front();
+    serialIn.pop_front();
+    return c;
+}
+
+int HardwareSerial::peek()
+{
+    return serialIn.empty() ? -1 : serialIn.front();
+}
+
+// ESP
+
+EspClass ESP;
+static std::vector<uint8_t> flash(HOST_FLASH_SIZE, 0xff);
+static long powerBudget = -1;
+
+uint8_t *hostFlash()
+{
+    return flash.data();
+}
+
+void hostFlashErase()
+{
+    std::fill(flash.begin(), flash.end(), 0xff);
+}
+
+void hostPowerLossAfter(long budget)
+{
+    powerBudget = budget;
+}
+
+void hostPowerTick()
+{
+    if (powerBudget < 0) {
+        return;
+    }
+    if (powerBudget == 0) {
+        throw HostPowerLoss();
+    }
+    powerBudget--;
+}
+
+EspClass::EspClass() : freeHeap(30000), sketchSize(0x80000)
+{
+    memset(&resetInfo, 0, sizeof(resetInfo));
+}
+
+String EspClass::getResetReason()
+{
+    return String("host");
+}
+
+void EspClass::getHeapStats(uint32_t *free, uint16_t *maxBlock, uint8_t *fragmentation)
+{
+    if (free) {
+        *free = freeHeap;
+    }
+    if (maxBlock) {
+        *maxBlock = freeHeap / 2;
+    }
+    if (fragmentation) {
+        *fragmentation = 10;
+    }
+}
+
+uint32_t EspClass::getFlashChipSize()
+{
+    return HOST_FLASH_SIZE;
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    return (uint32_t)(nowMicros * 160);
+}
+
+uint32_t EspClass::getFreeSketchSpace()
+{
+    const uint32_t used = (sketchSize + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1);
+    return used < FS_PHYS_ADDR ? FS_PHYS_ADDR - used : 0;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector)
+{
+    if ((sector + 1) * FLASH_SECTOR_SIZE > flash.size()) {
+        return false;
+    }
+    hostPowerTick();
+    memset(flash.data() + sector * FLASH_SECTOR_SIZE, 0xff, FLASH_SECTOR_SIZE);
+    return true;
+}
+
+bool EspClass::flashWrite(uint32_t offset, uint32_t *data, size_t size)
+{
+    if (offset % 4 || size % 4 || offset + size > flash.size()) {
+        return false;
+    }
+    hostPowerTick();
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        flash[offset + i] &= bytes[i];
+    }
+    return true;
+}
+
+bool EspClass::flashRead(uint32_t offset, uint32_t *data, size_t size)
+{
+    if (offset % 4 || size % 4 || offset + size > flash.size()) {
+        return false;
+    }
+    memcpy(data, flash.data() + offset, size);
+    return true;
+}
+
+void EspClass::wdtDisable()
+{
+    spinning = true;
+}
+
+void EspClass::wdtEnable(uint32_t)
+{
+    if (spinning) {
+        spinning = false;
+        hostAdvanceMicros(HOST_SPIN_MICROS); // no edge ended it, the spin ran out
+    }
+}
+
+void EspClass::restart()
+{
+    throw HostRestart();
+}
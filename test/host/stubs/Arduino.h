@@ -0,0 +1,515 @@
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+// Host stand-in for the parts of the ESP8266 Arduino core the firmware uses. Time is virtual:
+// millis() and micros() only move when the code under test waits (delay, bus transfers) or a
+// test advances the clock, so runs are repeatable and latencies come out in device time.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include "user_interface.h"
+
+#define ARDUINO 10813
+#define ESP8266 1
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define PGM_P const char *
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strlen_P strlen
+#define strstr_P strstr
+// the core's _P formats take %S for a PROGMEM string, which is %s here
+int hostVsnprintfP(char *buf, size_t size, const char *format, va_list args);
+int hostSnprintfP(char *buf, size_t size, const char *format, ...);
+#define sprintf_P(buf, ...) hostSnprintfP(buf, SIZE_MAX, __VA_ARGS__)
+#define snprintf_P hostSnprintfP
+#define vsnprintf_P hostVsnprintfP
+#define printf_P printf
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define OUTPUT_OPEN_DRAIN 3
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+#define LED_BUILTIN 2
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+#define SDA 4
+#define SCL 5
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI 3.1415926535897932384626433832795
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+// c_types.h
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t sint8;
+typedef int16_t sint16;
+typedef int32_t sint32;
+
+class __FlashStringHelper;
+
+// virtual clock
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void optimistic_yield(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+// handlers run at the edges of a signal set with hostPinSignal(), any edge mode
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void detachInterrupt(uint8_t pin);
+#define digitalPinToInterrupt(p) (p)
+// the input register, one bit per pin as set with digitalWrite()
+uint32_t hostGpioIn();
+#define GPIO_IN_ADDRESS 0x18
+#define GPIO_REG_READ(addr) hostGpioIn()
+#define noInterrupts()
+#define interrupts()
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+class String
+{
+private:
+    std::string s;
+
+public:
+    String() {}
+    String(const char *cstr) : s(cstr ? cstr : "") {}
+    String(const char *cstr, size_t len) : s(cstr, len) {}
+    String(const std::string &str) : s(str) {}
+    String(const __FlashStringHelper *str) : s(reinterpret_cast<const char *>(str)) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimals = 2);
+    explicit String(double value, unsigned char decimals = 2);
+
+    unsigned int length() const
+    {
+        return s.size();
+    }
+    bool isEmpty() const
+    {
+        return s.empty();
+    }
+    const char *c_str() const
+    {
+        return s.c_str();
+    }
+    char *begin()
+    {
+        return &s[0];
+    }
+    bool reserve(unsigned int size)
+    {
+        s.reserve(size);
+        return true;
+    }
+    const std::string &str() const
+    {
+        return s;
+    }
+
+    String &operator=(const char *cstr)
+    {
+        s = cstr ? cstr : "";
+        return *this;
+    }
+    String &operator=(const __FlashStringHelper *str)
+    {
+        s = reinterpret_cast<const char *>(str);
+        return *this;
+    }
+    String &operator+=(const String &rhs)
+    {
+        s += rhs.s;
+        return *this;
+    }
+    String &operator+=(const char *cstr)
+    {
+        s += cstr;
+        return *this;
+    }
+    String &operator+=(const __FlashStringHelper *str)
+    {
+        s += reinterpret_cast<const char *>(str);
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        s += c;
+        return *this;
+    }
+    String &operator+=(int value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(unsigned int value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(long value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(unsigned long value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(unsigned char value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(float value)
+    {
+        return *this += String(value);
+    }
+    String &operator+=(double value)
+    {
+        return *this += String(value);
+    }
+    template <typename T>
+    bool concat(T value)
+    {
+        *this += value;
+        return true;
+    }
+
+    bool operator==(const String &rhs) const
+    {
+        return s == rhs.s;
+    }
+    bool operator==(const char *cstr) const
+    {
+        return s == cstr;
+    }
+    bool operator!=(const String &rhs) const
+    {
+        return s != rhs.s;
+    }
+    bool operator!=(const char *cstr) const
+    {
+        return s != cstr;
+    }
+    bool operator<(const String &rhs) const
+    {
+        return s < rhs.s;
+    }
+    bool equals(const String &rhs) const
+    {
+        return s == rhs.s;
+    }
+    bool equals(const char *cstr) const
+    {
+        return s == cstr;
+    }
+    bool equalsIgnoreCase(const String &rhs) const;
+    char charAt(unsigned int index) const
+    {
+        return index < s.size() ? s[index] : 0;
+    }
+    void setCharAt(unsigned int index, char c)
+    {
+        if (index < s.size()) {
+            s[index] = c;
+        }
+    }
+    char operator[](unsigned int index) const
+    {
+        return charAt(index);
+    }
+    char &operator[](unsigned int index)
+    {
+        return s[index];
+    }
+    bool startsWith(const String &prefix) const
+    {
+        return s.compare(0, prefix.s.size(), prefix.s) == 0;
+    }
+    bool startsWith(const String &prefix, unsigned int offset) const
+    {
+        return offset <= s.size() && s.compare(offset, prefix.s.size(), prefix.s) == 0;
+    }
+    bool endsWith(const String &suffix) const
+    {
+        return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &str, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    void replace(const String &find, const String &replacement);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+    long toInt() const
+    {
+        return atol(s.c_str());
+    }
+    float toFloat() const
+    {
+        return atof(s.c_str());
+    }
+    void getBytes(unsigned char *buf, unsigned int size, unsigned int index = 0) const;
+    void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const
+    {
+        getBytes(reinterpret_cast<unsigned char *>(buf), size, index);
+    }
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+String operator+(const String &lhs, int rhs);
+String operator+(const String &lhs, unsigned int rhs);
+String operator+(const String &lhs, long rhs);
+String operator+(const String &lhs, unsigned long rhs);
+String operator+(const String &lhs, double rhs);
+String operator+(const String &lhs, const __FlashStringHelper *rhs);
+
+extern const String emptyString;
+
+class Print;
+
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+private:
+    size_t printNumber(unsigned long n, uint8_t base);
+    size_t printFloat(double number, uint8_t digits);
+
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str)
+    {
+        return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str)) : 0;
+    }
+    size_t write(const char *buffer, size_t size)
+    {
+        return write(reinterpret_cast<const uint8_t *>(buffer), size);
+    }
+    virtual void flush() {}
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+    size_t print(const __FlashStringHelper *str);
+    size_t print(const String &str);
+    size_t print(const char *str);
+    size_t print(char c);
+    size_t print(unsigned char value, int base = DEC);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(long long value, int base = DEC);
+    size_t print(unsigned long long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+    size_t print(const Printable &value)
+    {
+        return value.printTo(*this);
+    }
+
+    size_t println();
+    template <typename T>
+    size_t println(const T &value)
+    {
+        const size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T &value, int format)
+    {
+        const size_t n = print(value, format);
+        return n + println();
+    }
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long) {}
+    size_t readBytes(uint8_t *buffer, size_t length);
+    size_t readBytes(char *buffer, size_t length)
+    {
+        return readBytes(reinterpret_cast<uint8_t *>(buffer), length);
+    }
+    size_t readBytesUntil(char terminator, char *buffer, size_t length);
+    String readString();
+    String readStringUntil(char terminator);
+    long parseInt();
+};
+
+// Serial: input is queued by the test, output is kept (and echoed with HOST_ECHO_SERIAL set)
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    int availableForWrite()
+    {
+        return 128;
+    }
+    operator bool() const
+    {
+        return true;
+    }
+};
+extern HardwareSerial Serial;
+
+struct umm_info_t;
+
+// flash, reset reason and heap of the module, see hostFlash() in host.h for the flash image
+class EspClass
+{
+public:
+    rst_info resetInfo;
+    uint32_t freeHeap;
+    uint32_t sketchSize;
+
+    EspClass();
+    rst_info *getResetInfoPtr()
+    {
+        return &resetInfo;
+    }
+    String getResetReason();
+    uint32_t getFreeHeap()
+    {
+        return freeHeap;
+    }
+    uint16_t getMaxFreeBlockSize()
+    {
+        return freeHeap / 2;
+    }
+    uint8_t getHeapFragmentation()
+    {
+        return 10;
+    }
+    void getHeapStats(uint32_t *free, uint16_t *maxBlock, uint8_t *fragmentation);
+    uint32_t getFreeContStack()
+    {
+        return 2048;
+    }
+    uint32_t getChipId()
+    {
+        return 0x5725;
+    }
+    uint32_t getFlashChipSize();
+    uint32_t getFlashChipRealSize()
+    {
+        return getFlashChipSize();
+    }
+    uint32_t getCpuFreqMHz()
+    {
+        return 160;
+    }
+    uint32_t getCycleCount();
+    uint32_t getSketchSize()
+    {
+        return sketchSize;
+    }
+    uint32_t getFreeSketchSpace();
+    String getSketchMD5()
+    {
+        return String("00000000000000000000000000000000");
+    }
+    const char *getSdkVersion()
+    {
+        return "host";
+    }
+    String getCoreVersion()
+    {
+        return String("host");
+    }
+    bool flashEraseSector(uint32_t sector);
+    bool flashWrite(uint32_t offset, uint32_t *data, size_t size);
+    bool flashRead(uint32_t offset, uint32_t *data, size_t size);
+    void restart();
+    void reset()
+    {
+        restart();
+    }
+    void wdtFeed() {}
+    // the firmware turns the watchdog off only to spin for an edge, see hostPinSignal()
+    void wdtDisable();
+    void wdtEnable(uint32_t);
+};
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef HOST_ARDUINOOTA_H_
+#define HOST_ARDUINOOTA_H_
+#include <Arduino.h>
+#include <functional>
+
+#define U_FLASH 0
+#define U_FS 100
+typedef enum {
+    OTA_AUTH_ERROR,
+    OTA_BEGIN_ERROR,
+    OTA_CONNECT_ERROR,
+    OTA_RECEIVE_ERROR,
+    OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass
+{
+public:
+    void setHostname(const char *) {}
+    void setPassword(const char *) {}
+    void setPasswordHash(const char *) {}
+    void onStart(std::function<void()>) {}
+    void onEnd(std::function<void()>) {}
+    void onProgress(std::function<void(unsigned int, unsigned int)>) {}
+    void onError(std::function<void(ota_error_t)>) {}
+    void begin(bool = true) {}
+    void handle() {}
+    int getCommand()
+    {
+        return U_FLASH;
+    }
+};
+extern ArduinoOTAClass ArduinoOTA;
+#endif
@@ -0,0 +1,15 @@
+#ifndef HOST_DNSSERVER_H_
+#define HOST_DNSSERVER_H_
+#include "IPAddress.h"
+
+class DNSServer
+{
+public:
+    bool start(uint16_t, const String &, const IPAddress &)
+    {
+        return true;
+    }
+    void stop() {}
+    void processNextRequest() {}
+};
+#endif
@@ -0,0 +1,121 @@
+#ifndef HOST_ESP8266WIFI_H_
+#define HOST_ESP8266WIFI_H_
+// Host stand-in for the WiFi stack: never connects, keeps the mode it is given.
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include "IPAddress.h"
+
+enum WiFiMode_t {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+};
+enum WiFiSleepType_t {
+    WIFI_NONE_SLEEP = 0,
+    WIFI_LIGHT_SLEEP = 1,
+    WIFI_MODEM_SLEEP = 2
+};
+enum wl_status_t {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+};
+
+struct WiFiEventStationModeDisconnected
+{
+    String ssid;
+    uint8_t reason;
+};
+struct WiFiEventHandlerOpaque
+{
+};
+typedef std::shared_ptr<WiFiEventHandlerOpaque> WiFiEventHandler;
+
+class ESP8266WiFiClass
+{
+private:
+    WiFiMode_t wifiMode;
+
+public:
+    ESP8266WiFiClass() : wifiMode(WIFI_OFF) {}
+    bool mode(WiFiMode_t m)
+    {
+        wifiMode = m;
+        return true;
+    }
+    WiFiMode_t getMode()
+    {
+        return wifiMode;
+    }
+    wl_status_t begin(const char *, const char * = nullptr, int32_t = 0, const uint8_t * = nullptr, bool = true)
+    {
+        return WL_DISCONNECTED;
+    }
+    wl_status_t begin(const String &ssid, const String &passphrase, int32_t channel = 0, const uint8_t *bssid = nullptr, bool connect = true)
+    {
+        return begin(ssid.c_str(), passphrase.c_str(), channel, bssid, connect);
+    }
+    wl_status_t begin()
+    {
+        return WL_DISCONNECTED;
+    }
+    wl_status_t status()
+    {
+        return WL_DISCONNECTED;
+    }
+    bool isConnected()
+    {
+        return false;
+    }
+    bool disconnect(bool = false)
+    {
+        return true;
+    }
+    bool reconnect()
+    {
+        return false;
+    }
+    bool setSleepMode(WiFiSleepType_t)
+    {
+        return true;
+    }
+    void setOutputPower(float) {}
+    bool forceSleepBegin(uint32_t = 0)
+    {
+        return true;
+    }
+    bool hostname(const char *)
+    {
+        return true;
+    }
+    String SSID() const
+    {
+        return String();
+    }
+    int32_t RSSI()
+    {
+        return 0;
+    }
+    IPAddress localIP()
+    {
+        return IPAddress();
+    }
+    IPAddress gatewayIP()
+    {
+        return IPAddress();
+    }
+    IPAddress softAPIP()
+    {
+        return IPAddress(192, 168, 4, 1);
+    }
+    WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected &)>)
+    {
+        return WiFiEventHandler(new WiFiEventHandlerOpaque());
+    }
+};
+extern ESP8266WiFiClass WiFi;
+#endif
@@ -0,0 +1,26 @@
+#ifndef HOST_ESP8266MDNS_H_
+#define HOST_ESP8266MDNS_H_
+#include "IPAddress.h"
+
+class MDNSResponder
+{
+public:
+    bool begin(const char *, const IPAddress & = IPAddress(), uint32_t = 120)
+    {
+        return true;
+    }
+    bool addService(const char *, const char *, uint16_t)
+    {
+        return true;
+    }
+    bool announce()
+    {
+        return true;
+    }
+    bool update()
+    {
+        return true;
+    }
+};
+extern MDNSResponder MDNS;
+#endif
@@ -0,0 +1,4 @@
+#ifndef HOST_ESPASYNCTCP_H_
+#define HOST_ESPASYNCTCP_H_
+#include <Arduino.h>
+#endif
@@ -0,0 +1,150 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H_
+#define HOST_ESPASYNCWEBSERVER_H_
+// Host stand-in for the async web server: keeps the handlers, a test can call them through
+// hostHttpRequest() and look at the response code.
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <vector>
+
+enum WebRequestMethod {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_ANY = 0b01111111
+};
+
+class AsyncWebServerRequest;
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+
+class AsyncWebParameter
+{
+private:
+    String paramName;
+    String paramValue;
+
+public:
+    AsyncWebParameter(const String &name, const String &value) : paramName(name), paramValue(value) {}
+    const String &name() const
+    {
+        return paramName;
+    }
+    const String &value() const
+    {
+        return paramValue;
+    }
+};
+
+class AsyncWebServerResponse
+{
+public:
+    int code;
+    AwsResponseFiller filler;
+
+    AsyncWebServerResponse(int code) : code(code) {}
+    void addHeader(const String &, const String &) {}
+};
+
+class AsyncWebServerRequest
+{
+private:
+    std::vector<AsyncWebParameter> parameters;
+
+public:
+    File _tempFile;
+    int responseCode; // 0 until a response is sent
+
+    AsyncWebServerRequest(const std::vector<AsyncWebParameter> &parameters) : parameters(parameters), responseCode(0) {}
+    size_t params() const
+    {
+        return parameters.size();
+    }
+    AsyncWebParameter *getParam(size_t i)
+    {
+        return i < parameters.size() ? &parameters[i] : nullptr;
+    }
+    AsyncWebParameter *getParam(const String &name)
+    {
+        for (size_t i = 0; i < parameters.size(); i++) {
+            if (parameters[i].name() == name) {
+                return &parameters[i];
+            }
+        }
+        return nullptr;
+    }
+    bool hasParam(const String &name)
+    {
+        return getParam(name) != nullptr;
+    }
+    String arg(const char *name)
+    {
+        AsyncWebParameter *p = getParam(String(name));
+        return p ? p->value() : String();
+    }
+    bool hasHeader(const char *)
+    {
+        return false;
+    }
+    String header(const char *)
+    {
+        return String();
+    }
+
+    void send(AsyncWebServerResponse *response)
+    {
+        responseCode = response->code;
+        delete response;
+    }
+    void send(int code, const String & = String(), const String & = String())
+    {
+        responseCode = code;
+    }
+    void send(FS &fs, const String &path, const String & = String(), bool = false)
+    {
+        responseCode = fs.exists(path.c_str()) ? 200 : 404;
+    }
+    AsyncWebServerResponse *beginResponse(int code, const String & = String(), const String & = String())
+    {
+        return new AsyncWebServerResponse(code);
+    }
+    AsyncWebServerResponse *beginResponse(const String &, size_t, AwsResponseFiller filler)
+    {
+        AsyncWebServerResponse *response = new AsyncWebServerResponse(200);
+        response->filler = filler;
+        return response;
+    }
+    AsyncWebServerResponse *beginResponse_P(int code, const String &, const uint8_t *, size_t)
+    {
+        return new AsyncWebServerResponse(code);
+    }
+    AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller filler)
+    {
+        return beginResponse(contentType, 0, filler);
+    }
+};
+
+class AsyncWebServer
+{
+public:
+    struct Route
+    {
+        String path;
+        int method;
+        ArRequestHandlerFunction handler;
+        ArUploadHandlerFunction upload;
+    };
+    std::vector<Route> routes;
+
+    AsyncWebServer(uint16_t) {}
+    void on(const char *path, int method, ArRequestHandlerFunction handler, ArUploadHandlerFunction upload = nullptr)
+    {
+        routes.push_back(Route{String(path), method, handler, upload});
+    }
+    void onNotFound(ArRequestHandlerFunction) {}
+    void begin() {}
+};
+
+// runs the handler of path like a request from the web UI would, returns the response code
+int hostHttpRequest(AsyncWebServer &server, const char *path, int method, const std::vector<AsyncWebParameter> &params);
+#endif
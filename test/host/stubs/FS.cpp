@@ -0,0 +1,48 @@
+#include "FS.h"
+
+namespace fs
+{
+bool sflags(const char *mode, OpenMode &om, AccessMode &am)
+{
+    switch (mode[0]) {
+        case 'r':
+            am = AM_READ;
+            om = OM_DEFAULT;
+            break;
+        case 'w':
+            am = AM_WRITE;
+            om = (OpenMode)(OM_CREATE | OM_TRUNCATE);
+            break;
+        case 'a':
+            am = AM_WRITE;
+            om = (OpenMode)(OM_CREATE | OM_APPEND);
+            break;
+        default:
+            return false;
+    }
+    if (mode[1] == '+') {
+        am = AM_RW;
+    }
+    return true;
+}
+
+File Dir::openFile(const char *mode)
+{
+    OpenMode om;
+    AccessMode am;
+    if (!p || !sflags(mode, om, am)) {
+        return File();
+    }
+    return File(p->openFile(om, am));
+}
+
+File FS::open(const char *path, const char *mode)
+{
+    OpenMode om;
+    AccessMode am;
+    if (!sflags(mode, om, am)) {
+        return File();
+    }
+    return File(impl->open(path, om, am));
+}
+} // namespace fs
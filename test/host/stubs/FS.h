@@ -0,0 +1,243 @@
+#ifndef HOST_FS_H_
+#define HOST_FS_H_
+// The fs::File / Dir / FS front end of the ESP8266 core over FSImpl.h, enough for the firmware.
+#include <Arduino.h>
+#include "FSImpl.h"
+
+namespace fs
+{
+class File : public Stream
+{
+private:
+    FileImplPtr p;
+
+public:
+    File(FileImplPtr p = FileImplPtr()) : p(p) {}
+
+    size_t write(uint8_t c) override
+    {
+        return write(&c, 1);
+    }
+    size_t write(const uint8_t *buf, size_t size) override
+    {
+        return p ? p->write(buf, size) : 0;
+    }
+    using Print::write;
+    int available() override
+    {
+        return p ? p->size() - p->position() : 0;
+    }
+    int read() override
+    {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+    size_t read(uint8_t *buf, size_t size)
+    {
+        return p ? p->read(buf, size) : 0;
+    }
+    size_t read(char *buf, size_t size)
+    {
+        return read(reinterpret_cast<uint8_t *>(buf), size);
+    }
+    int peek() override
+    {
+        if (!p) {
+            return -1;
+        }
+        const size_t pos = p->position();
+        const int c = read();
+        p->seek(pos, SeekSet);
+        return c;
+    }
+    void flush() override
+    {
+        if (p) {
+            p->flush();
+        }
+    }
+    bool seek(uint32_t pos, SeekMode mode = SeekSet)
+    {
+        return p && p->seek(pos, mode);
+    }
+    size_t position() const
+    {
+        return p ? p->position() : 0;
+    }
+    size_t size() const
+    {
+        return p ? p->size() : 0;
+    }
+    bool truncate(uint32_t size)
+    {
+        return p && p->truncate(size);
+    }
+    void close()
+    {
+        if (p) {
+            p->close();
+            p.reset();
+        }
+    }
+    operator bool() const
+    {
+        return !!p;
+    }
+    const char *name() const
+    {
+        return p ? p->name() : "";
+    }
+    const char *fullName() const
+    {
+        return p ? p->fullName() : "";
+    }
+    bool isFile() const
+    {
+        return p && p->isFile();
+    }
+    bool isDirectory() const
+    {
+        return p && p->isDirectory();
+    }
+};
+
+class Dir
+{
+private:
+    DirImplPtr p;
+
+public:
+    Dir(DirImplPtr p = DirImplPtr()) : p(p) {}
+
+    File openFile(const char *mode);
+    String fileName()
+    {
+        return p ? String(p->fileName()) : String();
+    }
+    size_t fileSize()
+    {
+        return p ? p->fileSize() : 0;
+    }
+    bool isFile() const
+    {
+        return p && p->isFile();
+    }
+    bool isDirectory() const
+    {
+        return p && p->isDirectory();
+    }
+    bool next()
+    {
+        return p && p->next();
+    }
+    bool rewind()
+    {
+        return p && p->rewind();
+    }
+};
+
+class FS
+{
+private:
+    FSImplPtr impl;
+
+public:
+    FS(FSImplPtr impl) : impl(impl) {}
+
+    bool setConfig(const FSConfig &cfg)
+    {
+        return impl->setConfig(cfg);
+    }
+    bool begin()
+    {
+        return impl->begin();
+    }
+    void end()
+    {
+        impl->end();
+    }
+    bool format()
+    {
+        return impl->format();
+    }
+    bool info(FSInfo &info)
+    {
+        return impl->info(info);
+    }
+    bool info64(FSInfo64 &info)
+    {
+        return impl->info64(info);
+    }
+    File open(const char *path, const char *mode);
+    File open(const String &path, const char *mode)
+    {
+        return open(path.c_str(), mode);
+    }
+    bool exists(const char *path)
+    {
+        return impl->exists(path);
+    }
+    bool exists(const String &path)
+    {
+        return exists(path.c_str());
+    }
+    Dir openDir(const char *path)
+    {
+        return Dir(impl->openDir(path));
+    }
+    Dir openDir(const String &path)
+    {
+        return openDir(path.c_str());
+    }
+    bool remove(const char *path)
+    {
+        return impl->remove(path);
+    }
+    bool remove(const String &path)
+    {
+        return remove(path.c_str());
+    }
+    bool rename(const char *pathFrom, const char *pathTo)
+    {
+        return impl->rename(pathFrom, pathTo);
+    }
+    bool rename(const String &pathFrom, const String &pathTo)
+    {
+        return rename(pathFrom.c_str(), pathTo.c_str());
+    }
+    bool mkdir(const char *path)
+    {
+        return impl->mkdir(path);
+    }
+    bool rmdir(const char *path)
+    {
+        return impl->rmdir(path);
+    }
+    bool gc()
+    {
+        return impl->gc();
+    }
+};
+
+// "r", "r+", "w", "w+", "a", "a+" as in fopen()
+bool sflags(const char *mode, OpenMode &om, AccessMode &am);
+
+class SPIFFSConfig : public FSConfig
+{
+public:
+    SPIFFSConfig(bool autoFormat = true) : FSConfig(autoFormat) {}
+};
+} // namespace fs
+
+using fs::Dir;
+using fs::File;
+using fs::FS;
+using fs::FSInfo;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SPIFFSConfig;
+
+extern fs::FS SPIFFS;
+#endif
@@ -0,0 +1,27 @@
+#ifndef HOST_IPADDRESS_H_
+#define HOST_IPADDRESS_H_
+#include <Arduino.h>
+
+class IPAddress : public Printable
+{
+private:
+    uint8_t bytes[4];
+
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : bytes{a, b, c, d} {}
+    uint8_t operator[](int i) const
+    {
+        return bytes[i];
+    }
+    String toString() const
+    {
+        char s[16];
+        snprintf(s, sizeof(s), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return String(s);
+    }
+    size_t printTo(Print &p) const override
+    {
+        return p.print(toString());
+    }
+};
+#endif
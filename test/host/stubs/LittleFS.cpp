@@ -0,0 +1,231 @@
+#include "LittleFS.h"
+#include "RamFS.h"
+#include "host.h"
+
+using namespace fs;
+
+struct Partition
+{
+    HostPartition format;
+    FSImplPtr files;
+};
+
+static Partition partition = {HostPartition::Blank, newRamFSImpl()};
+
+// every write can be the one the power loss hits
+class HostFileImpl : public FileImpl
+{
+private:
+    FileImplPtr inner;
+
+public:
+    explicit HostFileImpl(FileImplPtr inner) : inner(inner) {}
+    size_t write(const uint8_t *buf, size_t size) override
+    {
+        hostPowerTick();
+        return inner->write(buf, size);
+    }
+    size_t read(uint8_t *buf, size_t size) override
+    {
+        return inner->read(buf, size);
+    }
+    void flush() override
+    {
+        inner->flush();
+    }
+    bool seek(uint32_t pos, SeekMode mode) override
+    {
+        return inner->seek(pos, mode);
+    }
+    size_t position() const override
+    {
+        return inner->position();
+    }
+    size_t size() const override
+    {
+        return inner->size();
+    }
+    bool truncate(uint32_t size) override
+    {
+        hostPowerTick();
+        return inner->truncate(size);
+    }
+    void close() override
+    {
+        inner->close();
+    }
+    const char *name() const override
+    {
+        return inner->name();
+    }
+    const char *fullName() const override
+    {
+        return inner->fullName();
+    }
+    bool isFile() const override
+    {
+        return inner->isFile();
+    }
+    bool isDirectory() const override
+    {
+        return inner->isDirectory();
+    }
+};
+
+class HostDirImpl : public DirImpl
+{
+private:
+    DirImplPtr inner;
+
+public:
+    explicit HostDirImpl(DirImplPtr inner) : inner(inner) {}
+    FileImplPtr openFile(OpenMode openMode, AccessMode accessMode) override
+    {
+        FileImplPtr file = inner->openFile(openMode, accessMode);
+        return file ? FileImplPtr(new HostFileImpl(file)) : file;
+    }
+    const char *fileName() override
+    {
+        return inner->fileName();
+    }
+    size_t fileSize() override
+    {
+        return inner->fileSize();
+    }
+    bool isFile() const override
+    {
+        return inner->isFile();
+    }
+    bool isDirectory() const override
+    {
+        return inner->isDirectory();
+    }
+    bool next() override
+    {
+        return inner->next();
+    }
+    bool rewind() override
+    {
+        return inner->rewind();
+    }
+};
+
+class HostPartitionFS : public FSImpl
+{
+private:
+    HostPartition kind;
+    bool autoFormat;
+
+    bool usable() const
+    {
+        return mounted && partition.format == kind;
+    }
+
+public:
+    bool mounted;
+
+    explicit HostPartitionFS(HostPartition kind) : kind(kind), autoFormat(true), mounted(false) {}
+    bool setConfig(const FSConfig &cfg) override
+    {
+        autoFormat = cfg._autoFormat;
+        return true;
+    }
+    bool begin() override
+    {
+        if (partition.format != kind && autoFormat) {
+            format();
+        }
+        mounted = partition.format == kind;
+        return mounted;
+    }
+    void end() override
+    {
+        mounted = false;
+    }
+    bool format() override
+    {
+        hostPowerTick();
+        partition.format = HostPartition::Blank;
+        partition.files = newRamFSImpl();
+        hostPowerTick();
+        partition.format = kind;
+        return true;
+    }
+    bool info(FSInfo &info) override
+    {
+        return usable() && partition.files->info(info);
+    }
+    bool info64(FSInfo64 &info) override
+    {
+        return usable() && partition.files->info64(info);
+    }
+    FileImplPtr open(const char *path, OpenMode openMode, AccessMode accessMode) override
+    {
+        if (!usable()) {
+            return FileImplPtr();
+        }
+        if (openMode & (OM_CREATE | OM_TRUNCATE)) {
+            hostPowerTick();
+        }
+        FileImplPtr file = partition.files->open(path, openMode, accessMode);
+        return file ? FileImplPtr(new HostFileImpl(file)) : file;
+    }
+    bool exists(const char *path) override
+    {
+        return usable() && partition.files->exists(path);
+    }
+    DirImplPtr openDir(const char *path) override
+    {
+        if (!usable()) {
+            return DirImplPtr();
+        }
+        return DirImplPtr(new HostDirImpl(partition.files->openDir(path)));
+    }
+    bool rename(const char *pathFrom, const char *pathTo) override
+    {
+        if (!usable()) {
+            return false;
+        }
+        hostPowerTick();
+        return partition.files->rename(pathFrom, pathTo);
+    }
+    bool remove(const char *path) override
+    {
+        if (!usable()) {
+            return false;
+        }
+        hostPowerTick();
+        return partition.files->remove(path);
+    }
+    bool mkdir(const char *) override
+    {
+        return false;
+    }
+    bool rmdir(const char *) override
+    {
+        return false;
+    }
+};
+
+static std::shared_ptr<HostPartitionFS> spiffsImpl(new HostPartitionFS(HostPartition::Spiffs));
+static std::shared_ptr<HostPartitionFS> littleImpl(new HostPartitionFS(HostPartition::Little));
+
+fs::FS SPIFFS(spiffsImpl);
+fs::FS LittleFS(littleImpl);
+
+HostPartition hostPartition()
+{
+    return partition.format;
+}
+
+void hostPartitionFormat(HostPartition format)
+{
+    partition.format = format;
+    partition.files = newRamFSImpl();
+}
+
+void hostPartitionUnmount()
+{
+    spiffsImpl->mounted = false;
+    littleImpl->mounted = false;
+}
@@ -0,0 +1,26 @@
+#ifndef HOST_LITTLEFS_H_
+#define HOST_LITTLEFS_H_
+// SPIFFS and LittleFS of the host build share one simulated partition like on the device:
+// each only mounts what it formatted itself, and formatting one wipes the other.
+#include "FS.h"
+
+class LittleFSConfig : public fs::FSConfig
+{
+public:
+    LittleFSConfig(bool autoFormat = true) : FSConfig(autoFormat) {}
+};
+
+extern fs::FS LittleFS;
+
+enum class HostPartition : uint8_t {
+    Blank,
+    Spiffs,
+    Little
+};
+
+// what the partition holds now; setting it formats it (empty) without a power tick
+HostPartition hostPartition();
+void hostPartitionFormat(HostPartition format);
+// after a simulated reset nothing is mounted anymore
+void hostPartitionUnmount();
+#endif
@@ -0,0 +1,76 @@
+// the network stand-ins: WiFi, mDNS, OTA and the web server
+#include "ESP8266WiFi.h"
+#include "ESP8266mDNS.h"
+#include "ArduinoOTA.h"
+#include "ESPAsyncWebServer.h"
+
+ESP8266WiFiClass WiFi;
+MDNSResponder MDNS;
+ArduinoOTAClass ArduinoOTA;
+
+int hostHttpRequest(AsyncWebServer &server, const char *path, int method, const std::vector<AsyncWebParameter> &params)
+{
+    for (size_t i = 0; i < server.routes.size(); i++) {
+        const AsyncWebServer::Route &route = server.routes[i];
+        if (route.path == path && (route.method & method)) {
+            AsyncWebServerRequest request(params);
+            route.handler(&request);
+            return request.responseCode;
+        }
+    }
+    return 404;
+}
+
+// PersWiFiManager.h is the real one, the stand-in never connects; its AP mode is only the WiFi mode
+// and the handler, which is what the firmware looks at
+#include "PersWiFiManager.h"
+
+PersWiFiManager::PersWiFiManager(AsyncWebServer &s, DNSServer &d) : _server(&s), _dnsServer(&d), _connectNonBlock(false), _connectStartTime(0) {}
+
+bool PersWiFiManager::attemptConnection(const String &, const String &)
+{
+    return false;
+}
+
+void PersWiFiManager::setupWiFiHandlers() {}
+
+bool PersWiFiManager::begin(const String &, const String &)
+{
+    return false;
+}
+
+String PersWiFiManager::getApSsid()
+{
+    return _apSsid;
+}
+
+void PersWiFiManager::setApCredentials(const String &apSsid, const String &apPass)
+{
+    _apSsid = apSsid;
+    _apPass = apPass;
+}
+
+void PersWiFiManager::setConnectNonBlock(bool b)
+{
+    _connectNonBlock = b;
+}
+
+void PersWiFiManager::handleWiFi() {}
+
+void PersWiFiManager::startApMode()
+{
+    WiFi.mode(WIFI_AP);
+    if (_apHandler) {
+        _apHandler();
+    }
+}
+
+void PersWiFiManager::onConnect(WiFiChangeHandlerFunction fn)
+{
+    _connectHandler = fn;
+}
+
+void PersWiFiManager::onAp(WiFiChangeHandlerFunction fn)
+{
+    _apHandler = fn;
+}
@@ -0,0 +1,491 @@
+#include "SSD1306Wire.h"
+#include "OLEDMenuFonts.h"
+
+const uint8_t *const ArialMT_Plain_10 = DejaVu_Sans_Mono_10;
+const uint8_t *const ArialMT_Plain_16 = DejaVu_Sans_Mono_12;
+const uint8_t *const ArialMT_Plain_24 = DejaVu_Sans_Mono_12;
+
+static HostOledStats oledStats;
+
+HostOledStats &hostOledStats()
+{
+    return oledStats;
+}
+
+void hostOledResetStats()
+{
+    memset(&oledStats, 0, sizeof(oledStats));
+}
+
+OLEDDisplay::OLEDDisplay()
+    : geometry(GEOMETRY_128_64), displayWidth(128), displayHeight(64), displayBufferSize(128 * 64 / 8),
+      textAlignment(TEXT_ALIGN_LEFT), color(WHITE), fontData(ArialMT_Plain_10), buffer(nullptr), buffer_back(nullptr)
+{
+}
+
+OLEDDisplay::~OLEDDisplay()
+{
+    end();
+}
+
+bool OLEDDisplay::init()
+{
+    if (!connect()) {
+        return false;
+    }
+    if (!buffer) {
+        buffer = (uint8_t *)malloc(displayBufferSize);
+        buffer_back = (uint8_t *)malloc(displayBufferSize);
+    }
+    sendInitCommands();
+    resetDisplay();
+    return true;
+}
+
+void OLEDDisplay::end()
+{
+    free(buffer);
+    free(buffer_back);
+    buffer = nullptr;
+    buffer_back = nullptr;
+}
+
+void OLEDDisplay::resetDisplay()
+{
+    clear();
+    memset(buffer_back, 1, displayBufferSize);
+    display();
+}
+
+void OLEDDisplay::sendInitCommands()
+{
+    sendCommand(DISPLAYOFF);
+    sendCommand(SETDISPLAYCLOCKDIV);
+    sendCommand(0xF0);
+    sendCommand(SETMULTIPLEX);
+    sendCommand(displayHeight - 1);
+    sendCommand(SETDISPLAYOFFSET);
+    sendCommand(0x00);
+    sendCommand(SETSTARTLINE);
+    sendCommand(CHARGEPUMP);
+    sendCommand(0x14);
+    sendCommand(MEMORYMODE);
+    sendCommand(0x00);
+    sendCommand(SEGREMAP);
+    sendCommand(COMSCANINC);
+    sendCommand(SETCOMPINS);
+    sendCommand(0x12);
+    sendCommand(SETCONTRAST);
+    sendCommand(0xCF);
+    sendCommand(SETPRECHARGE);
+    sendCommand(0xF1);
+    sendCommand(SETVCOMDETECT);
+    sendCommand(0x40);
+    sendCommand(DISPLAYALLON_RESUME);
+    sendCommand(NORMALDISPLAY);
+    sendCommand(0x2e); // deactivate scroll
+    sendCommand(DISPLAYON);
+}
+
+void OLEDDisplay::displayOn()
+{
+    sendCommand(DISPLAYON);
+}
+
+void OLEDDisplay::displayOff()
+{
+    sendCommand(DISPLAYOFF);
+}
+
+void OLEDDisplay::invertDisplay()
+{
+    sendCommand(INVERTDISPLAY);
+}
+
+void OLEDDisplay::normalDisplay()
+{
+    sendCommand(NORMALDISPLAY);
+}
+
+void OLEDDisplay::setContrast(uint8_t contrast, uint8_t precharge, uint8_t comdetect)
+{
+    sendCommand(SETPRECHARGE);
+    sendCommand(precharge);
+    sendCommand(SETCONTRAST);
+    sendCommand(contrast);
+    sendCommand(SETVCOMDETECT);
+    sendCommand(comdetect);
+    sendCommand(DISPLAYALLON_RESUME);
+    sendCommand(NORMALDISPLAY);
+    sendCommand(DISPLAYON);
+}
+
+void OLEDDisplay::setBrightness(uint8_t brightness)
+{
+    uint8_t contrast = brightness;
+    if (brightness < 128) {
+        contrast = brightness * 1.171;
+    } else {
+        contrast = brightness * 1.171 - 43;
+    }
+    uint8_t precharge = 241;
+    if (brightness == 0) {
+        precharge = 0;
+    }
+    setContrast(contrast, precharge, brightness / 8);
+}
+
+void OLEDDisplay::flipScreenVertically()
+{
+    sendCommand(SEGREMAP | 0x01);
+    sendCommand(COMSCANDEC);
+}
+
+void OLEDDisplay::mirrorScreen()
+{
+    sendCommand(SEGREMAP);
+    sendCommand(COMSCANDEC);
+}
+
+void OLEDDisplay::clear()
+{
+    memset(buffer, 0, displayBufferSize);
+}
+
+void OLEDDisplay::setColor(OLEDDISPLAY_COLOR color)
+{
+    this->color = color;
+}
+
+// applies the color to the set bits of one buffer byte
+void OLEDDisplay::plot(uint16_t pos, uint8_t bits)
+{
+    oledStats.pixels += __builtin_popcount(bits);
+    const uint8_t before = buffer[pos];
+    switch (color) {
+        case WHITE:
+            buffer[pos] |= bits;
+            break;
+        case BLACK:
+            buffer[pos] &= ~bits;
+            break;
+        case INVERSE:
+            buffer[pos] ^= bits;
+            break;
+    }
+    oledStats.bufferOps += buffer[pos] != before;
+}
+
+void OLEDDisplay::setPixel(int16_t x, int16_t y)
+{
+    if (x >= 0 && x < displayWidth && y >= 0 && y < displayHeight) {
+        plot(x + (y / 8) * displayWidth, 1 << (y & 7));
+    }
+}
+
+void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
+{
+    for (int16_t i = 0; i < length; i++) {
+        setPixel(x + i, y);
+    }
+}
+
+void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
+{
+    for (int16_t i = 0; i < length; i++) {
+        setPixel(x, y + i);
+    }
+}
+
+void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    drawHorizontalLine(x, y, width);
+    drawVerticalLine(x, y, height);
+    drawVerticalLine(x + width - 1, y, height);
+    drawHorizontalLine(x, y + height - 1, width);
+}
+
+void OLEDDisplay::fillRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    for (int16_t i = x; i < x + width; i++) {
+        drawVerticalLine(i, y, height);
+    }
+}
+
+void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *xbm)
+{
+    int16_t widthInXbm = (width + 7) / 8;
+    uint8_t data = 0;
+    for (int16_t y = 0; y < height; y++) {
+        for (int16_t x = 0; x < width; x++) {
+            if (x & 7) {
+                data >>= 1;
+            } else {
+                data = pgm_read_byte(xbm + (x / 8) + y * widthInXbm);
+            }
+            if (data & 0x01) {
+                setPixel(xMove + x, yMove + y);
+            }
+        }
+    }
+}
+
+// glyph columns of 8 pixel bytes, rasterHeight bytes per column, shifted into the pages they cover
+void OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData)
+{
+    if (width < 0 || height < 0) {
+        return;
+    }
+    if (yMove + height < 0 || yMove > displayHeight) {
+        return;
+    }
+    if (xMove + width < 0 || xMove > displayWidth) {
+        return;
+    }
+
+    uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+    int8_t yOffset = yMove & 7;
+    bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
+    int16_t initYMove = yMove;
+    int8_t initYOffset = yOffset;
+
+    for (uint16_t i = 0; i < bytesInData; i++) {
+        if (i % rasterHeight == 0) {
+            yMove = initYMove;
+            yOffset = initYOffset;
+        }
+        uint8_t currentByte = pgm_read_byte(data + offset + i);
+        int16_t xPos = xMove + (i / rasterHeight);
+        int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * displayWidth;
+        int16_t dataPos = xPos + yPos;
+        if (dataPos >= 0 && dataPos < displayBufferSize && xPos >= 0 && xPos < displayWidth) {
+            if (yOffset >= 0) {
+                plot(dataPos, currentByte << yOffset);
+                if (dataPos < (displayBufferSize - displayWidth)) {
+                    plot(dataPos + displayWidth, currentByte >> (8 - yOffset));
+                }
+            } else {
+                yOffset = -yOffset;
+                plot(dataPos, currentByte >> yOffset);
+                yMove -= 8;
+                yOffset = 8 - yOffset;
+            }
+        }
+    }
+}
+
+void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment)
+{
+    this->textAlignment = textAlignment;
+}
+
+void OLEDDisplay::setFont(const uint8_t *fontData)
+{
+    this->fontData = fontData;
+}
+
+// UTF-8 to the extended ASCII of the font tables, like the library's DefaultFontTableLookup
+static std::string utf8ascii(const String &text)
+{
+    std::string out;
+    uint8_t last = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        const uint8_t ch = text[i];
+        if (ch < 128) {
+            last = 0;
+            out += (char)ch;
+            continue;
+        }
+        const uint8_t prev = last;
+        last = ch;
+        if (prev == 0xC2) {
+            out += (char)ch;
+        } else if (prev == 0xC3) {
+            out += (char)(ch | 0xC0);
+        }
+    }
+    return out;
+}
+
+void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char *text, uint16_t textLength, uint16_t textWidth)
+{
+    uint8_t textHeight = pgm_read_byte(fontData + HEIGHT_POS);
+    uint8_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+    uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS) * JUMPTABLE_BYTES;
+    uint16_t cursorX = 0;
+
+    switch (textAlignment) {
+        case TEXT_ALIGN_CENTER_BOTH:
+            yMove -= textHeight >> 1;
+            // fall through
+        case TEXT_ALIGN_CENTER:
+            xMove -= textWidth >> 1;
+            break;
+        case TEXT_ALIGN_RIGHT:
+            xMove -= textWidth;
+            break;
+        case TEXT_ALIGN_LEFT:
+            break;
+    }
+
+    if (xMove + textWidth < 0 || xMove >= displayWidth) {
+        return;
+    }
+    if (yMove + textHeight < 0 || yMove >= displayWidth) {
+        return;
+    }
+
+    for (uint16_t j = 0; j < textLength; j++) {
+        int16_t xPos = xMove + cursorX;
+        if (xPos > displayWidth) {
+            break;
+        }
+        uint8_t code = text[j];
+        if (code >= firstChar) {
+            uint8_t charCode = code - firstChar;
+            const uint8_t *jump = fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES;
+            uint8_t msbJumpToChar = pgm_read_byte(jump);
+            uint8_t lsbJumpToChar = pgm_read_byte(jump + JUMPTABLE_LSB);
+            uint8_t charByteSize = pgm_read_byte(jump + JUMPTABLE_SIZE);
+            uint8_t currentCharWidth = pgm_read_byte(jump + JUMPTABLE_WIDTH);
+            if (!(msbJumpToChar == 255 && lsbJumpToChar == 255)) {
+                uint16_t charDataPosition = JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
+                oledStats.glyphs++;
+                drawInternal(xPos, yMove, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize);
+            }
+            cursorX += currentCharWidth;
+        }
+    }
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &strUser)
+{
+    uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+    const std::string text = utf8ascii(strUser);
+    uint16_t yOffset = 0;
+    if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
+        uint16_t lb = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            lb += text[i] == '\n';
+        }
+        yOffset = (lb * lineHeight) / 2;
+    }
+    uint16_t line = 0;
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        if (end > start) {
+            const char *part = text.c_str() + start;
+            const uint16_t length = end - start;
+            drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, part, length, getStringWidth(part, length));
+        }
+        start = end + 1;
+    }
+}
+
+void OLEDDisplay::drawStringf(int16_t x, int16_t y, char *buffer, String format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vsprintf(buffer, format.c_str(), args);
+    va_end(args);
+    drawString(x, y, buffer);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const char *text, uint16_t length)
+{
+    uint16_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+    uint16_t stringWidth = 0;
+    uint16_t maxWidth = 0;
+    while (length--) {
+        if ((uint8_t)text[length] < firstChar) {
+            if (text[length] == '\n') {
+                maxWidth = std::max(maxWidth, stringWidth);
+                stringWidth = 0;
+            }
+            continue;
+        }
+        stringWidth += pgm_read_byte(fontData + JUMPTABLE_START + ((uint8_t)text[length] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+    }
+    return std::max(maxWidth, stringWidth);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const String &strUser)
+{
+    const std::string text = utf8ascii(strUser);
+    return getStringWidth(text.c_str(), text.size());
+}
+
+SSD1306Wire::SSD1306Wire(uint8_t address, int, int, OLEDDISPLAY_GEOMETRY g) : _address(address)
+{
+    geometry = g;
+    displayHeight = g == GEOMETRY_128_32 ? 32 : 64;
+    displayBufferSize = displayWidth * displayHeight / 8;
+}
+
+bool SSD1306Wire::connect()
+{
+    Wire.begin();
+    Wire.setClock(700000);
+    return true;
+}
+
+void SSD1306Wire::sendCommand(uint8_t command)
+{
+    Wire.beginTransmission(_address);
+    Wire.write(0x80);
+    Wire.write(command);
+    Wire.endTransmission();
+}
+
+// one bounding box over all changed pages, 16 data bytes per transmission
+void SSD1306Wire::display(void)
+{
+    uint8_t minBoundY = UINT8_MAX;
+    uint8_t maxBoundY = 0;
+    uint8_t minBoundX = UINT8_MAX;
+    uint8_t maxBoundX = 0;
+    uint8_t x, y;
+    for (y = 0; y < (displayHeight / 8); y++) {
+        for (x = 0; x < displayWidth; x++) {
+            uint16_t pos = x + y * displayWidth;
+            if (buffer[pos] != buffer_back[pos]) {
+                minBoundY = std::min(minBoundY, y);
+                maxBoundY = std::max(maxBoundY, y);
+                minBoundX = std::min(minBoundX, x);
+                maxBoundX = std::max(maxBoundX, x);
+            }
+            buffer_back[pos] = buffer[pos];
+        }
+    }
+    if (minBoundY == UINT8_MAX) {
+        return;
+    }
+    sendCommand(COLUMNADDR);
+    sendCommand(minBoundX);
+    sendCommand(maxBoundX);
+    sendCommand(PAGEADDR);
+    sendCommand(minBoundY);
+    sendCommand(maxBoundY);
+    uint8_t k = 0;
+    for (y = minBoundY; y <= maxBoundY; y++) {
+        for (x = minBoundX; x <= maxBoundX; x++) {
+            if (k == 0) {
+                Wire.beginTransmission(_address);
+                Wire.write(0x40);
+            }
+            Wire.write(buffer[x + y * displayWidth]);
+            k++;
+            if (k == 16) {
+                Wire.endTransmission();
+                k = 0;
+            }
+        }
+    }
+    if (k != 0) {
+        Wire.endTransmission();
+    }
+}
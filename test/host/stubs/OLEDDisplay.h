@@ -0,0 +1,147 @@
+#ifndef HOST_OLEDDISPLAY_H_
+#define HOST_OLEDDISPLAY_H_
+// Host stand-in for the ThingPulse OLEDDisplay (4.4.0): the same frame buffer layout (8 pixel
+// high pages, a byte per column), font format and drawing rules, rendering into memory. It
+// counts what is drawn; what reaches the panel goes over Wire to SSD1306Sim.
+#include <Arduino.h>
+#include "OLEDDisplayFonts.h"
+
+#define OLEDDISPLAY_DOUBLE_BUFFER
+
+#define JUMPTABLE_BYTES 4
+#define JUMPTABLE_LSB 1
+#define JUMPTABLE_SIZE 2
+#define JUMPTABLE_WIDTH 3
+#define JUMPTABLE_START 4
+#define WIDTH_POS 0
+#define HEIGHT_POS 1
+#define FIRST_CHAR_POS 2
+#define CHAR_NUM_POS 3
+
+// SSD1306 commands
+#define CHARGEPUMP 0x8D
+#define COLUMNADDR 0x21
+#define COMSCANDEC 0xC8
+#define COMSCANINC 0xC0
+#define DISPLAYALLON 0xA5
+#define DISPLAYALLON_RESUME 0xA4
+#define DISPLAYOFF 0xAE
+#define DISPLAYON 0xAF
+#define EXTERNALVCC 0x1
+#define INVERTDISPLAY 0xA7
+#define MEMORYMODE 0x20
+#define NORMALDISPLAY 0xA6
+#define PAGEADDR 0x22
+#define SEGREMAP 0xA0
+#define SETCOMPINS 0xDA
+#define SETCONTRAST 0x81
+#define SETDISPLAYCLOCKDIV 0xD5
+#define SETDISPLAYOFFSET 0xD3
+#define SETHIGHCOLUMN 0x10
+#define SETLOWCOLUMN 0x00
+#define SETMULTIPLEX 0xA8
+#define SETPRECHARGE 0xD9
+#define SETSEGMENTREMAP 0xA1
+#define SETSTARTLINE 0x40
+#define SETVCOMDETECT 0xDB
+#define SWITCHCAPVCC 0x2
+
+enum OLEDDISPLAY_COLOR {
+    BLACK = 0,
+    WHITE = 1,
+    INVERSE = 2
+};
+
+enum OLEDDISPLAY_TEXT_ALIGNMENT {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_RIGHT = 1,
+    TEXT_ALIGN_CENTER = 2,
+    TEXT_ALIGN_CENTER_BOTH = 3
+};
+
+enum OLEDDISPLAY_GEOMETRY {
+    GEOMETRY_128_64 = 0,
+    GEOMETRY_128_32 = 1
+};
+
+// drawing work since the last hostOledResetStats()
+struct HostOledStats
+{
+    uint32_t glyphs;    // characters drawn
+    uint32_t pixels;    // pixels set, cleared or inverted, including the off screen ones skipped
+    uint32_t bufferOps; // frame buffer bytes modified
+};
+HostOledStats &hostOledStats();
+void hostOledResetStats();
+
+class OLEDDisplay : public Print
+{
+protected:
+    OLEDDISPLAY_GEOMETRY geometry;
+    uint16_t displayWidth;
+    uint16_t displayHeight;
+    uint16_t displayBufferSize;
+    OLEDDISPLAY_TEXT_ALIGNMENT textAlignment;
+    OLEDDISPLAY_COLOR color;
+    const uint8_t *fontData;
+
+    void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData);
+    void drawStringInternal(int16_t xMove, int16_t yMove, const char *text, uint16_t textLength, uint16_t textWidth);
+    void plot(uint16_t pos, uint8_t bits);
+    virtual void sendCommand(uint8_t command) = 0;
+    virtual bool connect() = 0;
+    void sendInitCommands();
+
+public:
+    uint8_t *buffer;
+    uint8_t *buffer_back;
+
+    OLEDDisplay();
+    virtual ~OLEDDisplay();
+    uint16_t width() const
+    {
+        return displayWidth;
+    }
+    uint16_t height() const
+    {
+        return displayHeight;
+    }
+    bool init();
+    void end();
+    void resetDisplay();
+    void displayOn();
+    void displayOff();
+    void invertDisplay();
+    void normalDisplay();
+    void setContrast(uint8_t contrast, uint8_t precharge = 241, uint8_t comdetect = 64);
+    void setBrightness(uint8_t brightness);
+    void flipScreenVertically();
+    void mirrorScreen();
+    void clear();
+    virtual void display() = 0;
+
+    void setColor(OLEDDISPLAY_COLOR color);
+    OLEDDISPLAY_COLOR getColor()
+    {
+        return color;
+    }
+    void setPixel(int16_t x, int16_t y);
+    void drawHorizontalLine(int16_t x, int16_t y, int16_t length);
+    void drawVerticalLine(int16_t x, int16_t y, int16_t length);
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height);
+    void fillRect(int16_t x, int16_t y, int16_t width, int16_t height);
+    void drawXbm(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *xbm);
+    void setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment);
+    void setFont(const uint8_t *fontData);
+    void drawString(int16_t x, int16_t y, const String &text);
+    void drawStringf(int16_t x, int16_t y, char *buffer, String format, ...);
+    uint16_t getStringWidth(const char *text, uint16_t length);
+    uint16_t getStringWidth(const String &text);
+
+    size_t write(uint8_t c) override
+    {
+        return 1;
+    }
+    using Print::write;
+};
+#endif
@@ -0,0 +1,9 @@
+#ifndef HOST_OLEDDISPLAYFONTS_H_
+#define HOST_OLEDDISPLAYFONTS_H_
+// The library's Arial tables are not in the tree; the stand-in draws them with the DejaVu fonts
+// of OLEDMenuFonts.h, same format, other glyphs.
+#include <stdint.h>
+extern const uint8_t *const ArialMT_Plain_10;
+extern const uint8_t *const ArialMT_Plain_16;
+extern const uint8_t *const ArialMT_Plain_24;
+#endif
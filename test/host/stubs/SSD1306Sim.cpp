@@ -0,0 +1,122 @@
+#include "SSD1306Sim.h"
+
+SSD1306Sim ssd1306Sim;
+
+SSD1306Sim::SSD1306Sim()
+{
+    reset();
+    hostI2cAttach(0x3c, this);
+}
+
+void SSD1306Sim::reset()
+{
+    memset(ram, 0, sizeof(ram));
+    colStart = 0;
+    colEnd = 127;
+    pageStart = 0;
+    pageEnd = 7;
+    col = 0;
+    page = 0;
+    on = false;
+    commands = 0;
+    dataBytes = 0;
+    pendingLength = 0;
+}
+
+std::string SSD1306Sim::pbm() const
+{
+    std::string out = "P4\n128 64\n";
+    for (uint8_t y = 0; y < 64; y++) {
+        for (uint8_t x = 0; x < 128; x += 8) {
+            uint8_t bits = 0;
+            for (uint8_t b = 0; b < 8; b++) {
+                bits = (bits << 1) | (pixel(x + b, y) ^ 1); // 1 is black in PBM
+            }
+            out += (char)bits;
+        }
+    }
+    return out;
+}
+
+// the number of argument bytes after a command byte
+static uint8_t arguments(uint8_t cmd)
+{
+    switch (cmd) {
+        case 0x21: // COLUMNADDR
+        case 0x22: // PAGEADDR
+            return 2;
+        case 0x20: // MEMORYMODE
+        case 0x81: // SETCONTRAST
+        case 0x8D: // CHARGEPUMP
+        case 0xA8: // SETMULTIPLEX
+        case 0xD3: // SETDISPLAYOFFSET
+        case 0xD5: // SETDISPLAYCLOCKDIV
+        case 0xD9: // SETPRECHARGE
+        case 0xDA: // SETCOMPINS
+        case 0xDB: // SETVCOMDETECT
+            return 1;
+    }
+    return 0;
+}
+
+void SSD1306Sim::command(uint8_t byte)
+{
+    commands++;
+    pending[pendingLength++] = byte;
+    if (pendingLength <= arguments(pending[0])) {
+        return;
+    }
+    pendingLength = 0;
+    switch (pending[0]) {
+        case 0x21:
+            colStart = col = pending[1] & 0x7f;
+            colEnd = pending[2] & 0x7f;
+            break;
+        case 0x22:
+            pageStart = page = pending[1] & 7;
+            pageEnd = pending[2] & 7;
+            break;
+        case 0xAE:
+            on = false;
+            break;
+        case 0xAF:
+            on = true;
+            break;
+    }
+}
+
+void SSD1306Sim::data(uint8_t byte)
+{
+    dataBytes++;
+    ram[page][col] = byte;
+    if (col++ < colEnd) {
+        return;
+    }
+    col = colStart;
+    page = page < pageEnd ? page + 1 : pageStart;
+}
+
+void SSD1306Sim::write(const uint8_t *bytes, size_t len)
+{
+    size_t i = 0;
+    while (i < len) {
+        const uint8_t control = bytes[i++];
+        const bool isData = control & 0x40;
+        if (control & 0x80) {
+            // continuation bit: a single byte, then another control byte
+            if (i < len) {
+                isData ? data(bytes[i]) : command(bytes[i]);
+                i++;
+            }
+            continue;
+        }
+        for (; i < len; i++) {
+            isData ? data(bytes[i]) : command(bytes[i]);
+        }
+    }
+}
+
+void SSD1306Sim::read(uint8_t *data, size_t len)
+{
+    memset(data, on ? 0x03 : 0x43, len); // status byte, bit 6 set while the display is off
+}
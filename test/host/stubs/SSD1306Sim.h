@@ -0,0 +1,40 @@
+#ifndef HOST_SSD1306_SIM_H_
+#define HOST_SSD1306_SIM_H_
+// The SSD1306 controller as it sees the bus: control bytes (0x80 one command, 0x00 command
+// stream, 0x40 data stream), horizontal addressing inside the COLUMNADDR/PAGEADDR window and the
+// display RAM the data lands in. A golden image compares ram, what the panel really shows.
+#include "Wire.h"
+#include <string>
+
+class SSD1306Sim : public HostI2cDevice
+{
+public:
+    uint8_t ram[8][128]; // pages of 8 pixel rows, a byte per column
+    uint8_t colStart, colEnd, pageStart, pageEnd;
+    uint8_t col, page;
+    bool on;
+    uint32_t commands;  // command bytes, arguments included
+    uint32_t dataBytes; // bytes written to display RAM
+
+    SSD1306Sim();
+    void reset();
+    bool pixel(uint8_t x, uint8_t y) const
+    {
+        return (ram[y / 8][x] >> (y % 8)) & 1;
+    }
+    // binary PBM of the display RAM, lit pixels white
+    std::string pbm() const;
+    void write(const uint8_t *data, size_t len) override;
+    void read(uint8_t *data, size_t len) override;
+
+private:
+    uint8_t pending[3]; // command being assembled with its arguments
+    uint8_t pendingLength;
+
+    void command(uint8_t byte);
+    void data(uint8_t byte);
+};
+
+// attached at 0x3c
+extern SSD1306Sim ssd1306Sim;
+#endif
@@ -0,0 +1,19 @@
+#ifndef HOST_SSD1306WIRE_H_
+#define HOST_SSD1306WIRE_H_
+// Host stand-in for SSD1306Wire (ThingPulse 4.4.0): the library's bounding box transfer over Wire
+#include "OLEDDisplay.h"
+#include <Wire.h>
+
+class SSD1306Wire : public OLEDDisplay
+{
+protected:
+    uint8_t _address;
+
+    void sendCommand(uint8_t command) override;
+    bool connect() override;
+
+public:
+    SSD1306Wire(uint8_t address, int sda, int scl, OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64);
+    void display(void) override;
+};
+#endif
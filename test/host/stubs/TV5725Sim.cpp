@@ -0,0 +1,54 @@
+#include "TV5725Sim.h"
+
+TV5725Sim tv5725Sim;
+
+TV5725Sim::TV5725Sim() : beforeRead(nullptr)
+{
+    reset();
+    hostI2cAttach(0x17, this);
+}
+
+void TV5725Sim::reset()
+{
+    memset(regs, 0, sizeof(regs));
+    segment = 0;
+    pointer = 0;
+    regs[0][0x0B] = 0x00; // CHIP_ID_FOUNDRY
+    regs[0][0x0C] = 0x25; // CHIP_ID_PRODUCT
+    regs[0][0x0D] = 0x12; // CHIP_ID_REVISION
+    clearWrites();
+}
+
+void TV5725Sim::clearWrites()
+{
+    memset(writes, 0, sizeof(writes));
+}
+
+void TV5725Sim::write(const uint8_t *data, size_t len)
+{
+    if (len == 0) {
+        return;
+    }
+    pointer = data[0];
+    for (size_t i = 1; i < len; i++, pointer++) {
+        if (pointer == 0xF0) {
+            segment = data[i] % TV5725_SIM_SEGMENTS;
+            continue;
+        }
+        if (segment == 0 && pointer < TV5725_SIM_STATUS_END) {
+            continue; // status, read only
+        }
+        regs[segment][pointer] = data[i];
+        writes[segment][pointer]++;
+    }
+}
+
+void TV5725Sim::read(uint8_t *data, size_t len)
+{
+    if (beforeRead) {
+        beforeRead(*this, segment, pointer);
+    }
+    for (size_t i = 0; i < len; i++, pointer++) {
+        data[i] = pointer == 0xF0 ? segment : regs[segment][pointer];
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef HOST_TV5725_SIM_H_
+#define HOST_TV5725_SIM_H_
+// The TV5725 as the firmware sees it over I2C: 6 register segments selected through 0xF0, auto
+// incrementing transfers. Segment 0 0x00-0x3F are the status registers, read only for the
+// firmware; a test or a replayed recording sets them in regs[0].
+#include "Wire.h"
+
+#define TV5725_SIM_SEGMENTS 6
+#define TV5725_SIM_STATUS_END 0x40
+
+class TV5725Sim : public HostI2cDevice
+{
+public:
+    uint8_t regs[TV5725_SIM_SEGMENTS][256];
+    uint8_t segment;
+    uint8_t pointer;
+    uint32_t writes[TV5725_SIM_SEGMENTS][256]; // firmware writes per register since clearWrites()
+    // called before each read transfer with the first register, a replay updates the status from it
+    void (*beforeRead)(TV5725Sim &sim, uint8_t segment, uint8_t reg);
+
+    TV5725Sim();
+    // power on state: registers 0, chip id set
+    void reset();
+    void clearWrites();
+    uint8_t &reg(uint8_t segment, uint8_t reg)
+    {
+        return regs[segment % TV5725_SIM_SEGMENTS][reg];
+    }
+    void write(const uint8_t *data, size_t len) override;
+    void read(uint8_t *data, size_t len) override;
+};
+
+// attached at GBS_ADDR
+extern TV5725Sim tv5725Sim;
+#endif
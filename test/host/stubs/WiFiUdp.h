@@ -0,0 +1,4 @@
+#ifndef HOST_WIFIUDP_H_
+#define HOST_WIFIUDP_H_
+#include <Arduino.h>
+#endif
@@ -0,0 +1,117 @@
+#include "Wire.h"
+#include "host.h"
+#include <map>
+
+TwoWire Wire;
+
+static HostI2cDevice *devices[128];
+static std::map<uint8_t, HostI2cStats> stats;
+
+void hostI2cAttach(uint8_t address, HostI2cDevice *device)
+{
+    devices[address & 0x7f] = device;
+}
+
+HostI2cStats &hostI2cStats(uint8_t address)
+{
+    return stats[address];
+}
+
+void hostI2cReset()
+{
+    stats.clear();
+}
+
+TwoWire::TwoWire() : txAddress(0), txLength(0), rxLength(0), rxIndex(0), clock(100000) {}
+
+void TwoWire::begin()
+{
+    clock = 100000;
+}
+
+void TwoWire::begin(int, int)
+{
+    begin();
+}
+
+void TwoWire::setClock(uint32_t frequency)
+{
+    clock = frequency;
+}
+
+// start, address, bytes with their acknowledge bits, stop
+void TwoWire::charge(uint8_t address, size_t bytes)
+{
+    const uint64_t us = ((1 + bytes) * 9 + 2) * 1000000ull / clock;
+    HostI2cStats &s = stats[address];
+    s.transfers++;
+    s.bytes += 1 + bytes;
+    s.micros += us;
+    hostAdvanceMicros(us);
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+    txAddress = address;
+    txLength = 0;
+}
+
+uint8_t TwoWire::endTransmission(uint8_t)
+{
+    HostI2cDevice *device = devices[txAddress & 0x7f];
+    charge(txAddress, device ? txLength : 0);
+    if (!device) {
+        return 2; // address not acknowledged
+    }
+    device->write(txBuffer, txLength);
+    txLength = 0;
+    return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t quantity, bool)
+{
+    HostI2cDevice *device = devices[address & 0x7f];
+    rxIndex = 0;
+    rxLength = 0;
+    charge(address, device ? quantity : 0);
+    if (!device) {
+        return 0;
+    }
+    rxLength = std::min(quantity, sizeof(rxBuffer));
+    device->read(rxBuffer, rxLength);
+    return rxLength;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    if (txLength >= sizeof(txBuffer)) {
+        return 0;
+    }
+    txBuffer[txLength++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (!write(data[i])) {
+            return i;
+        }
+    }
+    return len;
+}
+
+int TwoWire::available()
+{
+    return rxLength - rxIndex;
+}
+
+int TwoWire::read()
+{
+    return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1;
+}
+
+int TwoWire::peek()
+{
+    return rxIndex < rxLength ? rxBuffer[rxIndex] : -1;
+}
@@ -0,0 +1,76 @@
+#ifndef HOST_WIRE_H_
+#define HOST_WIRE_H_
+// Host stand-in for the I2C bus. Transfers go to the devices registered with hostI2cAttach()
+// and take the time they would at the set clock, on the virtual clock.
+#include <Arduino.h>
+
+class HostI2cDevice
+{
+public:
+    virtual ~HostI2cDevice() {}
+    // one write transfer, the bytes after the address
+    virtual void write(const uint8_t *data, size_t len) = 0;
+    // one read transfer, fills len bytes
+    virtual void read(uint8_t *data, size_t len) = 0;
+};
+
+// transfers per device address since the last hostI2cReset()
+struct HostI2cStats
+{
+    uint32_t transfers;
+    uint32_t bytes; // including the address byte
+    uint64_t micros;
+};
+
+void hostI2cAttach(uint8_t address, HostI2cDevice *device);
+HostI2cStats &hostI2cStats(uint8_t address);
+void hostI2cReset();
+
+class TwoWire : public Stream
+{
+private:
+    uint8_t txAddress;
+    uint8_t txBuffer[256];
+    size_t txLength;
+    uint8_t rxBuffer[256];
+    size_t rxLength;
+    size_t rxIndex;
+    uint32_t clock;
+
+    void charge(uint8_t address, size_t bytes);
+
+public:
+    TwoWire();
+    void begin();
+    void begin(int sda, int scl);
+    void setClock(uint32_t frequency);
+    void setClockStretchLimit(uint32_t) {}
+    void beginTransmission(uint8_t address);
+    void beginTransmission(int address)
+    {
+        beginTransmission((uint8_t)address);
+    }
+    uint8_t endTransmission(uint8_t sendStop = true);
+    size_t requestFrom(uint8_t address, size_t quantity, bool sendStop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop = true)
+    {
+        return requestFrom(address, (size_t)quantity, (bool)sendStop);
+    }
+    uint8_t requestFrom(int address, int quantity)
+    {
+        return requestFrom((uint8_t)address, (size_t)quantity, true);
+    }
+    size_t write(uint8_t data) override;
+    size_t write(const uint8_t *data, size_t len) override;
+    size_t write(int data)
+    {
+        return write((uint8_t)data);
+    }
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override {}
+};
+extern TwoWire Wire;
+#endif
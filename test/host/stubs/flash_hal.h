@@ -0,0 +1,11 @@
+#ifndef HOST_FLASH_HAL_H_
+#define HOST_FLASH_HAL_H_
+#include <stdint.h>
+
+// layout of the d1_mini build (eagle.flash.4m1m.ld): sketch space up to the file system at 3 MB
+#define HOST_FLASH_SIZE 0x400000
+#define FS_PHYS_ADDR 0x300000
+#define FS_PHYS_SIZE 0xFA000
+#define FS_PHYS_PAGE 0x100
+#define FS_PHYS_BLOCK 0x2000
+#endif
@@ -0,0 +1,4 @@
+#ifndef HOST_FLASH_UTILS_H_
+#define HOST_FLASH_UTILS_H_
+#define FLASH_SECTOR_SIZE 0x1000
+#endif
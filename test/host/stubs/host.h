@@ -0,0 +1,51 @@
+#ifndef HOST_H_
+#define HOST_H_
+// Controls of the host stand-ins, for the tests. Nothing here exists on the device.
+#include <Arduino.h>
+#include <string>
+
+// virtual clock, moved by delay(), bus transfers and the tests
+uint64_t hostNowMicros();
+void hostAdvanceMicros(uint64_t us);
+// called after every step of the clock, the simulators run from it
+void hostSetTimeHook(void (*hook)(uint64_t nowMicros));
+
+// A periodic signal on an input pin: a rising edge every period() us of the virtual clock, none
+// while it returns 0. It is asked again after every edge. Attached handlers run at the edges.
+// With the watchdog off the firmware spins on a flag a handler sets (framesync.h), and a spin
+// does not move the virtual clock, so there attaching a handler runs the clock to the next edge.
+// The 7 ms the firmware waits after the first edge then come after the second, a measurement
+// takes up to that much longer than on the device. A spin no edge ends costs HOST_SPIN_MICROS.
+#define HOST_SPIN_MICROS 120000 // 3000000 rounds, about 600000 to a 60 Hz edge at 160 MHz
+void hostPinSignal(uint8_t pin, uint32_t (*period)());
+
+void hostSerialInput(const char *text);
+std::string &hostSerialOutput();
+
+// the whole flash chip, erased (0xFF) at start; writes can only clear bits, like NOR flash
+uint8_t *hostFlash();
+void hostFlashErase();
+
+// Power loss: after budget more flash or file system writes the next one throws HostPowerLoss,
+// before it changes anything. A negative budget disarms it.
+struct HostPowerLoss
+{
+};
+void hostPowerLossAfter(long budget);
+// counts one write, throws if the budget ran out
+void hostPowerTick();
+
+// ESP.restart() throws this
+struct HostRestart
+{
+};
+
+// minimal checks for the test programs, a failed one ends the program with its location
+#define HOST_CHECK(cond)                                                            \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1);                                                                \
+        }                                                                           \
+    } while (0)
+#endif
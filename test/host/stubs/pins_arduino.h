@@ -0,0 +1,8 @@
+#ifndef HOST_PINS_ARDUINO_H_
+#define HOST_PINS_ARDUINO_H_
+// declared for fastpin.h, which the firmware does not call
+#include <Arduino.h>
+extern const uint32_t port_to_input_PGM[];
+extern const uint8_t digital_pin_to_port_PGM[];
+extern const uint8_t digital_pin_to_bit_mask_PGM[];
+#endif
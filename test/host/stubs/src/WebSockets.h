@@ -0,0 +1,21 @@
+#ifndef HOST_WEBSOCKETS_H_
+#define HOST_WEBSOCKETS_H_
+// Host stand-in for src/WebSockets.h, found before it because the firmware sources are built
+// from copies (see the Makefile)
+#include <Arduino.h>
+#include <functional>
+
+typedef enum {
+    WStype_ERROR,
+    WStype_DISCONNECTED,
+    WStype_CONNECTED,
+    WStype_TEXT,
+    WStype_BIN,
+    WStype_FRAGMENT_TEXT_START,
+    WStype_FRAGMENT_BIN_START,
+    WStype_FRAGMENT,
+    WStype_FRAGMENT_FIN,
+    WStype_PING,
+    WStype_PONG,
+} WStype_t;
+#endif
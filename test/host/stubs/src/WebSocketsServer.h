@@ -0,0 +1,58 @@
+#ifndef HOST_WEBSOCKETSSERVER_H_
+#define HOST_WEBSOCKETSSERVER_H_
+// Host stand-in for src/WebSocketsServer.h: no clients, what would be broadcast is counted
+#include "WebSockets.h"
+
+class WebSocketsServer
+{
+public:
+    typedef std::function<void(uint8_t num, WStype_t type, uint8_t *payload, size_t length)> WebSocketServerEvent;
+
+    WebSocketServerEvent event;
+    uint32_t broadcastBytes;
+
+    WebSocketsServer(uint16_t, String = "", String = "arduino") : broadcastBytes(0) {}
+    void begin() {}
+    void close() {}
+    void loop() {}
+    void onEvent(WebSocketServerEvent cbEvent)
+    {
+        event = cbEvent;
+    }
+    bool broadcastTXT(const uint8_t *, size_t length = 0)
+    {
+        broadcastBytes += length;
+        return true;
+    }
+    bool broadcastTXT(const char *payload, size_t length = 0)
+    {
+        return broadcastTXT(reinterpret_cast<const uint8_t *>(payload), length ? length : strlen(payload));
+    }
+    bool broadcastTXT(char *payload, size_t length = 0, bool = false)
+    {
+        return broadcastTXT(const_cast<const char *>(payload), length);
+    }
+    bool broadcastTXT(uint8_t *payload, size_t length = 0, bool = false)
+    {
+        return broadcastTXT(const_cast<const uint8_t *>(payload), length);
+    }
+    bool sendBIN(uint8_t, const uint8_t *, size_t)
+    {
+        return true;
+    }
+    bool sendBIN(uint8_t, uint8_t *, size_t, bool = false)
+    {
+        return true;
+    }
+    bool broadcastPing(uint8_t * = nullptr, size_t = 0)
+    {
+        return true;
+    }
+    void disconnect() {}
+    void disconnect(uint8_t) {}
+    int connectedClients(bool = false)
+    {
+        return 0;
+    }
+};
+#endif
@@ -0,0 +1,40 @@
+#ifndef HOST_USER_INTERFACE_H_
+#define HOST_USER_INTERFACE_H_
+#include <stdint.h>
+
+enum rst_reason {
+    REASON_DEFAULT_RST = 0,
+    REASON_WDT_RST = 1,
+    REASON_EXCEPTION_RST = 2,
+    REASON_SOFT_WDT_RST = 3,
+    REASON_SOFT_RESTART = 4,
+    REASON_DEEP_SLEEP_AWAKE = 5,
+    REASON_EXT_SYS_RST = 6
+};
+
+struct rst_info
+{
+    uint32_t reason;
+    uint32_t exccause;
+    uint32_t epc1;
+    uint32_t epc2;
+    uint32_t epc3;
+    uint32_t excvaddr;
+    uint32_t depc;
+};
+
+#define STATION_MODE 1
+#define SOFTAP_MODE 2
+#define NONE_SLEEP_T 0
+#define LIGHT_SLEEP_T 1
+#define MODEM_SLEEP_T 2
+
+inline bool wifi_set_sleep_type(int)
+{
+    return true;
+}
+inline uint32_t system_get_free_heap_size()
+{
+    return 30000;
+}
+#endif
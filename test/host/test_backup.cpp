@@ -0,0 +1,106 @@
+// backup archive round trip and the preferences migration, on the RAM backend (STORAGE_RAM)
+#include "Storage.h"
+#include "UserPrefs.h"
+#include "BackupArchive.h"
+#include "options.h"
+#include "host.h"
+#include <vector>
+
+static std::vector<uint8_t> makeArchive()
+{
+    std::vector<uint8_t> archive;
+    BackupWriter writer;
+    uint8_t buf[64];
+    size_t n;
+    while ((n = writer.fill(buf, sizeof(buf))) > 0) {
+        archive.insert(archive.end(), buf, buf + n);
+    }
+    return archive;
+}
+
+static bool restore(const std::vector<uint8_t> &archive)
+{
+    BackupReader reader;
+    reader.begin();
+    // in pieces, like the upload handler gets them
+    for (size_t i = 0; i < archive.size(); i += 50) {
+        if (!reader.feed(&archive[i], std::min<size_t>(50, archive.size() - i))) {
+            return false;
+        }
+    }
+    return reader.finish();
+}
+
+static std::vector<uint8_t> readFile(const char *name)
+{
+    File f = storage().open(name, "r");
+    std::vector<uint8_t> data(f.size());
+    f.read(data.data(), data.size());
+    return data;
+}
+
+static void writeFile(const char *name, const std::vector<uint8_t> &data)
+{
+    File f = storage().open(name, "w");
+    f.write(data.data(), data.size());
+    f.close();
+}
+
+int main()
+{
+    HOST_CHECK(storageBegin() && storageBackend() == StorageBackend::Ram);
+
+    userOptions options;
+    memset(&options, 0, sizeof(options));
+    writeFile(PREFS_LEGACY_FILE, std::vector<uint8_t>{'5', '1', 'D', '0'});
+    std::vector<uint8_t> preset(300);
+    for (size_t i = 0; i < preset.size(); i++) {
+        preset[i] = i;
+    }
+    writeFile("/preset_ntsc.B", preset);
+    writeFile("/junk", std::vector<uint8_t>(3, 1));
+    HOST_CHECK(loadUserPrefs(options) == PrefsLoad::Migrated);
+    HOST_CHECK(options.presetSlot == 'D' && options.presetPreference == 5 && options.enableFrameTimeLock == 1);
+    HOST_CHECK(!storage().exists(PREFS_LEGACY_FILE) && storage().exists(PREFS_FILE));
+
+    const std::vector<uint8_t> archive = makeArchive();
+    const std::vector<uint8_t> prefs = readFile(PREFS_FILE);
+
+    // into an empty file system
+    storage().remove("/preset_ntsc.B");
+    storage().remove(PREFS_FILE);
+    HOST_CHECK(restore(archive));
+    HOST_CHECK(readFile("/preset_ntsc.B") == preset && readFile(PREFS_FILE) == prefs);
+
+    // over existing files, nothing staged or set aside stays behind
+    writeFile("/preset_ntsc.B", std::vector<uint8_t>(10, 0xee));
+    HOST_CHECK(restore(archive));
+    HOST_CHECK(readFile("/preset_ntsc.B") == preset);
+    Dir dir = storage().openDir("/");
+    while (dir.next()) {
+        const String name = storageName(dir);
+        HOST_CHECK(!name.startsWith(BACKUP_TEMP_PREFIX) && !name.startsWith(BACKUP_ASIDE_PREFIX));
+    }
+
+    // an original set aside by a restore that stopped between its renames comes back
+    HOST_CHECK(storage().rename("/preset_ntsc.B", BACKUP_ASIDE_PREFIX "preset_ntsc.B"));
+    BackupReader::removeStaged();
+    HOST_CHECK(readFile("/preset_ntsc.B") == preset);
+    HOST_CHECK(!storage().exists(BACKUP_ASIDE_PREFIX "preset_ntsc.B"));
+
+    // a damaged archive changes nothing
+    std::vector<uint8_t> damaged = archive;
+    damaged[damaged.size() / 2] ^= 1;
+    writeFile("/preset_ntsc.B", std::vector<uint8_t>(10, 0xee));
+    HOST_CHECK(!restore(damaged));
+    HOST_CHECK(readFile("/preset_ntsc.B") == std::vector<uint8_t>(10, 0xee));
+
+    userOptions loaded;
+    memset(&loaded, 0, sizeof(loaded));
+    HOST_CHECK(loadUserPrefs(loaded) == PrefsLoad::Loaded && memcmp(&options, &loaded, sizeof(options)) == 0);
+
+    StorageBenchmark bench;
+    HOST_CHECK(storageBenchmark(storage(), 5, bench) && bench.rounds == 5 && !storage().exists(STORAGE_BENCH_FILE));
+    puts("backup: ok");
+    return 0;
+}
@@ -0,0 +1,365 @@
+// Estimators.h, and the checks built on it against the hand written loops they replaced:
+// same decisions where the samples are read the same way, and how many reads each needs
+#include "Estimators.h"
+#include "host.h"
+#include <vector>
+
+// a register that yields the next recorded value on each read
+template <class T>
+struct Source
+{
+    std::vector<T> values;
+    size_t reads;
+
+    Source(const std::vector<T> &values) : values(values), reads(0) {}
+    T read()
+    {
+        T v = values[reads % values.size()];
+        reads++;
+        return v;
+    }
+};
+
+static uint32_t rng = 1;
+static uint32_t next()
+{
+    rng = rng * 1103515245 + 12345;
+    return rng >> 16;
+}
+
+static void testWithinTolerance()
+{
+    // uint32_t: the old form wraps below the tolerance and calls 2 far from 1
+    uint32_t two = 2, one = 1;
+    HOST_CHECK(!(two > one - 3 && two < one + 3) && withinTolerance(two, one, 3));
+    // uint16_t promotes to int, the old form was right there and both agree
+    for (int a = 0; a < 40; a++) {
+        for (int b = 0; b < 40; b++) {
+            uint16_t x = a, y = b;
+            HOST_CHECK(((x > (y - 3)) && (x < (y + 3))) == withinTolerance(x, y, 2));
+            HOST_CHECK(!((x < (y - 3)) || (x > (y + 3))) == withinTolerance(x, y, 3));
+        }
+    }
+}
+
+static void testMovingAverage()
+{
+    MovingAverage<uint8_t, 4> avg;
+    HOST_CHECK(avg.value() == 0 && !avg.full());
+    HOST_CHECK(avg.add(200) == 200); // not pulled toward zero while filling
+    HOST_CHECK(avg.add(100) == 150);
+    avg.add(100);
+    HOST_CHECK(avg.add(100) == 125 && avg.full());
+    HOST_CHECK(avg.add(100) == 100); // 200 left the window
+    avg.reset();
+    HOST_CHECK(avg.add(7) == 7);
+}
+
+static void testEma()
+{
+    Ema<uint16_t, 2> ema;
+    HOST_CHECK(ema.add(400) == 400); // primed with the first sample
+    HOST_CHECK(ema.add(800) == 500); // a quarter of the step
+    for (int i = 0; i < 40; i++) {
+        ema.add(800);
+    }
+    HOST_CHECK(ema.value() == 800); // rounds to the target, does not stop one short
+    ema.reset();
+    HOST_CHECK(ema.add(3) == 3);
+}
+
+static void testMedian()
+{
+    Median<uint16_t, 3> median;
+    HOST_CHECK(median.value() == 0 && !median.full());
+    HOST_CHECK(median.add(262) == 262);
+    HOST_CHECK(median.add(0) == 262); // of two, the upper one
+    HOST_CHECK(median.add(263) == 262 && median.full());
+    HOST_CHECK(median.add(1125) == 263); // 262 left, one spike still loses
+    HOST_CHECK(median.add(1125) == 1125); // two of three win
+    median.reset();
+    HOST_CHECK(median.add(5) == 5);
+}
+
+static void testHysteresis()
+{
+    Hysteresis<uint8_t> level(10, 5);
+    HOST_CHECK(!level.add(9) && level.add(10) && level.add(6) && !level.add(5));
+    HOST_CHECK(!level.add(9) && !level.value());
+    Hysteresis<uint8_t> on(10, 5, true);
+    HOST_CHECK(on.add(6) && !on.add(0));
+}
+
+static void testStableRun()
+{
+    StableRun<uint16_t, 3, 4> run;
+    HOST_CHECK(!run.add(262) && !run.add(265) && !run.add(259));
+    HOST_CHECK(run.add(260) && run.value() == 262 && !run.broken() && run.samples() == 4);
+
+    // against the first sample, drift of 2 per read breaks the run
+    run.reset();
+    run.add(100);
+    run.add(102);
+    HOST_CHECK(!run.add(104) && run.broken() && run.value() == 104);
+
+    StableRun<uint16_t, 3, 4, true> chained;
+    chained.add(100);
+    chained.add(102);
+    chained.add(104);
+    HOST_CHECK(chained.add(106) && !chained.broken() && chained.value() == 106);
+    HOST_CHECK(!chained.add(120) && chained.broken());
+
+    StableRun<bool, false, 3> flag;
+    HOST_CHECK(!flag.add(true) && !flag.add(true) && flag.add(true) && flag.value());
+    HOST_CHECK(!flag.add(false) && flag.broken() && !flag.value());
+}
+
+static void testRunOf()
+{
+    RunOf<3> run;
+    HOST_CHECK(!run.add(true) && !run.add(true) && run.add(true) && run.done() && !run.failed());
+    HOST_CHECK(!run.add(false) && run.failed() && !run.done());
+    HOST_CHECK(!run.add(true) && !run.add(true) && !run.add(true)); // over until reset()
+    run.reset();
+    HOST_CHECK(!run.add(true) && !run.failed());
+}
+
+static void testChangeDetector()
+{
+    ChangeDetector<uint32_t, 3, 2> rate(10);
+    HOST_CHECK(!rate.add(1560) && rate.changing() && rate.value() == 10);
+    HOST_CHECK(rate.add(1561) && !rate.changing() && rate.value() == 1561);
+    HOST_CHECK(!rate.add(1563) && !rate.changing()); // jitter
+    HOST_CHECK(!rate.add(4000) && !rate.add(1560) && rate.value() == 1561); // single spur
+    HOST_CHECK(!rate.add(4000) && rate.add(4001) && rate.value() == 4001);
+}
+
+// one of the line count sequences the HD bypass check sees
+static std::vector<uint16_t> lineCounts(bool stable)
+{
+    std::vector<uint16_t> v;
+    for (int i = 0; i < 64; i++) {
+        uint16_t lines = 262 + next() % 2; // interlace
+        if (!stable && next() % 4 == 0) {
+            lines = 525 + next() % 40; // source switching
+        }
+        v.push_back(lines);
+    }
+    return v;
+}
+
+// gbs-control.ino before: the second read of a comparison is another sample
+static uint16_t oldLineCount(Source<uint16_t> &reg)
+{
+    uint16_t count = reg.read();
+    for (uint8_t i = 0; i < 3; i++) {
+        if (reg.read() < (count - 3) || reg.read() > (count + 3)) {
+            return 0;
+        }
+    }
+    return count;
+}
+
+static uint16_t newLineCount(Source<uint16_t> &reg)
+{
+    StableRun<uint16_t, 3, 4> lineCount;
+    lineCount.add(reg.read());
+    while (!lineCount.stable() && !lineCount.broken()) {
+        lineCount.add(reg.read());
+    }
+    return lineCount.stable() ? lineCount.value() : 0;
+}
+
+// getStatus16SpHsStable() readings, unstable ones spread over the run with a given chance
+static std::vector<bool> syncReads(unsigned unstablePerMille)
+{
+    std::vector<bool> v;
+    for (int i = 0; i < 64; i++) {
+        v.push_back(next() % 1000 >= unstablePerMille);
+    }
+    return v;
+}
+
+static bool oldSyncRun(Source<bool> &reg, uint8_t needed)
+{
+    for (uint8_t i = 0; i < needed; i++) {
+        if (!reg.read()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <uint8_t Needed>
+static bool newSyncRun(Source<bool> &reg)
+{
+    RunOf<Needed> run;
+    while (!run.add(reg.read()) && !run.failed()) {
+    }
+    return run.done();
+}
+
+// an RGBHV source's line count as the sync watcher reads it, now and then a glitched read
+static std::vector<uint16_t> rgbhvLines(unsigned glitchPerMille)
+{
+    std::vector<uint16_t> v;
+    for (int i = 0; i < 3; i++) {
+        v.push_back(next() % 1000 < glitchPerMille ? next() % 1200 : 806 + next() % 2);
+    }
+    return v;
+}
+
+static std::vector<uint32_t> pllRates()
+{
+    std::vector<uint32_t> v;
+    uint32_t rate = 1560;
+    for (int i = 0; i < 400; i++) {
+        unsigned r = next() % 100;
+        if (r < 3) {
+            rate = 1000 + next() % 4000; // mode change
+        }
+        v.push_back(r >= 3 && r < 8 ? 5008 : rate + next() % 3); // spur or jitter
+    }
+    return v;
+}
+
+struct Tally
+{
+    unsigned decisions;
+    unsigned positive;
+    size_t reads;
+};
+
+static void print(const char *check, const char *input, const Tally &before, const Tally &after)
+{
+    printf("  %-24s %-10s %5.1f -> %4.1f reads, %3u%% -> %3u%% accepted\n", check, input,
+           (double)before.reads / before.decisions, (double)after.reads / after.decisions,
+           100 * before.positive / before.decisions, 100 * after.positive / after.decisions);
+}
+
+static void compareLineCount(bool stable)
+{
+    Tally before = {0, 0, 0}, after = {0, 0, 0};
+    for (int i = 0; i < 2000; i++) {
+        const std::vector<uint16_t> values = lineCounts(stable);
+        Source<uint16_t> a(values), b(values);
+        before.positive += oldLineCount(a) != 0;
+        after.positive += newLineCount(b) != 0;
+        before.reads += a.reads;
+        after.reads += b.reads;
+        before.decisions++;
+        after.decisions++;
+    }
+    if (stable) {
+        HOST_CHECK(before.positive == before.decisions && after.positive == after.decisions);
+    }
+    print("hd bypass line count", stable ? "stable" : "switching", before, after);
+}
+
+template <uint8_t Needed>
+static void compareSyncRun(const char *check, unsigned unstablePerMille)
+{
+    Tally before = {0, 0, 0}, after = {0, 0, 0};
+    for (int i = 0; i < 2000; i++) {
+        const std::vector<bool> values = syncReads(unstablePerMille);
+        Source<bool> a(values), b(values);
+        const bool o = oldSyncRun(a, Needed), n = newSyncRun<Needed>(b);
+        HOST_CHECK(o == n && a.reads == b.reads);
+        before.positive += o;
+        after.positive += n;
+        before.reads += a.reads;
+        after.reads += b.reads;
+        before.decisions++;
+        after.decisions++;
+    }
+    char input[16];
+    snprintf(input, sizeof(input), "%u/1000", unstablePerMille);
+    print(check, input, before, after);
+}
+
+// the RGBHV checks compare the line count with 535 and then read it 30 times, 10 ms apart:
+// a pass that lands on the wrong side of 535 costs 300 ms
+static void compareRgbhvLines(unsigned glitchPerMille)
+{
+    Tally before = {0, 0, 0}, after = {0, 0, 0};
+    for (int i = 0; i < 20000; i++) {
+        const std::vector<uint16_t> values = rgbhvLines(glitchPerMille);
+        Source<uint16_t> a(values), b(values);
+        before.positive += a.read() <= 535;
+        Median<uint16_t, 3> lineCount;
+        for (uint8_t r = 0; r < 3; r++) {
+            lineCount.add(b.read());
+        }
+        after.positive += lineCount.value() <= 535;
+        before.reads += a.reads;
+        after.reads += b.reads;
+        before.decisions++;
+        after.decisions++;
+    }
+    HOST_CHECK(after.positive <= before.positive);
+    char input[16];
+    snprintf(input, sizeof(input), "%u/1000", glitchPerMille);
+    printf("  %-24s %-10s %5.1f -> %4.1f reads, %5.2f%% -> %5.2f%% wrong side of 535\n", "rgbhv line count", input,
+           (double)before.reads / before.decisions, (double)after.reads / after.decisions,
+           100.0 * before.positive / before.decisions, 100.0 * after.positive / after.decisions);
+}
+
+static void comparePllRate()
+{
+    const std::vector<uint32_t> values = pllRates();
+    Source<uint32_t> a(values), b(values);
+    uint32_t oldPllRate = 10;
+    ChangeDetector<uint32_t, 3, 2> pllRate(10);
+    Tally before = {0, 0, 0}, after = {0, 0, 0};
+    while (a.reads < values.size()) {
+        // runSyncWatcher before
+        uint32_t currentPllRate = a.read();
+        if (!withinTolerance(currentPllRate, oldPllRate, 3)) {
+            currentPllRate = a.read();
+            if (!withinTolerance(currentPllRate, oldPllRate, 3)) {
+                oldPllRate = currentPllRate;
+                before.positive++;
+            }
+        }
+        before.decisions++;
+        // and now
+        currentPllRate = b.read();
+        bool changed = pllRate.add(currentPllRate);
+        if (pllRate.changing()) {
+            changed = pllRate.add(b.read());
+        }
+        after.positive += changed;
+        after.decisions++;
+        HOST_CHECK(oldPllRate == pllRate.value() && a.reads == b.reads);
+    }
+    before.reads = a.reads;
+    after.reads = b.reads;
+    print("pll rate change", "spurs", before, after);
+}
+
+int main()
+{
+    testWithinTolerance();
+    testMovingAverage();
+    testEma();
+    testMedian();
+    testHysteresis();
+    testStableRun();
+    testRunOf();
+    testChangeDetector();
+
+    puts("estimators: reads per decision, old check -> Estimators.h");
+    compareLineCount(true);
+    compareLineCount(false);
+    compareSyncRun<64>("autobest htotal before", 0);
+    compareSyncRun<64>("autobest htotal before", 20);
+    compareSyncRun<16>("autobest htotal after", 20);
+    compareSyncRun<24>("autobest htotal settled", 20);
+    comparePllRate();
+    compareRgbhvLines(0);
+    compareRgbhvLines(20);
+    // coast (8), clamp (16) and RGBHV lines (up to 30) keep their loops, only the bounds moved
+    // to withinTolerance(), checked equal in testWithinTolerance()
+    puts("estimators: ok");
+    return 0;
+}
@@ -0,0 +1,203 @@
+// The OLED menu turned through like a user would with the rotary encoder: the real setup() and
+// loop() run on the virtual clock with nothing connected, each line of the script below sets
+// oledNav like the encoder interrupt does, and the frame the panel then shows (SSD1306Sim's
+// display RAM, not the frame buffer) is compared with golden/oled/<frame>.pbm. A changed frame
+// fails until the new one is reviewed and written with `make golden` (test_oled --update); the
+// actual one is left in build/oled/ to look at.
+//
+// Per line it reports what the menu drew (OLEDDisplay stand-in counts) and what went to the
+// panel: bytes on the bus through SSD1306PagedWire, against what sending every changed frame
+// whole would have cost, so rendering regressions and partial refresh gains show up in the log.
+#include <Arduino.h>
+#include "OLEDMenuManager.h"
+#include "SSD1306PagedWire.h"
+#include "SSD1306Sim.h"
+#include "slot.h"
+#include "host.h"
+#include <sys/stat.h>
+
+extern SSD1306PagedWire display;
+extern volatile OLEDMenuNav oledNav;
+bool writeSlotMeta(uint8_t index, const SlotMeta &slotMeta);
+void setup();
+void loop();
+
+#define LOOP_MICROS 100  // one loop() with nothing to do, the core's WiFi share included
+#define KEY_MILLIS 300   // between two encoder steps, and from the last one to the frame
+#define WAIT_MILLIS 1000 // a 'w' in the keys
+// what the library's whole frame display() puts on the bus: COLUMNADDR and PAGEADDR as six
+// single commands of 3 bytes, then 64 transmissions of address, control byte and 16 data bytes
+#define FULL_FRAME_BYTES (6 * 3 + 64 * 18)
+
+// saved presets, so the preset menu has a virtual list longer than its window
+static const char *const slotNames[] = {"SNES 240p", "Mega Drive", "PS1 480i", "Saturn", "N64", "Dreamcast VGA"};
+
+struct Frame
+{
+    const char *name;
+    const char *keys; // u up, d down, e press, w wait a second; each takes KEY_MILLIS
+};
+
+// the whole tree, in the order a user finds it; the reset entries are shown, not pressed
+static const Frame script[] = {
+    {"main_osd", ""},
+    {"main_resolution", "d"},
+    {"resolution_1280x960", "e"},
+    {"resolution_1280x1024", "d"},
+    {"resolution_1280x720", "d"},
+    {"resolution_1920x1080", "d"},
+    {"resolution_480_576", "d"},
+    {"resolution_downscale", "d"},
+    {"resolution_passthrough", "d"},
+    {"resolution_back", "d"},
+    {"resolution_wrapped", "d"},
+    {"resolution_loading", "dde"},
+    {"resolution_loaded", "ww"},
+    {"main_resolution_again", "uuue"},
+    {"main_presets", "d"},
+    {"presets_first", "e"},
+    {"presets_window_end", "ddd"},
+    {"presets_next_window", "d"},
+    {"presets_last", "d"},
+    {"presets_back", "d"},
+    {"presets_wrapped", "d"},
+    {"presets_from_back", "uu"},
+    {"main_presets_again", "de"},
+    {"main_wifi", "d"},
+    {"wifi_connect_to", "e"},
+    {"wifi_ssid", "d"},
+    {"wifi_ssid_scrolled", "ww"},
+    {"wifi_url", "d"},
+    {"main_wifi_again", "uuue"},
+    {"main_current", "d"},
+    {"current_no_input", "e"},
+    {"current_back", "ww"},
+    {"main_reset", "d"},
+    {"reset_gbs", "e"},
+    {"reset_factory", "d"},
+    {"reset_wifi", "d"},
+    {"main_reset_again", "de"},
+    {"main_osd_wrapped", "d"},
+    {"osd_countdown", "e"},
+    {"osd_timed_out", "wwwwwwwww"},
+};
+
+static void run(uint32_t millis)
+{
+    const uint64_t end = hostNowMicros() + millis * 1000ull;
+    while (hostNowMicros() < end) {
+        loop();
+        hostAdvanceMicros(LOOP_MICROS);
+    }
+}
+
+static void press(char key)
+{
+    switch (key) {
+        case 'u':
+            oledNav = OLEDMenuNav::UP;
+            break;
+        case 'd':
+            oledNav = OLEDMenuNav::DOWN;
+            break;
+        case 'e':
+            oledNav = OLEDMenuNav::ENTER;
+            break;
+        case 'w':
+            run(WAIT_MILLIS - KEY_MILLIS);
+            break;
+        default:
+            fprintf(stderr, "oled: unknown key %c\n", key);
+            exit(1);
+    }
+    run(KEY_MILLIS);
+}
+
+static std::string readFile(const std::string &path)
+{
+    std::string text;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return text;
+    }
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        text.append(buf, n);
+    }
+    fclose(f);
+    return text;
+}
+
+static void writeFile(const std::string &path, const std::string &text)
+{
+    FILE *f = fopen(path.c_str(), "wb");
+    HOST_CHECK(f && fwrite(text.data(), 1, text.size(), f) == text.size());
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    const bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    mkdir("build/oled", 0777);
+    setup();
+    for (uint8_t i = 0; i < sizeof(slotNames) / sizeof(slotNames[0]); i++) {
+        SlotMeta slot;
+        memset(&slot, 0, sizeof(slot));
+        snprintf(slot.name, sizeof(slot.name), "%-24s", slotNames[i]);
+        slot.slot = i;
+        HOST_CHECK(writeSlotMeta(i * 3, slot)); // with empty slots in between, the menu skips them
+    }
+    run(KEY_MILLIS);
+
+    puts("oled: per frame the pixels and glyphs drawn, display() calls that sent something and the OLED bus bytes they took,");
+    puts("oled: against sending each of those frames whole");
+    unsigned failed = 0;
+    uint64_t pixels = 0, bytes = 0, fullBytes = 0;
+    for (const Frame &frame : script) {
+        hostOledResetStats();
+        const OLEDBusStats before = display.busStats();
+        for (const char *key = frame.keys; *key; key++) {
+            press(*key);
+        }
+        if (!*frame.keys) {
+            run(KEY_MILLIS);
+        }
+        const OLEDBusStats &after = display.busStats();
+        const HostOledStats &drawn = hostOledStats();
+        const uint32_t frames = after.frames - before.frames;
+        const uint32_t sent = after.bytes - before.bytes;
+        printf("  %-24s %7u pixels %4u glyphs %3u frames %6u bus bytes (whole %6u)\n", frame.name, drawn.pixels,
+               drawn.glyphs, frames, sent, frames * FULL_FRAME_BYTES);
+        pixels += drawn.pixels;
+        bytes += sent;
+        fullBytes += frames * FULL_FRAME_BYTES;
+
+        // the panel has to end up with what the menu drew, whatever parts of it were sent
+        HOST_CHECK(memcmp(ssd1306Sim.ram, display.buffer, sizeof(ssd1306Sim.ram)) == 0);
+        const std::string path = std::string("golden/oled/") + frame.name + ".pbm";
+        const std::string actual = ssd1306Sim.pbm();
+        if (update) {
+            writeFile(path, actual);
+            continue;
+        }
+        const std::string expected = readFile(path);
+        if (expected != actual) {
+            const std::string actualPath = std::string("build/oled/") + frame.name + ".pbm";
+            writeFile(actualPath, actual);
+            fprintf(stderr, "oled: %s differs from %s, %s\n", frame.name, path.c_str(),
+                    expected.empty() ? "missing" : ("see " + actualPath).c_str());
+            failed++;
+        }
+    }
+    const unsigned frames = sizeof(script) / sizeof(script[0]);
+    if (failed) {
+        fprintf(stderr, "oled: %u of %u frames differ; if the change is intended, `make golden` and review the images\n",
+                failed, frames);
+        return 1;
+    }
+    printf("oled: %u frames %s, %llu pixels drawn, %llu bus bytes, %llu%% of sending whole frames\n", frames,
+           update ? "written to golden/oled/" : "match golden/oled/", (unsigned long long)pixels,
+           (unsigned long long)bytes, (unsigned long long)(fullBytes ? bytes * 100 / fullBytes : 0));
+    return 0;
+}
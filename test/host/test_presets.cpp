@@ -0,0 +1,257 @@
+// writeProgramArrayNew() against the TV5725 simulator: every preset header under every setting
+// it reads, compared with the register images in golden/. A changed image fails until the new
+// one is reviewed and written with `make golden` (test_presets --update).
+#include <Arduino.h>
+#include "ntsc_240p.h"
+#include "ntsc_720x480.h"
+#include "ntsc_1280x720.h"
+#include "ntsc_1280x1024.h"
+#include "ntsc_1920x1080.h"
+#include "ntsc_downscale.h"
+#include "pal_240p.h"
+#include "pal_768x576.h"
+#include "pal_1280x720.h"
+#include "pal_1280x1024.h"
+#include "pal_1920x1080.h"
+#include "pal_downscale.h"
+#include "ofw_RGBS.h"
+#include "ofw_ypbpr.h"
+#include "rgbhv.h"
+#include "options.h"
+#include "TV5725Sim.h"
+#include "host.h"
+#include <map>
+#include <vector>
+
+extern runTimeOptions *rto;
+extern userOptions *uopt;
+void writeProgramArrayNew(const uint8_t *programArray, boolean skipMDSection);
+
+struct Preset
+{
+    const char *name;
+    const uint8_t *data;
+};
+
+static const Preset presets[] = {
+    {"ntsc_240p", ntsc_240p},
+    {"ntsc_720x480", ntsc_720x480},
+    {"ntsc_1280x720", ntsc_1280x720},
+    {"ntsc_1280x1024", ntsc_1280x1024},
+    {"ntsc_1920x1080", ntsc_1920x1080},
+    {"ntsc_downscale", ntsc_downscale},
+    {"pal_240p", pal_240p},
+    {"pal_768x576", pal_768x576},
+    {"pal_1280x720", pal_1280x720},
+    {"pal_1280x1024", pal_1280x1024},
+    {"pal_1920x1080", pal_1920x1080},
+    {"pal_downscale", pal_downscale},
+    {"ofw_RGBS", ofw_RGBS},
+    {"ofw_ypbpr", ofw_ypbpr},
+    {"rgbhv", rgbhv},
+};
+
+// The settings writeProgramArrayNew() reads, one bit each in a combination number. The first
+// bit stands for the videoStandardInput classes it tells apart: 1 (PalNtscSd) against 3, and
+// 15 is cleared to 0 before anything is read, so it loads like 3 does.
+static const char *const settings[] = {
+    "sd",         // videoStandardInput 1, else 3
+    "hdmiFix",    // useHdmiSyncFix
+    "ypbpr",      // ADC_INPUT_SEL 0
+    "csync",      // syncTypeCsync
+    "medRes",     // medResLineCount 0x3c, else the default 0x33
+    "scaling",    // uopt->preferScalingRgbhv
+    "validRgbhv", // isValidForScalingRGBHV
+    "skipMd",     // skipMDSection
+};
+#define SETTINGS (sizeof(settings) / sizeof(settings[0]))
+#define COMBINATIONS (1 << SETTINGS)
+
+// what is not written keeps this, so an image also shows which registers a preset leaves alone
+static uint8_t before(uint8_t segment, uint16_t reg)
+{
+    return (segment * 53 + reg * 7) ^ 0x5a;
+}
+
+struct Image
+{
+    uint8_t regs[TV5725_SIM_SEGMENTS][256];
+    uint8_t videoStandardInput, inputIsYpBpR, outModeHdBypass;
+
+    bool operator<(const Image &o) const
+    {
+        return memcmp(this, &o, sizeof(Image)) < 0;
+    }
+};
+
+static Image load(const uint8_t *preset, unsigned combination)
+{
+    const auto set = [combination](unsigned bit) { return (combination >> bit) & 1; };
+    // segment and pointer stay, the firmware caches the segment it last selected
+    for (uint8_t s = 0; s < TV5725_SIM_SEGMENTS; s++) {
+        for (uint16_t r = s == 0 ? TV5725_SIM_STATUS_END : 0; r < 256; r++) {
+            tv5725Sim.regs[s][r] = before(s, r);
+        }
+    }
+    uint8_t &adcInputSel = tv5725Sim.reg(5, 0x02);
+    adcInputSel = (adcInputSel & 0x3f) | (set(2) ? 0x00 : 0x40);
+
+    memset(rto, 0, sizeof(*rto));
+    memset(uopt, 0, sizeof(*uopt));
+    rto->videoStandardInput = set(0) ? 1 : 3;
+    rto->useHdmiSyncFix = set(1);
+    rto->syncTypeCsync = set(3);
+    rto->medResLineCount = set(4) ? 0x3c : 0x33;
+    uopt->preferScalingRgbhv = set(5);
+    rto->isValidForScalingRGBHV = set(6);
+    writeProgramArrayNew(preset, set(7));
+
+    Image image;
+    memset(&image, 0, sizeof(image));
+    memcpy(image.regs, tv5725Sim.regs, sizeof(image.regs));
+    memset(image.regs[0], 0, TV5725_SIM_STATUS_END);
+    image.videoStandardInput = rto->videoStandardInput;
+    image.inputIsYpBpR = rto->inputIsYpBpR;
+    image.outModeHdBypass = rto->outModeHdBypass;
+    return image;
+}
+
+static void appendf(std::string &out, const char *format, ...)
+{
+    char line[160];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    out += line;
+}
+
+static void appendRto(std::string &out, const Image &image)
+{
+    appendf(out, "rto videoStandardInput %u inputIsYpBpR %u outModeHdBypass %u\n",
+            image.videoStandardInput, image.inputIsYpBpR, image.outModeHdBypass);
+}
+
+// The first image in full, the others as the registers they differ in from it, then the image
+// each combination of the settings loads.
+static std::string golden(const Preset &preset)
+{
+    std::vector<Image> images;
+    std::map<Image, unsigned> ids;
+    std::vector<unsigned> imageOf;
+    for (unsigned c = 0; c < COMBINATIONS; c++) {
+        const Image image = load(preset.data, c);
+        auto it = ids.find(image);
+        if (it == ids.end()) {
+            it = ids.insert(std::make_pair(image, (unsigned)images.size())).first;
+            images.push_back(image);
+        }
+        imageOf.push_back(it->second);
+    }
+
+    std::string out;
+    appendf(out, "# writeProgramArrayNew(%s), registers not written hold (segment * 53 + register * 7) ^ 0x5a\n", preset.name);
+    appendf(out, "image 0\n");
+    const Image &base = images[0];
+    for (uint8_t s = 0; s < TV5725_SIM_SEGMENTS; s++) {
+        for (uint16_t r = s == 0 ? TV5725_SIM_STATUS_END : 0; r < 256; r += 16) {
+            appendf(out, "s%u_%02x", s, r);
+            for (uint8_t i = 0; i < 16; i++) {
+                appendf(out, " %02x", base.regs[s][r + i]);
+            }
+            out += '\n';
+        }
+    }
+    appendRto(out, base);
+    for (size_t n = 1; n < images.size(); n++) {
+        appendf(out, "image %u\n", (unsigned)n);
+        for (uint8_t s = 0; s < TV5725_SIM_SEGMENTS; s++) {
+            for (uint16_t r = 0; r < 256; r++) {
+                if (images[n].regs[s][r] != base.regs[s][r]) {
+                    appendf(out, "s%u_%02x %02x\n", s, r, images[n].regs[s][r]);
+                }
+            }
+        }
+        appendRto(out, images[n]);
+    }
+    out += "combinations, bit 0 first:";
+    for (const char *setting : settings) {
+        appendf(out, " %s", setting);
+    }
+    out += '\n';
+    for (unsigned c = 0; c < COMBINATIONS; c += 16) {
+        appendf(out, "%3u:", c);
+        for (unsigned i = 0; i < 16; i++) {
+            appendf(out, " %u", imageOf[c + i]);
+        }
+        out += '\n';
+    }
+    return out;
+}
+
+static std::string readFile(const std::string &path)
+{
+    std::string text;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return text;
+    }
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        text.append(buf, n);
+    }
+    fclose(f);
+    return text;
+}
+
+// the first line the two differ in, for the failure message
+static std::string firstDifference(const std::string &expected, const std::string &actual)
+{
+    size_t line = 1, start = 0;
+    for (size_t i = 0; i < std::min(expected.size(), actual.size()); i++) {
+        if (expected[i] != actual[i]) {
+            break;
+        }
+        if (expected[i] == '\n') {
+            line++;
+            start = i + 1;
+        }
+    }
+    const size_t end = actual.find('\n', start);
+    return "line " + std::to_string(line) + ": " + actual.substr(start, end - start);
+}
+
+int main(int argc, char **argv)
+{
+    const bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    unsigned failed = 0, images = 0;
+    for (const Preset &preset : presets) {
+        const std::string path = std::string("golden/") + preset.name + ".txt";
+        const std::string actual = golden(preset);
+        for (size_t i = actual.find("\nimage "); i != std::string::npos; i = actual.find("\nimage ", i + 1)) {
+            images++;
+        }
+        if (update) {
+            FILE *f = fopen(path.c_str(), "wb");
+            HOST_CHECK(f && fwrite(actual.data(), 1, actual.size(), f) == actual.size());
+            fclose(f);
+            continue;
+        }
+        const std::string expected = readFile(path);
+        if (expected != actual) {
+            fprintf(stderr, "presets: %s differs from %s, %s\n", preset.name, path.c_str(),
+                    expected.empty() ? "missing" : firstDifference(expected, actual).c_str());
+            failed++;
+        }
+    }
+    if (failed) {
+        fprintf(stderr, "presets: %u of %u differ; if the change is intended, `make golden` and review the diff\n",
+                failed, (unsigned)(sizeof(presets) / sizeof(presets[0])));
+        return 1;
+    }
+    printf("presets: %u headers x %u combinations, %u distinct images %s\n",
+           (unsigned)(sizeof(presets) / sizeof(presets[0])), COMBINATIONS, images,
+           update ? "written to golden/" : "match golden/");
+    return 0;
+}
@@ -0,0 +1,607 @@
+// Source transitions replayed against the firmware: the status register sequences in replay/
+// drive the TV5725 simulator while the real setup() and loop() run on the virtual clock, so
+// runSyncWatcher(), getVideoMode(), applyPresets() and doPostPresetLoadSteps() react as they
+// would on the device. Each step of a scenario waits for the state it expects and reports the
+// time it took, the TV5725 bus transfers and the preset loads on the way. A step over its
+// budget fails, so a latency regression fails the build.
+//
+// A scenario, one event per line, times in ms since power on:
+//   <ms> rgb|component FIELD=value ...   status of the source on that input, from then on
+//   <ms> rgb|component off               nothing connected
+//   <ms> expect <name> <budget ms> <condition> ...
+//   <ms> user <command>                  a web UI command (handleType2Command), one character
+//   <ms> restart power|soft              power cycle or ESP.restart(), the next boot starts there
+//   <ms> end
+// FIELD is a TV5725 register field (RegisterTable) or one of the debug pin periods in us:
+// vsync (the IF and VS pin), spvsync (vsync the sync processor separates from composite sync,
+// taken to be vsync while SP_SOG_MODE is off) and pll (the PLL rate signal). sogmin and sogmax
+// make it a noisy sync on green source: only SOG levels (ADC_SOGCTRL) in that range separate its
+// sync, above it a quarter of the HSACT reads miss and the test bus shows no pulses, below it
+// video is sliced into sync, HLOW_LEN jumps and SOG bad is set; in range one read in 128 misses
+// HSACT. The source shows only while its input is selected with ADC_INPUT_SEL.
+// STATUS_SYNC_PROC_HTOTAL follows PLLAD_MD unless given, the PLL locks to the source.
+// A condition is <name>=, >= or <= <value>, name an rto field or SOG search count listed below,
+// a register field as the firmware would read it, or reloads: preset loads in the step so far.
+// A step starts at its time and is done once all of them hold.
+// A restart keeps the file system (boot cache, preferences, source index) and the sources as they
+// were, the TV5725 starts from its reset state either way.
+#include <Arduino.h>
+#include "options.h"
+#include "RegisterTable.h"
+#include "ModeSwitchProfile.h"
+#include "InputProbe.h"
+#include "SogSearch.h"
+#include "TV5725Sim.h"
+#include "host.h"
+#include <LittleFS.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+extern runTimeOptions *rto;
+extern char userCommand;
+void setup();
+void loop();
+
+#define LOOP_MICROS 100 // one loop() with nothing to do, the core's WiFi share included
+#define DEBUG_PIN D6
+#define COMPONENT 0
+#define RGB 1
+#define HANDOVER_BYTES (256 * 1024) // the file system from one boot to the next
+
+static const char *const scenarios[] = {
+    "240p_480i",
+    "ntsc_pal",
+    "rgbs_ypbpr",
+    "unplug_replug",
+    "rgbhv_resolution",
+    "preset_reload",
+    "power_on",
+    "sog_noisy",
+    // input detection, a source turning up on an idle board
+    "detect_rgbs",
+    "detect_ypbpr",
+    "detect_rgbhv",
+    "detect_input_change",
+    "detect_none",
+};
+
+struct FieldValue
+{
+    std::string name;
+    RegField field;
+    uint32_t value;
+};
+
+struct Input
+{
+    bool connected;
+    std::vector<FieldValue> status;
+    uint32_t vsync, spvsync, pll;
+    uint32_t sogMin, sogMax; // sogMax 0: any level works
+};
+
+struct Condition
+{
+    std::string name;
+    char op; // '=', '>' (>=) or '<' (<=)
+    uint32_t value;
+};
+
+struct Event
+{
+    uint32_t millis;
+    enum { Source, Off, Expect, User, Restart, End } type;
+    uint8_t input;
+    std::vector<FieldValue> status;
+    uint32_t vsync, spvsync, pll, sogMin, sogMax; // ~0 when not given
+    std::string name;
+    uint32_t budget;
+    std::vector<Condition> conditions;
+    unsigned line;
+};
+
+struct Step
+{
+    const Event *event;
+    bool open, done;
+    uint32_t millis, busStart, bus, reloadsStart, reloads;
+};
+
+static std::vector<Event> events;
+static size_t nextEvent;
+static std::vector<Step> steps;
+static Input inputs[2];
+static uint32_t endMillis;
+
+static uint32_t parseNumber(const std::string &text, const std::string &where)
+{
+    char *end;
+    const unsigned long v = strtoul(text.c_str(), &end, 0);
+    if (text.empty() || *end) {
+        fprintf(stderr, "%s: not a number: %s\n", where.c_str(), text.c_str());
+        exit(1);
+    }
+    return v;
+}
+
+static bool load(const char *name)
+{
+    const std::string path = std::string("replay/") + name + ".txt";
+    FILE *f = fopen(path.c_str(), "r");
+    if (!f) {
+        fprintf(stderr, "replay: %s missing\n", path.c_str());
+        return false;
+    }
+    char text[512];
+    unsigned line = 0;
+    while (fgets(text, sizeof(text), f)) {
+        line++;
+        const std::string where = path + ":" + std::to_string(line);
+        std::vector<std::string> words;
+        for (char *w = strtok(text, " \t\r\n"); w && *w != '#'; w = strtok(nullptr, " \t\r\n")) {
+            words.push_back(w);
+        }
+        if (words.empty()) {
+            continue;
+        }
+        Event e;
+        e.millis = parseNumber(words[0], where);
+        e.vsync = e.spvsync = e.pll = e.sogMin = e.sogMax = ~0u;
+        e.input = COMPONENT;
+        e.budget = 0;
+        e.line = line;
+        size_t first = 2;
+        if (words.size() > 1 && (words[1] == "rgb" || words[1] == "component")) {
+            e.input = words[1] == "rgb" ? RGB : COMPONENT;
+            if (words.size() == 3 && words[2] == "off") {
+                e.type = Event::Off;
+                first = words.size();
+            } else {
+                e.type = Event::Source;
+            }
+        } else if (words.size() > 3 && words[1] == "expect") {
+            e.type = Event::Expect;
+            e.name = words[2];
+            e.budget = parseNumber(words[3], where);
+            first = 4;
+        } else if (words.size() == 3 && words[1] == "user" && words[2].size() == 1) {
+            e.type = Event::User;
+            e.name = words[2];
+            first = words.size();
+        } else if (words.size() == 3 && words[1] == "restart" && (words[2] == "power" || words[2] == "soft")) {
+            e.type = Event::Restart;
+            e.name = words[2];
+            first = words.size();
+        } else if (words.size() == 2 && words[1] == "end") {
+            e.type = Event::End;
+            first = words.size();
+        } else {
+            fprintf(stderr, "%s: unknown event\n", where.c_str());
+            exit(1);
+        }
+        for (size_t i = first; i < words.size(); i++) {
+            const std::string &w = words[i];
+            const size_t op = w.find_first_of("=<>");
+            if (op == std::string::npos || op == 0) {
+                fprintf(stderr, "%s: expected name=value: %s\n", where.c_str(), w.c_str());
+                exit(1);
+            }
+            const std::string key = w.substr(0, op);
+            const bool twoChars = w[op] != '=';
+            const uint32_t value = parseNumber(w.substr(op + (twoChars ? 2 : 1)), where);
+            if (e.type == Event::Expect) {
+                e.conditions.push_back({key, w[op], value});
+                continue;
+            }
+            if (key == "vsync") {
+                e.vsync = value;
+            } else if (key == "spvsync") {
+                e.spvsync = value;
+            } else if (key == "pll") {
+                e.pll = value;
+            } else if (key == "sogmin") {
+                e.sogMin = value;
+            } else if (key == "sogmax") {
+                e.sogMax = value;
+            } else {
+                FieldValue fv;
+                if (!findRegField(key.c_str(), fv.field) || fv.field.segment != 0 || fv.field.byteOffset >= TV5725_SIM_STATUS_END) {
+                    fprintf(stderr, "%s: not a status field: %s\n", where.c_str(), key.c_str());
+                    exit(1);
+                }
+                fv.name = key;
+                fv.value = value;
+                e.status.push_back(fv);
+            }
+        }
+        events.push_back(e);
+    }
+    fclose(f);
+    std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.millis < b.millis; });
+    return true;
+}
+
+// a register field as the chip holds it
+static uint32_t simField(const char *name)
+{
+    RegField field;
+    HOST_CHECK(findRegField(name, field));
+    return decodeRegField(field, &tv5725Sim.regs[field.segment][field.byteOffset]);
+}
+
+static const Input *selectedInput()
+{
+    const uint32_t sel = simField("ADC_INPUT_SEL");
+    return sel < 2 && inputs[sel].connected ? &inputs[sel] : nullptr;
+}
+
+// the status registers as the chip shows them for the selected input
+static void updateStatus(TV5725Sim &sim, uint8_t segment, uint8_t r)
+{
+    if (segment != 0 || r >= TV5725_SIM_STATUS_END) {
+        return;
+    }
+    uint8_t *status = sim.regs[0];
+    uint8_t chipId[3];
+    memcpy(chipId, status + 0x0b, sizeof(chipId));
+    memset(status, 0, TV5725_SIM_STATUS_END);
+    memcpy(status + 0x0b, chipId, sizeof(chipId));
+    const Input *in = selectedInput();
+    if (!in) {
+        return;
+    }
+    RegField htotal;
+    findRegField("STATUS_SYNC_PROC_HTOTAL", htotal);
+    encodeRegField(htotal, simField("PLLAD_MD"), status + htotal.byteOffset);
+    for (const FieldValue &fv : in->status) {
+        encodeRegField(fv.field, fv.value, status + fv.field.byteOffset);
+    }
+    if (in->sogMax) {
+        // the same noise for every run of the scenario
+        static uint32_t noise = 1;
+        noise = noise * 1103515245 + 12345;
+        const uint32_t n = noise >> 16;
+        const uint32_t level = simField("ADC_SOGCTRL");
+        if (level > in->sogMax) {
+            status[0x16] &= n % 4 ? 0xff : ~0x02; // HSACT
+            status[0x2e] = status[0x2f] = 0;
+        } else if (level < in->sogMin) {
+            RegField hlow;
+            findRegField("STATUS_SYNC_PROC_HLOW_LEN", hlow);
+            encodeRegField(hlow, decodeRegField(hlow, status + hlow.byteOffset) + n % 64, status + hlow.byteOffset);
+            status[0x0f] |= 0x01; // SOG bad
+        } else if (n % 128 == 0) {
+            status[0x16] &= ~0x02;
+        }
+    }
+    // the test bus shows the sync processor only when it is selected
+    if (simField("TEST_BUS_SEL") != 0xa || simField("TEST_BUS_SP_SEL") != 0x0f) {
+        status[0x2e] = status[0x2f] = 0;
+    }
+}
+
+// what the firmware routed to the debug pin
+static uint32_t debugPinPeriod()
+{
+    const Input *in = selectedInput();
+    if (!simField("PAD_BOUT_EN")) {
+        return 0;
+    }
+    switch (simField("TEST_BUS_SEL")) {
+        case 0x0: // IF vertical period
+            return in ? in->vsync : 0;
+        case 0x2: // VDS, the output frame runs with the input or on its own
+            return in && in->vsync ? in->vsync : 16667;
+        case 0xa: { // sync processor
+            const uint32_t sp = simField("TEST_BUS_SP_SEL");
+            if (!in) {
+                return 0;
+            }
+            if (sp == 0x0f) {
+                return in->spvsync ? in->spvsync : (simField("SP_SOG_MODE") ? 0 : in->vsync);
+            }
+            return sp == 0x09 || sp == 0x6b ? in->pll : 0;
+        }
+    }
+    return 0;
+}
+
+static uint32_t busTransfers()
+{
+    return hostI2cStats(0x17).transfers;
+}
+
+// runs the events that are due, from the clock
+static void onTime(uint64_t nowMicros)
+{
+    while (nextEvent < events.size() && (uint64_t)events[nextEvent].millis * 1000 <= nowMicros) {
+        const Event &e = events[nextEvent++];
+        Input &in = inputs[e.input];
+        switch (e.type) {
+            case Event::Off:
+                in = Input();
+                break;
+            case Event::Source:
+                in.connected = true;
+                for (const FieldValue &fv : e.status) {
+                    auto it = std::find_if(in.status.begin(), in.status.end(), [&](const FieldValue &o) { return o.name == fv.name; });
+                    if (it != in.status.end()) {
+                        it->value = fv.value;
+                    } else {
+                        in.status.push_back(fv);
+                    }
+                }
+                in.vsync = e.vsync != ~0u ? e.vsync : in.vsync;
+                in.spvsync = e.spvsync != ~0u ? e.spvsync : in.spvsync;
+                in.pll = e.pll != ~0u ? e.pll : in.pll;
+                in.sogMin = e.sogMin != ~0u ? e.sogMin : in.sogMin;
+                in.sogMax = e.sogMax != ~0u ? e.sogMax : in.sogMax;
+                break;
+            case Event::Expect:
+                for (Step &s : steps) {
+                    if (s.event == &e) {
+                        s.open = true;
+                        s.busStart = busTransfers();
+                        s.reloadsStart = modeSwitchCount();
+                    }
+                }
+                break;
+            case Event::User:
+                userCommand = e.name[0]; // taken by the next loop()
+                break;
+            case Event::Restart:
+            case Event::End:
+                endMillis = e.millis;
+                break;
+        }
+    }
+}
+
+static uint32_t valueOf(const std::string &name, const Step &step)
+{
+    if (name == "reloads") {
+        return modeSwitchCount() - step.reloadsStart;
+    }
+    static const struct
+    {
+        const char *name;
+        uint32_t (*get)();
+    } fields[] = {
+        {"videoStandardInput", [] { return (uint32_t)rto->videoStandardInput; }},
+        {"sourceDisconnected", [] { return (uint32_t)rto->sourceDisconnected; }},
+        {"inputIsYpBpR", [] { return (uint32_t)rto->inputIsYpBpR; }},
+        {"syncTypeCsync", [] { return (uint32_t)rto->syncTypeCsync; }},
+        {"isInLowPowerMode", [] { return (uint32_t)rto->isInLowPowerMode; }},
+        {"motionAdaptiveDeinterlaceActive", [] { return (uint32_t)rto->motionAdaptiveDeinterlaceActive; }},
+        {"HPLLState", [] { return (uint32_t)rto->HPLLState; }},
+        {"continousStableCounter", [] { return (uint32_t)rto->continousStableCounter; }},
+        {"noSyncCounter", [] { return (uint32_t)rto->noSyncCounter; }},
+        {"applyPresetDoneStage", [] { return (uint32_t)rto->applyPresetDoneStage; }},
+        {"isValidForScalingRGBHV", [] { return (uint32_t)rto->isValidForScalingRGBHV; }},
+        {"presetID", [] { return (uint32_t)rto->presetID; }},
+        // the last SOG level search
+        {"sogProbes", [] { return (uint32_t)sogSearchStats().lastProbes; }},
+        {"sogMillis", [] { return sogSearchStats().lastMillis; }},
+    };
+    for (const auto &f : fields) {
+        if (name == f.name) {
+            return f.get();
+        }
+    }
+    RegField field;
+    if (findRegField(name.c_str(), field)) {
+        return decodeRegField(field, &tv5725Sim.regs[field.segment][field.byteOffset]);
+    }
+    fprintf(stderr, "replay: line %u: unknown condition %s\n", step.event->line, name.c_str());
+    exit(1);
+}
+
+static bool met(const Step &step)
+{
+    for (const Condition &c : step.event->conditions) {
+        const uint32_t v = valueOf(c.name, step);
+        if ((c.op == '=' && v != c.value) || (c.op == '>' && v < c.value) || (c.op == '<' && v > c.value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// one boot, from power on to its restart or the end of the scenario
+static int runBoot(const char *name)
+{
+    steps.clear();
+    for (const Event &e : events) {
+        if (e.type == Event::Expect) {
+            steps.push_back({&e, false, false, 0, 0, 0, 0, 0});
+        }
+    }
+    nextEvent = 0;
+    endMillis = ~0u;
+    tv5725Sim.beforeRead = updateStatus;
+    hostPinSignal(DEBUG_PIN, debugPinPeriod);
+    hostSetTimeHook(onTime);
+    onTime(0);
+
+    setup();
+    while (millis() < endMillis) {
+        loop();
+        hostAdvanceMicros(LOOP_MICROS);
+        for (Step &s : steps) {
+            if (s.open && !s.done && met(s)) {
+                s.done = true;
+                s.millis = millis() - s.event->millis;
+                s.bus = busTransfers() - s.busStart;
+                s.reloads = modeSwitchCount() - s.reloadsStart;
+            }
+        }
+    }
+
+    int failed = 0;
+    for (const Step &s : steps) {
+        if (!s.done) {
+            printf("  %-12s not reached in %u ms\n", s.event->name.c_str(), endMillis - s.event->millis);
+            failed = 1;
+            continue;
+        }
+        const bool late = s.millis > s.event->budget;
+        printf("  %-12s %5u ms %6u bus transfers %2u reloads%s\n", s.event->name.c_str(), s.millis, s.bus,
+               s.reloads, late ? "  over budget" : "");
+        if (late) {
+            fprintf(stderr, "replay: %s %s took %u ms, budget %u\n", name, s.event->name.c_str(), s.millis, s.event->budget);
+            failed = 1;
+        }
+    }
+    // the probe's own count, it starts at the first pass that came up empty
+    const InputProbeStats &probe = inputProbeStats();
+    printf("  input probe  %u passes", probe.passes);
+    for (uint8_t input = 0; input < 2; input++) {
+        if (probe.found[input]) {
+            printf(", %s found %ux, last %u ms after the first empty pass", input == RGB ? "rgb" : "component",
+                   probe.found[input], probe.lastMillis[input]);
+        }
+    }
+    putchar('\n');
+    const SogSearchStats &sog = sogSearchStats();
+    if (sog.searches) {
+        printf("  sog search   %u searches %u probes, last level %u in %u probes %u ms, worst %u ms\n", sog.searches,
+               sog.probes, sog.lastLevel, sog.lastProbes, sog.lastMillis, sog.worstMillis);
+    }
+    return failed;
+}
+
+// the files as <u16 path length> <path> <u32 size> <data>, a zero name length ends them
+static void saveFiles(uint8_t *out)
+{
+    uint8_t *const end = out + HANDOVER_BYTES - 2;
+    Dir dir = LittleFS.openDir("/");
+    while (dir.next()) {
+        const String name = dir.fileName();
+        File f = dir.openFile("r");
+        const uint32_t size = f.size();
+        HOST_CHECK(out + 6 + name.length() + size <= end);
+        out[0] = name.length();
+        out[1] = name.length() >> 8;
+        memcpy(out + 2, name.c_str(), name.length());
+        out += 2 + name.length();
+        memcpy(out, &size, 4);
+        HOST_CHECK(f.read(out + 4, size) == size);
+        out += 4 + size;
+        f.close();
+    }
+    out[0] = out[1] = 0;
+}
+
+static void restoreFiles(const uint8_t *in)
+{
+    hostPartitionFormat(HostPartition::Little);
+    HOST_CHECK(LittleFS.begin());
+    for (;;) {
+        const uint16_t nameLength = in[0] | (in[1] << 8);
+        if (!nameLength) {
+            break;
+        }
+        const std::string name((const char *)in + 2, nameLength);
+        in += 2 + nameLength;
+        uint32_t size;
+        memcpy(&size, in, 4);
+        File f = LittleFS.open(name.c_str(), "w");
+        HOST_CHECK(f && f.write(in + 4, size) == size);
+        f.close();
+        in += 4 + size;
+    }
+    LittleFS.end();
+    hostPartitionUnmount();
+}
+
+// One scenario from power on, in its own process: the firmware keeps its state in statics. Each
+// boot but the last runs in a child, this process has not started the firmware when the child
+// hands the file system back at the restart.
+static int run(const char *name, bool log)
+{
+    if (!load(name)) {
+        return 1;
+    }
+    const std::vector<Event> scenario = events;
+    uint8_t *handover = (uint8_t *)mmap(nullptr, HANDOVER_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    HOST_CHECK(handover != MAP_FAILED);
+    printf("replay: %s\n", name);
+    int failed = 0;
+    size_t first = 0;
+    uint32_t bootStart = 0;
+    for (;;) {
+        // the events of this boot timed from its start, the sources it finds at the start on top
+        events.clear();
+        size_t restart = scenario.size();
+        for (size_t i = 0; i < scenario.size() && restart == scenario.size(); i++) {
+            Event e = scenario[i];
+            if (i < first && e.type != Event::Source && e.type != Event::Off) {
+                continue;
+            }
+            e.millis = i < first ? 0 : e.millis - bootStart;
+            events.push_back(e);
+            if (i >= first && e.type == Event::Restart) {
+                restart = i;
+            }
+        }
+        if (restart == scenario.size()) {
+            failed |= runBoot(name);
+            break;
+        }
+        fflush(stdout);
+        const pid_t pid = fork();
+        if (pid == 0) {
+            const int status = runBoot(name);
+            if (status || log) {
+                fprintf(stderr, "%s\n", hostSerialOutput().c_str());
+            }
+            saveFiles(handover);
+            fflush(stdout);
+            _exit(status);
+        }
+        int status = 1;
+        waitpid(pid, &status, 0);
+        failed |= !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+        restoreFiles(handover);
+        ESP.resetInfo.reason = scenario[restart].name == "power" ? REASON_DEFAULT_RST : REASON_SOFT_RESTART;
+        printf("  %s restart at %u ms\n", scenario[restart].name == "power" ? "power on" : "soft", scenario[restart].millis);
+        first = restart + 1;
+        bootStart = scenario[restart].millis;
+    }
+    if (failed || log) {
+        fprintf(stderr, "%s\n", hostSerialOutput().c_str());
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) {
+        return run(argv[1], true); // one scenario, with the firmware's serial log
+    }
+    puts("replay: per step the time from its event to the state it expects, TV5725 bus transfers and preset loads");
+    // the output of each run goes out before the next one starts
+    fflush(stdout);
+    unsigned failed = 0;
+    for (const char *name : scenarios) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            const int status = run(name, false);
+            fflush(stdout);
+            _exit(status);
+        }
+        int status = 1;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed++;
+        }
+    }
+    if (failed) {
+        fprintf(stderr, "replay: %u of %u scenarios failed\n", failed, (unsigned)(sizeof(scenarios) / sizeof(scenarios[0])));
+        return 1;
+    }
+    puts("replay: ok");
+    return 0;
+}
@@ -0,0 +1,140 @@
+// SPIFFS to LittleFS conversion of storageBegin(), with a power loss at every write it makes
+#include "Storage.h"
+#include <LittleFS.h>
+#include <flash_hal.h>
+#include <flash_utils.h>
+#include "host.h"
+#include <map>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> Files;
+
+// slots, preferences and a preset per slot: far more than the heap could hold at once
+static Files sampleFiles()
+{
+    Files files;
+    files["/preferences.bin"] = std::vector<uint8_t>(69, 0x11);
+    files["/slots.bin"] = std::vector<uint8_t>(2000, 0x22);
+    files["/empty"] = std::vector<uint8_t>();
+    for (char slot = 'A'; slot <= 'Z'; slot++) {
+        std::vector<uint8_t> data(1300);
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = i * 7 + slot;
+        }
+        files[std::string("/preset_ntsc.") + slot] = data;
+        files[std::string("/preset_pal.") + slot] = data;
+    }
+    return files;
+}
+
+static void writeFiles(fs::FS &fs, const Files &files)
+{
+    for (Files::const_iterator it = files.begin(); it != files.end(); ++it) {
+        File f = fs.open(it->first.c_str(), "w");
+        HOST_CHECK(f);
+        HOST_CHECK(f.write(it->second.data(), it->second.size()) == it->second.size());
+        f.close();
+    }
+}
+
+static Files readFiles(fs::FS &fs)
+{
+    Files files;
+    Dir dir = fs.openDir("/");
+    while (dir.next()) {
+        File f = dir.openFile("r");
+        std::vector<uint8_t> data(f.size());
+        HOST_CHECK(f.read(data.data(), data.size()) == data.size());
+        files[storageName(dir).c_str()] = data;
+    }
+    return files;
+}
+
+static bool stashHeaderErased()
+{
+    const uint8_t *header = hostFlash() + FS_PHYS_ADDR - FLASH_SECTOR_SIZE;
+    for (size_t i = 0; i < FLASH_SECTOR_SIZE; i++) {
+        if (header[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// a device that still has its SPIFFS image, just powered on
+static void spiffsDevice(const Files &files)
+{
+    hostPowerLossAfter(-1);
+    hostFlashErase();
+    hostPartitionFormat(HostPartition::Spiffs);
+    hostPartitionUnmount();
+    SPIFFS.begin();
+    writeFiles(SPIFFS, files);
+    SPIFFS.end();
+}
+
+static void testConversion()
+{
+    const Files files = sampleFiles();
+    spiffsDevice(files);
+    HOST_CHECK(storageBegin());
+    HOST_CHECK(storageBackend() == StorageBackend::Little);
+    HOST_CHECK(hostPartition() == HostPartition::Little);
+    HOST_CHECK(readFiles(storage()) == files);
+    HOST_CHECK(stashHeaderErased());
+
+    // the next boot just mounts it
+    hostPartitionUnmount();
+    HOST_CHECK(storageBegin() && storageBackend() == StorageBackend::Little);
+    HOST_CHECK(readFiles(storage()) == files);
+}
+
+static void testPowerLoss()
+{
+    const Files files = sampleFiles();
+    long budget = 0;
+    for (;; budget++) {
+        spiffsDevice(files);
+        hostPowerLossAfter(budget);
+        bool lost = false;
+        try {
+            storageBegin();
+        } catch (const HostPowerLoss &) {
+            lost = true;
+        }
+        hostPowerLossAfter(-1);
+        hostPartitionUnmount();
+        HOST_CHECK(storageBegin());
+        HOST_CHECK(storageBackend() == StorageBackend::Little);
+        if (readFiles(storage()) != files) {
+            fprintf(stderr, "files lost with a power loss after %ld writes\n", budget);
+            HOST_CHECK(false);
+        }
+        HOST_CHECK(stashHeaderErased());
+        if (!lost) {
+            break;
+        }
+    }
+    printf("storage: conversion survives a power loss at each of its %ld writes\n", budget);
+}
+
+static void testNoRoom()
+{
+    const Files files = sampleFiles();
+    spiffsDevice(files);
+    const uint32_t sketchSize = ESP.sketchSize;
+    ESP.sketchSize = FS_PHYS_ADDR - 8 * FLASH_SECTOR_SIZE;
+    HOST_CHECK(storageBegin());
+    HOST_CHECK(storageBackend() == StorageBackend::Spiffs);
+    HOST_CHECK(readFiles(storage()) == files);
+    ESP.sketchSize = sketchSize;
+}
+
+int main()
+{
+    testConversion();
+    testPowerLoss();
+    testNoRoom();
+    puts("storage: ok");
+    return 0;
+}
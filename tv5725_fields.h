@@ -0,0 +1,2048 @@
+// generated by generate_register_table.py from tv5725.h, do not edit
+#ifndef TV5725_FIELDS_H_
+#define TV5725_FIELDS_H_
+
+#define TV5725_FIELD_COUNT 677
+
+static const char tv5725FieldNames[] PROGMEM =
+    "ADC_5_00\0"
+    "ADC_5_03\0"
+    "ADC_AUTO_OFST_DELAY\0"
+    "ADC_AUTO_OFST_EN\0"
+    "ADC_AUTO_OFST_PRD\0"
+    "ADC_AUTO_OFST_RANGE_REG\0"
+    "ADC_AUTO_OFST_STEP\0"
+    "ADC_AUTO_OFST_TEST\0"
+    "ADC_BGCTRL\0"
+    "ADC_BOFCTRL\0"
+    "ADC_CLK_ICLK1X\0"
+    "ADC_CLK_ICLK2X\0"
+    "ADC_CLK_PA\0"
+    "ADC_FLTR\0"
+    "ADC_GGCTRL\0"
+    "ADC_GOFCTRL\0"
+    "ADC_INPUT_SEL\0"
+    "ADC_POWDZ\0"
+    "ADC_RGCTRL\0"
+    "ADC_ROFCTRL\0"
+    "ADC_RYSEL_B\0"
+    "ADC_RYSEL_G\0"
+    "ADC_RYSEL_R\0"
+    "ADC_SOGCTRL\0"
+    "ADC_SOGEN\0"
+    "ADC_TA_05_CTRL\0"
+    "ADC_TA_05_EN\0"
+    "ADC_TEST_04\0"
+    "ADC_TEST_0C\0"
+    "ADC_TEST_0C_BIT1\0"
+    "ADC_TEST_0C_BIT3\0"
+    "ADC_TEST_0C_BIT4\0"
+    "ADC_TR_ISEL\0"
+    "ADC_TR_RSEL\0"
+    "ADC_TR_RSEL_04_BIT1\0"
+    "ADC_UNUSED_60\0"
+    "ADC_UNUSED_61\0"
+    "ADC_UNUSED_62\0"
+    "ADC_UNUSED_64\0"
+    "ADC_UNUSED_65\0"
+    "ADC_UNUSED_66\0"
+    "ADC_UNUSED_67\0"
+    "ADC_UNUSED_69\0"
+    "CAPTURE_ENABLE\0"
+    "CAP_FF_HALF_REQ\0"
+    "CAP_REQ_FREEZ\0"
+    "CAP_REQ_OVER\0"
+    "CAP_SAFE_GUARD_A\0"
+    "CAP_SAFE_GUARD_B\0"
+    "CAP_SAFE_GUARD_EN\0"
+    "CAP_STATUS_SEL\0"
+    "CHIP_ID_FOUNDRY\0"
+    "CHIP_ID_PRODUCT\0"
+    "CHIP_ID_REVISION\0"
+    "DAC_RGBS_ADC2DAC\0"
+    "DAC_RGBS_B0ENZ\0"
+    "DAC_RGBS_BYPS2DAC\0"
+    "DAC_RGBS_G0ENZ\0"
+    "DAC_RGBS_PWDNZ\0"
+    "DAC_RGBS_R0ENZ\0"
+    "DAC_RGBS_S0ENZ\0"
+    "DAC_RGBS_S1EN\0"
+    "DAC_RGBS_SPD\0"
+    "DEC1_BYPS\0"
+    "DEC2_BYPS\0"
+    "DEC_5_1F\0"
+    "DEC_IDREG_EN\0"
+    "DEC_MATRIX_BYPS\0"
+    "DEC_TEST_ENABLE\0"
+    "DEC_TEST_SEL\0"
+    "DEC_WEN_MODE\0"
+    "DEINT_00\0"
+    "DIAG_BOB_PLDY_RAM_BYPS\0"
+    "GBS_OPTION_PALFORCED60_ENABLED\0"
+    "GBS_OPTION_SCALING_RGBHV\0"
+    "GBS_OPTION_SCANLINES_ENABLED\0"
+    "GBS_PRESET_CUSTOM\0"
+    "GBS_PRESET_DISPLAY_CLOCK\0"
+    "GBS_PRESET_ID\0"
+    "GBS_RUNTIME_FTL_ADJUSTED\0"
+    "GBS_RUNTIME_UNUSED_BIT\0"
+    "GPIO_CONTROL_00\0"
+    "GPIO_CONTROL_01\0"
+    "HD_BLK_BU_DATA\0"
+    "HD_BLK_GY_DATA\0"
+    "HD_BLK_RV_DATA\0"
+    "HD_DYN_BYPS\0"
+    "HD_HB_SP\0"
+    "HD_HB_ST\0"
+    "HD_HSYNC_RST\0"
+    "HD_HS_SP\0"
+    "HD_HS_ST\0"
+    "HD_INI_ST\0"
+    "HD_MATRIX_BYPS\0"
+    "HD_SEL_BLK_IN\0"
+    "HD_U_OFFSET\0"
+    "HD_VB_SP\0"
+    "HD_VB_ST\0"
+    "HD_VS_SP\0"
+    "HD_VS_ST\0"
+    "HD_V_OFFSET\0"
+    "HD_Y_OFFSET\0"
+    "HPERIOD_IF\0"
+    "IF_AUTO_OFST_EN\0"
+    "IF_AUTO_OFST_PRD\0"
+    "IF_AUTO_OFST_U_RANGE\0"
+    "IF_AUTO_OFST_V_RANGE\0"
+    "IF_HBIN_SP\0"
+    "IF_HBIN_ST\0"
+    "IF_HB_SP\0"
+    "IF_HB_SP1\0"
+    "IF_HB_SP2\0"
+    "IF_HB_ST\0"
+    "IF_HB_ST2\0"
+    "IF_HSYNC_RST\0"
+    "IF_HS_DEC_FACTOR\0"
+    "IF_HS_FLIP\0"
+    "IF_HS_INT_LPF_BYPS\0"
+    "IF_HS_PSHIFT_BYPS\0"
+    "IF_HS_SEL_LPF\0"
+    "IF_HS_TAP11_BYPS\0"
+    "IF_HS_Y_PDELAY\0"
+    "IF_INI_ST\0"
+    "IF_IN_DREG_BYPS\0"
+    "IF_LD_RAM_BYPS\0"
+    "IF_LD_SEL_PROV\0"
+    "IF_LD_ST\0"
+    "IF_LD_WRST_SEL\0"
+    "IF_LINE_SP\0"
+    "IF_LINE_ST\0"
+    "IF_MATRIX_BYPS\0"
+    "IF_PRGRSV_CNTRL\0"
+    "IF_SEL16BIT\0"
+    "IF_SEL24BIT\0"
+    "IF_SEL_656\0"
+    "IF_SEL_ADC_SYNC\0"
+    "IF_SEL_HSCALE\0"
+    "IF_SEL_WEN\0"
+    "IF_TEST_EN\0"
+    "IF_TEST_SEL\0"
+    "IF_UV_REVERT\0"
+    "IF_VB_SP\0"
+    "IF_VB_ST\0"
+    "IF_VS_FLIP\0"
+    "IF_VS_SEL\0"
+    "INPUT_FORMATTER_02\0"
+    "INTERRUPT_CONTROL_00\0"
+    "INTERRUPT_CONTROL_01\0"
+    "INT_CONTROL_RST_NOHSYNC\0"
+    "INT_CONTROL_RST_SOGBAD\0"
+    "INT_CONTROL_RST_SOGSWITCH\0"
+    "MADPT_BIT_STILL_EN\0"
+    "MADPT_CMP_EN\0"
+    "MADPT_DD0_SEL\0"
+    "MADPT_EN_NOUT_FOR_LESS_STILL\0"
+    "MADPT_EN_NOUT_FOR_STILL\0"
+    "MADPT_EN_STILL_FOR_NRD\0"
+    "MADPT_EN_UV_DEINT\0"
+    "MADPT_HTAP_BYPS\0"
+    "MADPT_MI_1BIT_BYPS\0"
+    "MADPT_MI_1BIT_DLY\0"
+    "MADPT_MI_1BIT_FRAME2_EN\0"
+    "MADPT_MO_ADP_UV_EN\0"
+    "MADPT_NRD_VIIR_PD_BYPS\0"
+    "MADPT_PD_RAM_BYPS\0"
+    "MADPT_SEL_PHASE_INI\0"
+    "MADPT_STILL_NOISE_EST_EN\0"
+    "MADPT_UVDLY_PD_BYPS\0"
+    "MADPT_UVDLY_PD_SP\0"
+    "MADPT_UVDLY_PD_ST\0"
+    "MADPT_UV_DELAY\0"
+    "MADPT_UV_MI_DET_BYPS\0"
+    "MADPT_UV_MI_OFFSET\0"
+    "MADPT_UV_VSCALE_BYPS\0"
+    "MADPT_VIIR_BYPS\0"
+    "MADPT_VIIR_COEF\0"
+    "MADPT_VSCALE_DEC_FACTOR\0"
+    "MADPT_VTAP2_BYPS\0"
+    "MADPT_VTAP2_COEFF\0"
+    "MADPT_VTAP2_ROUND_SEL\0"
+    "MADPT_VT_FILTER_CNTRL\0"
+    "MADPT_Y_DELAY\0"
+    "MADPT_Y_DELAY_UV_DELAY\0"
+    "MADPT_Y_MI_DET_BYPS\0"
+    "MADPT_Y_MI_OFFSET\0"
+    "MADPT_Y_VSCALE_BYPS\0"
+    "MAPDT_VT_SEL_PRGV\0"
+    "MD_HD1250P_CNTRL\0"
+    "MD_HPERIOD_LOCK_VALUE\0"
+    "MD_HPERIOD_UNLOCK_VALUE\0"
+    "MD_HS_FLIP\0"
+    "MD_SEL_VGA60\0"
+    "MD_SVGA_60HZ_CNTRL\0"
+    "MD_SVGA_75HZ_CNTRL\0"
+    "MD_SVGA_85HZ_CNTRL\0"
+    "MD_SXGA_60HZ_CNTRL\0"
+    "MD_SXGA_75HZ_CNTRL\0"
+    "MD_SXGA_85HZ_CNTRL\0"
+    "MD_VGA_75HZ_CNTRL\0"
+    "MD_VGA_85HZ_CNTRL\0"
+    "MD_VGA_CNTRL\0"
+    "MD_VPERIOD_LOCK_VALUE\0"
+    "MD_VPERIOD_UNLOCK_VALUE\0"
+    "MD_VS_FLIP\0"
+    "MD_XGA_60HZ_CNTRL\0"
+    "MD_XGA_70HZ_CNTRL\0"
+    "MD_XGA_75HZ_CNTRL\0"
+    "MD_XGA_85HZ_CNTRL\0"
+    "MEM_ADR_DLY_REG\0"
+    "MEM_CLK_DLYCELL_SEL\0"
+    "MEM_CLK_DLY_REG\0"
+    "MEM_FBK_CLK_DLYCELL_SEL\0"
+    "MEM_FBK_CLK_INVERT\0"
+    "MEM_FF_TOP_FF_SEL\0"
+    "MEM_INTER_DLYCELL_SEL\0"
+    "MEM_PAD_CLK_INVERT\0"
+    "MEM_RD_DATA_CLK_INVERT\0"
+    "MEM_REQ_PBH_RFFH\0"
+    "OSD_BAR_FOREGROUND_VALUE\0"
+    "OSD_BAR_LENGTH\0"
+    "OSD_COMMAND_FINISH\0"
+    "OSD_DISP_EN\0"
+    "OSD_HORIZONTAL_ZOOM\0"
+    "OSD_INT_NG_LAT\0"
+    "OSD_MENU_BAR_BORD_COR\0"
+    "OSD_MENU_BAR_FONT_BGCOR\0"
+    "OSD_MENU_BAR_FONT_FORCOR\0"
+    "OSD_MENU_DISP_STYLE\0"
+    "OSD_MENU_EN\0"
+    "OSD_MENU_HORI_START\0"
+    "OSD_MENU_ICON_SEL\0"
+    "OSD_MENU_MOD_SEL\0"
+    "OSD_MENU_SEL_BGCOR\0"
+    "OSD_MENU_SEL_FORCOR\0"
+    "OSD_MENU_VER_START\0"
+    "OSD_SW_RESET\0"
+    "OSD_TEST_SEL\0"
+    "OSD_VERTICAL_ZOOM\0"
+    "OSD_YCBCR_RGB_FORMAT\0"
+    "OUT_SYNC_CNTRL\0"
+    "OUT_SYNC_SEL\0"
+    "PAD_BOUT_EN\0"
+    "PAD_CKIN_ENZ\0"
+    "PAD_CKOUT_ENZ\0"
+    "PAD_CONTROL_00_0x48\0"
+    "PAD_CONTROL_01_0x49\0"
+    "PAD_OSC_CNTRL\0"
+    "PAD_SYNC1_IN_ENZ\0"
+    "PAD_SYNC2_IN_ENZ\0"
+    "PAD_SYNC_OUT_ENZ\0"
+    "PAD_TRI_ENZ\0"
+    "PA_ADC_BYPSZ\0"
+    "PA_ADC_LAT\0"
+    "PA_ADC_LOCKOFF\0"
+    "PA_ADC_S\0"
+    "PA_SP_BYPSZ\0"
+    "PA_SP_LAT\0"
+    "PA_SP_LOCKOFF\0"
+    "PA_SP_S\0"
+    "PB_BYPASS\0"
+    "PB_CAP_OFFSET\0"
+    "PB_CUT_REFRESH\0"
+    "PB_DB_BUFFER_EN\0"
+    "PB_ENABLE\0"
+    "PB_FETCH_NUM\0"
+    "PB_GENERAL_FLAG_REG\0"
+    "PB_MAST_FLAG_REG\0"
+    "PB_REQ_SEL\0"
+    "PIP_CONVT_BYPS\0"
+    "PIP_DREG_BYPS\0"
+    "PIP_DYN_BYPS\0"
+    "PIP_EN\0"
+    "PIP_H_SP\0"
+    "PIP_H_ST\0"
+    "PIP_SUB_16B_SEL\0"
+    "PIP_TAP3_BYPS\0"
+    "PIP_UV_FLIP\0"
+    "PIP_U_DELAY\0"
+    "PIP_U_GAIN\0"
+    "PIP_U_OFST\0"
+    "PIP_V_DELAY\0"
+    "PIP_V_GAIN\0"
+    "PIP_V_OFST\0"
+    "PIP_V_SP\0"
+    "PIP_V_ST\0"
+    "PIP_Y_DELAY\0"
+    "PIP_Y_GAIN\0"
+    "PIP_Y_OFST\0"
+    "PLL648_CONTROL_01\0"
+    "PLL648_CONTROL_03\0"
+    "PLLAD_5_16\0"
+    "PLLAD_BPS\0"
+    "PLLAD_CKOS\0"
+    "PLLAD_CONTROL_00_5x11\0"
+    "PLLAD_FS\0"
+    "PLLAD_ICP\0"
+    "PLLAD_KS\0"
+    "PLLAD_LAT\0"
+    "PLLAD_LEN\0"
+    "PLLAD_MD\0"
+    "PLLAD_PDZ\0"
+    "PLLAD_R\0"
+    "PLLAD_S\0"
+    "PLLAD_TEST\0"
+    "PLLAD_TS\0"
+    "PLLAD_VCORST\0"
+    "PLL_ADS\0"
+    "PLL_CKIS\0"
+    "PLL_DIVBY2Z\0"
+    "PLL_IS\0"
+    "PLL_LEN\0"
+    "PLL_MS\0"
+    "PLL_R\0"
+    "PLL_S\0"
+    "PLL_VCORST\0"
+    "RESET_CONTROL_0x46\0"
+    "RESET_CONTROL_0x47\0"
+    "RFF_ADR_ADD_2\0"
+    "RFF_ENABLE\0"
+    "RFF_FETCH_NUM\0"
+    "RFF_LINE_FLIP\0"
+    "RFF_LREQ_CUT\0"
+    "RFF_MASTER_FLAG\0"
+    "RFF_REQ_SEL\0"
+    "RFF_WFF_OFFSET\0"
+    "RFF_WFF_STA_ADDR_A\0"
+    "RFF_WFF_STA_ADDR_B\0"
+    "RFF_YUV_DEINTERLACE\0"
+    "SDRAM_RESET_CONTROL\0"
+    "SDRAM_RESET_SIGNAL\0"
+    "SDRAM_START_INITIAL_CYCLE\0"
+    "SFTRST_DEC_RSTZ\0"
+    "SFTRST_DEINT_RSTZ\0"
+    "SFTRST_FIFO_RSTZ\0"
+    "SFTRST_HDBYPS_RSTZ\0"
+    "SFTRST_IF_RSTZ\0"
+    "SFTRST_INT_RSTZ\0"
+    "SFTRST_MEM_FF_RSTZ\0"
+    "SFTRST_MODE_RSTZ\0"
+    "SFTRST_SYNC_RSTZ\0"
+    "SFTRST_VDS_RSTZ\0"
+    "SP_5_56\0"
+    "SP_5_57\0"
+    "SP_CLAMP_INV_REG\0"
+    "SP_CLAMP_MANUAL\0"
+    "SP_CLP_SRC_SEL\0"
+    "SP_COAST_INV_REG\0"
+    "SP_CS_0x3E\0"
+    "SP_CS_CLP_SP\0"
+    "SP_CS_CLP_ST\0"
+    "SP_CS_HS_SP\0"
+    "SP_CS_HS_ST\0"
+    "SP_CS_P_SWAP\0"
+    "SP_DIS_SUB_COAST\0"
+    "SP_DLT_REG\0"
+    "SP_EXT_SYNC_SEL\0"
+    "SP_HCST_AUTO_EN\0"
+    "SP_HD_MODE\0"
+    "SP_HS2PLL_INV_REG\0"
+    "SP_HS_LOOP_SEL\0"
+    "SP_HS_POL_ATO\0"
+    "SP_HS_PROC_INV_REG\0"
+    "SP_HS_REG\0"
+    "SP_H_COAST\0"
+    "SP_H_CST_SP\0"
+    "SP_H_CST_ST\0"
+    "SP_H_PROTECT\0"
+    "SP_H_PULSE_IGNOR\0"
+    "SP_H_TIMER_VAL\0"
+    "SP_H_TOTAL_EQ_THD\0"
+    "SP_JITTER_SYNC\0"
+    "SP_NO_CLAMP_REG\0"
+    "SP_NO_COAST_REG\0"
+    "SP_POST_COAST\0"
+    "SP_PRE_COAST\0"
+    "SP_RT_HS_SP\0"
+    "SP_RT_HS_ST\0"
+    "SP_SDCS_VSSP_REG_H\0"
+    "SP_SDCS_VSSP_REG_L\0"
+    "SP_SDCS_VSST_REG_H\0"
+    "SP_SDCS_VSST_REG_L\0"
+    "SP_SOG_MODE\0"
+    "SP_SOG_P_ATO\0"
+    "SP_SOG_P_INV\0"
+    "SP_SOG_SRC_SEL\0"
+    "SP_SYNC_BYPS\0"
+    "SP_SYNC_PD_THD\0"
+    "SP_VS_POL_ATO\0"
+    "SP_VS_PROC_INV_REG\0"
+    "STATUS_00\0"
+    "STATUS_03\0"
+    "STATUS_04\0"
+    "STATUS_05\0"
+    "STATUS_0F\0"
+    "STATUS_16\0"
+    "STATUS_DEINT_PULLDN\0"
+    "STATUS_GPIO_CLKOUT\0"
+    "STATUS_GPIO_GPIO\0"
+    "STATUS_GPIO_HALF\0"
+    "STATUS_GPIO_HBOUT\0"
+    "STATUS_GPIO_MBA\0"
+    "STATUS_GPIO_MCS1\0"
+    "STATUS_GPIO_SCLSA\0"
+    "STATUS_GPIO_VBOUT\0"
+    "STATUS_IF_HT_BAD\0"
+    "STATUS_IF_HT_OK\0"
+    "STATUS_IF_HVT_OK\0"
+    "STATUS_IF_INP_1080I\0"
+    "STATUS_IF_INP_1808P\0"
+    "STATUS_IF_INP_2200_1125I\0"
+    "STATUS_IF_INP_2200_1125P\0"
+    "STATUS_IF_INP_2376_1250I\0"
+    "STATUS_IF_INP_2376_1250P\0"
+    "STATUS_IF_INP_2640_1125I\0"
+    "STATUS_IF_INP_2640_1125P\0"
+    "STATUS_IF_INP_720\0"
+    "STATUS_IF_INP_720P50\0"
+    "STATUS_IF_INP_720P60\0"
+    "STATUS_IF_INP_HD\0"
+    "STATUS_IF_INP_INT\0"
+    "STATUS_IF_INP_NTSC_INT\0"
+    "STATUS_IF_INP_NTSC_PRG\0"
+    "STATUS_IF_INP_PAL_INT\0"
+    "STATUS_IF_INP_PAL_PRG\0"
+    "STATUS_IF_INP_PC\0"
+    "STATUS_IF_INP_PRG\0"
+    "STATUS_IF_INP_SD\0"
+    "STATUS_IF_INP_SVGA\0"
+    "STATUS_IF_INP_SVGA60\0"
+    "STATUS_IF_INP_SVGA75\0"
+    "STATUS_IF_INP_SVGA85\0"
+    "STATUS_IF_INP_SW\0"
+    "STATUS_IF_INP_SXGA\0"
+    "STATUS_IF_INP_SXGA60\0"
+    "STATUS_IF_INP_SXGA75\0"
+    "STATUS_IF_INP_SXGA85\0"
+    "STATUS_IF_INP_USER\0"
+    "STATUS_IF_INP_VGA\0"
+    "STATUS_IF_INP_VGA60\0"
+    "STATUS_IF_INP_VGA75\0"
+    "STATUS_IF_INP_VGA86\0"
+    "STATUS_IF_INP_XGA\0"
+    "STATUS_IF_INP_XGA60\0"
+    "STATUS_IF_INP_XGA70\0"
+    "STATUS_IF_INP_XGA75\0"
+    "STATUS_IF_INP_XGA85\0"
+    "STATUS_IF_NO_SYNC\0"
+    "STATUS_IF_VT_BAD\0"
+    "STATUS_IF_VT_OK\0"
+    "STATUS_INT_INP_CSYNC\0"
+    "STATUS_INT_INP_HSYNC\0"
+    "STATUS_INT_INP_NO_SYNC\0"
+    "STATUS_INT_INP_SW\0"
+    "STATUS_INT_INP_VSYNC\0"
+    "STATUS_INT_SOG_BAD\0"
+    "STATUS_INT_SOG_OK\0"
+    "STATUS_INT_SOG_SW\0"
+    "STATUS_MEM_FF_CAP_FIFO_EMPTY\0"
+    "STATUS_MEM_FF_CAP_FIFO_FULL\0"
+    "STATUS_MEM_FF_EXT_FIN\0"
+    "STATUS_MEM_FF_PLY_FIFO_EMPTY\0"
+    "STATUS_MEM_FF_PLY_FIFO_FULL\0"
+    "STATUS_MEM_FF_RFF_FIFO_EMPTY\0"
+    "STATUS_MEM_FF_RFF_FIFO_FULL\0"
+    "STATUS_MEM_FF_WFF_FIFO_EMPTY\0"
+    "STATUS_MEM_FF_WFF_FIFO_FULL\0"
+    "STATUS_MISC_HBLK\0"
+    "STATUS_MISC_HSYNC\0"
+    "STATUS_MISC_PIP_EN_H\0"
+    "STATUS_MISC_PIP_EN_V\0"
+    "STATUS_MISC_PLL648_LOCK\0"
+    "STATUS_MISC_PLLAD_LOCK\0"
+    "STATUS_MISC_VBLK\0"
+    "STATUS_MISC_VSYNC\0"
+    "STATUS_SYNC_PROC_HLOW_LEN\0"
+    "STATUS_SYNC_PROC_HSACT\0"
+    "STATUS_SYNC_PROC_HSPOL\0"
+    "STATUS_SYNC_PROC_HTOTAL\0"
+    "STATUS_SYNC_PROC_VSACT\0"
+    "STATUS_SYNC_PROC_VSPOL\0"
+    "STATUS_SYNC_PROC_VTOTAL\0"
+    "STATUS_VDS_FIELD\0"
+    "STATUS_VDS_FR_NUM\0"
+    "STATUS_VDS_OUT_BLANK\0"
+    "STATUS_VDS_OUT_HSYNC\0"
+    "STATUS_VDS_OUT_VSYNC\0"
+    "STATUS_VDS_VERT_COUNT\0"
+    "TEST_BUS\0"
+    "TEST_BUS_1F\0"
+    "TEST_BUS_23\0"
+    "TEST_BUS_2E\0"
+    "TEST_BUS_2F\0"
+    "TEST_BUS_EN\0"
+    "TEST_BUS_SEL\0"
+    "TEST_BUS_SP_SEL\0"
+    "TEST_FF_STATUS\0"
+    "VDS_0X2A_RESERVED_2BITS\0"
+    "VDS_1ST_INT_BYPS\0"
+    "VDS_2ND_INT_BYPS\0"
+    "VDS_3_24\0"
+    "VDS_BLEV_AUTO_EN\0"
+    "VDS_BLEV_BYPS\0"
+    "VDS_BLEV_GAIN\0"
+    "VDS_BLEV_LEVEL\0"
+    "VDS_BLK_BF_EN\0"
+    "VDS_BLUE_BYPS\0"
+    "VDS_BLUE_RANGE\0"
+    "VDS_BLUE_UGAIN\0"
+    "VDS_BLUE_VGAIN\0"
+    "VDS_BLUE_Y_LEV\0"
+    "VDS_C1_BYPS\0"
+    "VDS_C1_GAIN\0"
+    "VDS_C1_TAG_HIGH_SLOPE\0"
+    "VDS_C1_TAG_LOW_SLOPE\0"
+    "VDS_C1_U_HIGH\0"
+    "VDS_C1_U_LOW\0"
+    "VDS_C1_Y_THRESH\0"
+    "VDS_C2_BYPS\0"
+    "VDS_C2_GAIN\0"
+    "VDS_C2_TAG_HIGH_SLOPE\0"
+    "VDS_C2_TAG_LOW_SLOPE\0"
+    "VDS_C2_U_HIGH\0"
+    "VDS_C2_U_LOW\0"
+    "VDS_C2_Y_THRESH\0"
+    "VDS_CONVT_BYPS\0"
+    "VDS_C_VPK_BYPS\0"
+    "VDS_C_VPK_CORE\0"
+    "VDS_C_VPK_GAIN\0"
+    "VDS_DFIELD_EN\0"
+    "VDS_DIF_FR_SEL_EN\0"
+    "VDS_DIS_HB_SP\0"
+    "VDS_DIS_HB_ST\0"
+    "VDS_DIS_VB_SP\0"
+    "VDS_DIS_VB_ST\0"
+    "VDS_DO_16B_EN\0"
+    "VDS_DO_UVSEL_FLIP\0"
+    "VDS_DO_UV_DEV_BYPS\0"
+    "VDS_DYN_BYPS\0"
+    "VDS_D_RAM_BYPS\0"
+    "VDS_D_SP\0"
+    "VDS_EN_FR_NUM_RST\0"
+    "VDS_EXT_HB_SP\0"
+    "VDS_EXT_HB_ST\0"
+    "VDS_EXT_VB_SP\0"
+    "VDS_EXT_VB_ST\0"
+    "VDS_FID_AA_DLY\0"
+    "VDS_FID_RST\0"
+    "VDS_FIELDAB_EN\0"
+    "VDS_FIELD_FLIP\0"
+    "VDS_FLOCK_EN\0"
+    "VDS_FRAME_NO\0"
+    "VDS_FRAME_RST\0"
+    "VDS_FREERUN_FID\0"
+    "VDS_FR_SELECT\0"
+    "VDS_GLB_NOISE\0"
+    "VDS_HALF_EN\0"
+    "VDS_HB_SP\0"
+    "VDS_HB_ST\0"
+    "VDS_HSCALE\0"
+    "VDS_HSCALE_BYPS\0"
+    "VDS_HSYNC_RST\0"
+    "VDS_HS_SP\0"
+    "VDS_HS_ST\0"
+    "VDS_IN_DREG_BYPS\0"
+    "VDS_NR_C_BYPS\0"
+    "VDS_NR_DIF_LPF5_BYPS\0"
+    "VDS_NR_EN_GLB_STILL\0"
+    "VDS_NR_EN_H_NOISY\0"
+    "VDS_NR_GLB_STILL_MENU\0"
+    "VDS_NR_MIG_USER_EN\0"
+    "VDS_NR_MI_GAIN\0"
+    "VDS_NR_MI_OFFSET\0"
+    "VDS_NR_MI_THRES\0"
+    "VDS_NR_MI_TH_EN\0"
+    "VDS_NR_NOISY_OFFSET\0"
+    "VDS_NR_STILL_GAIN\0"
+    "VDS_NR_Y_BYPS\0"
+    "VDS_NS_BYPS\0"
+    "VDS_NS_SQUARE_RAD\0"
+    "VDS_NS_U_CENTER\0"
+    "VDS_NS_U_GAIN\0"
+    "VDS_NS_V_CENTER\0"
+    "VDS_NS_V_GAIN\0"
+    "VDS_NS_Y_ACTIVE_EN\0"
+    "VDS_NS_Y_HIGH_TH\0"
+    "VDS_NS_Y_LOW_TH\0"
+    "VDS_PK_HB_CMP\0"
+    "VDS_PK_HB_CORE\0"
+    "VDS_PK_HB_GAIN\0"
+    "VDS_PK_HH_CMP\0"
+    "VDS_PK_HH_CORE\0"
+    "VDS_PK_HH_GAIN\0"
+    "VDS_PK_HL_CMP\0"
+    "VDS_PK_HL_CORE\0"
+    "VDS_PK_HL_GAIN\0"
+    "VDS_PK_LB_CMP\0"
+    "VDS_PK_LB_CORE\0"
+    "VDS_PK_LB_GAIN\0"
+    "VDS_PK_LH_CMP\0"
+    "VDS_PK_LH_CORE\0"
+    "VDS_PK_LH_GAIN\0"
+    "VDS_PK_LINE_BUF_SP\0"
+    "VDS_PK_RAM_BYPS\0"
+    "VDS_PK_VH_HH_SEL\0"
+    "VDS_PK_VH_HL_SEL\0"
+    "VDS_PK_VL_HH_SEL\0"
+    "VDS_PK_VL_HL_SEL\0"
+    "VDS_PK_Y_H_BYPS\0"
+    "VDS_PK_Y_V_BYPS\0"
+    "VDS_SK_BYPS\0"
+    "VDS_SK_GAIN\0"
+    "VDS_SK_RANGE\0"
+    "VDS_SK_U_CENTER\0"
+    "VDS_SK_V_CENTER\0"
+    "VDS_SK_Y_EN\0"
+    "VDS_SK_Y_HIGH_TH\0"
+    "VDS_SK_Y_LOW_TH\0"
+    "VDS_SRESET\0"
+    "VDS_STEP_CLIP\0"
+    "VDS_STEP_DLY_CNTRL\0"
+    "VDS_STEP_GAIN\0"
+    "VDS_SVM_2ND_BYPS\0"
+    "VDS_SVM_BPF_CNTRL\0"
+    "VDS_SVM_GAIN\0"
+    "VDS_SVM_OFFSET\0"
+    "VDS_SVM_POL_FLIP\0"
+    "VDS_SVM_SIGMOID_BYPS\0"
+    "VDS_SVM_V4CLK_DELAY\0"
+    "VDS_SVM_VCLK_DELAY\0"
+    "VDS_SYNC_EN\0"
+    "VDS_SYNC_IN_SEL\0"
+    "VDS_SYNC_LEV\0"
+    "VDS_TAP6_BYPS\0"
+    "VDS_TEST_BUS_SEL\0"
+    "VDS_TEST_EN\0"
+    "VDS_UCOS_GAIN\0"
+    "VDS_USER_MAX\0"
+    "VDS_USER_MIN\0"
+    "VDS_USIN_GAIN\0"
+    "VDS_UV_BLK_VAL\0"
+    "VDS_UV_FLIP\0"
+    "VDS_UV_STEP_BYPS\0"
+    "VDS_U_DELAY\0"
+    "VDS_U_OFST\0"
+    "VDS_VB_SP\0"
+    "VDS_VB_ST\0"
+    "VDS_VCOS_GAIN\0"
+    "VDS_VSCALE\0"
+    "VDS_VSCALE_BYPS\0"
+    "VDS_VSIN_GAIN\0"
+    "VDS_VSYNC_RST\0"
+    "VDS_VSYN_SIZE1\0"
+    "VDS_VSYN_SIZE2\0"
+    "VDS_VS_SP\0"
+    "VDS_VS_ST\0"
+    "VDS_V_DELAY\0"
+    "VDS_V_OFST\0"
+    "VDS_WEN_DELAY\0"
+    "VDS_WLEV_GAIN\0"
+    "VDS_W_LEV\0"
+    "VDS_W_LEV_BYPS\0"
+    "VDS_Y_DELAY\0"
+    "VDS_Y_GAIN\0"
+    "VDS_Y_OFST\0"
+    "VERYWIDEDUMMYREG\0"
+    "VPERIOD_IF\0"
+    "WFF_ADR_ADD_2\0"
+    "WFF_ENABLE\0"
+    "WFF_FF_STATUS_SEL\0"
+    "WFF_FF_STA_INV\0"
+    "WFF_HB_DELAY\0"
+    "WFF_LINE_FLIP\0"
+    "WFF_SAFE_GUARD\0"
+    "WFF_SAFE_GUARD_A\0"
+    "WFF_SAFE_GUARD_B\0"
+    "WFF_VB_DELAY\0"
+    "WFF_YUV_DEINTERLACE\0"
+    ;
+
+static constexpr RegFieldEntry tv5725Fields[TV5725_FIELD_COUNT] PROGMEM = {
+    {0, 0x05, 0x00, 0, 8, 0}, // ADC_5_00
+    {9, 0x05, 0x03, 0, 8, 0}, // ADC_5_03
+    {18, 0x05, 0x0E, 2, 2, 0}, // ADC_AUTO_OFST_DELAY
+    {38, 0x05, 0x0E, 0, 1, 0}, // ADC_AUTO_OFST_EN
+    {55, 0x05, 0x0E, 1, 1, 0}, // ADC_AUTO_OFST_PRD
+    {73, 0x05, 0x0F, 0, 8, 0}, // ADC_AUTO_OFST_RANGE_REG
+    {97, 0x05, 0x0E, 4, 2, 0}, // ADC_AUTO_OFST_STEP
+    {116, 0x05, 0x0E, 7, 1, 0}, // ADC_AUTO_OFST_TEST
+    {135, 0x05, 0x0B, 0, 8, 0}, // ADC_BGCTRL
+    {146, 0x05, 0x08, 0, 8, 0}, // ADC_BOFCTRL
+    {158, 0x05, 0x00, 4, 1, 0}, // ADC_CLK_ICLK1X
+    {173, 0x05, 0x00, 3, 1, 0}, // ADC_CLK_ICLK2X
+    {188, 0x05, 0x00, 0, 2, 0}, // ADC_CLK_PA
+    {199, 0x05, 0x03, 4, 2, 0}, // ADC_FLTR
+    {208, 0x05, 0x0A, 0, 8, 0}, // ADC_GGCTRL
+    {219, 0x05, 0x07, 0, 8, 0}, // ADC_GOFCTRL
+    {231, 0x05, 0x02, 6, 2, 0}, // ADC_INPUT_SEL
+    {245, 0x05, 0x03, 0, 1, 0}, // ADC_POWDZ
+    {255, 0x05, 0x09, 0, 8, 0}, // ADC_RGCTRL
+    {266, 0x05, 0x06, 0, 8, 0}, // ADC_ROFCTRL
+    {278, 0x05, 0x03, 3, 1, 0}, // ADC_RYSEL_B
+    {290, 0x05, 0x03, 2, 1, 0}, // ADC_RYSEL_G
+    {302, 0x05, 0x03, 1, 1, 0}, // ADC_RYSEL_R
+    {314, 0x05, 0x02, 1, 5, 0}, // ADC_SOGCTRL
+    {326, 0x05, 0x02, 0, 1, 0}, // ADC_SOGEN
+    {336, 0x05, 0x05, 0, 8, 0}, // ADC_TA_05_CTRL
+    {351, 0x05, 0x05, 0, 1, 0}, // ADC_TA_05_EN
+    {364, 0x05, 0x04, 0, 8, 0}, // ADC_TEST_04
+    {376, 0x05, 0x0C, 0, 8, 0}, // ADC_TEST_0C
+    {388, 0x05, 0x0C, 1, 1, 0}, // ADC_TEST_0C_BIT1
+    {405, 0x05, 0x0C, 3, 1, 0}, // ADC_TEST_0C_BIT3
+    {422, 0x05, 0x0C, 4, 1, 0}, // ADC_TEST_0C_BIT4
+    {439, 0x05, 0x04, 2, 3, 0}, // ADC_TR_ISEL
+    {451, 0x05, 0x04, 0, 2, 0}, // ADC_TR_RSEL
+    {463, 0x05, 0x04, 1, 1, 0}, // ADC_TR_RSEL_04_BIT1
+    {483, 0x05, 0x60, 0, 8, 0}, // ADC_UNUSED_60
+    {497, 0x05, 0x61, 0, 8, 0}, // ADC_UNUSED_61
+    {511, 0x05, 0x62, 0, 8, 0}, // ADC_UNUSED_62
+    {525, 0x05, 0x64, 0, 8, 0}, // ADC_UNUSED_64
+    {539, 0x05, 0x65, 0, 8, 0}, // ADC_UNUSED_65
+    {553, 0x05, 0x66, 0, 8, 0}, // ADC_UNUSED_66
+    {567, 0x05, 0x67, 0, 16, 0}, // ADC_UNUSED_67
+    {581, 0x05, 0x69, 0, 8, 0}, // ADC_UNUSED_69
+    {595, 0x04, 0x21, 0, 1, 0}, // CAPTURE_ENABLE
+    {610, 0x04, 0x21, 1, 1, 0}, // CAP_FF_HALF_REQ
+    {626, 0x04, 0x22, 3, 1, 0}, // CAP_REQ_FREEZ
+    {640, 0x04, 0x22, 0, 1, 0}, // CAP_REQ_OVER
+    {653, 0x04, 0x24, 0, 21, 0}, // CAP_SAFE_GUARD_A
+    {670, 0x04, 0x27, 0, 21, 0}, // CAP_SAFE_GUARD_B
+    {687, 0x04, 0x21, 5, 1, 0}, // CAP_SAFE_GUARD_EN
+    {705, 0x04, 0x22, 1, 1, 0}, // CAP_STATUS_SEL
+    {720, 0x00, 0x0B, 0, 8, 0}, // CHIP_ID_FOUNDRY
+    {736, 0x00, 0x0C, 0, 8, 0}, // CHIP_ID_PRODUCT
+    {752, 0x00, 0x0D, 0, 8, 0}, // CHIP_ID_REVISION
+    {769, 0x00, 0x4B, 2, 1, 0}, // DAC_RGBS_ADC2DAC
+    {786, 0x00, 0x45, 0, 1, 0}, // DAC_RGBS_B0ENZ
+    {801, 0x00, 0x4B, 1, 1, 0}, // DAC_RGBS_BYPS2DAC
+    {819, 0x00, 0x44, 5, 1, 0}, // DAC_RGBS_G0ENZ
+    {834, 0x00, 0x44, 0, 1, 0}, // DAC_RGBS_PWDNZ
+    {849, 0x00, 0x44, 2, 1, 0}, // DAC_RGBS_R0ENZ
+    {864, 0x00, 0x45, 3, 1, 0}, // DAC_RGBS_S0ENZ
+    {879, 0x00, 0x45, 4, 1, 0}, // DAC_RGBS_S1EN
+    {893, 0x00, 0x45, 2, 1, 0}, // DAC_RGBS_SPD
+    {906, 0x05, 0x1F, 0, 1, 0}, // DEC1_BYPS
+    {916, 0x05, 0x1F, 1, 1, 0}, // DEC2_BYPS
+    {926, 0x05, 0x1F, 0, 8, 0}, // DEC_5_1F
+    {935, 0x05, 0x1F, 7, 1, 0}, // DEC_IDREG_EN
+    {948, 0x05, 0x1F, 2, 1, 0}, // DEC_MATRIX_BYPS
+    {964, 0x05, 0x1F, 3, 1, 0}, // DEC_TEST_ENABLE
+    {980, 0x05, 0x1F, 4, 3, 0}, // DEC_TEST_SEL
+    {993, 0x05, 0x1E, 7, 1, 0}, // DEC_WEN_MODE
+    {1006, 0x02, 0x00, 0, 8, 0}, // DEINT_00
+    {1015, 0x02, 0x00, 7, 1, 0}, // DIAG_BOB_PLDY_RAM_BYPS
+    {1038, 0x01, 0x2C, 2, 1, 0}, // GBS_OPTION_PALFORCED60_ENABLED
+    {1069, 0x01, 0x2C, 1, 1, 0}, // GBS_OPTION_SCALING_RGBHV
+    {1094, 0x01, 0x2C, 0, 1, 0}, // GBS_OPTION_SCANLINES_ENABLED
+    {1123, 0x01, 0x2B, 7, 1, 0}, // GBS_PRESET_CUSTOM
+    {1141, 0x01, 0x2D, 0, 8, 0}, // GBS_PRESET_DISPLAY_CLOCK
+    {1166, 0x01, 0x2B, 0, 7, 0}, // GBS_PRESET_ID
+    {1180, 0x01, 0x2C, 4, 1, 0}, // GBS_RUNTIME_FTL_ADJUSTED
+    {1205, 0x01, 0x2C, 3, 1, 0}, // GBS_RUNTIME_UNUSED_BIT
+    {1228, 0x00, 0x52, 0, 8, 0}, // GPIO_CONTROL_00
+    {1244, 0x00, 0x53, 0, 8, 0}, // GPIO_CONTROL_01
+    {1260, 0x01, 0x54, 0, 8, 0}, // HD_BLK_BU_DATA
+    {1275, 0x01, 0x53, 0, 8, 0}, // HD_BLK_GY_DATA
+    {1290, 0x01, 0x55, 0, 8, 0}, // HD_BLK_RV_DATA
+    {1305, 0x01, 0x30, 2, 1, 0}, // HD_DYN_BYPS
+    {1317, 0x01, 0x3D, 0, 12, 0}, // HD_HB_SP
+    {1326, 0x01, 0x3B, 0, 12, 0}, // HD_HB_ST
+    {1335, 0x01, 0x37, 0, 11, 0}, // HD_HSYNC_RST
+    {1348, 0x01, 0x41, 0, 12, 0}, // HD_HS_SP
+    {1357, 0x01, 0x3F, 0, 12, 0}, // HD_HS_ST
+    {1366, 0x01, 0x39, 0, 11, 0}, // HD_INI_ST
+    {1376, 0x01, 0x30, 1, 1, 0}, // HD_MATRIX_BYPS
+    {1391, 0x01, 0x30, 3, 1, 0}, // HD_SEL_BLK_IN
+    {1405, 0x01, 0x34, 0, 8, 0}, // HD_U_OFFSET
+    {1417, 0x01, 0x45, 0, 12, 0}, // HD_VB_SP
+    {1426, 0x01, 0x43, 0, 12, 0}, // HD_VB_ST
+    {1435, 0x01, 0x49, 0, 12, 0}, // HD_VS_SP
+    {1444, 0x01, 0x47, 0, 12, 0}, // HD_VS_ST
+    {1453, 0x01, 0x36, 0, 8, 0}, // HD_V_OFFSET
+    {1465, 0x01, 0x32, 0, 8, 0}, // HD_Y_OFFSET
+    {1477, 0x00, 0x06, 0, 9, 0}, // HPERIOD_IF
+    {1488, 0x01, 0x29, 0, 1, 0}, // IF_AUTO_OFST_EN
+    {1504, 0x01, 0x29, 1, 1, 0}, // IF_AUTO_OFST_PRD
+    {1521, 0x01, 0x2A, 0, 4, 0}, // IF_AUTO_OFST_U_RANGE
+    {1542, 0x01, 0x2A, 4, 4, 0}, // IF_AUTO_OFST_V_RANGE
+    {1563, 0x01, 0x26, 0, 12, 0}, // IF_HBIN_SP
+    {1574, 0x01, 0x24, 0, 12, 0}, // IF_HBIN_ST
+    {1585, 0x01, 0x12, 0, 11, 0}, // IF_HB_SP
+    {1594, 0x01, 0x16, 0, 11, 0}, // IF_HB_SP1
+    {1604, 0x01, 0x1A, 0, 11, 0}, // IF_HB_SP2
+    {1614, 0x01, 0x10, 0, 11, 0}, // IF_HB_ST
+    {1623, 0x01, 0x18, 0, 11, 0}, // IF_HB_ST2
+    {1633, 0x01, 0x0E, 0, 11, 0}, // IF_HSYNC_RST
+    {1646, 0x01, 0x0B, 4, 2, 0}, // IF_HS_DEC_FACTOR
+    {1663, 0x01, 0x00, 7, 1, 0}, // IF_HS_FLIP
+    {1674, 0x01, 0x02, 2, 1, 0}, // IF_HS_INT_LPF_BYPS
+    {1693, 0x01, 0x02, 3, 1, 0}, // IF_HS_PSHIFT_BYPS
+    {1711, 0x01, 0x02, 1, 1, 0}, // IF_HS_SEL_LPF
+    {1725, 0x01, 0x02, 4, 1, 0}, // IF_HS_TAP11_BYPS
+    {1742, 0x01, 0x02, 5, 2, 0}, // IF_HS_Y_PDELAY
+    {1757, 0x01, 0x0C, 5, 11, 0}, // IF_INI_ST
+    {1767, 0x01, 0x00, 0, 1, 0}, // IF_IN_DREG_BYPS
+    {1783, 0x01, 0x0C, 0, 1, 0}, // IF_LD_RAM_BYPS
+    {1798, 0x01, 0x0B, 7, 1, 0}, // IF_LD_SEL_PROV
+    {1813, 0x01, 0x0C, 1, 4, 0}, // IF_LD_ST
+    {1822, 0x01, 0x28, 1, 1, 0}, // IF_LD_WRST_SEL
+    {1837, 0x01, 0x22, 0, 12, 0}, // IF_LINE_SP
+    {1848, 0x01, 0x20, 0, 12, 0}, // IF_LINE_ST
+    {1859, 0x01, 0x00, 1, 1, 0}, // IF_MATRIX_BYPS
+    {1874, 0x01, 0x00, 6, 1, 0}, // IF_PRGRSV_CNTRL
+    {1890, 0x01, 0x00, 4, 1, 0}, // IF_SEL16BIT
+    {1902, 0x01, 0x01, 7, 1, 0}, // IF_SEL24BIT
+    {1914, 0x01, 0x00, 3, 1, 0}, // IF_SEL_656
+    {1925, 0x01, 0x28, 2, 1, 0}, // IF_SEL_ADC_SYNC
+    {1941, 0x01, 0x0B, 6, 1, 0}, // IF_SEL_HSCALE
+    {1955, 0x01, 0x02, 0, 1, 0}, // IF_SEL_WEN
+    {1966, 0x01, 0x28, 3, 1, 0}, // IF_TEST_EN
+    {1977, 0x01, 0x28, 4, 4, 0}, // IF_TEST_SEL
+    {1989, 0x01, 0x00, 2, 1, 0}, // IF_UV_REVERT
+    {2002, 0x01, 0x1E, 0, 11, 0}, // IF_VB_SP
+    {2011, 0x01, 0x1C, 0, 11, 0}, // IF_VB_ST
+    {2020, 0x01, 0x01, 0, 1, 0}, // IF_VS_FLIP
+    {2031, 0x01, 0x00, 5, 1, 0}, // IF_VS_SEL
+    {2041, 0x01, 0x02, 0, 8, 0}, // INPUT_FORMATTER_02
+    {2060, 0x00, 0x58, 0, 8, 0}, // INTERRUPT_CONTROL_00
+    {2081, 0x00, 0x59, 0, 8, 0}, // INTERRUPT_CONTROL_01
+    {2102, 0x00, 0x58, 4, 1, 0}, // INT_CONTROL_RST_NOHSYNC
+    {2126, 0x00, 0x58, 0, 1, 0}, // INT_CONTROL_RST_SOGBAD
+    {2149, 0x00, 0x58, 1, 1, 0}, // INT_CONTROL_RST_SOGSWITCH
+    {2175, 0x02, 0x19, 0, 1, 0}, // MADPT_BIT_STILL_EN
+    {2194, 0x02, 0x35, 6, 1, 0}, // MADPT_CMP_EN
+    {2207, 0x02, 0x35, 3, 1, 0}, // MADPT_DD0_SEL
+    {2221, 0x02, 0x21, 5, 1, 0}, // MADPT_EN_NOUT_FOR_LESS_STILL
+    {2250, 0x02, 0x21, 4, 1, 0}, // MADPT_EN_NOUT_FOR_STILL
+    {2274, 0x02, 0x3A, 3, 1, 0}, // MADPT_EN_STILL_FOR_NRD
+    {2297, 0x02, 0x3A, 0, 1, 0}, // MADPT_EN_UV_DEINT
+    {2315, 0x02, 0x18, 3, 1, 0}, // MADPT_HTAP_BYPS
+    {2331, 0x02, 0x0C, 4, 1, 0}, // MADPT_MI_1BIT_BYPS
+    {2350, 0x02, 0x3A, 5, 2, 0}, // MADPT_MI_1BIT_DLY
+    {2368, 0x02, 0x0C, 5, 1, 0}, // MADPT_MI_1BIT_FRAME2_EN
+    {2392, 0x02, 0x16, 5, 1, 0}, // MADPT_MO_ADP_UV_EN
+    {2411, 0x02, 0x35, 4, 1, 0}, // MADPT_NRD_VIIR_PD_BYPS
+    {2434, 0x02, 0x24, 2, 1, 0}, // MADPT_PD_RAM_BYPS
+    {2452, 0x02, 0x31, 2, 1, 0}, // MADPT_SEL_PHASE_INI
+    {2472, 0x02, 0x0A, 5, 1, 0}, // MADPT_STILL_NOISE_EST_EN
+    {2497, 0x02, 0x35, 5, 1, 0}, // MADPT_UVDLY_PD_BYPS
+    {2517, 0x02, 0x39, 0, 4, 0}, // MADPT_UVDLY_PD_SP
+    {2535, 0x02, 0x39, 4, 4, 0}, // MADPT_UVDLY_PD_ST
+    {2553, 0x02, 0x17, 4, 4, 0}, // MADPT_UV_DELAY
+    {2568, 0x02, 0x3A, 7, 1, 0}, // MADPT_UV_MI_DET_BYPS
+    {2589, 0x02, 0x3B, 0, 7, 0}, // MADPT_UV_MI_OFFSET
+    {2608, 0x02, 0x02, 7, 1, 0}, // MADPT_UV_VSCALE_BYPS
+    {2629, 0x02, 0x26, 6, 1, 0}, // MADPT_VIIR_BYPS
+    {2645, 0x02, 0x27, 0, 7, 0}, // MADPT_VIIR_COEF
+    {2661, 0x02, 0x31, 0, 2, 0}, // MADPT_VSCALE_DEC_FACTOR
+    {2685, 0x02, 0x19, 2, 1, 0}, // MADPT_VTAP2_BYPS
+    {2702, 0x02, 0x19, 4, 4, 0}, // MADPT_VTAP2_COEFF
+    {2720, 0x02, 0x19, 3, 1, 0}, // MADPT_VTAP2_ROUND_SEL
+    {2742, 0x02, 0x16, 6, 1, 0}, // MADPT_VT_FILTER_CNTRL
+    {2764, 0x02, 0x17, 0, 4, 0}, // MADPT_Y_DELAY
+    {2778, 0x02, 0x17, 0, 8, 0}, // MADPT_Y_DELAY_UV_DELAY
+    {2801, 0x02, 0x0A, 7, 1, 0}, // MADPT_Y_MI_DET_BYPS
+    {2821, 0x02, 0x0B, 0, 7, 0}, // MADPT_Y_MI_OFFSET
+    {2839, 0x02, 0x02, 6, 1, 0}, // MADPT_Y_VSCALE_BYPS
+    {2859, 0x02, 0x16, 7, 1, 0}, // MAPDT_VT_SEL_PRGV
+    {2877, 0x01, 0x7F, 0, 7, 0}, // MD_HD1250P_CNTRL
+    {2894, 0x01, 0x60, 0, 5, 0}, // MD_HPERIOD_LOCK_VALUE
+    {2916, 0x01, 0x60, 5, 3, 0}, // MD_HPERIOD_UNLOCK_VALUE
+    {2940, 0x01, 0x63, 6, 1, 0}, // MD_HS_FLIP
+    {2951, 0x01, 0x65, 7, 1, 0}, // MD_SEL_VGA60
+    {2964, 0x01, 0x6A, 0, 8, 0}, // MD_SVGA_60HZ_CNTRL
+    {2983, 0x01, 0x6B, 0, 8, 0}, // MD_SVGA_75HZ_CNTRL
+    {3002, 0x01, 0x6C, 0, 8, 0}, // MD_SVGA_85HZ_CNTRL
+    {3021, 0x01, 0x73, 0, 7, 0}, // MD_SXGA_60HZ_CNTRL
+    {3040, 0x01, 0x74, 0, 7, 0}, // MD_SXGA_75HZ_CNTRL
+    {3059, 0x01, 0x75, 0, 7, 0}, // MD_SXGA_85HZ_CNTRL
+    {3078, 0x01, 0x66, 0, 8, 0}, // MD_VGA_75HZ_CNTRL
+    {3096, 0x01, 0x67, 0, 8, 0}, // MD_VGA_85HZ_CNTRL
+    {3114, 0x01, 0x65, 0, 7, 0}, // MD_VGA_CNTRL
+    {3127, 0x01, 0x61, 0, 5, 0}, // MD_VPERIOD_LOCK_VALUE
+    {3149, 0x01, 0x61, 5, 3, 0}, // MD_VPERIOD_UNLOCK_VALUE
+    {3173, 0x01, 0x63, 7, 1, 0}, // MD_VS_FLIP
+    {3184, 0x01, 0x6E, 0, 8, 0}, // MD_XGA_60HZ_CNTRL
+    {3202, 0x01, 0x6F, 0, 7, 0}, // MD_XGA_70HZ_CNTRL
+    {3220, 0x01, 0x70, 0, 7, 0}, // MD_XGA_75HZ_CNTRL
+    {3238, 0x01, 0x71, 0, 7, 0}, // MD_XGA_85HZ_CNTRL
+    {3256, 0x04, 0x1B, 0, 3, 0}, // MEM_ADR_DLY_REG
+    {3272, 0x04, 0x12, 1, 1, 0}, // MEM_CLK_DLYCELL_SEL
+    {3292, 0x04, 0x1B, 4, 3, 0}, // MEM_CLK_DLY_REG
+    {3308, 0x04, 0x12, 2, 1, 0}, // MEM_FBK_CLK_DLYCELL_SEL
+    {3332, 0x04, 0x13, 2, 1, 0}, // MEM_FBK_CLK_INVERT
+    {3351, 0x04, 0x5B, 7, 1, 0}, // MEM_FF_TOP_FF_SEL
+    {3369, 0x04, 0x12, 0, 1, 0}, // MEM_INTER_DLYCELL_SEL
+    {3391, 0x04, 0x13, 0, 1, 0}, // MEM_PAD_CLK_INVERT
+    {3410, 0x04, 0x13, 1, 1, 0}, // MEM_RD_DATA_CLK_INVERT
+    {3433, 0x04, 0x15, 0, 1, 0}, // MEM_REQ_PBH_RFFH
+    {3450, 0x00, 0x98, 0, 8, 0}, // OSD_BAR_FOREGROUND_VALUE
+    {3475, 0x00, 0x97, 0, 8, 0}, // OSD_BAR_LENGTH
+    {3490, 0x00, 0x93, 7, 1, 0}, // OSD_COMMAND_FINISH
+    {3509, 0x00, 0x90, 6, 1, 0}, // OSD_DISP_EN
+    {3521, 0x00, 0x90, 1, 3, 0}, // OSD_HORIZONTAL_ZOOM
+    {3541, 0x00, 0x94, 3, 1, 0}, // OSD_INT_NG_LAT
+    {3556, 0x00, 0x92, 6, 3, 0}, // OSD_MENU_BAR_BORD_COR
+    {3578, 0x00, 0x92, 3, 3, 0}, // OSD_MENU_BAR_FONT_BGCOR
+    {3602, 0x00, 0x92, 0, 3, 0}, // OSD_MENU_BAR_FONT_FORCOR
+    {3627, 0x00, 0x94, 0, 1, 0}, // OSD_MENU_DISP_STYLE
+    {3647, 0x00, 0x90, 7, 1, 0}, // OSD_MENU_EN
+    {3659, 0x00, 0x95, 0, 8, 0}, // OSD_MENU_HORI_START
+    {3679, 0x00, 0x91, 0, 4, 0}, // OSD_MENU_ICON_SEL
+    {3697, 0x00, 0x91, 4, 4, 0}, // OSD_MENU_MOD_SEL
+    {3714, 0x00, 0x93, 4, 3, 0}, // OSD_MENU_SEL_BGCOR
+    {3733, 0x00, 0x93, 1, 3, 0}, // OSD_MENU_SEL_FORCOR
+    {3753, 0x00, 0x96, 0, 8, 0}, // OSD_MENU_VER_START
+    {3772, 0x00, 0x90, 0, 1, 0}, // OSD_SW_RESET
+    {3785, 0x00, 0x94, 4, 4, 0}, // OSD_TEST_SEL
+    {3798, 0x00, 0x90, 4, 2, 0}, // OSD_VERTICAL_ZOOM
+    {3816, 0x00, 0x94, 2, 1, 0}, // OSD_YCBCR_RGB_FORMAT
+    {3837, 0x00, 0x4F, 5, 1, 0}, // OUT_SYNC_CNTRL
+    {3852, 0x00, 0x4F, 6, 2, 0}, // OUT_SYNC_SEL
+    {3865, 0x00, 0x48, 0, 1, 0}, // PAD_BOUT_EN
+    {3877, 0x00, 0x49, 0, 1, 0}, // PAD_CKIN_ENZ
+    {3890, 0x00, 0x49, 1, 1, 0}, // PAD_CKOUT_ENZ
+    {3904, 0x00, 0x48, 0, 8, 0}, // PAD_CONTROL_00_0x48
+    {3924, 0x00, 0x49, 0, 8, 0}, // PAD_CONTROL_01_0x49
+    {3944, 0x00, 0x4A, 0, 3, 0}, // PAD_OSC_CNTRL
+    {3958, 0x00, 0x48, 6, 1, 0}, // PAD_SYNC1_IN_ENZ
+    {3975, 0x00, 0x48, 7, 1, 0}, // PAD_SYNC2_IN_ENZ
+    {3992, 0x00, 0x49, 2, 1, 0}, // PAD_SYNC_OUT_ENZ
+    {4009, 0x00, 0x49, 4, 1, 0}, // PAD_TRI_ENZ
+    {4021, 0x05, 0x18, 0, 1, 0}, // PA_ADC_BYPSZ
+    {4034, 0x05, 0x18, 7, 1, 0}, // PA_ADC_LAT
+    {4045, 0x05, 0x18, 6, 1, 0}, // PA_ADC_LOCKOFF
+    {4060, 0x05, 0x18, 1, 5, 0}, // PA_ADC_S
+    {4069, 0x05, 0x19, 0, 1, 0}, // PA_SP_BYPSZ
+    {4081, 0x05, 0x19, 7, 1, 0}, // PA_SP_LAT
+    {4091, 0x05, 0x19, 6, 1, 0}, // PA_SP_LOCKOFF
+    {4105, 0x05, 0x19, 1, 5, 0}, // PA_SP_S
+    {4113, 0x04, 0x2B, 3, 1, 0}, // PB_BYPASS
+    {4123, 0x04, 0x37, 0, 10, 0}, // PB_CAP_OFFSET
+    {4137, 0x04, 0x2B, 0, 1, 0}, // PB_CUT_REFRESH
+    {4152, 0x04, 0x2B, 5, 1, 0}, // PB_DB_BUFFER_EN
+    {4168, 0x04, 0x2B, 7, 1, 0}, // PB_ENABLE
+    {4178, 0x04, 0x39, 0, 10, 0}, // PB_FETCH_NUM
+    {4191, 0x04, 0x2D, 0, 8, 0}, // PB_GENERAL_FLAG_REG
+    {4211, 0x04, 0x2C, 0, 8, 0}, // PB_MAST_FLAG_REG
+    {4228, 0x04, 0x2B, 1, 2, 0}, // PB_REQ_SEL
+    {4239, 0x03, 0x81, 0, 1, 0}, // PIP_CONVT_BYPS
+    {4254, 0x03, 0x81, 3, 1, 0}, // PIP_DREG_BYPS
+    {4268, 0x03, 0x80, 7, 1, 0}, // PIP_DYN_BYPS
+    {4281, 0x03, 0x81, 7, 1, 0}, // PIP_EN
+    {4288, 0x03, 0x8A, 0, 12, 0}, // PIP_H_SP
+    {4297, 0x03, 0x88, 0, 12, 0}, // PIP_H_ST
+    {4306, 0x03, 0x80, 6, 1, 0}, // PIP_SUB_16B_SEL
+    {4322, 0x03, 0x80, 3, 1, 0}, // PIP_TAP3_BYPS
+    {4336, 0x03, 0x80, 0, 1, 0}, // PIP_UV_FLIP
+    {4348, 0x03, 0x80, 1, 1, 0}, // PIP_U_DELAY
+    {4360, 0x03, 0x83, 0, 8, 0}, // PIP_U_GAIN
+    {4371, 0x03, 0x86, 0, 8, 0}, // PIP_U_OFST
+    {4382, 0x03, 0x80, 2, 1, 0}, // PIP_V_DELAY
+    {4394, 0x03, 0x84, 0, 8, 0}, // PIP_V_GAIN
+    {4405, 0x03, 0x87, 0, 8, 0}, // PIP_V_OFST
+    {4416, 0x03, 0x8E, 0, 11, 0}, // PIP_V_SP
+    {4425, 0x03, 0x8C, 0, 11, 0}, // PIP_V_ST
+    {4434, 0x03, 0x80, 4, 2, 0}, // PIP_Y_DELAY
+    {4446, 0x03, 0x82, 0, 8, 0}, // PIP_Y_GAIN
+    {4457, 0x03, 0x85, 0, 8, 0}, // PIP_Y_OFST
+    {4468, 0x00, 0x41, 0, 8, 0}, // PLL648_CONTROL_01
+    {4486, 0x00, 0x43, 0, 8, 0}, // PLL648_CONTROL_03
+    {4504, 0x05, 0x16, 0, 8, 0}, // PLLAD_5_16
+    {4515, 0x05, 0x11, 6, 1, 0}, // PLLAD_BPS
+    {4525, 0x05, 0x16, 6, 2, 0}, // PLLAD_CKOS
+    {4536, 0x05, 0x11, 0, 8, 0}, // PLLAD_CONTROL_00_5x11
+    {4558, 0x05, 0x11, 5, 1, 0}, // PLLAD_FS
+    {4567, 0x05, 0x17, 0, 3, 0}, // PLLAD_ICP
+    {4577, 0x05, 0x16, 4, 2, 0}, // PLLAD_KS
+    {4586, 0x05, 0x11, 7, 1, 0}, // PLLAD_LAT
+    {4596, 0x05, 0x11, 1, 1, 0}, // PLLAD_LEN
+    {4606, 0x05, 0x12, 0, 12, 0}, // PLLAD_MD
+    {4615, 0x05, 0x11, 4, 1, 0}, // PLLAD_PDZ
+    {4625, 0x05, 0x16, 0, 2, 0}, // PLLAD_R
+    {4633, 0x05, 0x16, 2, 2, 0}, // PLLAD_S
+    {4641, 0x05, 0x11, 2, 1, 0}, // PLLAD_TEST
+    {4652, 0x05, 0x11, 3, 1, 0}, // PLLAD_TS
+    {4661, 0x05, 0x11, 0, 1, 0}, // PLLAD_VCORST
+    {4674, 0x00, 0x40, 3, 1, 0}, // PLL_ADS
+    {4682, 0x00, 0x40, 0, 1, 0}, // PLL_CKIS
+    {4691, 0x00, 0x40, 1, 1, 0}, // PLL_DIVBY2Z
+    {4703, 0x00, 0x40, 2, 1, 0}, // PLL_IS
+    {4710, 0x00, 0x43, 4, 1, 0}, // PLL_LEN
+    {4718, 0x00, 0x40, 4, 3, 0}, // PLL_MS
+    {4725, 0x00, 0x43, 0, 2, 0}, // PLL_R
+    {4731, 0x00, 0x43, 2, 2, 0}, // PLL_S
+    {4737, 0x00, 0x43, 5, 1, 0}, // PLL_VCORST
+    {4748, 0x00, 0x46, 0, 8, 0}, // RESET_CONTROL_0x46
+    {4767, 0x00, 0x47, 0, 8, 0}, // RESET_CONTROL_0x47
+    {4786, 0x04, 0x4D, 4, 1, 0}, // RFF_ADR_ADD_2
+    {4800, 0x04, 0x4D, 7, 1, 0}, // RFF_ENABLE
+    {4811, 0x04, 0x59, 0, 10, 0}, // RFF_FETCH_NUM
+    {4825, 0x04, 0x50, 5, 1, 0}, // RFF_LINE_FLIP
+    {4839, 0x04, 0x50, 7, 1, 0}, // RFF_LREQ_CUT
+    {4852, 0x04, 0x4E, 0, 8, 0}, // RFF_MASTER_FLAG
+    {4868, 0x04, 0x4D, 5, 2, 0}, // RFF_REQ_SEL
+    {4880, 0x04, 0x57, 0, 10, 0}, // RFF_WFF_OFFSET
+    {4895, 0x04, 0x51, 0, 21, 0}, // RFF_WFF_STA_ADDR_A
+    {4914, 0x04, 0x54, 0, 21, 0}, // RFF_WFF_STA_ADDR_B
+    {4933, 0x04, 0x50, 6, 1, 0}, // RFF_YUV_DEINTERLACE
+    {4953, 0x04, 0x00, 0, 8, 0}, // SDRAM_RESET_CONTROL
+    {4973, 0x04, 0x00, 4, 1, 0}, // SDRAM_RESET_SIGNAL
+    {4992, 0x04, 0x00, 7, 1, 0}, // SDRAM_START_INITIAL_CYCLE
+    {5018, 0x00, 0x47, 0, 1, 0}, // SFTRST_DEC_RSTZ
+    {5034, 0x00, 0x46, 1, 1, 0}, // SFTRST_DEINT_RSTZ
+    {5052, 0x00, 0x46, 4, 1, 0}, // SFTRST_FIFO_RSTZ
+    {5069, 0x00, 0x47, 3, 1, 0}, // SFTRST_HDBYPS_RSTZ
+    {5088, 0x00, 0x46, 0, 1, 0}, // SFTRST_IF_RSTZ
+    {5103, 0x00, 0x47, 4, 1, 0}, // SFTRST_INT_RSTZ
+    {5119, 0x00, 0x46, 2, 1, 0}, // SFTRST_MEM_FF_RSTZ
+    {5138, 0x00, 0x47, 1, 1, 0}, // SFTRST_MODE_RSTZ
+    {5155, 0x00, 0x47, 2, 1, 0}, // SFTRST_SYNC_RSTZ
+    {5172, 0x00, 0x46, 6, 1, 0}, // SFTRST_VDS_RSTZ
+    {5188, 0x05, 0x56, 0, 8, 0}, // SP_5_56
+    {5196, 0x05, 0x57, 0, 8, 0}, // SP_5_57
+    {5204, 0x05, 0x56, 7, 1, 0}, // SP_CLAMP_INV_REG
+    {5221, 0x05, 0x56, 2, 1, 0}, // SP_CLAMP_MANUAL
+    {5237, 0x05, 0x56, 3, 1, 0}, // SP_CLP_SRC_SEL
+    {5252, 0x05, 0x57, 1, 1, 0}, // SP_COAST_INV_REG
+    {5269, 0x05, 0x3E, 0, 8, 0}, // SP_CS_0x3E
+    {5280, 0x05, 0x43, 0, 12, 0}, // SP_CS_CLP_SP
+    {5293, 0x05, 0x41, 0, 12, 0}, // SP_CS_CLP_ST
+    {5306, 0x05, 0x47, 0, 12, 0}, // SP_CS_HS_SP
+    {5318, 0x05, 0x45, 0, 12, 0}, // SP_CS_HS_ST
+    {5330, 0x05, 0x3E, 0, 1, 0}, // SP_CS_P_SWAP
+    {5343, 0x05, 0x3E, 5, 1, 0}, // SP_DIS_SUB_COAST
+    {5360, 0x05, 0x35, 0, 12, 0}, // SP_DLT_REG
+    {5371, 0x05, 0x20, 3, 1, 0}, // SP_EXT_SYNC_SEL
+    {5387, 0x05, 0x55, 7, 1, 0}, // SP_HCST_AUTO_EN
+    {5403, 0x05, 0x3E, 1, 1, 0}, // SP_HD_MODE
+    {5414, 0x05, 0x56, 1, 1, 0}, // SP_HS2PLL_INV_REG
+    {5432, 0x05, 0x57, 6, 1, 0}, // SP_HS_LOOP_SEL
+    {5447, 0x05, 0x55, 4, 1, 0}, // SP_HS_POL_ATO
+    {5461, 0x05, 0x56, 5, 1, 0}, // SP_HS_PROC_INV_REG
+    {5480, 0x05, 0x57, 7, 1, 0}, // SP_HS_REG
+    {5490, 0x05, 0x3E, 2, 1, 0}, // SP_H_COAST
+    {5501, 0x05, 0x4F, 0, 12, 0}, // SP_H_CST_SP
+    {5513, 0x05, 0x4D, 0, 12, 0}, // SP_H_CST_ST
+    {5525, 0x05, 0x3E, 4, 1, 0}, // SP_H_PROTECT
+    {5538, 0x05, 0x37, 0, 8, 0}, // SP_H_PULSE_IGNOR
+    {5555, 0x05, 0x33, 0, 8, 0}, // SP_H_TIMER_VAL
+    {5570, 0x05, 0x3A, 0, 8, 0}, // SP_H_TOTAL_EQ_THD
+    {5588, 0x05, 0x20, 4, 1, 0}, // SP_JITTER_SYNC
+    {5603, 0x05, 0x57, 0, 1, 0}, // SP_NO_CLAMP_REG
+    {5619, 0x05, 0x57, 2, 1, 0}, // SP_NO_COAST_REG
+    {5635, 0x05, 0x39, 0, 8, 0}, // SP_POST_COAST
+    {5649, 0x05, 0x38, 0, 8, 0}, // SP_PRE_COAST
+    {5662, 0x05, 0x4B, 0, 12, 0}, // SP_RT_HS_SP
+    {5674, 0x05, 0x49, 0, 12, 0}, // SP_RT_HS_ST
+    {5686, 0x05, 0x3B, 4, 3, 0}, // SP_SDCS_VSSP_REG_H
+    {5705, 0x05, 0x40, 0, 8, 0}, // SP_SDCS_VSSP_REG_L
+    {5724, 0x05, 0x3B, 0, 3, 0}, // SP_SDCS_VSST_REG_H
+    {5743, 0x05, 0x3F, 0, 8, 0}, // SP_SDCS_VSST_REG_L
+    {5762, 0x05, 0x56, 0, 1, 0}, // SP_SOG_MODE
+    {5774, 0x05, 0x20, 1, 1, 0}, // SP_SOG_P_ATO
+    {5787, 0x05, 0x20, 2, 1, 0}, // SP_SOG_P_INV
+    {5800, 0x05, 0x20, 0, 1, 0}, // SP_SOG_SRC_SEL
+    {5815, 0x05, 0x56, 4, 1, 0}, // SP_SYNC_BYPS
+    {5828, 0x05, 0x26, 0, 12, 0}, // SP_SYNC_PD_THD
+    {5843, 0x05, 0x55, 6, 1, 0}, // SP_VS_POL_ATO
+    {5857, 0x05, 0x56, 6, 1, 0}, // SP_VS_PROC_INV_REG
+    {5876, 0x00, 0x00, 0, 8, 0}, // STATUS_00
+    {5886, 0x00, 0x03, 0, 8, 0}, // STATUS_03
+    {5896, 0x00, 0x04, 0, 8, 0}, // STATUS_04
+    {5906, 0x00, 0x05, 0, 8, 0}, // STATUS_05
+    {5916, 0x00, 0x0F, 0, 8, 0}, // STATUS_0F
+    {5926, 0x00, 0x16, 0, 8, 0}, // STATUS_16
+    {5936, 0x00, 0x15, 7, 1, 0}, // STATUS_DEINT_PULLDN
+    {5956, 0x00, 0x0E, 7, 1, 0}, // STATUS_GPIO_CLKOUT
+    {5975, 0x00, 0x0E, 0, 1, 0}, // STATUS_GPIO_GPIO
+    {5992, 0x00, 0x0E, 1, 1, 0}, // STATUS_GPIO_HALF
+    {6009, 0x00, 0x0E, 5, 1, 0}, // STATUS_GPIO_HBOUT
+    {6027, 0x00, 0x0E, 3, 1, 0}, // STATUS_GPIO_MBA
+    {6043, 0x00, 0x0E, 4, 1, 0}, // STATUS_GPIO_MCS1
+    {6060, 0x00, 0x0E, 2, 1, 0}, // STATUS_GPIO_SCLSA
+    {6078, 0x00, 0x0E, 6, 1, 0}, // STATUS_GPIO_VBOUT
+    {6096, 0x00, 0x05, 2, 1, 0}, // STATUS_IF_HT_BAD
+    {6113, 0x00, 0x00, 1, 1, 0}, // STATUS_IF_HT_OK
+    {6129, 0x00, 0x00, 2, 1, 0}, // STATUS_IF_HVT_OK
+    {6146, 0x00, 0x04, 0, 1, 0}, // STATUS_IF_INP_1080I
+    {6166, 0x00, 0x04, 4, 1, 0}, // STATUS_IF_INP_1808P
+    {6186, 0x00, 0x03, 5, 1, 0}, // STATUS_IF_INP_2200_1125I
+    {6211, 0x00, 0x04, 1, 1, 0}, // STATUS_IF_INP_2200_1125P
+    {6236, 0x00, 0x03, 6, 1, 0}, // STATUS_IF_INP_2376_1250I
+    {6261, 0x00, 0x04, 2, 1, 0}, // STATUS_IF_INP_2376_1250P
+    {6286, 0x00, 0x03, 7, 1, 0}, // STATUS_IF_INP_2640_1125I
+    {6311, 0x00, 0x04, 3, 1, 0}, // STATUS_IF_INP_2640_1125P
+    {6336, 0x00, 0x03, 4, 1, 0}, // STATUS_IF_INP_720
+    {6354, 0x00, 0x03, 2, 1, 0}, // STATUS_IF_INP_720P50
+    {6375, 0x00, 0x03, 3, 1, 0}, // STATUS_IF_INP_720P60
+    {6396, 0x00, 0x04, 5, 1, 0}, // STATUS_IF_INP_HD
+    {6413, 0x00, 0x04, 6, 1, 0}, // STATUS_IF_INP_INT
+    {6431, 0x00, 0x00, 3, 1, 0}, // STATUS_IF_INP_NTSC_INT
+    {6454, 0x00, 0x00, 4, 1, 0}, // STATUS_IF_INP_NTSC_PRG
+    {6477, 0x00, 0x00, 5, 1, 0}, // STATUS_IF_INP_PAL_INT
+    {6499, 0x00, 0x00, 6, 1, 0}, // STATUS_IF_INP_PAL_PRG
+    {6521, 0x00, 0x03, 1, 1, 0}, // STATUS_IF_INP_PC
+    {6538, 0x00, 0x04, 7, 1, 0}, // STATUS_IF_INP_PRG
+    {6556, 0x00, 0x00, 7, 1, 0}, // STATUS_IF_INP_SD
+    {6573, 0x00, 0x01, 7, 1, 0}, // STATUS_IF_INP_SVGA
+    {6592, 0x00, 0x01, 4, 1, 0}, // STATUS_IF_INP_SVGA60
+    {6613, 0x00, 0x01, 5, 1, 0}, // STATUS_IF_INP_SVGA75
+    {6634, 0x00, 0x01, 6, 1, 0}, // STATUS_IF_INP_SVGA85
+    {6655, 0x00, 0x05, 4, 1, 0}, // STATUS_IF_INP_SW
+    {6672, 0x00, 0x03, 0, 1, 0}, // STATUS_IF_INP_SXGA
+    {6691, 0x00, 0x02, 5, 1, 0}, // STATUS_IF_INP_SXGA60
+    {6712, 0x00, 0x02, 6, 1, 0}, // STATUS_IF_INP_SXGA75
+    {6733, 0x00, 0x02, 7, 1, 0}, // STATUS_IF_INP_SXGA85
+    {6754, 0x00, 0x05, 0, 1, 0}, // STATUS_IF_INP_USER
+    {6773, 0x00, 0x01, 3, 1, 0}, // STATUS_IF_INP_VGA
+    {6791, 0x00, 0x01, 0, 1, 0}, // STATUS_IF_INP_VGA60
+    {6811, 0x00, 0x01, 1, 1, 0}, // STATUS_IF_INP_VGA75
+    {6831, 0x00, 0x01, 2, 1, 0}, // STATUS_IF_INP_VGA86
+    {6851, 0x00, 0x02, 4, 1, 0}, // STATUS_IF_INP_XGA
+    {6869, 0x00, 0x02, 0, 1, 0}, // STATUS_IF_INP_XGA60
+    {6889, 0x00, 0x02, 1, 1, 0}, // STATUS_IF_INP_XGA70
+    {6909, 0x00, 0x02, 2, 1, 0}, // STATUS_IF_INP_XGA75
+    {6929, 0x00, 0x02, 3, 1, 0}, // STATUS_IF_INP_XGA85
+    {6949, 0x00, 0x05, 1, 1, 0}, // STATUS_IF_NO_SYNC
+    {6967, 0x00, 0x05, 3, 1, 0}, // STATUS_IF_VT_BAD
+    {6984, 0x00, 0x00, 0, 1, 0}, // STATUS_IF_VT_OK
+    {7000, 0x00, 0x0F, 7, 1, 0}, // STATUS_INT_INP_CSYNC
+    {7021, 0x00, 0x0F, 5, 1, 0}, // STATUS_INT_INP_HSYNC
+    {7042, 0x00, 0x0F, 4, 1, 0}, // STATUS_INT_INP_NO_SYNC
+    {7065, 0x00, 0x0F, 3, 1, 0}, // STATUS_INT_INP_SW
+    {7083, 0x00, 0x0F, 6, 1, 0}, // STATUS_INT_INP_VSYNC
+    {7104, 0x00, 0x0F, 0, 1, 0}, // STATUS_INT_SOG_BAD
+    {7123, 0x00, 0x0F, 2, 1, 0}, // STATUS_INT_SOG_OK
+    {7141, 0x00, 0x0F, 1, 1, 0}, // STATUS_INT_SOG_SW
+    {7159, 0x00, 0x13, 5, 1, 0}, // STATUS_MEM_FF_CAP_FIFO_EMPTY
+    {7188, 0x00, 0x13, 4, 1, 0}, // STATUS_MEM_FF_CAP_FIFO_FULL
+    {7216, 0x00, 0x14, 0, 1, 0}, // STATUS_MEM_FF_EXT_FIN
+    {7238, 0x00, 0x13, 7, 1, 0}, // STATUS_MEM_FF_PLY_FIFO_EMPTY
+    {7267, 0x00, 0x13, 6, 1, 0}, // STATUS_MEM_FF_PLY_FIFO_FULL
+    {7295, 0x00, 0x13, 3, 1, 0}, // STATUS_MEM_FF_RFF_FIFO_EMPTY
+    {7324, 0x00, 0x13, 2, 1, 0}, // STATUS_MEM_FF_RFF_FIFO_FULL
+    {7352, 0x00, 0x13, 1, 1, 0}, // STATUS_MEM_FF_WFF_FIFO_EMPTY
+    {7381, 0x00, 0x13, 0, 1, 0}, // STATUS_MEM_FF_WFF_FIFO_FULL
+    {7409, 0x00, 0x0A, 5, 1, 0}, // STATUS_MISC_HBLK
+    {7426, 0x00, 0x0A, 7, 1, 0}, // STATUS_MISC_HSYNC
+    {7444, 0x00, 0x0A, 1, 1, 0}, // STATUS_MISC_PIP_EN_H
+    {7465, 0x00, 0x0A, 0, 1, 0}, // STATUS_MISC_PIP_EN_V
+    {7486, 0x00, 0x09, 6, 1, 0}, // STATUS_MISC_PLL648_LOCK
+    {7510, 0x00, 0x09, 7, 1, 0}, // STATUS_MISC_PLLAD_LOCK
+    {7533, 0x00, 0x0A, 4, 1, 0}, // STATUS_MISC_VBLK
+    {7550, 0x00, 0x0A, 6, 1, 0}, // STATUS_MISC_VSYNC
+    {7568, 0x00, 0x19, 0, 12, 0}, // STATUS_SYNC_PROC_HLOW_LEN
+    {7594, 0x00, 0x16, 1, 1, 0}, // STATUS_SYNC_PROC_HSACT
+    {7617, 0x00, 0x16, 0, 1, 0}, // STATUS_SYNC_PROC_HSPOL
+    {7640, 0x00, 0x17, 0, 12, 0}, // STATUS_SYNC_PROC_HTOTAL
+    {7664, 0x00, 0x16, 3, 1, 0}, // STATUS_SYNC_PROC_VSACT
+    {7687, 0x00, 0x16, 2, 1, 0}, // STATUS_SYNC_PROC_VSPOL
+    {7710, 0x00, 0x1B, 0, 11, 0}, // STATUS_SYNC_PROC_VTOTAL
+    {7734, 0x00, 0x11, 0, 1, 0}, // STATUS_VDS_FIELD
+    {7751, 0x00, 0x10, 0, 4, 0}, // STATUS_VDS_FR_NUM
+    {7769, 0x00, 0x11, 1, 1, 0}, // STATUS_VDS_OUT_BLANK
+    {7790, 0x00, 0x10, 5, 1, 0}, // STATUS_VDS_OUT_HSYNC
+    {7811, 0x00, 0x10, 4, 1, 0}, // STATUS_VDS_OUT_VSYNC
+    {7832, 0x00, 0x11, 4, 11, 0}, // STATUS_VDS_VERT_COUNT
+    {7854, 0x00, 0x2E, 0, 16, 0}, // TEST_BUS
+    {7863, 0x00, 0x1F, 0, 8, 0}, // TEST_BUS_1F
+    {7875, 0x00, 0x23, 0, 8, 0}, // TEST_BUS_23
+    {7887, 0x00, 0x2E, 0, 8, 0}, // TEST_BUS_2E
+    {7899, 0x00, 0x2F, 0, 8, 0}, // TEST_BUS_2F
+    {7911, 0x00, 0x4D, 5, 1, 0}, // TEST_BUS_EN
+    {7923, 0x00, 0x4D, 0, 5, 0}, // TEST_BUS_SEL
+    {7936, 0x05, 0x63, 0, 8, 0}, // TEST_BUS_SP_SEL
+    {7952, 0x00, 0x20, 0, 16, 0}, // TEST_FF_STATUS
+    {7967, 0x03, 0x2A, 6, 2, 0}, // VDS_0X2A_RESERVED_2BITS
+    {7991, 0x03, 0x40, 0, 1, 0}, // VDS_1ST_INT_BYPS
+    {8008, 0x03, 0x40, 1, 1, 0}, // VDS_2ND_INT_BYPS
+    {8025, 0x03, 0x24, 0, 8, 0}, // VDS_3_24
+    {8034, 0x03, 0x26, 7, 1, 0}, // VDS_BLEV_AUTO_EN
+    {8051, 0x03, 0x2A, 0, 1, 0}, // VDS_BLEV_BYPS
+    {8065, 0x03, 0x29, 0, 8, 0}, // VDS_BLEV_GAIN
+    {8079, 0x03, 0x28, 0, 8, 0}, // VDS_BLEV_LEVEL
+    {8094, 0x03, 0x3E, 7, 1, 0}, // VDS_BLK_BF_EN
+    {8108, 0x03, 0x73, 3, 1, 0}, // VDS_BLUE_BYPS
+    {8122, 0x03, 0x73, 0, 3, 0}, // VDS_BLUE_RANGE
+    {8137, 0x03, 0x73, 4, 4, 0}, // VDS_BLUE_UGAIN
+    {8152, 0x03, 0x74, 0, 4, 0}, // VDS_BLUE_VGAIN
+    {8167, 0x03, 0x74, 4, 4, 0}, // VDS_BLUE_Y_LEV
+    {8182, 0x03, 0x65, 4, 1, 0}, // VDS_C1_BYPS
+    {8194, 0x03, 0x63, 0, 4, 0}, // VDS_C1_GAIN
+    {8206, 0x03, 0x61, 6, 10, 0}, // VDS_C1_TAG_HIGH_SLOPE
+    {8228, 0x03, 0x60, 4, 10, 0}, // VDS_C1_TAG_LOW_SLOPE
+    {8249, 0x03, 0x64, 4, 8, 0}, // VDS_C1_U_HIGH
+    {8263, 0x03, 0x63, 4, 8, 0}, // VDS_C1_U_LOW
+    {8276, 0x03, 0x65, 5, 8, 0}, // VDS_C1_Y_THRESH
+    {8292, 0x03, 0x6B, 5, 1, 0}, // VDS_C2_BYPS
+    {8304, 0x03, 0x69, 1, 4, 0}, // VDS_C2_GAIN
+    {8316, 0x03, 0x67, 7, 10, 0}, // VDS_C2_TAG_HIGH_SLOPE
+    {8338, 0x03, 0x66, 5, 10, 0}, // VDS_C2_TAG_LOW_SLOPE
+    {8359, 0x03, 0x6A, 5, 8, 0}, // VDS_C2_U_HIGH
+    {8373, 0x03, 0x69, 5, 8, 0}, // VDS_C2_U_LOW
+    {8386, 0x03, 0x6B, 6, 8, 0}, // VDS_C2_Y_THRESH
+    {8402, 0x03, 0x3E, 3, 1, 0}, // VDS_CONVT_BYPS
+    {8417, 0x03, 0x4E, 3, 1, 0}, // VDS_C_VPK_BYPS
+    {8432, 0x03, 0x4E, 4, 3, 0}, // VDS_C_VPK_CORE
+    {8447, 0x03, 0x4F, 0, 6, 0}, // VDS_C_VPK_GAIN
+    {8462, 0x03, 0x00, 2, 1, 0}, // VDS_DFIELD_EN
+    {8476, 0x03, 0x1F, 4, 1, 0}, // VDS_DIF_FR_SEL_EN
+    {8494, 0x03, 0x11, 4, 12, 0}, // VDS_DIS_HB_SP
+    {8508, 0x03, 0x10, 0, 12, 0}, // VDS_DIS_HB_ST
+    {8522, 0x03, 0x14, 4, 11, 0}, // VDS_DIS_VB_SP
+    {8536, 0x03, 0x13, 0, 11, 0}, // VDS_DIS_VB_ST
+    {8550, 0x03, 0x50, 7, 1, 0}, // VDS_DO_16B_EN
+    {8564, 0x03, 0x50, 6, 1, 0}, // VDS_DO_UVSEL_FLIP
+    {8582, 0x03, 0x50, 5, 1, 0}, // VDS_DO_UV_DEV_BYPS
+    {8601, 0x03, 0x3E, 4, 1, 0}, // VDS_DYN_BYPS
+    {8614, 0x03, 0x26, 6, 1, 0}, // VDS_D_RAM_BYPS
+    {8629, 0x03, 0x25, 0, 10, 0}, // VDS_D_SP
+    {8638, 0x03, 0x1F, 5, 1, 0}, // VDS_EN_FR_NUM_RST
+    {8656, 0x03, 0x6E, 4, 12, 0}, // VDS_EXT_HB_SP
+    {8670, 0x03, 0x6D, 0, 12, 0}, // VDS_EXT_HB_ST
+    {8684, 0x03, 0x71, 4, 11, 0}, // VDS_EXT_VB_SP
+    {8698, 0x03, 0x70, 0, 11, 0}, // VDS_EXT_VB_ST
+    {8712, 0x03, 0x1A, 6, 1, 0}, // VDS_FID_AA_DLY
+    {8727, 0x03, 0x1A, 7, 1, 0}, // VDS_FID_RST
+    {8739, 0x03, 0x00, 1, 1, 0}, // VDS_FIELDAB_EN
+    {8754, 0x03, 0x00, 3, 1, 0}, // VDS_FIELD_FLIP
+    {8769, 0x03, 0x1A, 4, 1, 0}, // VDS_FLOCK_EN
+    {8782, 0x03, 0x1F, 0, 4, 0}, // VDS_FRAME_NO
+    {8795, 0x03, 0x19, 0, 10, 0}, // VDS_FRAME_RST
+    {8809, 0x03, 0x1A, 5, 1, 0}, // VDS_FREERUN_FID
+    {8825, 0x03, 0x1B, 0, 32, 0}, // VDS_FR_SELECT
+    {8839, 0x03, 0x51, 7, 11, 0}, // VDS_GLB_NOISE
+    {8853, 0x03, 0x00, 6, 1, 0}, // VDS_HALF_EN
+    {8865, 0x03, 0x05, 4, 12, 0}, // VDS_HB_SP
+    {8875, 0x03, 0x04, 0, 12, 0}, // VDS_HB_ST
+    {8885, 0x03, 0x16, 0, 10, 0}, // VDS_HSCALE
+    {8896, 0x03, 0x00, 4, 1, 0}, // VDS_HSCALE_BYPS
+    {8912, 0x03, 0x01, 0, 12, 0}, // VDS_HSYNC_RST
+    {8926, 0x03, 0x0B, 4, 12, 0}, // VDS_HS_SP
+    {8936, 0x03, 0x0A, 0, 12, 0}, // VDS_HS_ST
+    {8946, 0x03, 0x40, 2, 1, 0}, // VDS_IN_DREG_BYPS
+    {8963, 0x03, 0x52, 5, 1, 0}, // VDS_NR_C_BYPS
+    {8977, 0x03, 0x52, 6, 1, 0}, // VDS_NR_DIF_LPF5_BYPS
+    {8998, 0x03, 0x55, 6, 1, 0}, // VDS_NR_EN_GLB_STILL
+    {9018, 0x03, 0x55, 4, 1, 0}, // VDS_NR_EN_H_NOISY
+    {9036, 0x03, 0x55, 7, 1, 0}, // VDS_NR_GLB_STILL_MENU
+    {9058, 0x03, 0x53, 7, 1, 0}, // VDS_NR_MIG_USER_EN
+    {9077, 0x03, 0x54, 0, 4, 0}, // VDS_NR_MI_GAIN
+    {9092, 0x03, 0x53, 0, 7, 0}, // VDS_NR_MI_OFFSET
+    {9109, 0x03, 0x55, 0, 4, 0}, // VDS_NR_MI_THRES
+    {9125, 0x03, 0x52, 7, 1, 0}, // VDS_NR_MI_TH_EN
+    {9141, 0x03, 0x56, 0, 7, 0}, // VDS_NR_NOISY_OFFSET
+    {9161, 0x03, 0x54, 4, 4, 0}, // VDS_NR_STILL_GAIN
+    {9179, 0x03, 0x52, 4, 1, 0}, // VDS_NR_Y_BYPS
+    {9193, 0x03, 0x60, 2, 1, 0}, // VDS_NS_BYPS
+    {9205, 0x03, 0x5B, 7, 15, 0}, // VDS_NS_SQUARE_RAD
+    {9223, 0x03, 0x59, 0, 8, 0}, // VDS_NS_U_CENTER
+    {9239, 0x03, 0x5B, 0, 7, 0}, // VDS_NS_U_GAIN
+    {9253, 0x03, 0x5A, 0, 8, 0}, // VDS_NS_V_CENTER
+    {9269, 0x03, 0x5E, 6, 7, 0}, // VDS_NS_V_GAIN
+    {9283, 0x03, 0x60, 3, 1, 0}, // VDS_NS_Y_ACTIVE_EN
+    {9302, 0x03, 0x5D, 6, 8, 0}, // VDS_NS_Y_HIGH_TH
+    {9319, 0x03, 0x5F, 5, 5, 0}, // VDS_NS_Y_LOW_TH
+    {9335, 0x03, 0x4A, 3, 5, 0}, // VDS_PK_HB_CMP
+    {9349, 0x03, 0x4A, 0, 3, 0}, // VDS_PK_HB_CORE
+    {9364, 0x03, 0x4B, 0, 6, 0}, // VDS_PK_HB_GAIN
+    {9379, 0x03, 0x4C, 3, 5, 0}, // VDS_PK_HH_CMP
+    {9393, 0x03, 0x4C, 0, 3, 0}, // VDS_PK_HH_CORE
+    {9408, 0x03, 0x4D, 0, 6, 0}, // VDS_PK_HH_GAIN
+    {9423, 0x03, 0x48, 3, 5, 0}, // VDS_PK_HL_CMP
+    {9437, 0x03, 0x48, 0, 3, 0}, // VDS_PK_HL_CORE
+    {9452, 0x03, 0x49, 0, 6, 0}, // VDS_PK_HL_GAIN
+    {9467, 0x03, 0x44, 3, 5, 0}, // VDS_PK_LB_CMP
+    {9481, 0x03, 0x44, 0, 3, 0}, // VDS_PK_LB_CORE
+    {9496, 0x03, 0x45, 0, 6, 0}, // VDS_PK_LB_GAIN
+    {9511, 0x03, 0x46, 3, 5, 0}, // VDS_PK_LH_CMP
+    {9525, 0x03, 0x46, 0, 3, 0}, // VDS_PK_LH_CORE
+    {9540, 0x03, 0x47, 0, 6, 0}, // VDS_PK_LH_GAIN
+    {9555, 0x03, 0x41, 0, 10, 0}, // VDS_PK_LINE_BUF_SP
+    {9574, 0x03, 0x42, 6, 1, 0}, // VDS_PK_RAM_BYPS
+    {9590, 0x03, 0x43, 3, 1, 0}, // VDS_PK_VH_HH_SEL
+    {9607, 0x03, 0x43, 2, 1, 0}, // VDS_PK_VH_HL_SEL
+    {9624, 0x03, 0x43, 1, 1, 0}, // VDS_PK_VL_HH_SEL
+    {9641, 0x03, 0x43, 0, 1, 0}, // VDS_PK_VL_HL_SEL
+    {9658, 0x03, 0x4E, 0, 1, 0}, // VDS_PK_Y_H_BYPS
+    {9674, 0x03, 0x4E, 1, 1, 0}, // VDS_PK_Y_V_BYPS
+    {9690, 0x03, 0x31, 5, 1, 0}, // VDS_SK_BYPS
+    {9702, 0x03, 0x31, 0, 4, 0}, // VDS_SK_GAIN
+    {9714, 0x03, 0x30, 0, 8, 0}, // VDS_SK_RANGE
+    {9727, 0x03, 0x2C, 0, 8, 0}, // VDS_SK_U_CENTER
+    {9743, 0x03, 0x2D, 0, 8, 0}, // VDS_SK_V_CENTER
+    {9759, 0x03, 0x31, 4, 1, 0}, // VDS_SK_Y_EN
+    {9771, 0x03, 0x2F, 0, 8, 0}, // VDS_SK_Y_HIGH_TH
+    {9788, 0x03, 0x2E, 0, 8, 0}, // VDS_SK_Y_LOW_TH
+    {9804, 0x03, 0x00, 7, 1, 0}, // VDS_SRESET
+    {9815, 0x03, 0x2B, 4, 3, 0}, // VDS_STEP_CLIP
+    {9829, 0x03, 0x2A, 4, 2, 0}, // VDS_STEP_DLY_CNTRL
+    {9848, 0x03, 0x2B, 0, 4, 0}, // VDS_STEP_GAIN
+    {9862, 0x03, 0x32, 3, 1, 0}, // VDS_SVM_2ND_BYPS
+    {9879, 0x03, 0x32, 0, 2, 0}, // VDS_SVM_BPF_CNTRL
+    {9897, 0x03, 0x33, 0, 8, 0}, // VDS_SVM_GAIN
+    {9910, 0x03, 0x34, 0, 8, 0}, // VDS_SVM_OFFSET
+    {9925, 0x03, 0x32, 2, 1, 0}, // VDS_SVM_POL_FLIP
+    {9942, 0x03, 0x32, 7, 1, 0}, // VDS_SVM_SIGMOID_BYPS
+    {9963, 0x03, 0x40, 4, 2, 0}, // VDS_SVM_V4CLK_DELAY
+    {9983, 0x03, 0x32, 4, 3, 0}, // VDS_SVM_VCLK_DELAY
+    {10002, 0x03, 0x00, 0, 1, 0}, // VDS_SYNC_EN
+    {10014, 0x03, 0x72, 7, 1, 0}, // VDS_SYNC_IN_SEL
+    {10030, 0x03, 0x3D, 0, 9, 0}, // VDS_SYNC_LEV
+    {10043, 0x03, 0x24, 3, 1, 0}, // VDS_TAP6_BYPS
+    {10057, 0x03, 0x50, 0, 4, 0}, // VDS_TEST_BUS_SEL
+    {10074, 0x03, 0x50, 4, 1, 0}, // VDS_TEST_EN
+    {10086, 0x03, 0x36, 0, 8, 0}, // VDS_UCOS_GAIN
+    {10100, 0x03, 0x27, 4, 4, 0}, // VDS_USER_MAX
+    {10113, 0x03, 0x27, 0, 4, 0}, // VDS_USER_MIN
+    {10126, 0x03, 0x38, 0, 8, 0}, // VDS_USIN_GAIN
+    {10140, 0x03, 0x3F, 0, 8, 0}, // VDS_UV_BLK_VAL
+    {10155, 0x03, 0x24, 0, 1, 0}, // VDS_UV_FLIP
+    {10167, 0x03, 0x2B, 7, 1, 0}, // VDS_UV_STEP_BYPS
+    {10184, 0x03, 0x24, 1, 1, 0}, // VDS_U_DELAY
+    {10196, 0x03, 0x3B, 0, 8, 0}, // VDS_U_OFST
+    {10207, 0x03, 0x08, 4, 11, 0}, // VDS_VB_SP
+    {10217, 0x03, 0x07, 0, 11, 0}, // VDS_VB_ST
+    {10227, 0x03, 0x37, 0, 8, 0}, // VDS_VCOS_GAIN
+    {10241, 0x03, 0x17, 4, 10, 0}, // VDS_VSCALE
+    {10252, 0x03, 0x00, 5, 1, 0}, // VDS_VSCALE_BYPS
+    {10268, 0x03, 0x39, 0, 8, 0}, // VDS_VSIN_GAIN
+    {10282, 0x03, 0x02, 4, 11, 0}, // VDS_VSYNC_RST
+    {10296, 0x03, 0x20, 0, 11, 0}, // VDS_VSYN_SIZE1
+    {10311, 0x03, 0x22, 0, 11, 0}, // VDS_VSYN_SIZE2
+    {10326, 0x03, 0x0E, 4, 11, 0}, // VDS_VS_SP
+    {10336, 0x03, 0x0D, 0, 11, 0}, // VDS_VS_ST
+    {10346, 0x03, 0x24, 2, 1, 0}, // VDS_V_DELAY
+    {10358, 0x03, 0x3C, 0, 8, 0}, // VDS_V_OFST
+    {10369, 0x03, 0x24, 6, 2, 0}, // VDS_WEN_DELAY
+    {10383, 0x03, 0x58, 0, 8, 0}, // VDS_WLEV_GAIN
+    {10397, 0x03, 0x57, 0, 8, 0}, // VDS_W_LEV
+    {10407, 0x03, 0x56, 7, 1, 0}, // VDS_W_LEV_BYPS
+    {10422, 0x03, 0x24, 4, 2, 0}, // VDS_Y_DELAY
+    {10434, 0x03, 0x35, 0, 8, 0}, // VDS_Y_GAIN
+    {10445, 0x03, 0x3A, 0, 8, 0}, // VDS_Y_OFST
+    {10456, 0x05, 0xD0, 0, 32, 0}, // VERYWIDEDUMMYREG
+    {10473, 0x00, 0x07, 1, 11, 0}, // VPERIOD_IF
+    {10484, 0x04, 0x42, 5, 1, 0}, // WFF_ADR_ADD_2
+    {10498, 0x04, 0x42, 0, 1, 0}, // WFF_ENABLE
+    {10509, 0x04, 0x42, 7, 1, 0}, // WFF_FF_STATUS_SEL
+    {10527, 0x04, 0x42, 2, 1, 0}, // WFF_FF_STA_INV
+    {10542, 0x04, 0x4B, 0, 3, 0}, // WFF_HB_DELAY
+    {10555, 0x04, 0x4A, 4, 1, 0}, // WFF_LINE_FLIP
+    {10569, 0x04, 0x42, 3, 1, 0}, // WFF_SAFE_GUARD
+    {10584, 0x04, 0x44, 0, 21, 0}, // WFF_SAFE_GUARD_A
+    {10601, 0x04, 0x47, 0, 21, 0}, // WFF_SAFE_GUARD_B
+    {10618, 0x04, 0x4B, 4, 3, 0}, // WFF_VB_DELAY
+    {10631, 0x04, 0x4A, 0, 1, 0}, // WFF_YUV_DEINTERLACE
+};
+
+#ifdef TV5725_FIELDS_CHECK
+// fails to compile if tv5725.h changed without regenerating this table
+static_assert(GBS::ADC_5_00::segment == 0x05 && GBS::ADC_5_00::byteOffset == 0x00 && GBS::ADC_5_00::bitOffset == 0 && GBS::ADC_5_00::bitWidth == 8, "ADC_5_00");
+static_assert(GBS::ADC_5_03::segment == 0x05 && GBS::ADC_5_03::byteOffset == 0x03 && GBS::ADC_5_03::bitOffset == 0 && GBS::ADC_5_03::bitWidth == 8, "ADC_5_03");
+static_assert(GBS::ADC_AUTO_OFST_DELAY::segment == 0x05 && GBS::ADC_AUTO_OFST_DELAY::byteOffset == 0x0E && GBS::ADC_AUTO_OFST_DELAY::bitOffset == 2 && GBS::ADC_AUTO_OFST_DELAY::bitWidth == 2, "ADC_AUTO_OFST_DELAY");
+static_assert(GBS::ADC_AUTO_OFST_EN::segment == 0x05 && GBS::ADC_AUTO_OFST_EN::byteOffset == 0x0E && GBS::ADC_AUTO_OFST_EN::bitOffset == 0 && GBS::ADC_AUTO_OFST_EN::bitWidth == 1, "ADC_AUTO_OFST_EN");
+static_assert(GBS::ADC_AUTO_OFST_PRD::segment == 0x05 && GBS::ADC_AUTO_OFST_PRD::byteOffset == 0x0E && GBS::ADC_AUTO_OFST_PRD::bitOffset == 1 && GBS::ADC_AUTO_OFST_PRD::bitWidth == 1, "ADC_AUTO_OFST_PRD");
+static_assert(GBS::ADC_AUTO_OFST_RANGE_REG::segment == 0x05 && GBS::ADC_AUTO_OFST_RANGE_REG::byteOffset == 0x0F && GBS::ADC_AUTO_OFST_RANGE_REG::bitOffset == 0 && GBS::ADC_AUTO_OFST_RANGE_REG::bitWidth == 8, "ADC_AUTO_OFST_RANGE_REG");
+static_assert(GBS::ADC_AUTO_OFST_STEP::segment == 0x05 && GBS::ADC_AUTO_OFST_STEP::byteOffset == 0x0E && GBS::ADC_AUTO_OFST_STEP::bitOffset == 4 && GBS::ADC_AUTO_OFST_STEP::bitWidth == 2, "ADC_AUTO_OFST_STEP");
+static_assert(GBS::ADC_AUTO_OFST_TEST::segment == 0x05 && GBS::ADC_AUTO_OFST_TEST::byteOffset == 0x0E && GBS::ADC_AUTO_OFST_TEST::bitOffset == 7 && GBS::ADC_AUTO_OFST_TEST::bitWidth == 1, "ADC_AUTO_OFST_TEST");
+static_assert(GBS::ADC_BGCTRL::segment == 0x05 && GBS::ADC_BGCTRL::byteOffset == 0x0B && GBS::ADC_BGCTRL::bitOffset == 0 && GBS::ADC_BGCTRL::bitWidth == 8, "ADC_BGCTRL");
+static_assert(GBS::ADC_BOFCTRL::segment == 0x05 && GBS::ADC_BOFCTRL::byteOffset == 0x08 && GBS::ADC_BOFCTRL::bitOffset == 0 && GBS::ADC_BOFCTRL::bitWidth == 8, "ADC_BOFCTRL");
+static_assert(GBS::ADC_CLK_ICLK1X::segment == 0x05 && GBS::ADC_CLK_ICLK1X::byteOffset == 0x00 && GBS::ADC_CLK_ICLK1X::bitOffset == 4 && GBS::ADC_CLK_ICLK1X::bitWidth == 1, "ADC_CLK_ICLK1X");
+static_assert(GBS::ADC_CLK_ICLK2X::segment == 0x05 && GBS::ADC_CLK_ICLK2X::byteOffset == 0x00 && GBS::ADC_CLK_ICLK2X::bitOffset == 3 && GBS::ADC_CLK_ICLK2X::bitWidth == 1, "ADC_CLK_ICLK2X");
+static_assert(GBS::ADC_CLK_PA::segment == 0x05 && GBS::ADC_CLK_PA::byteOffset == 0x00 && GBS::ADC_CLK_PA::bitOffset == 0 && GBS::ADC_CLK_PA::bitWidth == 2, "ADC_CLK_PA");
+static_assert(GBS::ADC_FLTR::segment == 0x05 && GBS::ADC_FLTR::byteOffset == 0x03 && GBS::ADC_FLTR::bitOffset == 4 && GBS::ADC_FLTR::bitWidth == 2, "ADC_FLTR");
+static_assert(GBS::ADC_GGCTRL::segment == 0x05 && GBS::ADC_GGCTRL::byteOffset == 0x0A && GBS::ADC_GGCTRL::bitOffset == 0 && GBS::ADC_GGCTRL::bitWidth == 8, "ADC_GGCTRL");
+static_assert(GBS::ADC_GOFCTRL::segment == 0x05 && GBS::ADC_GOFCTRL::byteOffset == 0x07 && GBS::ADC_GOFCTRL::bitOffset == 0 && GBS::ADC_GOFCTRL::bitWidth == 8, "ADC_GOFCTRL");
+static_assert(GBS::ADC_INPUT_SEL::segment == 0x05 && GBS::ADC_INPUT_SEL::byteOffset == 0x02 && GBS::ADC_INPUT_SEL::bitOffset == 6 && GBS::ADC_INPUT_SEL::bitWidth == 2, "ADC_INPUT_SEL");
+static_assert(GBS::ADC_POWDZ::segment == 0x05 && GBS::ADC_POWDZ::byteOffset == 0x03 && GBS::ADC_POWDZ::bitOffset == 0 && GBS::ADC_POWDZ::bitWidth == 1, "ADC_POWDZ");
+static_assert(GBS::ADC_RGCTRL::segment == 0x05 && GBS::ADC_RGCTRL::byteOffset == 0x09 && GBS::ADC_RGCTRL::bitOffset == 0 && GBS::ADC_RGCTRL::bitWidth == 8, "ADC_RGCTRL");
+static_assert(GBS::ADC_ROFCTRL::segment == 0x05 && GBS::ADC_ROFCTRL::byteOffset == 0x06 && GBS::ADC_ROFCTRL::bitOffset == 0 && GBS::ADC_ROFCTRL::bitWidth == 8, "ADC_ROFCTRL");
+static_assert(GBS::ADC_RYSEL_B::segment == 0x05 && GBS::ADC_RYSEL_B::byteOffset == 0x03 && GBS::ADC_RYSEL_B::bitOffset == 3 && GBS::ADC_RYSEL_B::bitWidth == 1, "ADC_RYSEL_B");
+static_assert(GBS::ADC_RYSEL_G::segment == 0x05 && GBS::ADC_RYSEL_G::byteOffset == 0x03 && GBS::ADC_RYSEL_G::bitOffset == 2 && GBS::ADC_RYSEL_G::bitWidth == 1, "ADC_RYSEL_G");
+static_assert(GBS::ADC_RYSEL_R::segment == 0x05 && GBS::ADC_RYSEL_R::byteOffset == 0x03 && GBS::ADC_RYSEL_R::bitOffset == 1 && GBS::ADC_RYSEL_R::bitWidth == 1, "ADC_RYSEL_R");
+static_assert(GBS::ADC_SOGCTRL::segment == 0x05 && GBS::ADC_SOGCTRL::byteOffset == 0x02 && GBS::ADC_SOGCTRL::bitOffset == 1 && GBS::ADC_SOGCTRL::bitWidth == 5, "ADC_SOGCTRL");
+static_assert(GBS::ADC_SOGEN::segment == 0x05 && GBS::ADC_SOGEN::byteOffset == 0x02 && GBS::ADC_SOGEN::bitOffset == 0 && GBS::ADC_SOGEN::bitWidth == 1, "ADC_SOGEN");
+static_assert(GBS::ADC_TA_05_CTRL::segment == 0x05 && GBS::ADC_TA_05_CTRL::byteOffset == 0x05 && GBS::ADC_TA_05_CTRL::bitOffset == 0 && GBS::ADC_TA_05_CTRL::bitWidth == 8, "ADC_TA_05_CTRL");
+static_assert(GBS::ADC_TA_05_EN::segment == 0x05 && GBS::ADC_TA_05_EN::byteOffset == 0x05 && GBS::ADC_TA_05_EN::bitOffset == 0 && GBS::ADC_TA_05_EN::bitWidth == 1, "ADC_TA_05_EN");
+static_assert(GBS::ADC_TEST_04::segment == 0x05 && GBS::ADC_TEST_04::byteOffset == 0x04 && GBS::ADC_TEST_04::bitOffset == 0 && GBS::ADC_TEST_04::bitWidth == 8, "ADC_TEST_04");
+static_assert(GBS::ADC_TEST_0C::segment == 0x05 && GBS::ADC_TEST_0C::byteOffset == 0x0C && GBS::ADC_TEST_0C::bitOffset == 0 && GBS::ADC_TEST_0C::bitWidth == 8, "ADC_TEST_0C");
+static_assert(GBS::ADC_TEST_0C_BIT1::segment == 0x05 && GBS::ADC_TEST_0C_BIT1::byteOffset == 0x0C && GBS::ADC_TEST_0C_BIT1::bitOffset == 1 && GBS::ADC_TEST_0C_BIT1::bitWidth == 1, "ADC_TEST_0C_BIT1");
+static_assert(GBS::ADC_TEST_0C_BIT3::segment == 0x05 && GBS::ADC_TEST_0C_BIT3::byteOffset == 0x0C && GBS::ADC_TEST_0C_BIT3::bitOffset == 3 && GBS::ADC_TEST_0C_BIT3::bitWidth == 1, "ADC_TEST_0C_BIT3");
+static_assert(GBS::ADC_TEST_0C_BIT4::segment == 0x05 && GBS::ADC_TEST_0C_BIT4::byteOffset == 0x0C && GBS::ADC_TEST_0C_BIT4::bitOffset == 4 && GBS::ADC_TEST_0C_BIT4::bitWidth == 1, "ADC_TEST_0C_BIT4");
+static_assert(GBS::ADC_TR_ISEL::segment == 0x05 && GBS::ADC_TR_ISEL::byteOffset == 0x04 && GBS::ADC_TR_ISEL::bitOffset == 2 && GBS::ADC_TR_ISEL::bitWidth == 3, "ADC_TR_ISEL");
+static_assert(GBS::ADC_TR_RSEL::segment == 0x05 && GBS::ADC_TR_RSEL::byteOffset == 0x04 && GBS::ADC_TR_RSEL::bitOffset == 0 && GBS::ADC_TR_RSEL::bitWidth == 2, "ADC_TR_RSEL");
+static_assert(GBS::ADC_TR_RSEL_04_BIT1::segment == 0x05 && GBS::ADC_TR_RSEL_04_BIT1::byteOffset == 0x04 && GBS::ADC_TR_RSEL_04_BIT1::bitOffset == 1 && GBS::ADC_TR_RSEL_04_BIT1::bitWidth == 1, "ADC_TR_RSEL_04_BIT1");
+static_assert(GBS::ADC_UNUSED_60::segment == 0x05 && GBS::ADC_UNUSED_60::byteOffset == 0x60 && GBS::ADC_UNUSED_60::bitOffset == 0 && GBS::ADC_UNUSED_60::bitWidth == 8, "ADC_UNUSED_60");
+static_assert(GBS::ADC_UNUSED_61::segment == 0x05 && GBS::ADC_UNUSED_61::byteOffset == 0x61 && GBS::ADC_UNUSED_61::bitOffset == 0 && GBS::ADC_UNUSED_61::bitWidth == 8, "ADC_UNUSED_61");
+static_assert(GBS::ADC_UNUSED_62::segment == 0x05 && GBS::ADC_UNUSED_62::byteOffset == 0x62 && GBS::ADC_UNUSED_62::bitOffset == 0 && GBS::ADC_UNUSED_62::bitWidth == 8, "ADC_UNUSED_62");
+static_assert(GBS::ADC_UNUSED_64::segment == 0x05 && GBS::ADC_UNUSED_64::byteOffset == 0x64 && GBS::ADC_UNUSED_64::bitOffset == 0 && GBS::ADC_UNUSED_64::bitWidth == 8, "ADC_UNUSED_64");
+static_assert(GBS::ADC_UNUSED_65::segment == 0x05 && GBS::ADC_UNUSED_65::byteOffset == 0x65 && GBS::ADC_UNUSED_65::bitOffset == 0 && GBS::ADC_UNUSED_65::bitWidth == 8, "ADC_UNUSED_65");
+static_assert(GBS::ADC_UNUSED_66::segment == 0x05 && GBS::ADC_UNUSED_66::byteOffset == 0x66 && GBS::ADC_UNUSED_66::bitOffset == 0 && GBS::ADC_UNUSED_66::bitWidth == 8, "ADC_UNUSED_66");
+static_assert(GBS::ADC_UNUSED_67::segment == 0x05 && GBS::ADC_UNUSED_67::byteOffset == 0x67 && GBS::ADC_UNUSED_67::bitOffset == 0 && GBS::ADC_UNUSED_67::bitWidth == 16, "ADC_UNUSED_67");
+static_assert(GBS::ADC_UNUSED_69::segment == 0x05 && GBS::ADC_UNUSED_69::byteOffset == 0x69 && GBS::ADC_UNUSED_69::bitOffset == 0 && GBS::ADC_UNUSED_69::bitWidth == 8, "ADC_UNUSED_69");
+static_assert(GBS::CAPTURE_ENABLE::segment == 0x04 && GBS::CAPTURE_ENABLE::byteOffset == 0x21 && GBS::CAPTURE_ENABLE::bitOffset == 0 && GBS::CAPTURE_ENABLE::bitWidth == 1, "CAPTURE_ENABLE");
+static_assert(GBS::CAP_FF_HALF_REQ::segment == 0x04 && GBS::CAP_FF_HALF_REQ::byteOffset == 0x21 && GBS::CAP_FF_HALF_REQ::bitOffset == 1 && GBS::CAP_FF_HALF_REQ::bitWidth == 1, "CAP_FF_HALF_REQ");
+static_assert(GBS::CAP_REQ_FREEZ::segment == 0x04 && GBS::CAP_REQ_FREEZ::byteOffset == 0x22 && GBS::CAP_REQ_FREEZ::bitOffset == 3 && GBS::CAP_REQ_FREEZ::bitWidth == 1, "CAP_REQ_FREEZ");
+static_assert(GBS::CAP_REQ_OVER::segment == 0x04 && GBS::CAP_REQ_OVER::byteOffset == 0x22 && GBS::CAP_REQ_OVER::bitOffset == 0 && GBS::CAP_REQ_OVER::bitWidth == 1, "CAP_REQ_OVER");
+static_assert(GBS::CAP_SAFE_GUARD_A::segment == 0x04 && GBS::CAP_SAFE_GUARD_A::byteOffset == 0x24 && GBS::CAP_SAFE_GUARD_A::bitOffset == 0 && GBS::CAP_SAFE_GUARD_A::bitWidth == 21, "CAP_SAFE_GUARD_A");
+static_assert(GBS::CAP_SAFE_GUARD_B::segment == 0x04 && GBS::CAP_SAFE_GUARD_B::byteOffset == 0x27 && GBS::CAP_SAFE_GUARD_B::bitOffset == 0 && GBS::CAP_SAFE_GUARD_B::bitWidth == 21, "CAP_SAFE_GUARD_B");
+static_assert(GBS::CAP_SAFE_GUARD_EN::segment == 0x04 && GBS::CAP_SAFE_GUARD_EN::byteOffset == 0x21 && GBS::CAP_SAFE_GUARD_EN::bitOffset == 5 && GBS::CAP_SAFE_GUARD_EN::bitWidth == 1, "CAP_SAFE_GUARD_EN");
+static_assert(GBS::CAP_STATUS_SEL::segment == 0x04 && GBS::CAP_STATUS_SEL::byteOffset == 0x22 && GBS::CAP_STATUS_SEL::bitOffset == 1 && GBS::CAP_STATUS_SEL::bitWidth == 1, "CAP_STATUS_SEL");
+static_assert(GBS::CHIP_ID_FOUNDRY::segment == 0x00 && GBS::CHIP_ID_FOUNDRY::byteOffset == 0x0B && GBS::CHIP_ID_FOUNDRY::bitOffset == 0 && GBS::CHIP_ID_FOUNDRY::bitWidth == 8, "CHIP_ID_FOUNDRY");
+static_assert(GBS::CHIP_ID_PRODUCT::segment == 0x00 && GBS::CHIP_ID_PRODUCT::byteOffset == 0x0C && GBS::CHIP_ID_PRODUCT::bitOffset == 0 && GBS::CHIP_ID_PRODUCT::bitWidth == 8, "CHIP_ID_PRODUCT");
+static_assert(GBS::CHIP_ID_REVISION::segment == 0x00 && GBS::CHIP_ID_REVISION::byteOffset == 0x0D && GBS::CHIP_ID_REVISION::bitOffset == 0 && GBS::CHIP_ID_REVISION::bitWidth == 8, "CHIP_ID_REVISION");
+static_assert(GBS::DAC_RGBS_ADC2DAC::segment == 0x00 && GBS::DAC_RGBS_ADC2DAC::byteOffset == 0x4B && GBS::DAC_RGBS_ADC2DAC::bitOffset == 2 && GBS::DAC_RGBS_ADC2DAC::bitWidth == 1, "DAC_RGBS_ADC2DAC");
+static_assert(GBS::DAC_RGBS_B0ENZ::segment == 0x00 && GBS::DAC_RGBS_B0ENZ::byteOffset == 0x45 && GBS::DAC_RGBS_B0ENZ::bitOffset == 0 && GBS::DAC_RGBS_B0ENZ::bitWidth == 1, "DAC_RGBS_B0ENZ");
+static_assert(GBS::DAC_RGBS_BYPS2DAC::segment == 0x00 && GBS::DAC_RGBS_BYPS2DAC::byteOffset == 0x4B && GBS::DAC_RGBS_BYPS2DAC::bitOffset == 1 && GBS::DAC_RGBS_BYPS2DAC::bitWidth == 1, "DAC_RGBS_BYPS2DAC");
+static_assert(GBS::DAC_RGBS_G0ENZ::segment == 0x00 && GBS::DAC_RGBS_G0ENZ::byteOffset == 0x44 && GBS::DAC_RGBS_G0ENZ::bitOffset == 5 && GBS::DAC_RGBS_G0ENZ::bitWidth == 1, "DAC_RGBS_G0ENZ");
+static_assert(GBS::DAC_RGBS_PWDNZ::segment == 0x00 && GBS::DAC_RGBS_PWDNZ::byteOffset == 0x44 && GBS::DAC_RGBS_PWDNZ::bitOffset == 0 && GBS::DAC_RGBS_PWDNZ::bitWidth == 1, "DAC_RGBS_PWDNZ");
+static_assert(GBS::DAC_RGBS_R0ENZ::segment == 0x00 && GBS::DAC_RGBS_R0ENZ::byteOffset == 0x44 && GBS::DAC_RGBS_R0ENZ::bitOffset == 2 && GBS::DAC_RGBS_R0ENZ::bitWidth == 1, "DAC_RGBS_R0ENZ");
+static_assert(GBS::DAC_RGBS_S0ENZ::segment == 0x00 && GBS::DAC_RGBS_S0ENZ::byteOffset == 0x45 && GBS::DAC_RGBS_S0ENZ::bitOffset == 3 && GBS::DAC_RGBS_S0ENZ::bitWidth == 1, "DAC_RGBS_S0ENZ");
+static_assert(GBS::DAC_RGBS_S1EN::segment == 0x00 && GBS::DAC_RGBS_S1EN::byteOffset == 0x45 && GBS::DAC_RGBS_S1EN::bitOffset == 4 && GBS::DAC_RGBS_S1EN::bitWidth == 1, "DAC_RGBS_S1EN");
+static_assert(GBS::DAC_RGBS_SPD::segment == 0x00 && GBS::DAC_RGBS_SPD::byteOffset == 0x45 && GBS::DAC_RGBS_SPD::bitOffset == 2 && GBS::DAC_RGBS_SPD::bitWidth == 1, "DAC_RGBS_SPD");
+static_assert(GBS::DEC1_BYPS::segment == 0x05 && GBS::DEC1_BYPS::byteOffset == 0x1F && GBS::DEC1_BYPS::bitOffset == 0 && GBS::DEC1_BYPS::bitWidth == 1, "DEC1_BYPS");
+static_assert(GBS::DEC2_BYPS::segment == 0x05 && GBS::DEC2_BYPS::byteOffset == 0x1F && GBS::DEC2_BYPS::bitOffset == 1 && GBS::DEC2_BYPS::bitWidth == 1, "DEC2_BYPS");
+static_assert(GBS::DEC_5_1F::segment == 0x05 && GBS::DEC_5_1F::byteOffset == 0x1F && GBS::DEC_5_1F::bitOffset == 0 && GBS::DEC_5_1F::bitWidth == 8, "DEC_5_1F");
+static_assert(GBS::DEC_IDREG_EN::segment == 0x05 && GBS::DEC_IDREG_EN::byteOffset == 0x1F && GBS::DEC_IDREG_EN::bitOffset == 7 && GBS::DEC_IDREG_EN::bitWidth == 1, "DEC_IDREG_EN");
+static_assert(GBS::DEC_MATRIX_BYPS::segment == 0x05 && GBS::DEC_MATRIX_BYPS::byteOffset == 0x1F && GBS::DEC_MATRIX_BYPS::bitOffset == 2 && GBS::DEC_MATRIX_BYPS::bitWidth == 1, "DEC_MATRIX_BYPS");
+static_assert(GBS::DEC_TEST_ENABLE::segment == 0x05 && GBS::DEC_TEST_ENABLE::byteOffset == 0x1F && GBS::DEC_TEST_ENABLE::bitOffset == 3 && GBS::DEC_TEST_ENABLE::bitWidth == 1, "DEC_TEST_ENABLE");
+static_assert(GBS::DEC_TEST_SEL::segment == 0x05 && GBS::DEC_TEST_SEL::byteOffset == 0x1F && GBS::DEC_TEST_SEL::bitOffset == 4 && GBS::DEC_TEST_SEL::bitWidth == 3, "DEC_TEST_SEL");
+static_assert(GBS::DEC_WEN_MODE::segment == 0x05 && GBS::DEC_WEN_MODE::byteOffset == 0x1E && GBS::DEC_WEN_MODE::bitOffset == 7 && GBS::DEC_WEN_MODE::bitWidth == 1, "DEC_WEN_MODE");
+static_assert(GBS::DEINT_00::segment == 0x02 && GBS::DEINT_00::byteOffset == 0x00 && GBS::DEINT_00::bitOffset == 0 && GBS::DEINT_00::bitWidth == 8, "DEINT_00");
+static_assert(GBS::DIAG_BOB_PLDY_RAM_BYPS::segment == 0x02 && GBS::DIAG_BOB_PLDY_RAM_BYPS::byteOffset == 0x00 && GBS::DIAG_BOB_PLDY_RAM_BYPS::bitOffset == 7 && GBS::DIAG_BOB_PLDY_RAM_BYPS::bitWidth == 1, "DIAG_BOB_PLDY_RAM_BYPS");
+static_assert(GBS::GBS_OPTION_PALFORCED60_ENABLED::segment == 0x01 && GBS::GBS_OPTION_PALFORCED60_ENABLED::byteOffset == 0x2C && GBS::GBS_OPTION_PALFORCED60_ENABLED::bitOffset == 2 && GBS::GBS_OPTION_PALFORCED60_ENABLED::bitWidth == 1, "GBS_OPTION_PALFORCED60_ENABLED");
+static_assert(GBS::GBS_OPTION_SCALING_RGBHV::segment == 0x01 && GBS::GBS_OPTION_SCALING_RGBHV::byteOffset == 0x2C && GBS::GBS_OPTION_SCALING_RGBHV::bitOffset == 1 && GBS::GBS_OPTION_SCALING_RGBHV::bitWidth == 1, "GBS_OPTION_SCALING_RGBHV");
+static_assert(GBS::GBS_OPTION_SCANLINES_ENABLED::segment == 0x01 && GBS::GBS_OPTION_SCANLINES_ENABLED::byteOffset == 0x2C && GBS::GBS_OPTION_SCANLINES_ENABLED::bitOffset == 0 && GBS::GBS_OPTION_SCANLINES_ENABLED::bitWidth == 1, "GBS_OPTION_SCANLINES_ENABLED");
+static_assert(GBS::GBS_PRESET_CUSTOM::segment == 0x01 && GBS::GBS_PRESET_CUSTOM::byteOffset == 0x2B && GBS::GBS_PRESET_CUSTOM::bitOffset == 7 && GBS::GBS_PRESET_CUSTOM::bitWidth == 1, "GBS_PRESET_CUSTOM");
+static_assert(GBS::GBS_PRESET_DISPLAY_CLOCK::segment == 0x01 && GBS::GBS_PRESET_DISPLAY_CLOCK::byteOffset == 0x2D && GBS::GBS_PRESET_DISPLAY_CLOCK::bitOffset == 0 && GBS::GBS_PRESET_DISPLAY_CLOCK::bitWidth == 8, "GBS_PRESET_DISPLAY_CLOCK");
+static_assert(GBS::GBS_PRESET_ID::segment == 0x01 && GBS::GBS_PRESET_ID::byteOffset == 0x2B && GBS::GBS_PRESET_ID::bitOffset == 0 && GBS::GBS_PRESET_ID::bitWidth == 7, "GBS_PRESET_ID");
+static_assert(GBS::GBS_RUNTIME_FTL_ADJUSTED::segment == 0x01 && GBS::GBS_RUNTIME_FTL_ADJUSTED::byteOffset == 0x2C && GBS::GBS_RUNTIME_FTL_ADJUSTED::bitOffset == 4 && GBS::GBS_RUNTIME_FTL_ADJUSTED::bitWidth == 1, "GBS_RUNTIME_FTL_ADJUSTED");
+static_assert(GBS::GBS_RUNTIME_UNUSED_BIT::segment == 0x01 && GBS::GBS_RUNTIME_UNUSED_BIT::byteOffset == 0x2C && GBS::GBS_RUNTIME_UNUSED_BIT::bitOffset == 3 && GBS::GBS_RUNTIME_UNUSED_BIT::bitWidth == 1, "GBS_RUNTIME_UNUSED_BIT");
+static_assert(GBS::GPIO_CONTROL_00::segment == 0x00 && GBS::GPIO_CONTROL_00::byteOffset == 0x52 && GBS::GPIO_CONTROL_00::bitOffset == 0 && GBS::GPIO_CONTROL_00::bitWidth == 8, "GPIO_CONTROL_00");
+static_assert(GBS::GPIO_CONTROL_01::segment == 0x00 && GBS::GPIO_CONTROL_01::byteOffset == 0x53 && GBS::GPIO_CONTROL_01::bitOffset == 0 && GBS::GPIO_CONTROL_01::bitWidth == 8, "GPIO_CONTROL_01");
+static_assert(GBS::HD_BLK_BU_DATA::segment == 0x01 && GBS::HD_BLK_BU_DATA::byteOffset == 0x54 && GBS::HD_BLK_BU_DATA::bitOffset == 0 && GBS::HD_BLK_BU_DATA::bitWidth == 8, "HD_BLK_BU_DATA");
+static_assert(GBS::HD_BLK_GY_DATA::segment == 0x01 && GBS::HD_BLK_GY_DATA::byteOffset == 0x53 && GBS::HD_BLK_GY_DATA::bitOffset == 0 && GBS::HD_BLK_GY_DATA::bitWidth == 8, "HD_BLK_GY_DATA");
+static_assert(GBS::HD_BLK_RV_DATA::segment == 0x01 && GBS::HD_BLK_RV_DATA::byteOffset == 0x55 && GBS::HD_BLK_RV_DATA::bitOffset == 0 && GBS::HD_BLK_RV_DATA::bitWidth == 8, "HD_BLK_RV_DATA");
+static_assert(GBS::HD_DYN_BYPS::segment == 0x01 && GBS::HD_DYN_BYPS::byteOffset == 0x30 && GBS::HD_DYN_BYPS::bitOffset == 2 && GBS::HD_DYN_BYPS::bitWidth == 1, "HD_DYN_BYPS");
+static_assert(GBS::HD_HB_SP::segment == 0x01 && GBS::HD_HB_SP::byteOffset == 0x3D && GBS::HD_HB_SP::bitOffset == 0 && GBS::HD_HB_SP::bitWidth == 12, "HD_HB_SP");
+static_assert(GBS::HD_HB_ST::segment == 0x01 && GBS::HD_HB_ST::byteOffset == 0x3B && GBS::HD_HB_ST::bitOffset == 0 && GBS::HD_HB_ST::bitWidth == 12, "HD_HB_ST");
+static_assert(GBS::HD_HSYNC_RST::segment == 0x01 && GBS::HD_HSYNC_RST::byteOffset == 0x37 && GBS::HD_HSYNC_RST::bitOffset == 0 && GBS::HD_HSYNC_RST::bitWidth == 11, "HD_HSYNC_RST");
+static_assert(GBS::HD_HS_SP::segment == 0x01 && GBS::HD_HS_SP::byteOffset == 0x41 && GBS::HD_HS_SP::bitOffset == 0 && GBS::HD_HS_SP::bitWidth == 12, "HD_HS_SP");
+static_assert(GBS::HD_HS_ST::segment == 0x01 && GBS::HD_HS_ST::byteOffset == 0x3F && GBS::HD_HS_ST::bitOffset == 0 && GBS::HD_HS_ST::bitWidth == 12, "HD_HS_ST");
+static_assert(GBS::HD_INI_ST::segment == 0x01 && GBS::HD_INI_ST::byteOffset == 0x39 && GBS::HD_INI_ST::bitOffset == 0 && GBS::HD_INI_ST::bitWidth == 11, "HD_INI_ST");
+static_assert(GBS::HD_MATRIX_BYPS::segment == 0x01 && GBS::HD_MATRIX_BYPS::byteOffset == 0x30 && GBS::HD_MATRIX_BYPS::bitOffset == 1 && GBS::HD_MATRIX_BYPS::bitWidth == 1, "HD_MATRIX_BYPS");
+static_assert(GBS::HD_SEL_BLK_IN::segment == 0x01 && GBS::HD_SEL_BLK_IN::byteOffset == 0x30 && GBS::HD_SEL_BLK_IN::bitOffset == 3 && GBS::HD_SEL_BLK_IN::bitWidth == 1, "HD_SEL_BLK_IN");
+static_assert(GBS::HD_U_OFFSET::segment == 0x01 && GBS::HD_U_OFFSET::byteOffset == 0x34 && GBS::HD_U_OFFSET::bitOffset == 0 && GBS::HD_U_OFFSET::bitWidth == 8, "HD_U_OFFSET");
+static_assert(GBS::HD_VB_SP::segment == 0x01 && GBS::HD_VB_SP::byteOffset == 0x45 && GBS::HD_VB_SP::bitOffset == 0 && GBS::HD_VB_SP::bitWidth == 12, "HD_VB_SP");
+static_assert(GBS::HD_VB_ST::segment == 0x01 && GBS::HD_VB_ST::byteOffset == 0x43 && GBS::HD_VB_ST::bitOffset == 0 && GBS::HD_VB_ST::bitWidth == 12, "HD_VB_ST");
+static_assert(GBS::HD_VS_SP::segment == 0x01 && GBS::HD_VS_SP::byteOffset == 0x49 && GBS::HD_VS_SP::bitOffset == 0 && GBS::HD_VS_SP::bitWidth == 12, "HD_VS_SP");
+static_assert(GBS::HD_VS_ST::segment == 0x01 && GBS::HD_VS_ST::byteOffset == 0x47 && GBS::HD_VS_ST::bitOffset == 0 && GBS::HD_VS_ST::bitWidth == 12, "HD_VS_ST");
+static_assert(GBS::HD_V_OFFSET::segment == 0x01 && GBS::HD_V_OFFSET::byteOffset == 0x36 && GBS::HD_V_OFFSET::bitOffset == 0 && GBS::HD_V_OFFSET::bitWidth == 8, "HD_V_OFFSET");
+static_assert(GBS::HD_Y_OFFSET::segment == 0x01 && GBS::HD_Y_OFFSET::byteOffset == 0x32 && GBS::HD_Y_OFFSET::bitOffset == 0 && GBS::HD_Y_OFFSET::bitWidth == 8, "HD_Y_OFFSET");
+static_assert(GBS::HPERIOD_IF::segment == 0x00 && GBS::HPERIOD_IF::byteOffset == 0x06 && GBS::HPERIOD_IF::bitOffset == 0 && GBS::HPERIOD_IF::bitWidth == 9, "HPERIOD_IF");
+static_assert(GBS::IF_AUTO_OFST_EN::segment == 0x01 && GBS::IF_AUTO_OFST_EN::byteOffset == 0x29 && GBS::IF_AUTO_OFST_EN::bitOffset == 0 && GBS::IF_AUTO_OFST_EN::bitWidth == 1, "IF_AUTO_OFST_EN");
+static_assert(GBS::IF_AUTO_OFST_PRD::segment == 0x01 && GBS::IF_AUTO_OFST_PRD::byteOffset == 0x29 && GBS::IF_AUTO_OFST_PRD::bitOffset == 1 && GBS::IF_AUTO_OFST_PRD::bitWidth == 1, "IF_AUTO_OFST_PRD");
+static_assert(GBS::IF_AUTO_OFST_U_RANGE::segment == 0x01 && GBS::IF_AUTO_OFST_U_RANGE::byteOffset == 0x2A && GBS::IF_AUTO_OFST_U_RANGE::bitOffset == 0 && GBS::IF_AUTO_OFST_U_RANGE::bitWidth == 4, "IF_AUTO_OFST_U_RANGE");
+static_assert(GBS::IF_AUTO_OFST_V_RANGE::segment == 0x01 && GBS::IF_AUTO_OFST_V_RANGE::byteOffset == 0x2A && GBS::IF_AUTO_OFST_V_RANGE::bitOffset == 4 && GBS::IF_AUTO_OFST_V_RANGE::bitWidth == 4, "IF_AUTO_OFST_V_RANGE");
+static_assert(GBS::IF_HBIN_SP::segment == 0x01 && GBS::IF_HBIN_SP::byteOffset == 0x26 && GBS::IF_HBIN_SP::bitOffset == 0 && GBS::IF_HBIN_SP::bitWidth == 12, "IF_HBIN_SP");
+static_assert(GBS::IF_HBIN_ST::segment == 0x01 && GBS::IF_HBIN_ST::byteOffset == 0x24 && GBS::IF_HBIN_ST::bitOffset == 0 && GBS::IF_HBIN_ST::bitWidth == 12, "IF_HBIN_ST");
+static_assert(GBS::IF_HB_SP::segment == 0x01 && GBS::IF_HB_SP::byteOffset == 0x12 && GBS::IF_HB_SP::bitOffset == 0 && GBS::IF_HB_SP::bitWidth == 11, "IF_HB_SP");
+static_assert(GBS::IF_HB_SP1::segment == 0x01 && GBS::IF_HB_SP1::byteOffset == 0x16 && GBS::IF_HB_SP1::bitOffset == 0 && GBS::IF_HB_SP1::bitWidth == 11, "IF_HB_SP1");
+static_assert(GBS::IF_HB_SP2::segment == 0x01 && GBS::IF_HB_SP2::byteOffset == 0x1A && GBS::IF_HB_SP2::bitOffset == 0 && GBS::IF_HB_SP2::bitWidth == 11, "IF_HB_SP2");
+static_assert(GBS::IF_HB_ST::segment == 0x01 && GBS::IF_HB_ST::byteOffset == 0x10 && GBS::IF_HB_ST::bitOffset == 0 && GBS::IF_HB_ST::bitWidth == 11, "IF_HB_ST");
+static_assert(GBS::IF_HB_ST2::segment == 0x01 && GBS::IF_HB_ST2::byteOffset == 0x18 && GBS::IF_HB_ST2::bitOffset == 0 && GBS::IF_HB_ST2::bitWidth == 11, "IF_HB_ST2");
+static_assert(GBS::IF_HSYNC_RST::segment == 0x01 && GBS::IF_HSYNC_RST::byteOffset == 0x0E && GBS::IF_HSYNC_RST::bitOffset == 0 && GBS::IF_HSYNC_RST::bitWidth == 11, "IF_HSYNC_RST");
+static_assert(GBS::IF_HS_DEC_FACTOR::segment == 0x01 && GBS::IF_HS_DEC_FACTOR::byteOffset == 0x0B && GBS::IF_HS_DEC_FACTOR::bitOffset == 4 && GBS::IF_HS_DEC_FACTOR::bitWidth == 2, "IF_HS_DEC_FACTOR");
+static_assert(GBS::IF_HS_FLIP::segment == 0x01 && GBS::IF_HS_FLIP::byteOffset == 0x00 && GBS::IF_HS_FLIP::bitOffset == 7 && GBS::IF_HS_FLIP::bitWidth == 1, "IF_HS_FLIP");
+static_assert(GBS::IF_HS_INT_LPF_BYPS::segment == 0x01 && GBS::IF_HS_INT_LPF_BYPS::byteOffset == 0x02 && GBS::IF_HS_INT_LPF_BYPS::bitOffset == 2 && GBS::IF_HS_INT_LPF_BYPS::bitWidth == 1, "IF_HS_INT_LPF_BYPS");
+static_assert(GBS::IF_HS_PSHIFT_BYPS::segment == 0x01 && GBS::IF_HS_PSHIFT_BYPS::byteOffset == 0x02 && GBS::IF_HS_PSHIFT_BYPS::bitOffset == 3 && GBS::IF_HS_PSHIFT_BYPS::bitWidth == 1, "IF_HS_PSHIFT_BYPS");
+static_assert(GBS::IF_HS_SEL_LPF::segment == 0x01 && GBS::IF_HS_SEL_LPF::byteOffset == 0x02 && GBS::IF_HS_SEL_LPF::bitOffset == 1 && GBS::IF_HS_SEL_LPF::bitWidth == 1, "IF_HS_SEL_LPF");
+static_assert(GBS::IF_HS_TAP11_BYPS::segment == 0x01 && GBS::IF_HS_TAP11_BYPS::byteOffset == 0x02 && GBS::IF_HS_TAP11_BYPS::bitOffset == 4 && GBS::IF_HS_TAP11_BYPS::bitWidth == 1, "IF_HS_TAP11_BYPS");
+static_assert(GBS::IF_HS_Y_PDELAY::segment == 0x01 && GBS::IF_HS_Y_PDELAY::byteOffset == 0x02 && GBS::IF_HS_Y_PDELAY::bitOffset == 5 && GBS::IF_HS_Y_PDELAY::bitWidth == 2, "IF_HS_Y_PDELAY");
+static_assert(GBS::IF_INI_ST::segment == 0x01 && GBS::IF_INI_ST::byteOffset == 0x0C && GBS::IF_INI_ST::bitOffset == 5 && GBS::IF_INI_ST::bitWidth == 11, "IF_INI_ST");
+static_assert(GBS::IF_IN_DREG_BYPS::segment == 0x01 && GBS::IF_IN_DREG_BYPS::byteOffset == 0x00 && GBS::IF_IN_DREG_BYPS::bitOffset == 0 && GBS::IF_IN_DREG_BYPS::bitWidth == 1, "IF_IN_DREG_BYPS");
+static_assert(GBS::IF_LD_RAM_BYPS::segment == 0x01 && GBS::IF_LD_RAM_BYPS::byteOffset == 0x0C && GBS::IF_LD_RAM_BYPS::bitOffset == 0 && GBS::IF_LD_RAM_BYPS::bitWidth == 1, "IF_LD_RAM_BYPS");
+static_assert(GBS::IF_LD_SEL_PROV::segment == 0x01 && GBS::IF_LD_SEL_PROV::byteOffset == 0x0B && GBS::IF_LD_SEL_PROV::bitOffset == 7 && GBS::IF_LD_SEL_PROV::bitWidth == 1, "IF_LD_SEL_PROV");
+static_assert(GBS::IF_LD_ST::segment == 0x01 && GBS::IF_LD_ST::byteOffset == 0x0C && GBS::IF_LD_ST::bitOffset == 1 && GBS::IF_LD_ST::bitWidth == 4, "IF_LD_ST");
+static_assert(GBS::IF_LD_WRST_SEL::segment == 0x01 && GBS::IF_LD_WRST_SEL::byteOffset == 0x28 && GBS::IF_LD_WRST_SEL::bitOffset == 1 && GBS::IF_LD_WRST_SEL::bitWidth == 1, "IF_LD_WRST_SEL");
+static_assert(GBS::IF_LINE_SP::segment == 0x01 && GBS::IF_LINE_SP::byteOffset == 0x22 && GBS::IF_LINE_SP::bitOffset == 0 && GBS::IF_LINE_SP::bitWidth == 12, "IF_LINE_SP");
+static_assert(GBS::IF_LINE_ST::segment == 0x01 && GBS::IF_LINE_ST::byteOffset == 0x20 && GBS::IF_LINE_ST::bitOffset == 0 && GBS::IF_LINE_ST::bitWidth == 12, "IF_LINE_ST");
+static_assert(GBS::IF_MATRIX_BYPS::segment == 0x01 && GBS::IF_MATRIX_BYPS::byteOffset == 0x00 && GBS::IF_MATRIX_BYPS::bitOffset == 1 && GBS::IF_MATRIX_BYPS::bitWidth == 1, "IF_MATRIX_BYPS");
+static_assert(GBS::IF_PRGRSV_CNTRL::segment == 0x01 && GBS::IF_PRGRSV_CNTRL::byteOffset == 0x00 && GBS::IF_PRGRSV_CNTRL::bitOffset == 6 && GBS::IF_PRGRSV_CNTRL::bitWidth == 1, "IF_PRGRSV_CNTRL");
+static_assert(GBS::IF_SEL16BIT::segment == 0x01 && GBS::IF_SEL16BIT::byteOffset == 0x00 && GBS::IF_SEL16BIT::bitOffset == 4 && GBS::IF_SEL16BIT::bitWidth == 1, "IF_SEL16BIT");
+static_assert(GBS::IF_SEL24BIT::segment == 0x01 && GBS::IF_SEL24BIT::byteOffset == 0x01 && GBS::IF_SEL24BIT::bitOffset == 7 && GBS::IF_SEL24BIT::bitWidth == 1, "IF_SEL24BIT");
+static_assert(GBS::IF_SEL_656::segment == 0x01 && GBS::IF_SEL_656::byteOffset == 0x00 && GBS::IF_SEL_656::bitOffset == 3 && GBS::IF_SEL_656::bitWidth == 1, "IF_SEL_656");
+static_assert(GBS::IF_SEL_ADC_SYNC::segment == 0x01 && GBS::IF_SEL_ADC_SYNC::byteOffset == 0x28 && GBS::IF_SEL_ADC_SYNC::bitOffset == 2 && GBS::IF_SEL_ADC_SYNC::bitWidth == 1, "IF_SEL_ADC_SYNC");
+static_assert(GBS::IF_SEL_HSCALE::segment == 0x01 && GBS::IF_SEL_HSCALE::byteOffset == 0x0B && GBS::IF_SEL_HSCALE::bitOffset == 6 && GBS::IF_SEL_HSCALE::bitWidth == 1, "IF_SEL_HSCALE");
+static_assert(GBS::IF_SEL_WEN::segment == 0x01 && GBS::IF_SEL_WEN::byteOffset == 0x02 && GBS::IF_SEL_WEN::bitOffset == 0 && GBS::IF_SEL_WEN::bitWidth == 1, "IF_SEL_WEN");
+static_assert(GBS::IF_TEST_EN::segment == 0x01 && GBS::IF_TEST_EN::byteOffset == 0x28 && GBS::IF_TEST_EN::bitOffset == 3 && GBS::IF_TEST_EN::bitWidth == 1, "IF_TEST_EN");
+static_assert(GBS::IF_TEST_SEL::segment == 0x01 && GBS::IF_TEST_SEL::byteOffset == 0x28 && GBS::IF_TEST_SEL::bitOffset == 4 && GBS::IF_TEST_SEL::bitWidth == 4, "IF_TEST_SEL");
+static_assert(GBS::IF_UV_REVERT::segment == 0x01 && GBS::IF_UV_REVERT::byteOffset == 0x00 && GBS::IF_UV_REVERT::bitOffset == 2 && GBS::IF_UV_REVERT::bitWidth == 1, "IF_UV_REVERT");
+static_assert(GBS::IF_VB_SP::segment == 0x01 && GBS::IF_VB_SP::byteOffset == 0x1E && GBS::IF_VB_SP::bitOffset == 0 && GBS::IF_VB_SP::bitWidth == 11, "IF_VB_SP");
+static_assert(GBS::IF_VB_ST::segment == 0x01 && GBS::IF_VB_ST::byteOffset == 0x1C && GBS::IF_VB_ST::bitOffset == 0 && GBS::IF_VB_ST::bitWidth == 11, "IF_VB_ST");
+static_assert(GBS::IF_VS_FLIP::segment == 0x01 && GBS::IF_VS_FLIP::byteOffset == 0x01 && GBS::IF_VS_FLIP::bitOffset == 0 && GBS::IF_VS_FLIP::bitWidth == 1, "IF_VS_FLIP");
+static_assert(GBS::IF_VS_SEL::segment == 0x01 && GBS::IF_VS_SEL::byteOffset == 0x00 && GBS::IF_VS_SEL::bitOffset == 5 && GBS::IF_VS_SEL::bitWidth == 1, "IF_VS_SEL");
+static_assert(GBS::INPUT_FORMATTER_02::segment == 0x01 && GBS::INPUT_FORMATTER_02::byteOffset == 0x02 && GBS::INPUT_FORMATTER_02::bitOffset == 0 && GBS::INPUT_FORMATTER_02::bitWidth == 8, "INPUT_FORMATTER_02");
+static_assert(GBS::INTERRUPT_CONTROL_00::segment == 0x00 && GBS::INTERRUPT_CONTROL_00::byteOffset == 0x58 && GBS::INTERRUPT_CONTROL_00::bitOffset == 0 && GBS::INTERRUPT_CONTROL_00::bitWidth == 8, "INTERRUPT_CONTROL_00");
+static_assert(GBS::INTERRUPT_CONTROL_01::segment == 0x00 && GBS::INTERRUPT_CONTROL_01::byteOffset == 0x59 && GBS::INTERRUPT_CONTROL_01::bitOffset == 0 && GBS::INTERRUPT_CONTROL_01::bitWidth == 8, "INTERRUPT_CONTROL_01");
+static_assert(GBS::INT_CONTROL_RST_NOHSYNC::segment == 0x00 && GBS::INT_CONTROL_RST_NOHSYNC::byteOffset == 0x58 && GBS::INT_CONTROL_RST_NOHSYNC::bitOffset == 4 && GBS::INT_CONTROL_RST_NOHSYNC::bitWidth == 1, "INT_CONTROL_RST_NOHSYNC");
+static_assert(GBS::INT_CONTROL_RST_SOGBAD::segment == 0x00 && GBS::INT_CONTROL_RST_SOGBAD::byteOffset == 0x58 && GBS::INT_CONTROL_RST_SOGBAD::bitOffset == 0 && GBS::INT_CONTROL_RST_SOGBAD::bitWidth == 1, "INT_CONTROL_RST_SOGBAD");
+static_assert(GBS::INT_CONTROL_RST_SOGSWITCH::segment == 0x00 && GBS::INT_CONTROL_RST_SOGSWITCH::byteOffset == 0x58 && GBS::INT_CONTROL_RST_SOGSWITCH::bitOffset == 1 && GBS::INT_CONTROL_RST_SOGSWITCH::bitWidth == 1, "INT_CONTROL_RST_SOGSWITCH");
+static_assert(GBS::MADPT_BIT_STILL_EN::segment == 0x02 && GBS::MADPT_BIT_STILL_EN::byteOffset == 0x19 && GBS::MADPT_BIT_STILL_EN::bitOffset == 0 && GBS::MADPT_BIT_STILL_EN::bitWidth == 1, "MADPT_BIT_STILL_EN");
+static_assert(GBS::MADPT_CMP_EN::segment == 0x02 && GBS::MADPT_CMP_EN::byteOffset == 0x35 && GBS::MADPT_CMP_EN::bitOffset == 6 && GBS::MADPT_CMP_EN::bitWidth == 1, "MADPT_CMP_EN");
+static_assert(GBS::MADPT_DD0_SEL::segment == 0x02 && GBS::MADPT_DD0_SEL::byteOffset == 0x35 && GBS::MADPT_DD0_SEL::bitOffset == 3 && GBS::MADPT_DD0_SEL::bitWidth == 1, "MADPT_DD0_SEL");
+static_assert(GBS::MADPT_EN_NOUT_FOR_LESS_STILL::segment == 0x02 && GBS::MADPT_EN_NOUT_FOR_LESS_STILL::byteOffset == 0x21 && GBS::MADPT_EN_NOUT_FOR_LESS_STILL::bitOffset == 5 && GBS::MADPT_EN_NOUT_FOR_LESS_STILL::bitWidth == 1, "MADPT_EN_NOUT_FOR_LESS_STILL");
+static_assert(GBS::MADPT_EN_NOUT_FOR_STILL::segment == 0x02 && GBS::MADPT_EN_NOUT_FOR_STILL::byteOffset == 0x21 && GBS::MADPT_EN_NOUT_FOR_STILL::bitOffset == 4 && GBS::MADPT_EN_NOUT_FOR_STILL::bitWidth == 1, "MADPT_EN_NOUT_FOR_STILL");
+static_assert(GBS::MADPT_EN_STILL_FOR_NRD::segment == 0x02 && GBS::MADPT_EN_STILL_FOR_NRD::byteOffset == 0x3A && GBS::MADPT_EN_STILL_FOR_NRD::bitOffset == 3 && GBS::MADPT_EN_STILL_FOR_NRD::bitWidth == 1, "MADPT_EN_STILL_FOR_NRD");
+static_assert(GBS::MADPT_EN_UV_DEINT::segment == 0x02 && GBS::MADPT_EN_UV_DEINT::byteOffset == 0x3A && GBS::MADPT_EN_UV_DEINT::bitOffset == 0 && GBS::MADPT_EN_UV_DEINT::bitWidth == 1, "MADPT_EN_UV_DEINT");
+static_assert(GBS::MADPT_HTAP_BYPS::segment == 0x02 && GBS::MADPT_HTAP_BYPS::byteOffset == 0x18 && GBS::MADPT_HTAP_BYPS::bitOffset == 3 && GBS::MADPT_HTAP_BYPS::bitWidth == 1, "MADPT_HTAP_BYPS");
+static_assert(GBS::MADPT_MI_1BIT_BYPS::segment == 0x02 && GBS::MADPT_MI_1BIT_BYPS::byteOffset == 0x0C && GBS::MADPT_MI_1BIT_BYPS::bitOffset == 4 && GBS::MADPT_MI_1BIT_BYPS::bitWidth == 1, "MADPT_MI_1BIT_BYPS");
+static_assert(GBS::MADPT_MI_1BIT_DLY::segment == 0x02 && GBS::MADPT_MI_1BIT_DLY::byteOffset == 0x3A && GBS::MADPT_MI_1BIT_DLY::bitOffset == 5 && GBS::MADPT_MI_1BIT_DLY::bitWidth == 2, "MADPT_MI_1BIT_DLY");
+static_assert(GBS::MADPT_MI_1BIT_FRAME2_EN::segment == 0x02 && GBS::MADPT_MI_1BIT_FRAME2_EN::byteOffset == 0x0C && GBS::MADPT_MI_1BIT_FRAME2_EN::bitOffset == 5 && GBS::MADPT_MI_1BIT_FRAME2_EN::bitWidth == 1, "MADPT_MI_1BIT_FRAME2_EN");
+static_assert(GBS::MADPT_MO_ADP_UV_EN::segment == 0x02 && GBS::MADPT_MO_ADP_UV_EN::byteOffset == 0x16 && GBS::MADPT_MO_ADP_UV_EN::bitOffset == 5 && GBS::MADPT_MO_ADP_UV_EN::bitWidth == 1, "MADPT_MO_ADP_UV_EN");
+static_assert(GBS::MADPT_NRD_VIIR_PD_BYPS::segment == 0x02 && GBS::MADPT_NRD_VIIR_PD_BYPS::byteOffset == 0x35 && GBS::MADPT_NRD_VIIR_PD_BYPS::bitOffset == 4 && GBS::MADPT_NRD_VIIR_PD_BYPS::bitWidth == 1, "MADPT_NRD_VIIR_PD_BYPS");
+static_assert(GBS::MADPT_PD_RAM_BYPS::segment == 0x02 && GBS::MADPT_PD_RAM_BYPS::byteOffset == 0x24 && GBS::MADPT_PD_RAM_BYPS::bitOffset == 2 && GBS::MADPT_PD_RAM_BYPS::bitWidth == 1, "MADPT_PD_RAM_BYPS");
+static_assert(GBS::MADPT_SEL_PHASE_INI::segment == 0x02 && GBS::MADPT_SEL_PHASE_INI::byteOffset == 0x31 && GBS::MADPT_SEL_PHASE_INI::bitOffset == 2 && GBS::MADPT_SEL_PHASE_INI::bitWidth == 1, "MADPT_SEL_PHASE_INI");
+static_assert(GBS::MADPT_STILL_NOISE_EST_EN::segment == 0x02 && GBS::MADPT_STILL_NOISE_EST_EN::byteOffset == 0x0A && GBS::MADPT_STILL_NOISE_EST_EN::bitOffset == 5 && GBS::MADPT_STILL_NOISE_EST_EN::bitWidth == 1, "MADPT_STILL_NOISE_EST_EN");
+static_assert(GBS::MADPT_UVDLY_PD_BYPS::segment == 0x02 && GBS::MADPT_UVDLY_PD_BYPS::byteOffset == 0x35 && GBS::MADPT_UVDLY_PD_BYPS::bitOffset == 5 && GBS::MADPT_UVDLY_PD_BYPS::bitWidth == 1, "MADPT_UVDLY_PD_BYPS");
+static_assert(GBS::MADPT_UVDLY_PD_SP::segment == 0x02 && GBS::MADPT_UVDLY_PD_SP::byteOffset == 0x39 && GBS::MADPT_UVDLY_PD_SP::bitOffset == 0 && GBS::MADPT_UVDLY_PD_SP::bitWidth == 4, "MADPT_UVDLY_PD_SP");
+static_assert(GBS::MADPT_UVDLY_PD_ST::segment == 0x02 && GBS::MADPT_UVDLY_PD_ST::byteOffset == 0x39 && GBS::MADPT_UVDLY_PD_ST::bitOffset == 4 && GBS::MADPT_UVDLY_PD_ST::bitWidth == 4, "MADPT_UVDLY_PD_ST");
+static_assert(GBS::MADPT_UV_DELAY::segment == 0x02 && GBS::MADPT_UV_DELAY::byteOffset == 0x17 && GBS::MADPT_UV_DELAY::bitOffset == 4 && GBS::MADPT_UV_DELAY::bitWidth == 4, "MADPT_UV_DELAY");
+static_assert(GBS::MADPT_UV_MI_DET_BYPS::segment == 0x02 && GBS::MADPT_UV_MI_DET_BYPS::byteOffset == 0x3A && GBS::MADPT_UV_MI_DET_BYPS::bitOffset == 7 && GBS::MADPT_UV_MI_DET_BYPS::bitWidth == 1, "MADPT_UV_MI_DET_BYPS");
+static_assert(GBS::MADPT_UV_MI_OFFSET::segment == 0x02 && GBS::MADPT_UV_MI_OFFSET::byteOffset == 0x3B && GBS::MADPT_UV_MI_OFFSET::bitOffset == 0 && GBS::MADPT_UV_MI_OFFSET::bitWidth == 7, "MADPT_UV_MI_OFFSET");
+static_assert(GBS::MADPT_UV_VSCALE_BYPS::segment == 0x02 && GBS::MADPT_UV_VSCALE_BYPS::byteOffset == 0x02 && GBS::MADPT_UV_VSCALE_BYPS::bitOffset == 7 && GBS::MADPT_UV_VSCALE_BYPS::bitWidth == 1, "MADPT_UV_VSCALE_BYPS");
+static_assert(GBS::MADPT_VIIR_BYPS::segment == 0x02 && GBS::MADPT_VIIR_BYPS::byteOffset == 0x26 && GBS::MADPT_VIIR_BYPS::bitOffset == 6 && GBS::MADPT_VIIR_BYPS::bitWidth == 1, "MADPT_VIIR_BYPS");
+static_assert(GBS::MADPT_VIIR_COEF::segment == 0x02 && GBS::MADPT_VIIR_COEF::byteOffset == 0x27 && GBS::MADPT_VIIR_COEF::bitOffset == 0 && GBS::MADPT_VIIR_COEF::bitWidth == 7, "MADPT_VIIR_COEF");
+static_assert(GBS::MADPT_VSCALE_DEC_FACTOR::segment == 0x02 && GBS::MADPT_VSCALE_DEC_FACTOR::byteOffset == 0x31 && GBS::MADPT_VSCALE_DEC_FACTOR::bitOffset == 0 && GBS::MADPT_VSCALE_DEC_FACTOR::bitWidth == 2, "MADPT_VSCALE_DEC_FACTOR");
+static_assert(GBS::MADPT_VTAP2_BYPS::segment == 0x02 && GBS::MADPT_VTAP2_BYPS::byteOffset == 0x19 && GBS::MADPT_VTAP2_BYPS::bitOffset == 2 && GBS::MADPT_VTAP2_BYPS::bitWidth == 1, "MADPT_VTAP2_BYPS");
+static_assert(GBS::MADPT_VTAP2_COEFF::segment == 0x02 && GBS::MADPT_VTAP2_COEFF::byteOffset == 0x19 && GBS::MADPT_VTAP2_COEFF::bitOffset == 4 && GBS::MADPT_VTAP2_COEFF::bitWidth == 4, "MADPT_VTAP2_COEFF");
+static_assert(GBS::MADPT_VTAP2_ROUND_SEL::segment == 0x02 && GBS::MADPT_VTAP2_ROUND_SEL::byteOffset == 0x19 && GBS::MADPT_VTAP2_ROUND_SEL::bitOffset == 3 && GBS::MADPT_VTAP2_ROUND_SEL::bitWidth == 1, "MADPT_VTAP2_ROUND_SEL");
+static_assert(GBS::MADPT_VT_FILTER_CNTRL::segment == 0x02 && GBS::MADPT_VT_FILTER_CNTRL::byteOffset == 0x16 && GBS::MADPT_VT_FILTER_CNTRL::bitOffset == 6 && GBS::MADPT_VT_FILTER_CNTRL::bitWidth == 1, "MADPT_VT_FILTER_CNTRL");
+static_assert(GBS::MADPT_Y_DELAY::segment == 0x02 && GBS::MADPT_Y_DELAY::byteOffset == 0x17 && GBS::MADPT_Y_DELAY::bitOffset == 0 && GBS::MADPT_Y_DELAY::bitWidth == 4, "MADPT_Y_DELAY");
+static_assert(GBS::MADPT_Y_DELAY_UV_DELAY::segment == 0x02 && GBS::MADPT_Y_DELAY_UV_DELAY::byteOffset == 0x17 && GBS::MADPT_Y_DELAY_UV_DELAY::bitOffset == 0 && GBS::MADPT_Y_DELAY_UV_DELAY::bitWidth == 8, "MADPT_Y_DELAY_UV_DELAY");
+static_assert(GBS::MADPT_Y_MI_DET_BYPS::segment == 0x02 && GBS::MADPT_Y_MI_DET_BYPS::byteOffset == 0x0A && GBS::MADPT_Y_MI_DET_BYPS::bitOffset == 7 && GBS::MADPT_Y_MI_DET_BYPS::bitWidth == 1, "MADPT_Y_MI_DET_BYPS");
+static_assert(GBS::MADPT_Y_MI_OFFSET::segment == 0x02 && GBS::MADPT_Y_MI_OFFSET::byteOffset == 0x0B && GBS::MADPT_Y_MI_OFFSET::bitOffset == 0 && GBS::MADPT_Y_MI_OFFSET::bitWidth == 7, "MADPT_Y_MI_OFFSET");
+static_assert(GBS::MADPT_Y_VSCALE_BYPS::segment == 0x02 && GBS::MADPT_Y_VSCALE_BYPS::byteOffset == 0x02 && GBS::MADPT_Y_VSCALE_BYPS::bitOffset == 6 && GBS::MADPT_Y_VSCALE_BYPS::bitWidth == 1, "MADPT_Y_VSCALE_BYPS");
+static_assert(GBS::MAPDT_VT_SEL_PRGV::segment == 0x02 && GBS::MAPDT_VT_SEL_PRGV::byteOffset == 0x16 && GBS::MAPDT_VT_SEL_PRGV::bitOffset == 7 && GBS::MAPDT_VT_SEL_PRGV::bitWidth == 1, "MAPDT_VT_SEL_PRGV");
+static_assert(GBS::MD_HD1250P_CNTRL::segment == 0x01 && GBS::MD_HD1250P_CNTRL::byteOffset == 0x7F && GBS::MD_HD1250P_CNTRL::bitOffset == 0 && GBS::MD_HD1250P_CNTRL::bitWidth == 7, "MD_HD1250P_CNTRL");
+static_assert(GBS::MD_HPERIOD_LOCK_VALUE::segment == 0x01 && GBS::MD_HPERIOD_LOCK_VALUE::byteOffset == 0x60 && GBS::MD_HPERIOD_LOCK_VALUE::bitOffset == 0 && GBS::MD_HPERIOD_LOCK_VALUE::bitWidth == 5, "MD_HPERIOD_LOCK_VALUE");
+static_assert(GBS::MD_HPERIOD_UNLOCK_VALUE::segment == 0x01 && GBS::MD_HPERIOD_UNLOCK_VALUE::byteOffset == 0x60 && GBS::MD_HPERIOD_UNLOCK_VALUE::bitOffset == 5 && GBS::MD_HPERIOD_UNLOCK_VALUE::bitWidth == 3, "MD_HPERIOD_UNLOCK_VALUE");
+static_assert(GBS::MD_HS_FLIP::segment == 0x01 && GBS::MD_HS_FLIP::byteOffset == 0x63 && GBS::MD_HS_FLIP::bitOffset == 6 && GBS::MD_HS_FLIP::bitWidth == 1, "MD_HS_FLIP");
+static_assert(GBS::MD_SEL_VGA60::segment == 0x01 && GBS::MD_SEL_VGA60::byteOffset == 0x65 && GBS::MD_SEL_VGA60::bitOffset == 7 && GBS::MD_SEL_VGA60::bitWidth == 1, "MD_SEL_VGA60");
+static_assert(GBS::MD_SVGA_60HZ_CNTRL::segment == 0x01 && GBS::MD_SVGA_60HZ_CNTRL::byteOffset == 0x6A && GBS::MD_SVGA_60HZ_CNTRL::bitOffset == 0 && GBS::MD_SVGA_60HZ_CNTRL::bitWidth == 8, "MD_SVGA_60HZ_CNTRL");
+static_assert(GBS::MD_SVGA_75HZ_CNTRL::segment == 0x01 && GBS::MD_SVGA_75HZ_CNTRL::byteOffset == 0x6B && GBS::MD_SVGA_75HZ_CNTRL::bitOffset == 0 && GBS::MD_SVGA_75HZ_CNTRL::bitWidth == 8, "MD_SVGA_75HZ_CNTRL");
+static_assert(GBS::MD_SVGA_85HZ_CNTRL::segment == 0x01 && GBS::MD_SVGA_85HZ_CNTRL::byteOffset == 0x6C && GBS::MD_SVGA_85HZ_CNTRL::bitOffset == 0 && GBS::MD_SVGA_85HZ_CNTRL::bitWidth == 8, "MD_SVGA_85HZ_CNTRL");
+static_assert(GBS::MD_SXGA_60HZ_CNTRL::segment == 0x01 && GBS::MD_SXGA_60HZ_CNTRL::byteOffset == 0x73 && GBS::MD_SXGA_60HZ_CNTRL::bitOffset == 0 && GBS::MD_SXGA_60HZ_CNTRL::bitWidth == 7, "MD_SXGA_60HZ_CNTRL");
+static_assert(GBS::MD_SXGA_75HZ_CNTRL::segment == 0x01 && GBS::MD_SXGA_75HZ_CNTRL::byteOffset == 0x74 && GBS::MD_SXGA_75HZ_CNTRL::bitOffset == 0 && GBS::MD_SXGA_75HZ_CNTRL::bitWidth == 7, "MD_SXGA_75HZ_CNTRL");
+static_assert(GBS::MD_SXGA_85HZ_CNTRL::segment == 0x01 && GBS::MD_SXGA_85HZ_CNTRL::byteOffset == 0x75 && GBS::MD_SXGA_85HZ_CNTRL::bitOffset == 0 && GBS::MD_SXGA_85HZ_CNTRL::bitWidth == 7, "MD_SXGA_85HZ_CNTRL");
+static_assert(GBS::MD_VGA_75HZ_CNTRL::segment == 0x01 && GBS::MD_VGA_75HZ_CNTRL::byteOffset == 0x66 && GBS::MD_VGA_75HZ_CNTRL::bitOffset == 0 && GBS::MD_VGA_75HZ_CNTRL::bitWidth == 8, "MD_VGA_75HZ_CNTRL");
+static_assert(GBS::MD_VGA_85HZ_CNTRL::segment == 0x01 && GBS::MD_VGA_85HZ_CNTRL::byteOffset == 0x67 && GBS::MD_VGA_85HZ_CNTRL::bitOffset == 0 && GBS::MD_VGA_85HZ_CNTRL::bitWidth == 8, "MD_VGA_85HZ_CNTRL");
+static_assert(GBS::MD_VGA_CNTRL::segment == 0x01 && GBS::MD_VGA_CNTRL::byteOffset == 0x65 && GBS::MD_VGA_CNTRL::bitOffset == 0 && GBS::MD_VGA_CNTRL::bitWidth == 7, "MD_VGA_CNTRL");
+static_assert(GBS::MD_VPERIOD_LOCK_VALUE::segment == 0x01 && GBS::MD_VPERIOD_LOCK_VALUE::byteOffset == 0x61 && GBS::MD_VPERIOD_LOCK_VALUE::bitOffset == 0 && GBS::MD_VPERIOD_LOCK_VALUE::bitWidth == 5, "MD_VPERIOD_LOCK_VALUE");
+static_assert(GBS::MD_VPERIOD_UNLOCK_VALUE::segment == 0x01 && GBS::MD_VPERIOD_UNLOCK_VALUE::byteOffset == 0x61 && GBS::MD_VPERIOD_UNLOCK_VALUE::bitOffset == 5 && GBS::MD_VPERIOD_UNLOCK_VALUE::bitWidth == 3, "MD_VPERIOD_UNLOCK_VALUE");
+static_assert(GBS::MD_VS_FLIP::segment == 0x01 && GBS::MD_VS_FLIP::byteOffset == 0x63 && GBS::MD_VS_FLIP::bitOffset == 7 && GBS::MD_VS_FLIP::bitWidth == 1, "MD_VS_FLIP");
+static_assert(GBS::MD_XGA_60HZ_CNTRL::segment == 0x01 && GBS::MD_XGA_60HZ_CNTRL::byteOffset == 0x6E && GBS::MD_XGA_60HZ_CNTRL::bitOffset == 0 && GBS::MD_XGA_60HZ_CNTRL::bitWidth == 8, "MD_XGA_60HZ_CNTRL");
+static_assert(GBS::MD_XGA_70HZ_CNTRL::segment == 0x01 && GBS::MD_XGA_70HZ_CNTRL::byteOffset == 0x6F && GBS::MD_XGA_70HZ_CNTRL::bitOffset == 0 && GBS::MD_XGA_70HZ_CNTRL::bitWidth == 7, "MD_XGA_70HZ_CNTRL");
+static_assert(GBS::MD_XGA_75HZ_CNTRL::segment == 0x01 && GBS::MD_XGA_75HZ_CNTRL::byteOffset == 0x70 && GBS::MD_XGA_75HZ_CNTRL::bitOffset == 0 && GBS::MD_XGA_75HZ_CNTRL::bitWidth == 7, "MD_XGA_75HZ_CNTRL");
+static_assert(GBS::MD_XGA_85HZ_CNTRL::segment == 0x01 && GBS::MD_XGA_85HZ_CNTRL::byteOffset == 0x71 && GBS::MD_XGA_85HZ_CNTRL::bitOffset == 0 && GBS::MD_XGA_85HZ_CNTRL::bitWidth == 7, "MD_XGA_85HZ_CNTRL");
+static_assert(GBS::MEM_ADR_DLY_REG::segment == 0x04 && GBS::MEM_ADR_DLY_REG::byteOffset == 0x1B && GBS::MEM_ADR_DLY_REG::bitOffset == 0 && GBS::MEM_ADR_DLY_REG::bitWidth == 3, "MEM_ADR_DLY_REG");
+static_assert(GBS::MEM_CLK_DLYCELL_SEL::segment == 0x04 && GBS::MEM_CLK_DLYCELL_SEL::byteOffset == 0x12 && GBS::MEM_CLK_DLYCELL_SEL::bitOffset == 1 && GBS::MEM_CLK_DLYCELL_SEL::bitWidth == 1, "MEM_CLK_DLYCELL_SEL");
+static_assert(GBS::MEM_CLK_DLY_REG::segment == 0x04 && GBS::MEM_CLK_DLY_REG::byteOffset == 0x1B && GBS::MEM_CLK_DLY_REG::bitOffset == 4 && GBS::MEM_CLK_DLY_REG::bitWidth == 3, "MEM_CLK_DLY_REG");
+static_assert(GBS::MEM_FBK_CLK_DLYCELL_SEL::segment == 0x04 && GBS::MEM_FBK_CLK_DLYCELL_SEL::byteOffset == 0x12 && GBS::MEM_FBK_CLK_DLYCELL_SEL::bitOffset == 2 && GBS::MEM_FBK_CLK_DLYCELL_SEL::bitWidth == 1, "MEM_FBK_CLK_DLYCELL_SEL");
+static_assert(GBS::MEM_FBK_CLK_INVERT::segment == 0x04 && GBS::MEM_FBK_CLK_INVERT::byteOffset == 0x13 && GBS::MEM_FBK_CLK_INVERT::bitOffset == 2 && GBS::MEM_FBK_CLK_INVERT::bitWidth == 1, "MEM_FBK_CLK_INVERT");
+static_assert(GBS::MEM_FF_TOP_FF_SEL::segment == 0x04 && GBS::MEM_FF_TOP_FF_SEL::byteOffset == 0x5B && GBS::MEM_FF_TOP_FF_SEL::bitOffset == 7 && GBS::MEM_FF_TOP_FF_SEL::bitWidth == 1, "MEM_FF_TOP_FF_SEL");
+static_assert(GBS::MEM_INTER_DLYCELL_SEL::segment == 0x04 && GBS::MEM_INTER_DLYCELL_SEL::byteOffset == 0x12 && GBS::MEM_INTER_DLYCELL_SEL::bitOffset == 0 && GBS::MEM_INTER_DLYCELL_SEL::bitWidth == 1, "MEM_INTER_DLYCELL_SEL");
+static_assert(GBS::MEM_PAD_CLK_INVERT::segment == 0x04 && GBS::MEM_PAD_CLK_INVERT::byteOffset == 0x13 && GBS::MEM_PAD_CLK_INVERT::bitOffset == 0 && GBS::MEM_PAD_CLK_INVERT::bitWidth == 1, "MEM_PAD_CLK_INVERT");
+static_assert(GBS::MEM_RD_DATA_CLK_INVERT::segment == 0x04 && GBS::MEM_RD_DATA_CLK_INVERT::byteOffset == 0x13 && GBS::MEM_RD_DATA_CLK_INVERT::bitOffset == 1 && GBS::MEM_RD_DATA_CLK_INVERT::bitWidth == 1, "MEM_RD_DATA_CLK_INVERT");
+static_assert(GBS::MEM_REQ_PBH_RFFH::segment == 0x04 && GBS::MEM_REQ_PBH_RFFH::byteOffset == 0x15 && GBS::MEM_REQ_PBH_RFFH::bitOffset == 0 && GBS::MEM_REQ_PBH_RFFH::bitWidth == 1, "MEM_REQ_PBH_RFFH");
+static_assert(GBS::OSD_BAR_FOREGROUND_VALUE::segment == 0x00 && GBS::OSD_BAR_FOREGROUND_VALUE::byteOffset == 0x98 && GBS::OSD_BAR_FOREGROUND_VALUE::bitOffset == 0 && GBS::OSD_BAR_FOREGROUND_VALUE::bitWidth == 8, "OSD_BAR_FOREGROUND_VALUE");
+static_assert(GBS::OSD_BAR_LENGTH::segment == 0x00 && GBS::OSD_BAR_LENGTH::byteOffset == 0x97 && GBS::OSD_BAR_LENGTH::bitOffset == 0 && GBS::OSD_BAR_LENGTH::bitWidth == 8, "OSD_BAR_LENGTH");
+static_assert(GBS::OSD_COMMAND_FINISH::segment == 0x00 && GBS::OSD_COMMAND_FINISH::byteOffset == 0x93 && GBS::OSD_COMMAND_FINISH::bitOffset == 7 && GBS::OSD_COMMAND_FINISH::bitWidth == 1, "OSD_COMMAND_FINISH");
+static_assert(GBS::OSD_DISP_EN::segment == 0x00 && GBS::OSD_DISP_EN::byteOffset == 0x90 && GBS::OSD_DISP_EN::bitOffset == 6 && GBS::OSD_DISP_EN::bitWidth == 1, "OSD_DISP_EN");
+static_assert(GBS::OSD_HORIZONTAL_ZOOM::segment == 0x00 && GBS::OSD_HORIZONTAL_ZOOM::byteOffset == 0x90 && GBS::OSD_HORIZONTAL_ZOOM::bitOffset == 1 && GBS::OSD_HORIZONTAL_ZOOM::bitWidth == 3, "OSD_HORIZONTAL_ZOOM");
+static_assert(GBS::OSD_INT_NG_LAT::segment == 0x00 && GBS::OSD_INT_NG_LAT::byteOffset == 0x94 && GBS::OSD_INT_NG_LAT::bitOffset == 3 && GBS::OSD_INT_NG_LAT::bitWidth == 1, "OSD_INT_NG_LAT");
+static_assert(GBS::OSD_MENU_BAR_BORD_COR::segment == 0x00 && GBS::OSD_MENU_BAR_BORD_COR::byteOffset == 0x92 && GBS::OSD_MENU_BAR_BORD_COR::bitOffset == 6 && GBS::OSD_MENU_BAR_BORD_COR::bitWidth == 3, "OSD_MENU_BAR_BORD_COR");
+static_assert(GBS::OSD_MENU_BAR_FONT_BGCOR::segment == 0x00 && GBS::OSD_MENU_BAR_FONT_BGCOR::byteOffset == 0x92 && GBS::OSD_MENU_BAR_FONT_BGCOR::bitOffset == 3 && GBS::OSD_MENU_BAR_FONT_BGCOR::bitWidth == 3, "OSD_MENU_BAR_FONT_BGCOR");
+static_assert(GBS::OSD_MENU_BAR_FONT_FORCOR::segment == 0x00 && GBS::OSD_MENU_BAR_FONT_FORCOR::byteOffset == 0x92 && GBS::OSD_MENU_BAR_FONT_FORCOR::bitOffset == 0 && GBS::OSD_MENU_BAR_FONT_FORCOR::bitWidth == 3, "OSD_MENU_BAR_FONT_FORCOR");
+static_assert(GBS::OSD_MENU_DISP_STYLE::segment == 0x00 && GBS::OSD_MENU_DISP_STYLE::byteOffset == 0x94 && GBS::OSD_MENU_DISP_STYLE::bitOffset == 0 && GBS::OSD_MENU_DISP_STYLE::bitWidth == 1, "OSD_MENU_DISP_STYLE");
+static_assert(GBS::OSD_MENU_EN::segment == 0x00 && GBS::OSD_MENU_EN::byteOffset == 0x90 && GBS::OSD_MENU_EN::bitOffset == 7 && GBS::OSD_MENU_EN::bitWidth == 1, "OSD_MENU_EN");
+static_assert(GBS::OSD_MENU_HORI_START::segment == 0x00 && GBS::OSD_MENU_HORI_START::byteOffset == 0x95 && GBS::OSD_MENU_HORI_START::bitOffset == 0 && GBS::OSD_MENU_HORI_START::bitWidth == 8, "OSD_MENU_HORI_START");
+static_assert(GBS::OSD_MENU_ICON_SEL::segment == 0x00 && GBS::OSD_MENU_ICON_SEL::byteOffset == 0x91 && GBS::OSD_MENU_ICON_SEL::bitOffset == 0 && GBS::OSD_MENU_ICON_SEL::bitWidth == 4, "OSD_MENU_ICON_SEL");
+static_assert(GBS::OSD_MENU_MOD_SEL::segment == 0x00 && GBS::OSD_MENU_MOD_SEL::byteOffset == 0x91 && GBS::OSD_MENU_MOD_SEL::bitOffset == 4 && GBS::OSD_MENU_MOD_SEL::bitWidth == 4, "OSD_MENU_MOD_SEL");
+static_assert(GBS::OSD_MENU_SEL_BGCOR::segment == 0x00 && GBS::OSD_MENU_SEL_BGCOR::byteOffset == 0x93 && GBS::OSD_MENU_SEL_BGCOR::bitOffset == 4 && GBS::OSD_MENU_SEL_BGCOR::bitWidth == 3, "OSD_MENU_SEL_BGCOR");
+static_assert(GBS::OSD_MENU_SEL_FORCOR::segment == 0x00 && GBS::OSD_MENU_SEL_FORCOR::byteOffset == 0x93 && GBS::OSD_MENU_SEL_FORCOR::bitOffset == 1 && GBS::OSD_MENU_SEL_FORCOR::bitWidth == 3, "OSD_MENU_SEL_FORCOR");
+static_assert(GBS::OSD_MENU_VER_START::segment == 0x00 && GBS::OSD_MENU_VER_START::byteOffset == 0x96 && GBS::OSD_MENU_VER_START::bitOffset == 0 && GBS::OSD_MENU_VER_START::bitWidth == 8, "OSD_MENU_VER_START");
+static_assert(GBS::OSD_SW_RESET::segment == 0x00 && GBS::OSD_SW_RESET::byteOffset == 0x90 && GBS::OSD_SW_RESET::bitOffset == 0 && GBS::OSD_SW_RESET::bitWidth == 1, "OSD_SW_RESET");
+static_assert(GBS::OSD_TEST_SEL::segment == 0x00 && GBS::OSD_TEST_SEL::byteOffset == 0x94 && GBS::OSD_TEST_SEL::bitOffset == 4 && GBS::OSD_TEST_SEL::bitWidth == 4, "OSD_TEST_SEL");
+static_assert(GBS::OSD_VERTICAL_ZOOM::segment == 0x00 && GBS::OSD_VERTICAL_ZOOM::byteOffset == 0x90 && GBS::OSD_VERTICAL_ZOOM::bitOffset == 4 && GBS::OSD_VERTICAL_ZOOM::bitWidth == 2, "OSD_VERTICAL_ZOOM");
+static_assert(GBS::OSD_YCBCR_RGB_FORMAT::segment == 0x00 && GBS::OSD_YCBCR_RGB_FORMAT::byteOffset == 0x94 && GBS::OSD_YCBCR_RGB_FORMAT::bitOffset == 2 && GBS::OSD_YCBCR_RGB_FORMAT::bitWidth == 1, "OSD_YCBCR_RGB_FORMAT");
+static_assert(GBS::OUT_SYNC_CNTRL::segment == 0x00 && GBS::OUT_SYNC_CNTRL::byteOffset == 0x4F && GBS::OUT_SYNC_CNTRL::bitOffset == 5 && GBS::OUT_SYNC_CNTRL::bitWidth == 1, "OUT_SYNC_CNTRL");
+static_assert(GBS::OUT_SYNC_SEL::segment == 0x00 && GBS::OUT_SYNC_SEL::byteOffset == 0x4F && GBS::OUT_SYNC_SEL::bitOffset == 6 && GBS::OUT_SYNC_SEL::bitWidth == 2, "OUT_SYNC_SEL");
+static_assert(GBS::PAD_BOUT_EN::segment == 0x00 && GBS::PAD_BOUT_EN::byteOffset == 0x48 && GBS::PAD_BOUT_EN::bitOffset == 0 && GBS::PAD_BOUT_EN::bitWidth == 1, "PAD_BOUT_EN");
+static_assert(GBS::PAD_CKIN_ENZ::segment == 0x00 && GBS::PAD_CKIN_ENZ::byteOffset == 0x49 && GBS::PAD_CKIN_ENZ::bitOffset == 0 && GBS::PAD_CKIN_ENZ::bitWidth == 1, "PAD_CKIN_ENZ");
+static_assert(GBS::PAD_CKOUT_ENZ::segment == 0x00 && GBS::PAD_CKOUT_ENZ::byteOffset == 0x49 && GBS::PAD_CKOUT_ENZ::bitOffset == 1 && GBS::PAD_CKOUT_ENZ::bitWidth == 1, "PAD_CKOUT_ENZ");
+static_assert(GBS::PAD_CONTROL_00_0x48::segment == 0x00 && GBS::PAD_CONTROL_00_0x48::byteOffset == 0x48 && GBS::PAD_CONTROL_00_0x48::bitOffset == 0 && GBS::PAD_CONTROL_00_0x48::bitWidth == 8, "PAD_CONTROL_00_0x48");
+static_assert(GBS::PAD_CONTROL_01_0x49::segment == 0x00 && GBS::PAD_CONTROL_01_0x49::byteOffset == 0x49 && GBS::PAD_CONTROL_01_0x49::bitOffset == 0 && GBS::PAD_CONTROL_01_0x49::bitWidth == 8, "PAD_CONTROL_01_0x49");
+static_assert(GBS::PAD_OSC_CNTRL::segment == 0x00 && GBS::PAD_OSC_CNTRL::byteOffset == 0x4A && GBS::PAD_OSC_CNTRL::bitOffset == 0 && GBS::PAD_OSC_CNTRL::bitWidth == 3, "PAD_OSC_CNTRL");
+static_assert(GBS::PAD_SYNC1_IN_ENZ::segment == 0x00 && GBS::PAD_SYNC1_IN_ENZ::byteOffset == 0x48 && GBS::PAD_SYNC1_IN_ENZ::bitOffset == 6 && GBS::PAD_SYNC1_IN_ENZ::bitWidth == 1, "PAD_SYNC1_IN_ENZ");
+static_assert(GBS::PAD_SYNC2_IN_ENZ::segment == 0x00 && GBS::PAD_SYNC2_IN_ENZ::byteOffset == 0x48 && GBS::PAD_SYNC2_IN_ENZ::bitOffset == 7 && GBS::PAD_SYNC2_IN_ENZ::bitWidth == 1, "PAD_SYNC2_IN_ENZ");
+static_assert(GBS::PAD_SYNC_OUT_ENZ::segment == 0x00 && GBS::PAD_SYNC_OUT_ENZ::byteOffset == 0x49 && GBS::PAD_SYNC_OUT_ENZ::bitOffset == 2 && GBS::PAD_SYNC_OUT_ENZ::bitWidth == 1, "PAD_SYNC_OUT_ENZ");
+static_assert(GBS::PAD_TRI_ENZ::segment == 0x00 && GBS::PAD_TRI_ENZ::byteOffset == 0x49 && GBS::PAD_TRI_ENZ::bitOffset == 4 && GBS::PAD_TRI_ENZ::bitWidth == 1, "PAD_TRI_ENZ");
+static_assert(GBS::PA_ADC_BYPSZ::segment == 0x05 && GBS::PA_ADC_BYPSZ::byteOffset == 0x18 && GBS::PA_ADC_BYPSZ::bitOffset == 0 && GBS::PA_ADC_BYPSZ::bitWidth == 1, "PA_ADC_BYPSZ");
+static_assert(GBS::PA_ADC_LAT::segment == 0x05 && GBS::PA_ADC_LAT::byteOffset == 0x18 && GBS::PA_ADC_LAT::bitOffset == 7 && GBS::PA_ADC_LAT::bitWidth == 1, "PA_ADC_LAT");
+static_assert(GBS::PA_ADC_LOCKOFF::segment == 0x05 && GBS::PA_ADC_LOCKOFF::byteOffset == 0x18 && GBS::PA_ADC_LOCKOFF::bitOffset == 6 && GBS::PA_ADC_LOCKOFF::bitWidth == 1, "PA_ADC_LOCKOFF");
+static_assert(GBS::PA_ADC_S::segment == 0x05 && GBS::PA_ADC_S::byteOffset == 0x18 && GBS::PA_ADC_S::bitOffset == 1 && GBS::PA_ADC_S::bitWidth == 5, "PA_ADC_S");
+static_assert(GBS::PA_SP_BYPSZ::segment == 0x05 && GBS::PA_SP_BYPSZ::byteOffset == 0x19 && GBS::PA_SP_BYPSZ::bitOffset == 0 && GBS::PA_SP_BYPSZ::bitWidth == 1, "PA_SP_BYPSZ");
+static_assert(GBS::PA_SP_LAT::segment == 0x05 && GBS::PA_SP_LAT::byteOffset == 0x19 && GBS::PA_SP_LAT::bitOffset == 7 && GBS::PA_SP_LAT::bitWidth == 1, "PA_SP_LAT");
+static_assert(GBS::PA_SP_LOCKOFF::segment == 0x05 && GBS::PA_SP_LOCKOFF::byteOffset == 0x19 && GBS::PA_SP_LOCKOFF::bitOffset == 6 && GBS::PA_SP_LOCKOFF::bitWidth == 1, "PA_SP_LOCKOFF");
+static_assert(GBS::PA_SP_S::segment == 0x05 && GBS::PA_SP_S::byteOffset == 0x19 && GBS::PA_SP_S::bitOffset == 1 && GBS::PA_SP_S::bitWidth == 5, "PA_SP_S");
+static_assert(GBS::PB_BYPASS::segment == 0x04 && GBS::PB_BYPASS::byteOffset == 0x2B && GBS::PB_BYPASS::bitOffset == 3 && GBS::PB_BYPASS::bitWidth == 1, "PB_BYPASS");
+static_assert(GBS::PB_CAP_OFFSET::segment == 0x04 && GBS::PB_CAP_OFFSET::byteOffset == 0x37 && GBS::PB_CAP_OFFSET::bitOffset == 0 && GBS::PB_CAP_OFFSET::bitWidth == 10, "PB_CAP_OFFSET");
+static_assert(GBS::PB_CUT_REFRESH::segment == 0x04 && GBS::PB_CUT_REFRESH::byteOffset == 0x2B && GBS::PB_CUT_REFRESH::bitOffset == 0 && GBS::PB_CUT_REFRESH::bitWidth == 1, "PB_CUT_REFRESH");
+static_assert(GBS::PB_DB_BUFFER_EN::segment == 0x04 && GBS::PB_DB_BUFFER_EN::byteOffset == 0x2B && GBS::PB_DB_BUFFER_EN::bitOffset == 5 && GBS::PB_DB_BUFFER_EN::bitWidth == 1, "PB_DB_BUFFER_EN");
+static_assert(GBS::PB_ENABLE::segment == 0x04 && GBS::PB_ENABLE::byteOffset == 0x2B && GBS::PB_ENABLE::bitOffset == 7 && GBS::PB_ENABLE::bitWidth == 1, "PB_ENABLE");
+static_assert(GBS::PB_FETCH_NUM::segment == 0x04 && GBS::PB_FETCH_NUM::byteOffset == 0x39 && GBS::PB_FETCH_NUM::bitOffset == 0 && GBS::PB_FETCH_NUM::bitWidth == 10, "PB_FETCH_NUM");
+static_assert(GBS::PB_GENERAL_FLAG_REG::segment == 0x04 && GBS::PB_GENERAL_FLAG_REG::byteOffset == 0x2D && GBS::PB_GENERAL_FLAG_REG::bitOffset == 0 && GBS::PB_GENERAL_FLAG_REG::bitWidth == 8, "PB_GENERAL_FLAG_REG");
+static_assert(GBS::PB_MAST_FLAG_REG::segment == 0x04 && GBS::PB_MAST_FLAG_REG::byteOffset == 0x2C && GBS::PB_MAST_FLAG_REG::bitOffset == 0 && GBS::PB_MAST_FLAG_REG::bitWidth == 8, "PB_MAST_FLAG_REG");
+static_assert(GBS::PB_REQ_SEL::segment == 0x04 && GBS::PB_REQ_SEL::byteOffset == 0x2B && GBS::PB_REQ_SEL::bitOffset == 1 && GBS::PB_REQ_SEL::bitWidth == 2, "PB_REQ_SEL");
+static_assert(GBS::PIP_CONVT_BYPS::segment == 0x03 && GBS::PIP_CONVT_BYPS::byteOffset == 0x81 && GBS::PIP_CONVT_BYPS::bitOffset == 0 && GBS::PIP_CONVT_BYPS::bitWidth == 1, "PIP_CONVT_BYPS");
+static_assert(GBS::PIP_DREG_BYPS::segment == 0x03 && GBS::PIP_DREG_BYPS::byteOffset == 0x81 && GBS::PIP_DREG_BYPS::bitOffset == 3 && GBS::PIP_DREG_BYPS::bitWidth == 1, "PIP_DREG_BYPS");
+static_assert(GBS::PIP_DYN_BYPS::segment == 0x03 && GBS::PIP_DYN_BYPS::byteOffset == 0x80 && GBS::PIP_DYN_BYPS::bitOffset == 7 && GBS::PIP_DYN_BYPS::bitWidth == 1, "PIP_DYN_BYPS");
+static_assert(GBS::PIP_EN::segment == 0x03 && GBS::PIP_EN::byteOffset == 0x81 && GBS::PIP_EN::bitOffset == 7 && GBS::PIP_EN::bitWidth == 1, "PIP_EN");
+static_assert(GBS::PIP_H_SP::segment == 0x03 && GBS::PIP_H_SP::byteOffset == 0x8A && GBS::PIP_H_SP::bitOffset == 0 && GBS::PIP_H_SP::bitWidth == 12, "PIP_H_SP");
+static_assert(GBS::PIP_H_ST::segment == 0x03 && GBS::PIP_H_ST::byteOffset == 0x88 && GBS::PIP_H_ST::bitOffset == 0 && GBS::PIP_H_ST::bitWidth == 12, "PIP_H_ST");
+static_assert(GBS::PIP_SUB_16B_SEL::segment == 0x03 && GBS::PIP_SUB_16B_SEL::byteOffset == 0x80 && GBS::PIP_SUB_16B_SEL::bitOffset == 6 && GBS::PIP_SUB_16B_SEL::bitWidth == 1, "PIP_SUB_16B_SEL");
+static_assert(GBS::PIP_TAP3_BYPS::segment == 0x03 && GBS::PIP_TAP3_BYPS::byteOffset == 0x80 && GBS::PIP_TAP3_BYPS::bitOffset == 3 && GBS::PIP_TAP3_BYPS::bitWidth == 1, "PIP_TAP3_BYPS");
+static_assert(GBS::PIP_UV_FLIP::segment == 0x03 && GBS::PIP_UV_FLIP::byteOffset == 0x80 && GBS::PIP_UV_FLIP::bitOffset == 0 && GBS::PIP_UV_FLIP::bitWidth == 1, "PIP_UV_FLIP");
+static_assert(GBS::PIP_U_DELAY::segment == 0x03 && GBS::PIP_U_DELAY::byteOffset == 0x80 && GBS::PIP_U_DELAY::bitOffset == 1 && GBS::PIP_U_DELAY::bitWidth == 1, "PIP_U_DELAY");
+static_assert(GBS::PIP_U_GAIN::segment == 0x03 && GBS::PIP_U_GAIN::byteOffset == 0x83 && GBS::PIP_U_GAIN::bitOffset == 0 && GBS::PIP_U_GAIN::bitWidth == 8, "PIP_U_GAIN");
+static_assert(GBS::PIP_U_OFST::segment == 0x03 && GBS::PIP_U_OFST::byteOffset == 0x86 && GBS::PIP_U_OFST::bitOffset == 0 && GBS::PIP_U_OFST::bitWidth == 8, "PIP_U_OFST");
+static_assert(GBS::PIP_V_DELAY::segment == 0x03 && GBS::PIP_V_DELAY::byteOffset == 0x80 && GBS::PIP_V_DELAY::bitOffset == 2 && GBS::PIP_V_DELAY::bitWidth == 1, "PIP_V_DELAY");
+static_assert(GBS::PIP_V_GAIN::segment == 0x03 && GBS::PIP_V_GAIN::byteOffset == 0x84 && GBS::PIP_V_GAIN::bitOffset == 0 && GBS::PIP_V_GAIN::bitWidth == 8, "PIP_V_GAIN");
+static_assert(GBS::PIP_V_OFST::segment == 0x03 && GBS::PIP_V_OFST::byteOffset == 0x87 && GBS::PIP_V_OFST::bitOffset == 0 && GBS::PIP_V_OFST::bitWidth == 8, "PIP_V_OFST");
+static_assert(GBS::PIP_V_SP::segment == 0x03 && GBS::PIP_V_SP::byteOffset == 0x8E && GBS::PIP_V_SP::bitOffset == 0 && GBS::PIP_V_SP::bitWidth == 11, "PIP_V_SP");
+static_assert(GBS::PIP_V_ST::segment == 0x03 && GBS::PIP_V_ST::byteOffset == 0x8C && GBS::PIP_V_ST::bitOffset == 0 && GBS::PIP_V_ST::bitWidth == 11, "PIP_V_ST");
+static_assert(GBS::PIP_Y_DELAY::segment == 0x03 && GBS::PIP_Y_DELAY::byteOffset == 0x80 && GBS::PIP_Y_DELAY::bitOffset == 4 && GBS::PIP_Y_DELAY::bitWidth == 2, "PIP_Y_DELAY");
+static_assert(GBS::PIP_Y_GAIN::segment == 0x03 && GBS::PIP_Y_GAIN::byteOffset == 0x82 && GBS::PIP_Y_GAIN::bitOffset == 0 && GBS::PIP_Y_GAIN::bitWidth == 8, "PIP_Y_GAIN");
+static_assert(GBS::PIP_Y_OFST::segment == 0x03 && GBS::PIP_Y_OFST::byteOffset == 0x85 && GBS::PIP_Y_OFST::bitOffset == 0 && GBS::PIP_Y_OFST::bitWidth == 8, "PIP_Y_OFST");
+static_assert(GBS::PLL648_CONTROL_01::segment == 0x00 && GBS::PLL648_CONTROL_01::byteOffset == 0x41 && GBS::PLL648_CONTROL_01::bitOffset == 0 && GBS::PLL648_CONTROL_01::bitWidth == 8, "PLL648_CONTROL_01");
+static_assert(GBS::PLL648_CONTROL_03::segment == 0x00 && GBS::PLL648_CONTROL_03::byteOffset == 0x43 && GBS::PLL648_CONTROL_03::bitOffset == 0 && GBS::PLL648_CONTROL_03::bitWidth == 8, "PLL648_CONTROL_03");
+static_assert(GBS::PLLAD_5_16::segment == 0x05 && GBS::PLLAD_5_16::byteOffset == 0x16 && GBS::PLLAD_5_16::bitOffset == 0 && GBS::PLLAD_5_16::bitWidth == 8, "PLLAD_5_16");
+static_assert(GBS::PLLAD_BPS::segment == 0x05 && GBS::PLLAD_BPS::byteOffset == 0x11 && GBS::PLLAD_BPS::bitOffset == 6 && GBS::PLLAD_BPS::bitWidth == 1, "PLLAD_BPS");
+static_assert(GBS::PLLAD_CKOS::segment == 0x05 && GBS::PLLAD_CKOS::byteOffset == 0x16 && GBS::PLLAD_CKOS::bitOffset == 6 && GBS::PLLAD_CKOS::bitWidth == 2, "PLLAD_CKOS");
+static_assert(GBS::PLLAD_CONTROL_00_5x11::segment == 0x05 && GBS::PLLAD_CONTROL_00_5x11::byteOffset == 0x11 && GBS::PLLAD_CONTROL_00_5x11::bitOffset == 0 && GBS::PLLAD_CONTROL_00_5x11::bitWidth == 8, "PLLAD_CONTROL_00_5x11");
+static_assert(GBS::PLLAD_FS::segment == 0x05 && GBS::PLLAD_FS::byteOffset == 0x11 && GBS::PLLAD_FS::bitOffset == 5 && GBS::PLLAD_FS::bitWidth == 1, "PLLAD_FS");
+static_assert(GBS::PLLAD_ICP::segment == 0x05 && GBS::PLLAD_ICP::byteOffset == 0x17 && GBS::PLLAD_ICP::bitOffset == 0 && GBS::PLLAD_ICP::bitWidth == 3, "PLLAD_ICP");
+static_assert(GBS::PLLAD_KS::segment == 0x05 && GBS::PLLAD_KS::byteOffset == 0x16 && GBS::PLLAD_KS::bitOffset == 4 && GBS::PLLAD_KS::bitWidth == 2, "PLLAD_KS");
+static_assert(GBS::PLLAD_LAT::segment == 0x05 && GBS::PLLAD_LAT::byteOffset == 0x11 && GBS::PLLAD_LAT::bitOffset == 7 && GBS::PLLAD_LAT::bitWidth == 1, "PLLAD_LAT");
+static_assert(GBS::PLLAD_LEN::segment == 0x05 && GBS::PLLAD_LEN::byteOffset == 0x11 && GBS::PLLAD_LEN::bitOffset == 1 && GBS::PLLAD_LEN::bitWidth == 1, "PLLAD_LEN");
+static_assert(GBS::PLLAD_MD::segment == 0x05 && GBS::PLLAD_MD::byteOffset == 0x12 && GBS::PLLAD_MD::bitOffset == 0 && GBS::PLLAD_MD::bitWidth == 12, "PLLAD_MD");
+static_assert(GBS::PLLAD_PDZ::segment == 0x05 && GBS::PLLAD_PDZ::byteOffset == 0x11 && GBS::PLLAD_PDZ::bitOffset == 4 && GBS::PLLAD_PDZ::bitWidth == 1, "PLLAD_PDZ");
+static_assert(GBS::PLLAD_R::segment == 0x05 && GBS::PLLAD_R::byteOffset == 0x16 && GBS::PLLAD_R::bitOffset == 0 && GBS::PLLAD_R::bitWidth == 2, "PLLAD_R");
+static_assert(GBS::PLLAD_S::segment == 0x05 && GBS::PLLAD_S::byteOffset == 0x16 && GBS::PLLAD_S::bitOffset == 2 && GBS::PLLAD_S::bitWidth == 2, "PLLAD_S");
+static_assert(GBS::PLLAD_TEST::segment == 0x05 && GBS::PLLAD_TEST::byteOffset == 0x11 && GBS::PLLAD_TEST::bitOffset == 2 && GBS::PLLAD_TEST::bitWidth == 1, "PLLAD_TEST");
+static_assert(GBS::PLLAD_TS::segment == 0x05 && GBS::PLLAD_TS::byteOffset == 0x11 && GBS::PLLAD_TS::bitOffset == 3 && GBS::PLLAD_TS::bitWidth == 1, "PLLAD_TS");
+static_assert(GBS::PLLAD_VCORST::segment == 0x05 && GBS::PLLAD_VCORST::byteOffset == 0x11 && GBS::PLLAD_VCORST::bitOffset == 0 && GBS::PLLAD_VCORST::bitWidth == 1, "PLLAD_VCORST");
+static_assert(GBS::PLL_ADS::segment == 0x00 && GBS::PLL_ADS::byteOffset == 0x40 && GBS::PLL_ADS::bitOffset == 3 && GBS::PLL_ADS::bitWidth == 1, "PLL_ADS");
+static_assert(GBS::PLL_CKIS::segment == 0x00 && GBS::PLL_CKIS::byteOffset == 0x40 && GBS::PLL_CKIS::bitOffset == 0 && GBS::PLL_CKIS::bitWidth == 1, "PLL_CKIS");
+static_assert(GBS::PLL_DIVBY2Z::segment == 0x00 && GBS::PLL_DIVBY2Z::byteOffset == 0x40 && GBS::PLL_DIVBY2Z::bitOffset == 1 && GBS::PLL_DIVBY2Z::bitWidth == 1, "PLL_DIVBY2Z");
+static_assert(GBS::PLL_IS::segment == 0x00 && GBS::PLL_IS::byteOffset == 0x40 && GBS::PLL_IS::bitOffset == 2 && GBS::PLL_IS::bitWidth == 1, "PLL_IS");
+static_assert(GBS::PLL_LEN::segment == 0x00 && GBS::PLL_LEN::byteOffset == 0x43 && GBS::PLL_LEN::bitOffset == 4 && GBS::PLL_LEN::bitWidth == 1, "PLL_LEN");
+static_assert(GBS::PLL_MS::segment == 0x00 && GBS::PLL_MS::byteOffset == 0x40 && GBS::PLL_MS::bitOffset == 4 && GBS::PLL_MS::bitWidth == 3, "PLL_MS");
+static_assert(GBS::PLL_R::segment == 0x00 && GBS::PLL_R::byteOffset == 0x43 && GBS::PLL_R::bitOffset == 0 && GBS::PLL_R::bitWidth == 2, "PLL_R");
+static_assert(GBS::PLL_S::segment == 0x00 && GBS::PLL_S::byteOffset == 0x43 && GBS::PLL_S::bitOffset == 2 && GBS::PLL_S::bitWidth == 2, "PLL_S");
+static_assert(GBS::PLL_VCORST::segment == 0x00 && GBS::PLL_VCORST::byteOffset == 0x43 && GBS::PLL_VCORST::bitOffset == 5 && GBS::PLL_VCORST::bitWidth == 1, "PLL_VCORST");
+static_assert(GBS::RESET_CONTROL_0x46::segment == 0x00 && GBS::RESET_CONTROL_0x46::byteOffset == 0x46 && GBS::RESET_CONTROL_0x46::bitOffset == 0 && GBS::RESET_CONTROL_0x46::bitWidth == 8, "RESET_CONTROL_0x46");
+static_assert(GBS::RESET_CONTROL_0x47::segment == 0x00 && GBS::RESET_CONTROL_0x47::byteOffset == 0x47 && GBS::RESET_CONTROL_0x47::bitOffset == 0 && GBS::RESET_CONTROL_0x47::bitWidth == 8, "RESET_CONTROL_0x47");
+static_assert(GBS::RFF_ADR_ADD_2::segment == 0x04 && GBS::RFF_ADR_ADD_2::byteOffset == 0x4D && GBS::RFF_ADR_ADD_2::bitOffset == 4 && GBS::RFF_ADR_ADD_2::bitWidth == 1, "RFF_ADR_ADD_2");
+static_assert(GBS::RFF_ENABLE::segment == 0x04 && GBS::RFF_ENABLE::byteOffset == 0x4D && GBS::RFF_ENABLE::bitOffset == 7 && GBS::RFF_ENABLE::bitWidth == 1, "RFF_ENABLE");
+static_assert(GBS::RFF_FETCH_NUM::segment == 0x04 && GBS::RFF_FETCH_NUM::byteOffset == 0x59 && GBS::RFF_FETCH_NUM::bitOffset == 0 && GBS::RFF_FETCH_NUM::bitWidth == 10, "RFF_FETCH_NUM");
+static_assert(GBS::RFF_LINE_FLIP::segment == 0x04 && GBS::RFF_LINE_FLIP::byteOffset == 0x50 && GBS::RFF_LINE_FLIP::bitOffset == 5 && GBS::RFF_LINE_FLIP::bitWidth == 1, "RFF_LINE_FLIP");
+static_assert(GBS::RFF_LREQ_CUT::segment == 0x04 && GBS::RFF_LREQ_CUT::byteOffset == 0x50 && GBS::RFF_LREQ_CUT::bitOffset == 7 && GBS::RFF_LREQ_CUT::bitWidth == 1, "RFF_LREQ_CUT");
+static_assert(GBS::RFF_MASTER_FLAG::segment == 0x04 && GBS::RFF_MASTER_FLAG::byteOffset == 0x4E && GBS::RFF_MASTER_FLAG::bitOffset == 0 && GBS::RFF_MASTER_FLAG::bitWidth == 8, "RFF_MASTER_FLAG");
+static_assert(GBS::RFF_REQ_SEL::segment == 0x04 && GBS::RFF_REQ_SEL::byteOffset == 0x4D && GBS::RFF_REQ_SEL::bitOffset == 5 && GBS::RFF_REQ_SEL::bitWidth == 2, "RFF_REQ_SEL");
+static_assert(GBS::RFF_WFF_OFFSET::segment == 0x04 && GBS::RFF_WFF_OFFSET::byteOffset == 0x57 && GBS::RFF_WFF_OFFSET::bitOffset == 0 && GBS::RFF_WFF_OFFSET::bitWidth == 10, "RFF_WFF_OFFSET");
+static_assert(GBS::RFF_WFF_STA_ADDR_A::segment == 0x04 && GBS::RFF_WFF_STA_ADDR_A::byteOffset == 0x51 && GBS::RFF_WFF_STA_ADDR_A::bitOffset == 0 && GBS::RFF_WFF_STA_ADDR_A::bitWidth == 21, "RFF_WFF_STA_ADDR_A");
+static_assert(GBS::RFF_WFF_STA_ADDR_B::segment == 0x04 && GBS::RFF_WFF_STA_ADDR_B::byteOffset == 0x54 && GBS::RFF_WFF_STA_ADDR_B::bitOffset == 0 && GBS::RFF_WFF_STA_ADDR_B::bitWidth == 21, "RFF_WFF_STA_ADDR_B");
+static_assert(GBS::RFF_YUV_DEINTERLACE::segment == 0x04 && GBS::RFF_YUV_DEINTERLACE::byteOffset == 0x50 && GBS::RFF_YUV_DEINTERLACE::bitOffset == 6 && GBS::RFF_YUV_DEINTERLACE::bitWidth == 1, "RFF_YUV_DEINTERLACE");
+static_assert(GBS::SDRAM_RESET_CONTROL::segment == 0x04 && GBS::SDRAM_RESET_CONTROL::byteOffset == 0x00 && GBS::SDRAM_RESET_CONTROL::bitOffset == 0 && GBS::SDRAM_RESET_CONTROL::bitWidth == 8, "SDRAM_RESET_CONTROL");
+static_assert(GBS::SDRAM_RESET_SIGNAL::segment == 0x04 && GBS::SDRAM_RESET_SIGNAL::byteOffset == 0x00 && GBS::SDRAM_RESET_SIGNAL::bitOffset == 4 && GBS::SDRAM_RESET_SIGNAL::bitWidth == 1, "SDRAM_RESET_SIGNAL");
+static_assert(GBS::SDRAM_START_INITIAL_CYCLE::segment == 0x04 && GBS::SDRAM_START_INITIAL_CYCLE::byteOffset == 0x00 && GBS::SDRAM_START_INITIAL_CYCLE::bitOffset == 7 && GBS::SDRAM_START_INITIAL_CYCLE::bitWidth == 1, "SDRAM_START_INITIAL_CYCLE");
+static_assert(GBS::SFTRST_DEC_RSTZ::segment == 0x00 && GBS::SFTRST_DEC_RSTZ::byteOffset == 0x47 && GBS::SFTRST_DEC_RSTZ::bitOffset == 0 && GBS::SFTRST_DEC_RSTZ::bitWidth == 1, "SFTRST_DEC_RSTZ");
+static_assert(GBS::SFTRST_DEINT_RSTZ::segment == 0x00 && GBS::SFTRST_DEINT_RSTZ::byteOffset == 0x46 && GBS::SFTRST_DEINT_RSTZ::bitOffset == 1 && GBS::SFTRST_DEINT_RSTZ::bitWidth == 1, "SFTRST_DEINT_RSTZ");
+static_assert(GBS::SFTRST_FIFO_RSTZ::segment == 0x00 && GBS::SFTRST_FIFO_RSTZ::byteOffset == 0x46 && GBS::SFTRST_FIFO_RSTZ::bitOffset == 4 && GBS::SFTRST_FIFO_RSTZ::bitWidth == 1, "SFTRST_FIFO_RSTZ");
+static_assert(GBS::SFTRST_HDBYPS_RSTZ::segment == 0x00 && GBS::SFTRST_HDBYPS_RSTZ::byteOffset == 0x47 && GBS::SFTRST_HDBYPS_RSTZ::bitOffset == 3 && GBS::SFTRST_HDBYPS_RSTZ::bitWidth == 1, "SFTRST_HDBYPS_RSTZ");
+static_assert(GBS::SFTRST_IF_RSTZ::segment == 0x00 && GBS::SFTRST_IF_RSTZ::byteOffset == 0x46 && GBS::SFTRST_IF_RSTZ::bitOffset == 0 && GBS::SFTRST_IF_RSTZ::bitWidth == 1, "SFTRST_IF_RSTZ");
+static_assert(GBS::SFTRST_INT_RSTZ::segment == 0x00 && GBS::SFTRST_INT_RSTZ::byteOffset == 0x47 && GBS::SFTRST_INT_RSTZ::bitOffset == 4 && GBS::SFTRST_INT_RSTZ::bitWidth == 1, "SFTRST_INT_RSTZ");
+static_assert(GBS::SFTRST_MEM_FF_RSTZ::segment == 0x00 && GBS::SFTRST_MEM_FF_RSTZ::byteOffset == 0x46 && GBS::SFTRST_MEM_FF_RSTZ::bitOffset == 2 && GBS::SFTRST_MEM_FF_RSTZ::bitWidth == 1, "SFTRST_MEM_FF_RSTZ");
+static_assert(GBS::SFTRST_MODE_RSTZ::segment == 0x00 && GBS::SFTRST_MODE_RSTZ::byteOffset == 0x47 && GBS::SFTRST_MODE_RSTZ::bitOffset == 1 && GBS::SFTRST_MODE_RSTZ::bitWidth == 1, "SFTRST_MODE_RSTZ");
+static_assert(GBS::SFTRST_SYNC_RSTZ::segment == 0x00 && GBS::SFTRST_SYNC_RSTZ::byteOffset == 0x47 && GBS::SFTRST_SYNC_RSTZ::bitOffset == 2 && GBS::SFTRST_SYNC_RSTZ::bitWidth == 1, "SFTRST_SYNC_RSTZ");
+static_assert(GBS::SFTRST_VDS_RSTZ::segment == 0x00 && GBS::SFTRST_VDS_RSTZ::byteOffset == 0x46 && GBS::SFTRST_VDS_RSTZ::bitOffset == 6 && GBS::SFTRST_VDS_RSTZ::bitWidth == 1, "SFTRST_VDS_RSTZ");
+static_assert(GBS::SP_5_56::segment == 0x05 && GBS::SP_5_56::byteOffset == 0x56 && GBS::SP_5_56::bitOffset == 0 && GBS::SP_5_56::bitWidth == 8, "SP_5_56");
+static_assert(GBS::SP_5_57::segment == 0x05 && GBS::SP_5_57::byteOffset == 0x57 && GBS::SP_5_57::bitOffset == 0 && GBS::SP_5_57::bitWidth == 8, "SP_5_57");
+static_assert(GBS::SP_CLAMP_INV_REG::segment == 0x05 && GBS::SP_CLAMP_INV_REG::byteOffset == 0x56 && GBS::SP_CLAMP_INV_REG::bitOffset == 7 && GBS::SP_CLAMP_INV_REG::bitWidth == 1, "SP_CLAMP_INV_REG");
+static_assert(GBS::SP_CLAMP_MANUAL::segment == 0x05 && GBS::SP_CLAMP_MANUAL::byteOffset == 0x56 && GBS::SP_CLAMP_MANUAL::bitOffset == 2 && GBS::SP_CLAMP_MANUAL::bitWidth == 1, "SP_CLAMP_MANUAL");
+static_assert(GBS::SP_CLP_SRC_SEL::segment == 0x05 && GBS::SP_CLP_SRC_SEL::byteOffset == 0x56 && GBS::SP_CLP_SRC_SEL::bitOffset == 3 && GBS::SP_CLP_SRC_SEL::bitWidth == 1, "SP_CLP_SRC_SEL");
+static_assert(GBS::SP_COAST_INV_REG::segment == 0x05 && GBS::SP_COAST_INV_REG::byteOffset == 0x57 && GBS::SP_COAST_INV_REG::bitOffset == 1 && GBS::SP_COAST_INV_REG::bitWidth == 1, "SP_COAST_INV_REG");
+static_assert(GBS::SP_CS_0x3E::segment == 0x05 && GBS::SP_CS_0x3E::byteOffset == 0x3E && GBS::SP_CS_0x3E::bitOffset == 0 && GBS::SP_CS_0x3E::bitWidth == 8, "SP_CS_0x3E");
+static_assert(GBS::SP_CS_CLP_SP::segment == 0x05 && GBS::SP_CS_CLP_SP::byteOffset == 0x43 && GBS::SP_CS_CLP_SP::bitOffset == 0 && GBS::SP_CS_CLP_SP::bitWidth == 12, "SP_CS_CLP_SP");
+static_assert(GBS::SP_CS_CLP_ST::segment == 0x05 && GBS::SP_CS_CLP_ST::byteOffset == 0x41 && GBS::SP_CS_CLP_ST::bitOffset == 0 && GBS::SP_CS_CLP_ST::bitWidth == 12, "SP_CS_CLP_ST");
+static_assert(GBS::SP_CS_HS_SP::segment == 0x05 && GBS::SP_CS_HS_SP::byteOffset == 0x47 && GBS::SP_CS_HS_SP::bitOffset == 0 && GBS::SP_CS_HS_SP::bitWidth == 12, "SP_CS_HS_SP");
+static_assert(GBS::SP_CS_HS_ST::segment == 0x05 && GBS::SP_CS_HS_ST::byteOffset == 0x45 && GBS::SP_CS_HS_ST::bitOffset == 0 && GBS::SP_CS_HS_ST::bitWidth == 12, "SP_CS_HS_ST");
+static_assert(GBS::SP_CS_P_SWAP::segment == 0x05 && GBS::SP_CS_P_SWAP::byteOffset == 0x3E && GBS::SP_CS_P_SWAP::bitOffset == 0 && GBS::SP_CS_P_SWAP::bitWidth == 1, "SP_CS_P_SWAP");
+static_assert(GBS::SP_DIS_SUB_COAST::segment == 0x05 && GBS::SP_DIS_SUB_COAST::byteOffset == 0x3E && GBS::SP_DIS_SUB_COAST::bitOffset == 5 && GBS::SP_DIS_SUB_COAST::bitWidth == 1, "SP_DIS_SUB_COAST");
+static_assert(GBS::SP_DLT_REG::segment == 0x05 && GBS::SP_DLT_REG::byteOffset == 0x35 && GBS::SP_DLT_REG::bitOffset == 0 && GBS::SP_DLT_REG::bitWidth == 12, "SP_DLT_REG");
+static_assert(GBS::SP_EXT_SYNC_SEL::segment == 0x05 && GBS::SP_EXT_SYNC_SEL::byteOffset == 0x20 && GBS::SP_EXT_SYNC_SEL::bitOffset == 3 && GBS::SP_EXT_SYNC_SEL::bitWidth == 1, "SP_EXT_SYNC_SEL");
+static_assert(GBS::SP_HCST_AUTO_EN::segment == 0x05 && GBS::SP_HCST_AUTO_EN::byteOffset == 0x55 && GBS::SP_HCST_AUTO_EN::bitOffset == 7 && GBS::SP_HCST_AUTO_EN::bitWidth == 1, "SP_HCST_AUTO_EN");
+static_assert(GBS::SP_HD_MODE::segment == 0x05 && GBS::SP_HD_MODE::byteOffset == 0x3E && GBS::SP_HD_MODE::bitOffset == 1 && GBS::SP_HD_MODE::bitWidth == 1, "SP_HD_MODE");
+static_assert(GBS::SP_HS2PLL_INV_REG::segment == 0x05 && GBS::SP_HS2PLL_INV_REG::byteOffset == 0x56 && GBS::SP_HS2PLL_INV_REG::bitOffset == 1 && GBS::SP_HS2PLL_INV_REG::bitWidth == 1, "SP_HS2PLL_INV_REG");
+static_assert(GBS::SP_HS_LOOP_SEL::segment == 0x05 && GBS::SP_HS_LOOP_SEL::byteOffset == 0x57 && GBS::SP_HS_LOOP_SEL::bitOffset == 6 && GBS::SP_HS_LOOP_SEL::bitWidth == 1, "SP_HS_LOOP_SEL");
+static_assert(GBS::SP_HS_POL_ATO::segment == 0x05 && GBS::SP_HS_POL_ATO::byteOffset == 0x55 && GBS::SP_HS_POL_ATO::bitOffset == 4 && GBS::SP_HS_POL_ATO::bitWidth == 1, "SP_HS_POL_ATO");
+static_assert(GBS::SP_HS_PROC_INV_REG::segment == 0x05 && GBS::SP_HS_PROC_INV_REG::byteOffset == 0x56 && GBS::SP_HS_PROC_INV_REG::bitOffset == 5 && GBS::SP_HS_PROC_INV_REG::bitWidth == 1, "SP_HS_PROC_INV_REG");
+static_assert(GBS::SP_HS_REG::segment == 0x05 && GBS::SP_HS_REG::byteOffset == 0x57 && GBS::SP_HS_REG::bitOffset == 7 && GBS::SP_HS_REG::bitWidth == 1, "SP_HS_REG");
+static_assert(GBS::SP_H_COAST::segment == 0x05 && GBS::SP_H_COAST::byteOffset == 0x3E && GBS::SP_H_COAST::bitOffset == 2 && GBS::SP_H_COAST::bitWidth == 1, "SP_H_COAST");
+static_assert(GBS::SP_H_CST_SP::segment == 0x05 && GBS::SP_H_CST_SP::byteOffset == 0x4F && GBS::SP_H_CST_SP::bitOffset == 0 && GBS::SP_H_CST_SP::bitWidth == 12, "SP_H_CST_SP");
+static_assert(GBS::SP_H_CST_ST::segment == 0x05 && GBS::SP_H_CST_ST::byteOffset == 0x4D && GBS::SP_H_CST_ST::bitOffset == 0 && GBS::SP_H_CST_ST::bitWidth == 12, "SP_H_CST_ST");
+static_assert(GBS::SP_H_PROTECT::segment == 0x05 && GBS::SP_H_PROTECT::byteOffset == 0x3E && GBS::SP_H_PROTECT::bitOffset == 4 && GBS::SP_H_PROTECT::bitWidth == 1, "SP_H_PROTECT");
+static_assert(GBS::SP_H_PULSE_IGNOR::segment == 0x05 && GBS::SP_H_PULSE_IGNOR::byteOffset == 0x37 && GBS::SP_H_PULSE_IGNOR::bitOffset == 0 && GBS::SP_H_PULSE_IGNOR::bitWidth == 8, "SP_H_PULSE_IGNOR");
+static_assert(GBS::SP_H_TIMER_VAL::segment == 0x05 && GBS::SP_H_TIMER_VAL::byteOffset == 0x33 && GBS::SP_H_TIMER_VAL::bitOffset == 0 && GBS::SP_H_TIMER_VAL::bitWidth == 8, "SP_H_TIMER_VAL");
+static_assert(GBS::SP_H_TOTAL_EQ_THD::segment == 0x05 && GBS::SP_H_TOTAL_EQ_THD::byteOffset == 0x3A && GBS::SP_H_TOTAL_EQ_THD::bitOffset == 0 && GBS::SP_H_TOTAL_EQ_THD::bitWidth == 8, "SP_H_TOTAL_EQ_THD");
+static_assert(GBS::SP_JITTER_SYNC::segment == 0x05 && GBS::SP_JITTER_SYNC::byteOffset == 0x20 && GBS::SP_JITTER_SYNC::bitOffset == 4 && GBS::SP_JITTER_SYNC::bitWidth == 1, "SP_JITTER_SYNC");
+static_assert(GBS::SP_NO_CLAMP_REG::segment == 0x05 && GBS::SP_NO_CLAMP_REG::byteOffset == 0x57 && GBS::SP_NO_CLAMP_REG::bitOffset == 0 && GBS::SP_NO_CLAMP_REG::bitWidth == 1, "SP_NO_CLAMP_REG");
+static_assert(GBS::SP_NO_COAST_REG::segment == 0x05 && GBS::SP_NO_COAST_REG::byteOffset == 0x57 && GBS::SP_NO_COAST_REG::bitOffset == 2 && GBS::SP_NO_COAST_REG::bitWidth == 1, "SP_NO_COAST_REG");
+static_assert(GBS::SP_POST_COAST::segment == 0x05 && GBS::SP_POST_COAST::byteOffset == 0x39 && GBS::SP_POST_COAST::bitOffset == 0 && GBS::SP_POST_COAST::bitWidth == 8, "SP_POST_COAST");
+static_assert(GBS::SP_PRE_COAST::segment == 0x05 && GBS::SP_PRE_COAST::byteOffset == 0x38 && GBS::SP_PRE_COAST::bitOffset == 0 && GBS::SP_PRE_COAST::bitWidth == 8, "SP_PRE_COAST");
+static_assert(GBS::SP_RT_HS_SP::segment == 0x05 && GBS::SP_RT_HS_SP::byteOffset == 0x4B && GBS::SP_RT_HS_SP::bitOffset == 0 && GBS::SP_RT_HS_SP::bitWidth == 12, "SP_RT_HS_SP");
+static_assert(GBS::SP_RT_HS_ST::segment == 0x05 && GBS::SP_RT_HS_ST::byteOffset == 0x49 && GBS::SP_RT_HS_ST::bitOffset == 0 && GBS::SP_RT_HS_ST::bitWidth == 12, "SP_RT_HS_ST");
+static_assert(GBS::SP_SDCS_VSSP_REG_H::segment == 0x05 && GBS::SP_SDCS_VSSP_REG_H::byteOffset == 0x3B && GBS::SP_SDCS_VSSP_REG_H::bitOffset == 4 && GBS::SP_SDCS_VSSP_REG_H::bitWidth == 3, "SP_SDCS_VSSP_REG_H");
+static_assert(GBS::SP_SDCS_VSSP_REG_L::segment == 0x05 && GBS::SP_SDCS_VSSP_REG_L::byteOffset == 0x40 && GBS::SP_SDCS_VSSP_REG_L::bitOffset == 0 && GBS::SP_SDCS_VSSP_REG_L::bitWidth == 8, "SP_SDCS_VSSP_REG_L");
+static_assert(GBS::SP_SDCS_VSST_REG_H::segment == 0x05 && GBS::SP_SDCS_VSST_REG_H::byteOffset == 0x3B && GBS::SP_SDCS_VSST_REG_H::bitOffset == 0 && GBS::SP_SDCS_VSST_REG_H::bitWidth == 3, "SP_SDCS_VSST_REG_H");
+static_assert(GBS::SP_SDCS_VSST_REG_L::segment == 0x05 && GBS::SP_SDCS_VSST_REG_L::byteOffset == 0x3F && GBS::SP_SDCS_VSST_REG_L::bitOffset == 0 && GBS::SP_SDCS_VSST_REG_L::bitWidth == 8, "SP_SDCS_VSST_REG_L");
+static_assert(GBS::SP_SOG_MODE::segment == 0x05 && GBS::SP_SOG_MODE::byteOffset == 0x56 && GBS::SP_SOG_MODE::bitOffset == 0 && GBS::SP_SOG_MODE::bitWidth == 1, "SP_SOG_MODE");
+static_assert(GBS::SP_SOG_P_ATO::segment == 0x05 && GBS::SP_SOG_P_ATO::byteOffset == 0x20 && GBS::SP_SOG_P_ATO::bitOffset == 1 && GBS::SP_SOG_P_ATO::bitWidth == 1, "SP_SOG_P_ATO");
+static_assert(GBS::SP_SOG_P_INV::segment == 0x05 && GBS::SP_SOG_P_INV::byteOffset == 0x20 && GBS::SP_SOG_P_INV::bitOffset == 2 && GBS::SP_SOG_P_INV::bitWidth == 1, "SP_SOG_P_INV");
+static_assert(GBS::SP_SOG_SRC_SEL::segment == 0x05 && GBS::SP_SOG_SRC_SEL::byteOffset == 0x20 && GBS::SP_SOG_SRC_SEL::bitOffset == 0 && GBS::SP_SOG_SRC_SEL::bitWidth == 1, "SP_SOG_SRC_SEL");
+static_assert(GBS::SP_SYNC_BYPS::segment == 0x05 && GBS::SP_SYNC_BYPS::byteOffset == 0x56 && GBS::SP_SYNC_BYPS::bitOffset == 4 && GBS::SP_SYNC_BYPS::bitWidth == 1, "SP_SYNC_BYPS");
+static_assert(GBS::SP_SYNC_PD_THD::segment == 0x05 && GBS::SP_SYNC_PD_THD::byteOffset == 0x26 && GBS::SP_SYNC_PD_THD::bitOffset == 0 && GBS::SP_SYNC_PD_THD::bitWidth == 12, "SP_SYNC_PD_THD");
+static_assert(GBS::SP_VS_POL_ATO::segment == 0x05 && GBS::SP_VS_POL_ATO::byteOffset == 0x55 && GBS::SP_VS_POL_ATO::bitOffset == 6 && GBS::SP_VS_POL_ATO::bitWidth == 1, "SP_VS_POL_ATO");
+static_assert(GBS::SP_VS_PROC_INV_REG::segment == 0x05 && GBS::SP_VS_PROC_INV_REG::byteOffset == 0x56 && GBS::SP_VS_PROC_INV_REG::bitOffset == 6 && GBS::SP_VS_PROC_INV_REG::bitWidth == 1, "SP_VS_PROC_INV_REG");
+static_assert(GBS::STATUS_00::segment == 0x00 && GBS::STATUS_00::byteOffset == 0x00 && GBS::STATUS_00::bitOffset == 0 && GBS::STATUS_00::bitWidth == 8, "STATUS_00");
+static_assert(GBS::STATUS_03::segment == 0x00 && GBS::STATUS_03::byteOffset == 0x03 && GBS::STATUS_03::bitOffset == 0 && GBS::STATUS_03::bitWidth == 8, "STATUS_03");
+static_assert(GBS::STATUS_04::segment == 0x00 && GBS::STATUS_04::byteOffset == 0x04 && GBS::STATUS_04::bitOffset == 0 && GBS::STATUS_04::bitWidth == 8, "STATUS_04");
+static_assert(GBS::STATUS_05::segment == 0x00 && GBS::STATUS_05::byteOffset == 0x05 && GBS::STATUS_05::bitOffset == 0 && GBS::STATUS_05::bitWidth == 8, "STATUS_05");
+static_assert(GBS::STATUS_0F::segment == 0x00 && GBS::STATUS_0F::byteOffset == 0x0F && GBS::STATUS_0F::bitOffset == 0 && GBS::STATUS_0F::bitWidth == 8, "STATUS_0F");
+static_assert(GBS::STATUS_16::segment == 0x00 && GBS::STATUS_16::byteOffset == 0x16 && GBS::STATUS_16::bitOffset == 0 && GBS::STATUS_16::bitWidth == 8, "STATUS_16");
+static_assert(GBS::STATUS_DEINT_PULLDN::segment == 0x00 && GBS::STATUS_DEINT_PULLDN::byteOffset == 0x15 && GBS::STATUS_DEINT_PULLDN::bitOffset == 7 && GBS::STATUS_DEINT_PULLDN::bitWidth == 1, "STATUS_DEINT_PULLDN");
+static_assert(GBS::STATUS_GPIO_CLKOUT::segment == 0x00 && GBS::STATUS_GPIO_CLKOUT::byteOffset == 0x0E && GBS::STATUS_GPIO_CLKOUT::bitOffset == 7 && GBS::STATUS_GPIO_CLKOUT::bitWidth == 1, "STATUS_GPIO_CLKOUT");
+static_assert(GBS::STATUS_GPIO_GPIO::segment == 0x00 && GBS::STATUS_GPIO_GPIO::byteOffset == 0x0E && GBS::STATUS_GPIO_GPIO::bitOffset == 0 && GBS::STATUS_GPIO_GPIO::bitWidth == 1, "STATUS_GPIO_GPIO");
+static_assert(GBS::STATUS_GPIO_HALF::segment == 0x00 && GBS::STATUS_GPIO_HALF::byteOffset == 0x0E && GBS::STATUS_GPIO_HALF::bitOffset == 1 && GBS::STATUS_GPIO_HALF::bitWidth == 1, "STATUS_GPIO_HALF");
+static_assert(GBS::STATUS_GPIO_HBOUT::segment == 0x00 && GBS::STATUS_GPIO_HBOUT::byteOffset == 0x0E && GBS::STATUS_GPIO_HBOUT::bitOffset == 5 && GBS::STATUS_GPIO_HBOUT::bitWidth == 1, "STATUS_GPIO_HBOUT");
+static_assert(GBS::STATUS_GPIO_MBA::segment == 0x00 && GBS::STATUS_GPIO_MBA::byteOffset == 0x0E && GBS::STATUS_GPIO_MBA::bitOffset == 3 && GBS::STATUS_GPIO_MBA::bitWidth == 1, "STATUS_GPIO_MBA");
+static_assert(GBS::STATUS_GPIO_MCS1::segment == 0x00 && GBS::STATUS_GPIO_MCS1::byteOffset == 0x0E && GBS::STATUS_GPIO_MCS1::bitOffset == 4 && GBS::STATUS_GPIO_MCS1::bitWidth == 1, "STATUS_GPIO_MCS1");
+static_assert(GBS::STATUS_GPIO_SCLSA::segment == 0x00 && GBS::STATUS_GPIO_SCLSA::byteOffset == 0x0E && GBS::STATUS_GPIO_SCLSA::bitOffset == 2 && GBS::STATUS_GPIO_SCLSA::bitWidth == 1, "STATUS_GPIO_SCLSA");
+static_assert(GBS::STATUS_GPIO_VBOUT::segment == 0x00 && GBS::STATUS_GPIO_VBOUT::byteOffset == 0x0E && GBS::STATUS_GPIO_VBOUT::bitOffset == 6 && GBS::STATUS_GPIO_VBOUT::bitWidth == 1, "STATUS_GPIO_VBOUT");
+static_assert(GBS::STATUS_IF_HT_BAD::segment == 0x00 && GBS::STATUS_IF_HT_BAD::byteOffset == 0x05 && GBS::STATUS_IF_HT_BAD::bitOffset == 2 && GBS::STATUS_IF_HT_BAD::bitWidth == 1, "STATUS_IF_HT_BAD");
+static_assert(GBS::STATUS_IF_HT_OK::segment == 0x00 && GBS::STATUS_IF_HT_OK::byteOffset == 0x00 && GBS::STATUS_IF_HT_OK::bitOffset == 1 && GBS::STATUS_IF_HT_OK::bitWidth == 1, "STATUS_IF_HT_OK");
+static_assert(GBS::STATUS_IF_HVT_OK::segment == 0x00 && GBS::STATUS_IF_HVT_OK::byteOffset == 0x00 && GBS::STATUS_IF_HVT_OK::bitOffset == 2 && GBS::STATUS_IF_HVT_OK::bitWidth == 1, "STATUS_IF_HVT_OK");
+static_assert(GBS::STATUS_IF_INP_1080I::segment == 0x00 && GBS::STATUS_IF_INP_1080I::byteOffset == 0x04 && GBS::STATUS_IF_INP_1080I::bitOffset == 0 && GBS::STATUS_IF_INP_1080I::bitWidth == 1, "STATUS_IF_INP_1080I");
+static_assert(GBS::STATUS_IF_INP_1808P::segment == 0x00 && GBS::STATUS_IF_INP_1808P::byteOffset == 0x04 && GBS::STATUS_IF_INP_1808P::bitOffset == 4 && GBS::STATUS_IF_INP_1808P::bitWidth == 1, "STATUS_IF_INP_1808P");
+static_assert(GBS::STATUS_IF_INP_2200_1125I::segment == 0x00 && GBS::STATUS_IF_INP_2200_1125I::byteOffset == 0x03 && GBS::STATUS_IF_INP_2200_1125I::bitOffset == 5 && GBS::STATUS_IF_INP_2200_1125I::bitWidth == 1, "STATUS_IF_INP_2200_1125I");
+static_assert(GBS::STATUS_IF_INP_2200_1125P::segment == 0x00 && GBS::STATUS_IF_INP_2200_1125P::byteOffset == 0x04 && GBS::STATUS_IF_INP_2200_1125P::bitOffset == 1 && GBS::STATUS_IF_INP_2200_1125P::bitWidth == 1, "STATUS_IF_INP_2200_1125P");
+static_assert(GBS::STATUS_IF_INP_2376_1250I::segment == 0x00 && GBS::STATUS_IF_INP_2376_1250I::byteOffset == 0x03 && GBS::STATUS_IF_INP_2376_1250I::bitOffset == 6 && GBS::STATUS_IF_INP_2376_1250I::bitWidth == 1, "STATUS_IF_INP_2376_1250I");
+static_assert(GBS::STATUS_IF_INP_2376_1250P::segment == 0x00 && GBS::STATUS_IF_INP_2376_1250P::byteOffset == 0x04 && GBS::STATUS_IF_INP_2376_1250P::bitOffset == 2 && GBS::STATUS_IF_INP_2376_1250P::bitWidth == 1, "STATUS_IF_INP_2376_1250P");
+static_assert(GBS::STATUS_IF_INP_2640_1125I::segment == 0x00 && GBS::STATUS_IF_INP_2640_1125I::byteOffset == 0x03 && GBS::STATUS_IF_INP_2640_1125I::bitOffset == 7 && GBS::STATUS_IF_INP_2640_1125I::bitWidth == 1, "STATUS_IF_INP_2640_1125I");
+static_assert(GBS::STATUS_IF_INP_2640_1125P::segment == 0x00 && GBS::STATUS_IF_INP_2640_1125P::byteOffset == 0x04 && GBS::STATUS_IF_INP_2640_1125P::bitOffset == 3 && GBS::STATUS_IF_INP_2640_1125P::bitWidth == 1, "STATUS_IF_INP_2640_1125P");
+static_assert(GBS::STATUS_IF_INP_720::segment == 0x00 && GBS::STATUS_IF_INP_720::byteOffset == 0x03 && GBS::STATUS_IF_INP_720::bitOffset == 4 && GBS::STATUS_IF_INP_720::bitWidth == 1, "STATUS_IF_INP_720");
+static_assert(GBS::STATUS_IF_INP_720P50::segment == 0x00 && GBS::STATUS_IF_INP_720P50::byteOffset == 0x03 && GBS::STATUS_IF_INP_720P50::bitOffset == 2 && GBS::STATUS_IF_INP_720P50::bitWidth == 1, "STATUS_IF_INP_720P50");
+static_assert(GBS::STATUS_IF_INP_720P60::segment == 0x00 && GBS::STATUS_IF_INP_720P60::byteOffset == 0x03 && GBS::STATUS_IF_INP_720P60::bitOffset == 3 && GBS::STATUS_IF_INP_720P60::bitWidth == 1, "STATUS_IF_INP_720P60");
+static_assert(GBS::STATUS_IF_INP_HD::segment == 0x00 && GBS::STATUS_IF_INP_HD::byteOffset == 0x04 && GBS::STATUS_IF_INP_HD::bitOffset == 5 && GBS::STATUS_IF_INP_HD::bitWidth == 1, "STATUS_IF_INP_HD");
+static_assert(GBS::STATUS_IF_INP_INT::segment == 0x00 && GBS::STATUS_IF_INP_INT::byteOffset == 0x04 && GBS::STATUS_IF_INP_INT::bitOffset == 6 && GBS::STATUS_IF_INP_INT::bitWidth == 1, "STATUS_IF_INP_INT");
+static_assert(GBS::STATUS_IF_INP_NTSC_INT::segment == 0x00 && GBS::STATUS_IF_INP_NTSC_INT::byteOffset == 0x00 && GBS::STATUS_IF_INP_NTSC_INT::bitOffset == 3 && GBS::STATUS_IF_INP_NTSC_INT::bitWidth == 1, "STATUS_IF_INP_NTSC_INT");
+static_assert(GBS::STATUS_IF_INP_NTSC_PRG::segment == 0x00 && GBS::STATUS_IF_INP_NTSC_PRG::byteOffset == 0x00 && GBS::STATUS_IF_INP_NTSC_PRG::bitOffset == 4 && GBS::STATUS_IF_INP_NTSC_PRG::bitWidth == 1, "STATUS_IF_INP_NTSC_PRG");
+static_assert(GBS::STATUS_IF_INP_PAL_INT::segment == 0x00 && GBS::STATUS_IF_INP_PAL_INT::byteOffset == 0x00 && GBS::STATUS_IF_INP_PAL_INT::bitOffset == 5 && GBS::STATUS_IF_INP_PAL_INT::bitWidth == 1, "STATUS_IF_INP_PAL_INT");
+static_assert(GBS::STATUS_IF_INP_PAL_PRG::segment == 0x00 && GBS::STATUS_IF_INP_PAL_PRG::byteOffset == 0x00 && GBS::STATUS_IF_INP_PAL_PRG::bitOffset == 6 && GBS::STATUS_IF_INP_PAL_PRG::bitWidth == 1, "STATUS_IF_INP_PAL_PRG");
+static_assert(GBS::STATUS_IF_INP_PC::segment == 0x00 && GBS::STATUS_IF_INP_PC::byteOffset == 0x03 && GBS::STATUS_IF_INP_PC::bitOffset == 1 && GBS::STATUS_IF_INP_PC::bitWidth == 1, "STATUS_IF_INP_PC");
+static_assert(GBS::STATUS_IF_INP_PRG::segment == 0x00 && GBS::STATUS_IF_INP_PRG::byteOffset == 0x04 && GBS::STATUS_IF_INP_PRG::bitOffset == 7 && GBS::STATUS_IF_INP_PRG::bitWidth == 1, "STATUS_IF_INP_PRG");
+static_assert(GBS::STATUS_IF_INP_SD::segment == 0x00 && GBS::STATUS_IF_INP_SD::byteOffset == 0x00 && GBS::STATUS_IF_INP_SD::bitOffset == 7 && GBS::STATUS_IF_INP_SD::bitWidth == 1, "STATUS_IF_INP_SD");
+static_assert(GBS::STATUS_IF_INP_SVGA::segment == 0x00 && GBS::STATUS_IF_INP_SVGA::byteOffset == 0x01 && GBS::STATUS_IF_INP_SVGA::bitOffset == 7 && GBS::STATUS_IF_INP_SVGA::bitWidth == 1, "STATUS_IF_INP_SVGA");
+static_assert(GBS::STATUS_IF_INP_SVGA60::segment == 0x00 && GBS::STATUS_IF_INP_SVGA60::byteOffset == 0x01 && GBS::STATUS_IF_INP_SVGA60::bitOffset == 4 && GBS::STATUS_IF_INP_SVGA60::bitWidth == 1, "STATUS_IF_INP_SVGA60");
+static_assert(GBS::STATUS_IF_INP_SVGA75::segment == 0x00 && GBS::STATUS_IF_INP_SVGA75::byteOffset == 0x01 && GBS::STATUS_IF_INP_SVGA75::bitOffset == 5 && GBS::STATUS_IF_INP_SVGA75::bitWidth == 1, "STATUS_IF_INP_SVGA75");
+static_assert(GBS::STATUS_IF_INP_SVGA85::segment == 0x00 && GBS::STATUS_IF_INP_SVGA85::byteOffset == 0x01 && GBS::STATUS_IF_INP_SVGA85::bitOffset == 6 && GBS::STATUS_IF_INP_SVGA85::bitWidth == 1, "STATUS_IF_INP_SVGA85");
+static_assert(GBS::STATUS_IF_INP_SW::segment == 0x00 && GBS::STATUS_IF_INP_SW::byteOffset == 0x05 && GBS::STATUS_IF_INP_SW::bitOffset == 4 && GBS::STATUS_IF_INP_SW::bitWidth == 1, "STATUS_IF_INP_SW");
+static_assert(GBS::STATUS_IF_INP_SXGA::segment == 0x00 && GBS::STATUS_IF_INP_SXGA::byteOffset == 0x03 && GBS::STATUS_IF_INP_SXGA::bitOffset == 0 && GBS::STATUS_IF_INP_SXGA::bitWidth == 1, "STATUS_IF_INP_SXGA");
+static_assert(GBS::STATUS_IF_INP_SXGA60::segment == 0x00 && GBS::STATUS_IF_INP_SXGA60::byteOffset == 0x02 && GBS::STATUS_IF_INP_SXGA60::bitOffset == 5 && GBS::STATUS_IF_INP_SXGA60::bitWidth == 1, "STATUS_IF_INP_SXGA60");
+static_assert(GBS::STATUS_IF_INP_SXGA75::segment == 0x00 && GBS::STATUS_IF_INP_SXGA75::byteOffset == 0x02 && GBS::STATUS_IF_INP_SXGA75::bitOffset == 6 && GBS::STATUS_IF_INP_SXGA75::bitWidth == 1, "STATUS_IF_INP_SXGA75");
+static_assert(GBS::STATUS_IF_INP_SXGA85::segment == 0x00 && GBS::STATUS_IF_INP_SXGA85::byteOffset == 0x02 && GBS::STATUS_IF_INP_SXGA85::bitOffset == 7 && GBS::STATUS_IF_INP_SXGA85::bitWidth == 1, "STATUS_IF_INP_SXGA85");
+static_assert(GBS::STATUS_IF_INP_USER::segment == 0x00 && GBS::STATUS_IF_INP_USER::byteOffset == 0x05 && GBS::STATUS_IF_INP_USER::bitOffset == 0 && GBS::STATUS_IF_INP_USER::bitWidth == 1, "STATUS_IF_INP_USER");
+static_assert(GBS::STATUS_IF_INP_VGA::segment == 0x00 && GBS::STATUS_IF_INP_VGA::byteOffset == 0x01 && GBS::STATUS_IF_INP_VGA::bitOffset == 3 && GBS::STATUS_IF_INP_VGA::bitWidth == 1, "STATUS_IF_INP_VGA");
+static_assert(GBS::STATUS_IF_INP_VGA60::segment == 0x00 && GBS::STATUS_IF_INP_VGA60::byteOffset == 0x01 && GBS::STATUS_IF_INP_VGA60::bitOffset == 0 && GBS::STATUS_IF_INP_VGA60::bitWidth == 1, "STATUS_IF_INP_VGA60");
+static_assert(GBS::STATUS_IF_INP_VGA75::segment == 0x00 && GBS::STATUS_IF_INP_VGA75::byteOffset == 0x01 && GBS::STATUS_IF_INP_VGA75::bitOffset == 1 && GBS::STATUS_IF_INP_VGA75::bitWidth == 1, "STATUS_IF_INP_VGA75");
+static_assert(GBS::STATUS_IF_INP_VGA86::segment == 0x00 && GBS::STATUS_IF_INP_VGA86::byteOffset == 0x01 && GBS::STATUS_IF_INP_VGA86::bitOffset == 2 && GBS::STATUS_IF_INP_VGA86::bitWidth == 1, "STATUS_IF_INP_VGA86");
+static_assert(GBS::STATUS_IF_INP_XGA::segment == 0x00 && GBS::STATUS_IF_INP_XGA::byteOffset == 0x02 && GBS::STATUS_IF_INP_XGA::bitOffset == 4 && GBS::STATUS_IF_INP_XGA::bitWidth == 1, "STATUS_IF_INP_XGA");
+static_assert(GBS::STATUS_IF_INP_XGA60::segment == 0x00 && GBS::STATUS_IF_INP_XGA60::byteOffset == 0x02 && GBS::STATUS_IF_INP_XGA60::bitOffset == 0 && GBS::STATUS_IF_INP_XGA60::bitWidth == 1, "STATUS_IF_INP_XGA60");
+static_assert(GBS::STATUS_IF_INP_XGA70::segment == 0x00 && GBS::STATUS_IF_INP_XGA70::byteOffset == 0x02 && GBS::STATUS_IF_INP_XGA70::bitOffset == 1 && GBS::STATUS_IF_INP_XGA70::bitWidth == 1, "STATUS_IF_INP_XGA70");
+static_assert(GBS::STATUS_IF_INP_XGA75::segment == 0x00 && GBS::STATUS_IF_INP_XGA75::byteOffset == 0x02 && GBS::STATUS_IF_INP_XGA75::bitOffset == 2 && GBS::STATUS_IF_INP_XGA75::bitWidth == 1, "STATUS_IF_INP_XGA75");
+static_assert(GBS::STATUS_IF_INP_XGA85::segment == 0x00 && GBS::STATUS_IF_INP_XGA85::byteOffset == 0x02 && GBS::STATUS_IF_INP_XGA85::bitOffset == 3 && GBS::STATUS_IF_INP_XGA85::bitWidth == 1, "STATUS_IF_INP_XGA85");
+static_assert(GBS::STATUS_IF_NO_SYNC::segment == 0x00 && GBS::STATUS_IF_NO_SYNC::byteOffset == 0x05 && GBS::STATUS_IF_NO_SYNC::bitOffset == 1 && GBS::STATUS_IF_NO_SYNC::bitWidth == 1, "STATUS_IF_NO_SYNC");
+static_assert(GBS::STATUS_IF_VT_BAD::segment == 0x00 && GBS::STATUS_IF_VT_BAD::byteOffset == 0x05 && GBS::STATUS_IF_VT_BAD::bitOffset == 3 && GBS::STATUS_IF_VT_BAD::bitWidth == 1, "STATUS_IF_VT_BAD");
+static_assert(GBS::STATUS_IF_VT_OK::segment == 0x00 && GBS::STATUS_IF_VT_OK::byteOffset == 0x00 && GBS::STATUS_IF_VT_OK::bitOffset == 0 && GBS::STATUS_IF_VT_OK::bitWidth == 1, "STATUS_IF_VT_OK");
+static_assert(GBS::STATUS_INT_INP_CSYNC::segment == 0x00 && GBS::STATUS_INT_INP_CSYNC::byteOffset == 0x0F && GBS::STATUS_INT_INP_CSYNC::bitOffset == 7 && GBS::STATUS_INT_INP_CSYNC::bitWidth == 1, "STATUS_INT_INP_CSYNC");
+static_assert(GBS::STATUS_INT_INP_HSYNC::segment == 0x00 && GBS::STATUS_INT_INP_HSYNC::byteOffset == 0x0F && GBS::STATUS_INT_INP_HSYNC::bitOffset == 5 && GBS::STATUS_INT_INP_HSYNC::bitWidth == 1, "STATUS_INT_INP_HSYNC");
+static_assert(GBS::STATUS_INT_INP_NO_SYNC::segment == 0x00 && GBS::STATUS_INT_INP_NO_SYNC::byteOffset == 0x0F && GBS::STATUS_INT_INP_NO_SYNC::bitOffset == 4 && GBS::STATUS_INT_INP_NO_SYNC::bitWidth == 1, "STATUS_INT_INP_NO_SYNC");
+static_assert(GBS::STATUS_INT_INP_SW::segment == 0x00 && GBS::STATUS_INT_INP_SW::byteOffset == 0x0F && GBS::STATUS_INT_INP_SW::bitOffset == 3 && GBS::STATUS_INT_INP_SW::bitWidth == 1, "STATUS_INT_INP_SW");
+static_assert(GBS::STATUS_INT_INP_VSYNC::segment == 0x00 && GBS::STATUS_INT_INP_VSYNC::byteOffset == 0x0F && GBS::STATUS_INT_INP_VSYNC::bitOffset == 6 && GBS::STATUS_INT_INP_VSYNC::bitWidth == 1, "STATUS_INT_INP_VSYNC");
+static_assert(GBS::STATUS_INT_SOG_BAD::segment == 0x00 && GBS::STATUS_INT_SOG_BAD::byteOffset == 0x0F && GBS::STATUS_INT_SOG_BAD::bitOffset == 0 && GBS::STATUS_INT_SOG_BAD::bitWidth == 1, "STATUS_INT_SOG_BAD");
+static_assert(GBS::STATUS_INT_SOG_OK::segment == 0x00 && GBS::STATUS_INT_SOG_OK::byteOffset == 0x0F && GBS::STATUS_INT_SOG_OK::bitOffset == 2 && GBS::STATUS_INT_SOG_OK::bitWidth == 1, "STATUS_INT_SOG_OK");
+static_assert(GBS::STATUS_INT_SOG_SW::segment == 0x00 && GBS::STATUS_INT_SOG_SW::byteOffset == 0x0F && GBS::STATUS_INT_SOG_SW::bitOffset == 1 && GBS::STATUS_INT_SOG_SW::bitWidth == 1, "STATUS_INT_SOG_SW");
+static_assert(GBS::STATUS_MEM_FF_CAP_FIFO_EMPTY::segment == 0x00 && GBS::STATUS_MEM_FF_CAP_FIFO_EMPTY::byteOffset == 0x13 && GBS::STATUS_MEM_FF_CAP_FIFO_EMPTY::bitOffset == 5 && GBS::STATUS_MEM_FF_CAP_FIFO_EMPTY::bitWidth == 1, "STATUS_MEM_FF_CAP_FIFO_EMPTY");
+static_assert(GBS::STATUS_MEM_FF_CAP_FIFO_FULL::segment == 0x00 && GBS::STATUS_MEM_FF_CAP_FIFO_FULL::byteOffset == 0x13 && GBS::STATUS_MEM_FF_CAP_FIFO_FULL::bitOffset == 4 && GBS::STATUS_MEM_FF_CAP_FIFO_FULL::bitWidth == 1, "STATUS_MEM_FF_CAP_FIFO_FULL");
+static_assert(GBS::STATUS_MEM_FF_EXT_FIN::segment == 0x00 && GBS::STATUS_MEM_FF_EXT_FIN::byteOffset == 0x14 && GBS::STATUS_MEM_FF_EXT_FIN::bitOffset == 0 && GBS::STATUS_MEM_FF_EXT_FIN::bitWidth == 1, "STATUS_MEM_FF_EXT_FIN");
+static_assert(GBS::STATUS_MEM_FF_PLY_FIFO_EMPTY::segment == 0x00 && GBS::STATUS_MEM_FF_PLY_FIFO_EMPTY::byteOffset == 0x13 && GBS::STATUS_MEM_FF_PLY_FIFO_EMPTY::bitOffset == 7 && GBS::STATUS_MEM_FF_PLY_FIFO_EMPTY::bitWidth == 1, "STATUS_MEM_FF_PLY_FIFO_EMPTY");
+static_assert(GBS::STATUS_MEM_FF_PLY_FIFO_FULL::segment == 0x00 && GBS::STATUS_MEM_FF_PLY_FIFO_FULL::byteOffset == 0x13 && GBS::STATUS_MEM_FF_PLY_FIFO_FULL::bitOffset == 6 && GBS::STATUS_MEM_FF_PLY_FIFO_FULL::bitWidth == 1, "STATUS_MEM_FF_PLY_FIFO_FULL");
+static_assert(GBS::STATUS_MEM_FF_RFF_FIFO_EMPTY::segment == 0x00 && GBS::STATUS_MEM_FF_RFF_FIFO_EMPTY::byteOffset == 0x13 && GBS::STATUS_MEM_FF_RFF_FIFO_EMPTY::bitOffset == 3 && GBS::STATUS_MEM_FF_RFF_FIFO_EMPTY::bitWidth == 1, "STATUS_MEM_FF_RFF_FIFO_EMPTY");
+static_assert(GBS::STATUS_MEM_FF_RFF_FIFO_FULL::segment == 0x00 && GBS::STATUS_MEM_FF_RFF_FIFO_FULL::byteOffset == 0x13 && GBS::STATUS_MEM_FF_RFF_FIFO_FULL::bitOffset == 2 && GBS::STATUS_MEM_FF_RFF_FIFO_FULL::bitWidth == 1, "STATUS_MEM_FF_RFF_FIFO_FULL");
+static_assert(GBS::STATUS_MEM_FF_WFF_FIFO_EMPTY::segment == 0x00 && GBS::STATUS_MEM_FF_WFF_FIFO_EMPTY::byteOffset == 0x13 && GBS::STATUS_MEM_FF_WFF_FIFO_EMPTY::bitOffset == 1 && GBS::STATUS_MEM_FF_WFF_FIFO_EMPTY::bitWidth == 1, "STATUS_MEM_FF_WFF_FIFO_EMPTY");
+static_assert(GBS::STATUS_MEM_FF_WFF_FIFO_FULL::segment == 0x00 && GBS::STATUS_MEM_FF_WFF_FIFO_FULL::byteOffset == 0x13 && GBS::STATUS_MEM_FF_WFF_FIFO_FULL::bitOffset == 0 && GBS::STATUS_MEM_FF_WFF_FIFO_FULL::bitWidth == 1, "STATUS_MEM_FF_WFF_FIFO_FULL");
+static_assert(GBS::STATUS_MISC_HBLK::segment == 0x00 && GBS::STATUS_MISC_HBLK::byteOffset == 0x0A && GBS::STATUS_MISC_HBLK::bitOffset == 5 && GBS::STATUS_MISC_HBLK::bitWidth == 1, "STATUS_MISC_HBLK");
+static_assert(GBS::STATUS_MISC_HSYNC::segment == 0x00 && GBS::STATUS_MISC_HSYNC::byteOffset == 0x0A && GBS::STATUS_MISC_HSYNC::bitOffset == 7 && GBS::STATUS_MISC_HSYNC::bitWidth == 1, "STATUS_MISC_HSYNC");
+static_assert(GBS::STATUS_MISC_PIP_EN_H::segment == 0x00 && GBS::STATUS_MISC_PIP_EN_H::byteOffset == 0x0A && GBS::STATUS_MISC_PIP_EN_H::bitOffset == 1 && GBS::STATUS_MISC_PIP_EN_H::bitWidth == 1, "STATUS_MISC_PIP_EN_H");
+static_assert(GBS::STATUS_MISC_PIP_EN_V::segment == 0x00 && GBS::STATUS_MISC_PIP_EN_V::byteOffset == 0x0A && GBS::STATUS_MISC_PIP_EN_V::bitOffset == 0 && GBS::STATUS_MISC_PIP_EN_V::bitWidth == 1, "STATUS_MISC_PIP_EN_V");
+static_assert(GBS::STATUS_MISC_PLL648_LOCK::segment == 0x00 && GBS::STATUS_MISC_PLL648_LOCK::byteOffset == 0x09 && GBS::STATUS_MISC_PLL648_LOCK::bitOffset == 6 && GBS::STATUS_MISC_PLL648_LOCK::bitWidth == 1, "STATUS_MISC_PLL648_LOCK");
+static_assert(GBS::STATUS_MISC_PLLAD_LOCK::segment == 0x00 && GBS::STATUS_MISC_PLLAD_LOCK::byteOffset == 0x09 && GBS::STATUS_MISC_PLLAD_LOCK::bitOffset == 7 && GBS::STATUS_MISC_PLLAD_LOCK::bitWidth == 1, "STATUS_MISC_PLLAD_LOCK");
+static_assert(GBS::STATUS_MISC_VBLK::segment == 0x00 && GBS::STATUS_MISC_VBLK::byteOffset == 0x0A && GBS::STATUS_MISC_VBLK::bitOffset == 4 && GBS::STATUS_MISC_VBLK::bitWidth == 1, "STATUS_MISC_VBLK");
+static_assert(GBS::STATUS_MISC_VSYNC::segment == 0x00 && GBS::STATUS_MISC_VSYNC::byteOffset == 0x0A && GBS::STATUS_MISC_VSYNC::bitOffset == 6 && GBS::STATUS_MISC_VSYNC::bitWidth == 1, "STATUS_MISC_VSYNC");
+static_assert(GBS::STATUS_SYNC_PROC_HLOW_LEN::segment == 0x00 && GBS::STATUS_SYNC_PROC_HLOW_LEN::byteOffset == 0x19 && GBS::STATUS_SYNC_PROC_HLOW_LEN::bitOffset == 0 && GBS::STATUS_SYNC_PROC_HLOW_LEN::bitWidth == 12, "STATUS_SYNC_PROC_HLOW_LEN");
+static_assert(GBS::STATUS_SYNC_PROC_HSACT::segment == 0x00 && GBS::STATUS_SYNC_PROC_HSACT::byteOffset == 0x16 && GBS::STATUS_SYNC_PROC_HSACT::bitOffset == 1 && GBS::STATUS_SYNC_PROC_HSACT::bitWidth == 1, "STATUS_SYNC_PROC_HSACT");
+static_assert(GBS::STATUS_SYNC_PROC_HSPOL::segment == 0x00 && GBS::STATUS_SYNC_PROC_HSPOL::byteOffset == 0x16 && GBS::STATUS_SYNC_PROC_HSPOL::bitOffset == 0 && GBS::STATUS_SYNC_PROC_HSPOL::bitWidth == 1, "STATUS_SYNC_PROC_HSPOL");
+static_assert(GBS::STATUS_SYNC_PROC_HTOTAL::segment == 0x00 && GBS::STATUS_SYNC_PROC_HTOTAL::byteOffset == 0x17 && GBS::STATUS_SYNC_PROC_HTOTAL::bitOffset == 0 && GBS::STATUS_SYNC_PROC_HTOTAL::bitWidth == 12, "STATUS_SYNC_PROC_HTOTAL");
+static_assert(GBS::STATUS_SYNC_PROC_VSACT::segment == 0x00 && GBS::STATUS_SYNC_PROC_VSACT::byteOffset == 0x16 && GBS::STATUS_SYNC_PROC_VSACT::bitOffset == 3 && GBS::STATUS_SYNC_PROC_VSACT::bitWidth == 1, "STATUS_SYNC_PROC_VSACT");
+static_assert(GBS::STATUS_SYNC_PROC_VSPOL::segment == 0x00 && GBS::STATUS_SYNC_PROC_VSPOL::byteOffset == 0x16 && GBS::STATUS_SYNC_PROC_VSPOL::bitOffset == 2 && GBS::STATUS_SYNC_PROC_VSPOL::bitWidth == 1, "STATUS_SYNC_PROC_VSPOL");
+static_assert(GBS::STATUS_SYNC_PROC_VTOTAL::segment == 0x00 && GBS::STATUS_SYNC_PROC_VTOTAL::byteOffset == 0x1B && GBS::STATUS_SYNC_PROC_VTOTAL::bitOffset == 0 && GBS::STATUS_SYNC_PROC_VTOTAL::bitWidth == 11, "STATUS_SYNC_PROC_VTOTAL");
+static_assert(GBS::STATUS_VDS_FIELD::segment == 0x00 && GBS::STATUS_VDS_FIELD::byteOffset == 0x11 && GBS::STATUS_VDS_FIELD::bitOffset == 0 && GBS::STATUS_VDS_FIELD::bitWidth == 1, "STATUS_VDS_FIELD");
+static_assert(GBS::STATUS_VDS_FR_NUM::segment == 0x00 && GBS::STATUS_VDS_FR_NUM::byteOffset == 0x10 && GBS::STATUS_VDS_FR_NUM::bitOffset == 0 && GBS::STATUS_VDS_FR_NUM::bitWidth == 4, "STATUS_VDS_FR_NUM");
+static_assert(GBS::STATUS_VDS_OUT_BLANK::segment == 0x00 && GBS::STATUS_VDS_OUT_BLANK::byteOffset == 0x11 && GBS::STATUS_VDS_OUT_BLANK::bitOffset == 1 && GBS::STATUS_VDS_OUT_BLANK::bitWidth == 1, "STATUS_VDS_OUT_BLANK");
+static_assert(GBS::STATUS_VDS_OUT_HSYNC::segment == 0x00 && GBS::STATUS_VDS_OUT_HSYNC::byteOffset == 0x10 && GBS::STATUS_VDS_OUT_HSYNC::bitOffset == 5 && GBS::STATUS_VDS_OUT_HSYNC::bitWidth == 1, "STATUS_VDS_OUT_HSYNC");
+static_assert(GBS::STATUS_VDS_OUT_VSYNC::segment == 0x00 && GBS::STATUS_VDS_OUT_VSYNC::byteOffset == 0x10 && GBS::STATUS_VDS_OUT_VSYNC::bitOffset == 4 && GBS::STATUS_VDS_OUT_VSYNC::bitWidth == 1, "STATUS_VDS_OUT_VSYNC");
+static_assert(GBS::STATUS_VDS_VERT_COUNT::segment == 0x00 && GBS::STATUS_VDS_VERT_COUNT::byteOffset == 0x11 && GBS::STATUS_VDS_VERT_COUNT::bitOffset == 4 && GBS::STATUS_VDS_VERT_COUNT::bitWidth == 11, "STATUS_VDS_VERT_COUNT");
+static_assert(GBS::TEST_BUS::segment == 0x00 && GBS::TEST_BUS::byteOffset == 0x2E && GBS::TEST_BUS::bitOffset == 0 && GBS::TEST_BUS::bitWidth == 16, "TEST_BUS");
+static_assert(GBS::TEST_BUS_1F::segment == 0x00 && GBS::TEST_BUS_1F::byteOffset == 0x1F && GBS::TEST_BUS_1F::bitOffset == 0 && GBS::TEST_BUS_1F::bitWidth == 8, "TEST_BUS_1F");
+static_assert(GBS::TEST_BUS_23::segment == 0x00 && GBS::TEST_BUS_23::byteOffset == 0x23 && GBS::TEST_BUS_23::bitOffset == 0 && GBS::TEST_BUS_23::bitWidth == 8, "TEST_BUS_23");
+static_assert(GBS::TEST_BUS_2E::segment == 0x00 && GBS::TEST_BUS_2E::byteOffset == 0x2E && GBS::TEST_BUS_2E::bitOffset == 0 && GBS::TEST_BUS_2E::bitWidth == 8, "TEST_BUS_2E");
+static_assert(GBS::TEST_BUS_2F::segment == 0x00 && GBS::TEST_BUS_2F::byteOffset == 0x2F && GBS::TEST_BUS_2F::bitOffset == 0 && GBS::TEST_BUS_2F::bitWidth == 8, "TEST_BUS_2F");
+static_assert(GBS::TEST_BUS_EN::segment == 0x00 && GBS::TEST_BUS_EN::byteOffset == 0x4D && GBS::TEST_BUS_EN::bitOffset == 5 && GBS::TEST_BUS_EN::bitWidth == 1, "TEST_BUS_EN");
+static_assert(GBS::TEST_BUS_SEL::segment == 0x00 && GBS::TEST_BUS_SEL::byteOffset == 0x4D && GBS::TEST_BUS_SEL::bitOffset == 0 && GBS::TEST_BUS_SEL::bitWidth == 5, "TEST_BUS_SEL");
+static_assert(GBS::TEST_BUS_SP_SEL::segment == 0x05 && GBS::TEST_BUS_SP_SEL::byteOffset == 0x63 && GBS::TEST_BUS_SP_SEL::bitOffset == 0 && GBS::TEST_BUS_SP_SEL::bitWidth == 8, "TEST_BUS_SP_SEL");
+static_assert(GBS::TEST_FF_STATUS::segment == 0x00 && GBS::TEST_FF_STATUS::byteOffset == 0x20 && GBS::TEST_FF_STATUS::bitOffset == 0 && GBS::TEST_FF_STATUS::bitWidth == 16, "TEST_FF_STATUS");
+static_assert(GBS::VDS_0X2A_RESERVED_2BITS::segment == 0x03 && GBS::VDS_0X2A_RESERVED_2BITS::byteOffset == 0x2A && GBS::VDS_0X2A_RESERVED_2BITS::bitOffset == 6 && GBS::VDS_0X2A_RESERVED_2BITS::bitWidth == 2, "VDS_0X2A_RESERVED_2BITS");
+static_assert(GBS::VDS_1ST_INT_BYPS::segment == 0x03 && GBS::VDS_1ST_INT_BYPS::byteOffset == 0x40 && GBS::VDS_1ST_INT_BYPS::bitOffset == 0 && GBS::VDS_1ST_INT_BYPS::bitWidth == 1, "VDS_1ST_INT_BYPS");
+static_assert(GBS::VDS_2ND_INT_BYPS::segment == 0x03 && GBS::VDS_2ND_INT_BYPS::byteOffset == 0x40 && GBS::VDS_2ND_INT_BYPS::bitOffset == 1 && GBS::VDS_2ND_INT_BYPS::bitWidth == 1, "VDS_2ND_INT_BYPS");
+static_assert(GBS::VDS_3_24::segment == 0x03 && GBS::VDS_3_24::byteOffset == 0x24 && GBS::VDS_3_24::bitOffset == 0 && GBS::VDS_3_24::bitWidth == 8, "VDS_3_24");
+static_assert(GBS::VDS_BLEV_AUTO_EN::segment == 0x03 && GBS::VDS_BLEV_AUTO_EN::byteOffset == 0x26 && GBS::VDS_BLEV_AUTO_EN::bitOffset == 7 && GBS::VDS_BLEV_AUTO_EN::bitWidth == 1, "VDS_BLEV_AUTO_EN");
+static_assert(GBS::VDS_BLEV_BYPS::segment == 0x03 && GBS::VDS_BLEV_BYPS::byteOffset == 0x2A && GBS::VDS_BLEV_BYPS::bitOffset == 0 && GBS::VDS_BLEV_BYPS::bitWidth == 1, "VDS_BLEV_BYPS");
+static_assert(GBS::VDS_BLEV_GAIN::segment == 0x03 && GBS::VDS_BLEV_GAIN::byteOffset == 0x29 && GBS::VDS_BLEV_GAIN::bitOffset == 0 && GBS::VDS_BLEV_GAIN::bitWidth == 8, "VDS_BLEV_GAIN");
+static_assert(GBS::VDS_BLEV_LEVEL::segment == 0x03 && GBS::VDS_BLEV_LEVEL::byteOffset == 0x28 && GBS::VDS_BLEV_LEVEL::bitOffset == 0 && GBS::VDS_BLEV_LEVEL::bitWidth == 8, "VDS_BLEV_LEVEL");
+static_assert(GBS::VDS_BLK_BF_EN::segment == 0x03 && GBS::VDS_BLK_BF_EN::byteOffset == 0x3E && GBS::VDS_BLK_BF_EN::bitOffset == 7 && GBS::VDS_BLK_BF_EN::bitWidth == 1, "VDS_BLK_BF_EN");
+static_assert(GBS::VDS_BLUE_BYPS::segment == 0x03 && GBS::VDS_BLUE_BYPS::byteOffset == 0x73 && GBS::VDS_BLUE_BYPS::bitOffset == 3 && GBS::VDS_BLUE_BYPS::bitWidth == 1, "VDS_BLUE_BYPS");
+static_assert(GBS::VDS_BLUE_RANGE::segment == 0x03 && GBS::VDS_BLUE_RANGE::byteOffset == 0x73 && GBS::VDS_BLUE_RANGE::bitOffset == 0 && GBS::VDS_BLUE_RANGE::bitWidth == 3, "VDS_BLUE_RANGE");
+static_assert(GBS::VDS_BLUE_UGAIN::segment == 0x03 && GBS::VDS_BLUE_UGAIN::byteOffset == 0x73 && GBS::VDS_BLUE_UGAIN::bitOffset == 4 && GBS::VDS_BLUE_UGAIN::bitWidth == 4, "VDS_BLUE_UGAIN");
+static_assert(GBS::VDS_BLUE_VGAIN::segment == 0x03 && GBS::VDS_BLUE_VGAIN::byteOffset == 0x74 && GBS::VDS_BLUE_VGAIN::bitOffset == 0 && GBS::VDS_BLUE_VGAIN::bitWidth == 4, "VDS_BLUE_VGAIN");
+static_assert(GBS::VDS_BLUE_Y_LEV::segment == 0x03 && GBS::VDS_BLUE_Y_LEV::byteOffset == 0x74 && GBS::VDS_BLUE_Y_LEV::bitOffset == 4 && GBS::VDS_BLUE_Y_LEV::bitWidth == 4, "VDS_BLUE_Y_LEV");
+static_assert(GBS::VDS_C1_BYPS::segment == 0x03 && GBS::VDS_C1_BYPS::byteOffset == 0x65 && GBS::VDS_C1_BYPS::bitOffset == 4 && GBS::VDS_C1_BYPS::bitWidth == 1, "VDS_C1_BYPS");
+static_assert(GBS::VDS_C1_GAIN::segment == 0x03 && GBS::VDS_C1_GAIN::byteOffset == 0x63 && GBS::VDS_C1_GAIN::bitOffset == 0 && GBS::VDS_C1_GAIN::bitWidth == 4, "VDS_C1_GAIN");
+static_assert(GBS::VDS_C1_TAG_HIGH_SLOPE::segment == 0x03 && GBS::VDS_C1_TAG_HIGH_SLOPE::byteOffset == 0x61 && GBS::VDS_C1_TAG_HIGH_SLOPE::bitOffset == 6 && GBS::VDS_C1_TAG_HIGH_SLOPE::bitWidth == 10, "VDS_C1_TAG_HIGH_SLOPE");
+static_assert(GBS::VDS_C1_TAG_LOW_SLOPE::segment == 0x03 && GBS::VDS_C1_TAG_LOW_SLOPE::byteOffset == 0x60 && GBS::VDS_C1_TAG_LOW_SLOPE::bitOffset == 4 && GBS::VDS_C1_TAG_LOW_SLOPE::bitWidth == 10, "VDS_C1_TAG_LOW_SLOPE");
+static_assert(GBS::VDS_C1_U_HIGH::segment == 0x03 && GBS::VDS_C1_U_HIGH::byteOffset == 0x64 && GBS::VDS_C1_U_HIGH::bitOffset == 4 && GBS::VDS_C1_U_HIGH::bitWidth == 8, "VDS_C1_U_HIGH");
+static_assert(GBS::VDS_C1_U_LOW::segment == 0x03 && GBS::VDS_C1_U_LOW::byteOffset == 0x63 && GBS::VDS_C1_U_LOW::bitOffset == 4 && GBS::VDS_C1_U_LOW::bitWidth == 8, "VDS_C1_U_LOW");
+static_assert(GBS::VDS_C1_Y_THRESH::segment == 0x03 && GBS::VDS_C1_Y_THRESH::byteOffset == 0x65 && GBS::VDS_C1_Y_THRESH::bitOffset == 5 && GBS::VDS_C1_Y_THRESH::bitWidth == 8, "VDS_C1_Y_THRESH");
+static_assert(GBS::VDS_C2_BYPS::segment == 0x03 && GBS::VDS_C2_BYPS::byteOffset == 0x6B && GBS::VDS_C2_BYPS::bitOffset == 5 && GBS::VDS_C2_BYPS::bitWidth == 1, "VDS_C2_BYPS");
+static_assert(GBS::VDS_C2_GAIN::segment == 0x03 && GBS::VDS_C2_GAIN::byteOffset == 0x69 && GBS::VDS_C2_GAIN::bitOffset == 1 && GBS::VDS_C2_GAIN::bitWidth == 4, "VDS_C2_GAIN");
+static_assert(GBS::VDS_C2_TAG_HIGH_SLOPE::segment == 0x03 && GBS::VDS_C2_TAG_HIGH_SLOPE::byteOffset == 0x67 && GBS::VDS_C2_TAG_HIGH_SLOPE::bitOffset == 7 && GBS::VDS_C2_TAG_HIGH_SLOPE::bitWidth == 10, "VDS_C2_TAG_HIGH_SLOPE");
+static_assert(GBS::VDS_C2_TAG_LOW_SLOPE::segment == 0x03 && GBS::VDS_C2_TAG_LOW_SLOPE::byteOffset == 0x66 && GBS::VDS_C2_TAG_LOW_SLOPE::bitOffset == 5 && GBS::VDS_C2_TAG_LOW_SLOPE::bitWidth == 10, "VDS_C2_TAG_LOW_SLOPE");
+static_assert(GBS::VDS_C2_U_HIGH::segment == 0x03 && GBS::VDS_C2_U_HIGH::byteOffset == 0x6A && GBS::VDS_C2_U_HIGH::bitOffset == 5 && GBS::VDS_C2_U_HIGH::bitWidth == 8, "VDS_C2_U_HIGH");
+static_assert(GBS::VDS_C2_U_LOW::segment == 0x03 && GBS::VDS_C2_U_LOW::byteOffset == 0x69 && GBS::VDS_C2_U_LOW::bitOffset == 5 && GBS::VDS_C2_U_LOW::bitWidth == 8, "VDS_C2_U_LOW");
+static_assert(GBS::VDS_C2_Y_THRESH::segment == 0x03 && GBS::VDS_C2_Y_THRESH::byteOffset == 0x6B && GBS::VDS_C2_Y_THRESH::bitOffset == 6 && GBS::VDS_C2_Y_THRESH::bitWidth == 8, "VDS_C2_Y_THRESH");
+static_assert(GBS::VDS_CONVT_BYPS::segment == 0x03 && GBS::VDS_CONVT_BYPS::byteOffset == 0x3E && GBS::VDS_CONVT_BYPS::bitOffset == 3 && GBS::VDS_CONVT_BYPS::bitWidth == 1, "VDS_CONVT_BYPS");
+static_assert(GBS::VDS_C_VPK_BYPS::segment == 0x03 && GBS::VDS_C_VPK_BYPS::byteOffset == 0x4E && GBS::VDS_C_VPK_BYPS::bitOffset == 3 && GBS::VDS_C_VPK_BYPS::bitWidth == 1, "VDS_C_VPK_BYPS");
+static_assert(GBS::VDS_C_VPK_CORE::segment == 0x03 && GBS::VDS_C_VPK_CORE::byteOffset == 0x4E && GBS::VDS_C_VPK_CORE::bitOffset == 4 && GBS::VDS_C_VPK_CORE::bitWidth == 3, "VDS_C_VPK_CORE");
+static_assert(GBS::VDS_C_VPK_GAIN::segment == 0x03 && GBS::VDS_C_VPK_GAIN::byteOffset == 0x4F && GBS::VDS_C_VPK_GAIN::bitOffset == 0 && GBS::VDS_C_VPK_GAIN::bitWidth == 6, "VDS_C_VPK_GAIN");
+static_assert(GBS::VDS_DFIELD_EN::segment == 0x03 && GBS::VDS_DFIELD_EN::byteOffset == 0x00 && GBS::VDS_DFIELD_EN::bitOffset == 2 && GBS::VDS_DFIELD_EN::bitWidth == 1, "VDS_DFIELD_EN");
+static_assert(GBS::VDS_DIF_FR_SEL_EN::segment == 0x03 && GBS::VDS_DIF_FR_SEL_EN::byteOffset == 0x1F && GBS::VDS_DIF_FR_SEL_EN::bitOffset == 4 && GBS::VDS_DIF_FR_SEL_EN::bitWidth == 1, "VDS_DIF_FR_SEL_EN");
+static_assert(GBS::VDS_DIS_HB_SP::segment == 0x03 && GBS::VDS_DIS_HB_SP::byteOffset == 0x11 && GBS::VDS_DIS_HB_SP::bitOffset == 4 && GBS::VDS_DIS_HB_SP::bitWidth == 12, "VDS_DIS_HB_SP");
+static_assert(GBS::VDS_DIS_HB_ST::segment == 0x03 && GBS::VDS_DIS_HB_ST::byteOffset == 0x10 && GBS::VDS_DIS_HB_ST::bitOffset == 0 && GBS::VDS_DIS_HB_ST::bitWidth == 12, "VDS_DIS_HB_ST");
+static_assert(GBS::VDS_DIS_VB_SP::segment == 0x03 && GBS::VDS_DIS_VB_SP::byteOffset == 0x14 && GBS::VDS_DIS_VB_SP::bitOffset == 4 && GBS::VDS_DIS_VB_SP::bitWidth == 11, "VDS_DIS_VB_SP");
+static_assert(GBS::VDS_DIS_VB_ST::segment == 0x03 && GBS::VDS_DIS_VB_ST::byteOffset == 0x13 && GBS::VDS_DIS_VB_ST::bitOffset == 0 && GBS::VDS_DIS_VB_ST::bitWidth == 11, "VDS_DIS_VB_ST");
+static_assert(GBS::VDS_DO_16B_EN::segment == 0x03 && GBS::VDS_DO_16B_EN::byteOffset == 0x50 && GBS::VDS_DO_16B_EN::bitOffset == 7 && GBS::VDS_DO_16B_EN::bitWidth == 1, "VDS_DO_16B_EN");
+static_assert(GBS::VDS_DO_UVSEL_FLIP::segment == 0x03 && GBS::VDS_DO_UVSEL_FLIP::byteOffset == 0x50 && GBS::VDS_DO_UVSEL_FLIP::bitOffset == 6 && GBS::VDS_DO_UVSEL_FLIP::bitWidth == 1, "VDS_DO_UVSEL_FLIP");
+static_assert(GBS::VDS_DO_UV_DEV_BYPS::segment == 0x03 && GBS::VDS_DO_UV_DEV_BYPS::byteOffset == 0x50 && GBS::VDS_DO_UV_DEV_BYPS::bitOffset == 5 && GBS::VDS_DO_UV_DEV_BYPS::bitWidth == 1, "VDS_DO_UV_DEV_BYPS");
+static_assert(GBS::VDS_DYN_BYPS::segment == 0x03 && GBS::VDS_DYN_BYPS::byteOffset == 0x3E && GBS::VDS_DYN_BYPS::bitOffset == 4 && GBS::VDS_DYN_BYPS::bitWidth == 1, "VDS_DYN_BYPS");
+static_assert(GBS::VDS_D_RAM_BYPS::segment == 0x03 && GBS::VDS_D_RAM_BYPS::byteOffset == 0x26 && GBS::VDS_D_RAM_BYPS::bitOffset == 6 && GBS::VDS_D_RAM_BYPS::bitWidth == 1, "VDS_D_RAM_BYPS");
+static_assert(GBS::VDS_D_SP::segment == 0x03 && GBS::VDS_D_SP::byteOffset == 0x25 && GBS::VDS_D_SP::bitOffset == 0 && GBS::VDS_D_SP::bitWidth == 10, "VDS_D_SP");
+static_assert(GBS::VDS_EN_FR_NUM_RST::segment == 0x03 && GBS::VDS_EN_FR_NUM_RST::byteOffset == 0x1F && GBS::VDS_EN_FR_NUM_RST::bitOffset == 5 && GBS::VDS_EN_FR_NUM_RST::bitWidth == 1, "VDS_EN_FR_NUM_RST");
+static_assert(GBS::VDS_EXT_HB_SP::segment == 0x03 && GBS::VDS_EXT_HB_SP::byteOffset == 0x6E && GBS::VDS_EXT_HB_SP::bitOffset == 4 && GBS::VDS_EXT_HB_SP::bitWidth == 12, "VDS_EXT_HB_SP");
+static_assert(GBS::VDS_EXT_HB_ST::segment == 0x03 && GBS::VDS_EXT_HB_ST::byteOffset == 0x6D && GBS::VDS_EXT_HB_ST::bitOffset == 0 && GBS::VDS_EXT_HB_ST::bitWidth == 12, "VDS_EXT_HB_ST");
+static_assert(GBS::VDS_EXT_VB_SP::segment == 0x03 && GBS::VDS_EXT_VB_SP::byteOffset == 0x71 && GBS::VDS_EXT_VB_SP::bitOffset == 4 && GBS::VDS_EXT_VB_SP::bitWidth == 11, "VDS_EXT_VB_SP");
+static_assert(GBS::VDS_EXT_VB_ST::segment == 0x03 && GBS::VDS_EXT_VB_ST::byteOffset == 0x70 && GBS::VDS_EXT_VB_ST::bitOffset == 0 && GBS::VDS_EXT_VB_ST::bitWidth == 11, "VDS_EXT_VB_ST");
+static_assert(GBS::VDS_FID_AA_DLY::segment == 0x03 && GBS::VDS_FID_AA_DLY::byteOffset == 0x1A && GBS::VDS_FID_AA_DLY::bitOffset == 6 && GBS::VDS_FID_AA_DLY::bitWidth == 1, "VDS_FID_AA_DLY");
+static_assert(GBS::VDS_FID_RST::segment == 0x03 && GBS::VDS_FID_RST::byteOffset == 0x1A && GBS::VDS_FID_RST::bitOffset == 7 && GBS::VDS_FID_RST::bitWidth == 1, "VDS_FID_RST");
+static_assert(GBS::VDS_FIELDAB_EN::segment == 0x03 && GBS::VDS_FIELDAB_EN::byteOffset == 0x00 && GBS::VDS_FIELDAB_EN::bitOffset == 1 && GBS::VDS_FIELDAB_EN::bitWidth == 1, "VDS_FIELDAB_EN");
+static_assert(GBS::VDS_FIELD_FLIP::segment == 0x03 && GBS::VDS_FIELD_FLIP::byteOffset == 0x00 && GBS::VDS_FIELD_FLIP::bitOffset == 3 && GBS::VDS_FIELD_FLIP::bitWidth == 1, "VDS_FIELD_FLIP");
+static_assert(GBS::VDS_FLOCK_EN::segment == 0x03 && GBS::VDS_FLOCK_EN::byteOffset == 0x1A && GBS::VDS_FLOCK_EN::bitOffset == 4 && GBS::VDS_FLOCK_EN::bitWidth == 1, "VDS_FLOCK_EN");
+static_assert(GBS::VDS_FRAME_NO::segment == 0x03 && GBS::VDS_FRAME_NO::byteOffset == 0x1F && GBS::VDS_FRAME_NO::bitOffset == 0 && GBS::VDS_FRAME_NO::bitWidth == 4, "VDS_FRAME_NO");
+static_assert(GBS::VDS_FRAME_RST::segment == 0x03 && GBS::VDS_FRAME_RST::byteOffset == 0x19 && GBS::VDS_FRAME_RST::bitOffset == 0 && GBS::VDS_FRAME_RST::bitWidth == 10, "VDS_FRAME_RST");
+static_assert(GBS::VDS_FREERUN_FID::segment == 0x03 && GBS::VDS_FREERUN_FID::byteOffset == 0x1A && GBS::VDS_FREERUN_FID::bitOffset == 5 && GBS::VDS_FREERUN_FID::bitWidth == 1, "VDS_FREERUN_FID");
+static_assert(GBS::VDS_FR_SELECT::segment == 0x03 && GBS::VDS_FR_SELECT::byteOffset == 0x1B && GBS::VDS_FR_SELECT::bitOffset == 0 && GBS::VDS_FR_SELECT::bitWidth == 32, "VDS_FR_SELECT");
+static_assert(GBS::VDS_GLB_NOISE::segment == 0x03 && GBS::VDS_GLB_NOISE::byteOffset == 0x51 && GBS::VDS_GLB_NOISE::bitOffset == 7 && GBS::VDS_GLB_NOISE::bitWidth == 11, "VDS_GLB_NOISE");
+static_assert(GBS::VDS_HALF_EN::segment == 0x03 && GBS::VDS_HALF_EN::byteOffset == 0x00 && GBS::VDS_HALF_EN::bitOffset == 6 && GBS::VDS_HALF_EN::bitWidth == 1, "VDS_HALF_EN");
+static_assert(GBS::VDS_HB_SP::segment == 0x03 && GBS::VDS_HB_SP::byteOffset == 0x05 && GBS::VDS_HB_SP::bitOffset == 4 && GBS::VDS_HB_SP::bitWidth == 12, "VDS_HB_SP");
+static_assert(GBS::VDS_HB_ST::segment == 0x03 && GBS::VDS_HB_ST::byteOffset == 0x04 && GBS::VDS_HB_ST::bitOffset == 0 && GBS::VDS_HB_ST::bitWidth == 12, "VDS_HB_ST");
+static_assert(GBS::VDS_HSCALE::segment == 0x03 && GBS::VDS_HSCALE::byteOffset == 0x16 && GBS::VDS_HSCALE::bitOffset == 0 && GBS::VDS_HSCALE::bitWidth == 10, "VDS_HSCALE");
+static_assert(GBS::VDS_HSCALE_BYPS::segment == 0x03 && GBS::VDS_HSCALE_BYPS::byteOffset == 0x00 && GBS::VDS_HSCALE_BYPS::bitOffset == 4 && GBS::VDS_HSCALE_BYPS::bitWidth == 1, "VDS_HSCALE_BYPS");
+static_assert(GBS::VDS_HSYNC_RST::segment == 0x03 && GBS::VDS_HSYNC_RST::byteOffset == 0x01 && GBS::VDS_HSYNC_RST::bitOffset == 0 && GBS::VDS_HSYNC_RST::bitWidth == 12, "VDS_HSYNC_RST");
+static_assert(GBS::VDS_HS_SP::segment == 0x03 && GBS::VDS_HS_SP::byteOffset == 0x0B && GBS::VDS_HS_SP::bitOffset == 4 && GBS::VDS_HS_SP::bitWidth == 12, "VDS_HS_SP");
+static_assert(GBS::VDS_HS_ST::segment == 0x03 && GBS::VDS_HS_ST::byteOffset == 0x0A && GBS::VDS_HS_ST::bitOffset == 0 && GBS::VDS_HS_ST::bitWidth == 12, "VDS_HS_ST");
+static_assert(GBS::VDS_IN_DREG_BYPS::segment == 0x03 && GBS::VDS_IN_DREG_BYPS::byteOffset == 0x40 && GBS::VDS_IN_DREG_BYPS::bitOffset == 2 && GBS::VDS_IN_DREG_BYPS::bitWidth == 1, "VDS_IN_DREG_BYPS");
+static_assert(GBS::VDS_NR_C_BYPS::segment == 0x03 && GBS::VDS_NR_C_BYPS::byteOffset == 0x52 && GBS::VDS_NR_C_BYPS::bitOffset == 5 && GBS::VDS_NR_C_BYPS::bitWidth == 1, "VDS_NR_C_BYPS");
+static_assert(GBS::VDS_NR_DIF_LPF5_BYPS::segment == 0x03 && GBS::VDS_NR_DIF_LPF5_BYPS::byteOffset == 0x52 && GBS::VDS_NR_DIF_LPF5_BYPS::bitOffset == 6 && GBS::VDS_NR_DIF_LPF5_BYPS::bitWidth == 1, "VDS_NR_DIF_LPF5_BYPS");
+static_assert(GBS::VDS_NR_EN_GLB_STILL::segment == 0x03 && GBS::VDS_NR_EN_GLB_STILL::byteOffset == 0x55 && GBS::VDS_NR_EN_GLB_STILL::bitOffset == 6 && GBS::VDS_NR_EN_GLB_STILL::bitWidth == 1, "VDS_NR_EN_GLB_STILL");
+static_assert(GBS::VDS_NR_EN_H_NOISY::segment == 0x03 && GBS::VDS_NR_EN_H_NOISY::byteOffset == 0x55 && GBS::VDS_NR_EN_H_NOISY::bitOffset == 4 && GBS::VDS_NR_EN_H_NOISY::bitWidth == 1, "VDS_NR_EN_H_NOISY");
+static_assert(GBS::VDS_NR_GLB_STILL_MENU::segment == 0x03 && GBS::VDS_NR_GLB_STILL_MENU::byteOffset == 0x55 && GBS::VDS_NR_GLB_STILL_MENU::bitOffset == 7 && GBS::VDS_NR_GLB_STILL_MENU::bitWidth == 1, "VDS_NR_GLB_STILL_MENU");
+static_assert(GBS::VDS_NR_MIG_USER_EN::segment == 0x03 && GBS::VDS_NR_MIG_USER_EN::byteOffset == 0x53 && GBS::VDS_NR_MIG_USER_EN::bitOffset == 7 && GBS::VDS_NR_MIG_USER_EN::bitWidth == 1, "VDS_NR_MIG_USER_EN");
+static_assert(GBS::VDS_NR_MI_GAIN::segment == 0x03 && GBS::VDS_NR_MI_GAIN::byteOffset == 0x54 && GBS::VDS_NR_MI_GAIN::bitOffset == 0 && GBS::VDS_NR_MI_GAIN::bitWidth == 4, "VDS_NR_MI_GAIN");
+static_assert(GBS::VDS_NR_MI_OFFSET::segment == 0x03 && GBS::VDS_NR_MI_OFFSET::byteOffset == 0x53 && GBS::VDS_NR_MI_OFFSET::bitOffset == 0 && GBS::VDS_NR_MI_OFFSET::bitWidth == 7, "VDS_NR_MI_OFFSET");
+static_assert(GBS::VDS_NR_MI_THRES::segment == 0x03 && GBS::VDS_NR_MI_THRES::byteOffset == 0x55 && GBS::VDS_NR_MI_THRES::bitOffset == 0 && GBS::VDS_NR_MI_THRES::bitWidth == 4, "VDS_NR_MI_THRES");
+static_assert(GBS::VDS_NR_MI_TH_EN::segment == 0x03 && GBS::VDS_NR_MI_TH_EN::byteOffset == 0x52 && GBS::VDS_NR_MI_TH_EN::bitOffset == 7 && GBS::VDS_NR_MI_TH_EN::bitWidth == 1, "VDS_NR_MI_TH_EN");
+static_assert(GBS::VDS_NR_NOISY_OFFSET::segment == 0x03 && GBS::VDS_NR_NOISY_OFFSET::byteOffset == 0x56 && GBS::VDS_NR_NOISY_OFFSET::bitOffset == 0 && GBS::VDS_NR_NOISY_OFFSET::bitWidth == 7, "VDS_NR_NOISY_OFFSET");
+static_assert(GBS::VDS_NR_STILL_GAIN::segment == 0x03 && GBS::VDS_NR_STILL_GAIN::byteOffset == 0x54 && GBS::VDS_NR_STILL_GAIN::bitOffset == 4 && GBS::VDS_NR_STILL_GAIN::bitWidth == 4, "VDS_NR_STILL_GAIN");
+static_assert(GBS::VDS_NR_Y_BYPS::segment == 0x03 && GBS::VDS_NR_Y_BYPS::byteOffset == 0x52 && GBS::VDS_NR_Y_BYPS::bitOffset == 4 && GBS::VDS_NR_Y_BYPS::bitWidth == 1, "VDS_NR_Y_BYPS");
+static_assert(GBS::VDS_NS_BYPS::segment == 0x03 && GBS::VDS_NS_BYPS::byteOffset == 0x60 && GBS::VDS_NS_BYPS::bitOffset == 2 && GBS::VDS_NS_BYPS::bitWidth == 1, "VDS_NS_BYPS");
+static_assert(GBS::VDS_NS_SQUARE_RAD::segment == 0x03 && GBS::VDS_NS_SQUARE_RAD::byteOffset == 0x5B && GBS::VDS_NS_SQUARE_RAD::bitOffset == 7 && GBS::VDS_NS_SQUARE_RAD::bitWidth == 15, "VDS_NS_SQUARE_RAD");
+static_assert(GBS::VDS_NS_U_CENTER::segment == 0x03 && GBS::VDS_NS_U_CENTER::byteOffset == 0x59 && GBS::VDS_NS_U_CENTER::bitOffset == 0 && GBS::VDS_NS_U_CENTER::bitWidth == 8, "VDS_NS_U_CENTER");
+static_assert(GBS::VDS_NS_U_GAIN::segment == 0x03 && GBS::VDS_NS_U_GAIN::byteOffset == 0x5B && GBS::VDS_NS_U_GAIN::bitOffset == 0 && GBS::VDS_NS_U_GAIN::bitWidth == 7, "VDS_NS_U_GAIN");
+static_assert(GBS::VDS_NS_V_CENTER::segment == 0x03 && GBS::VDS_NS_V_CENTER::byteOffset == 0x5A && GBS::VDS_NS_V_CENTER::bitOffset == 0 && GBS::VDS_NS_V_CENTER::bitWidth == 8, "VDS_NS_V_CENTER");
+static_assert(GBS::VDS_NS_V_GAIN::segment == 0x03 && GBS::VDS_NS_V_GAIN::byteOffset == 0x5E && GBS::VDS_NS_V_GAIN::bitOffset == 6 && GBS::VDS_NS_V_GAIN::bitWidth == 7, "VDS_NS_V_GAIN");
+static_assert(GBS::VDS_NS_Y_ACTIVE_EN::segment == 0x03 && GBS::VDS_NS_Y_ACTIVE_EN::byteOffset == 0x60 && GBS::VDS_NS_Y_ACTIVE_EN::bitOffset == 3 && GBS::VDS_NS_Y_ACTIVE_EN::bitWidth == 1, "VDS_NS_Y_ACTIVE_EN");
+static_assert(GBS::VDS_NS_Y_HIGH_TH::segment == 0x03 && GBS::VDS_NS_Y_HIGH_TH::byteOffset == 0x5D && GBS::VDS_NS_Y_HIGH_TH::bitOffset == 6 && GBS::VDS_NS_Y_HIGH_TH::bitWidth == 8, "VDS_NS_Y_HIGH_TH");
+static_assert(GBS::VDS_NS_Y_LOW_TH::segment == 0x03 && GBS::VDS_NS_Y_LOW_TH::byteOffset == 0x5F && GBS::VDS_NS_Y_LOW_TH::bitOffset == 5 && GBS::VDS_NS_Y_LOW_TH::bitWidth == 5, "VDS_NS_Y_LOW_TH");
+static_assert(GBS::VDS_PK_HB_CMP::segment == 0x03 && GBS::VDS_PK_HB_CMP::byteOffset == 0x4A && GBS::VDS_PK_HB_CMP::bitOffset == 3 && GBS::VDS_PK_HB_CMP::bitWidth == 5, "VDS_PK_HB_CMP");
+static_assert(GBS::VDS_PK_HB_CORE::segment == 0x03 && GBS::VDS_PK_HB_CORE::byteOffset == 0x4A && GBS::VDS_PK_HB_CORE::bitOffset == 0 && GBS::VDS_PK_HB_CORE::bitWidth == 3, "VDS_PK_HB_CORE");
+static_assert(GBS::VDS_PK_HB_GAIN::segment == 0x03 && GBS::VDS_PK_HB_GAIN::byteOffset == 0x4B && GBS::VDS_PK_HB_GAIN::bitOffset == 0 && GBS::VDS_PK_HB_GAIN::bitWidth == 6, "VDS_PK_HB_GAIN");
+static_assert(GBS::VDS_PK_HH_CMP::segment == 0x03 && GBS::VDS_PK_HH_CMP::byteOffset == 0x4C && GBS::VDS_PK_HH_CMP::bitOffset == 3 && GBS::VDS_PK_HH_CMP::bitWidth == 5, "VDS_PK_HH_CMP");
+static_assert(GBS::VDS_PK_HH_CORE::segment == 0x03 && GBS::VDS_PK_HH_CORE::byteOffset == 0x4C && GBS::VDS_PK_HH_CORE::bitOffset == 0 && GBS::VDS_PK_HH_CORE::bitWidth == 3, "VDS_PK_HH_CORE");
+static_assert(GBS::VDS_PK_HH_GAIN::segment == 0x03 && GBS::VDS_PK_HH_GAIN::byteOffset == 0x4D && GBS::VDS_PK_HH_GAIN::bitOffset == 0 && GBS::VDS_PK_HH_GAIN::bitWidth == 6, "VDS_PK_HH_GAIN");
+static_assert(GBS::VDS_PK_HL_CMP::segment == 0x03 && GBS::VDS_PK_HL_CMP::byteOffset == 0x48 && GBS::VDS_PK_HL_CMP::bitOffset == 3 && GBS::VDS_PK_HL_CMP::bitWidth == 5, "VDS_PK_HL_CMP");
+static_assert(GBS::VDS_PK_HL_CORE::segment == 0x03 && GBS::VDS_PK_HL_CORE::byteOffset == 0x48 && GBS::VDS_PK_HL_CORE::bitOffset == 0 && GBS::VDS_PK_HL_CORE::bitWidth == 3, "VDS_PK_HL_CORE");
+static_assert(GBS::VDS_PK_HL_GAIN::segment == 0x03 && GBS::VDS_PK_HL_GAIN::byteOffset == 0x49 && GBS::VDS_PK_HL_GAIN::bitOffset == 0 && GBS::VDS_PK_HL_GAIN::bitWidth == 6, "VDS_PK_HL_GAIN");
+static_assert(GBS::VDS_PK_LB_CMP::segment == 0x03 && GBS::VDS_PK_LB_CMP::byteOffset == 0x44 && GBS::VDS_PK_LB_CMP::bitOffset == 3 && GBS::VDS_PK_LB_CMP::bitWidth == 5, "VDS_PK_LB_CMP");
+static_assert(GBS::VDS_PK_LB_CORE::segment == 0x03 && GBS::VDS_PK_LB_CORE::byteOffset == 0x44 && GBS::VDS_PK_LB_CORE::bitOffset == 0 && GBS::VDS_PK_LB_CORE::bitWidth == 3, "VDS_PK_LB_CORE");
+static_assert(GBS::VDS_PK_LB_GAIN::segment == 0x03 && GBS::VDS_PK_LB_GAIN::byteOffset == 0x45 && GBS::VDS_PK_LB_GAIN::bitOffset == 0 && GBS::VDS_PK_LB_GAIN::bitWidth == 6, "VDS_PK_LB_GAIN");
+static_assert(GBS::VDS_PK_LH_CMP::segment == 0x03 && GBS::VDS_PK_LH_CMP::byteOffset == 0x46 && GBS::VDS_PK_LH_CMP::bitOffset == 3 && GBS::VDS_PK_LH_CMP::bitWidth == 5, "VDS_PK_LH_CMP");
+static_assert(GBS::VDS_PK_LH_CORE::segment == 0x03 && GBS::VDS_PK_LH_CORE::byteOffset == 0x46 && GBS::VDS_PK_LH_CORE::bitOffset == 0 && GBS::VDS_PK_LH_CORE::bitWidth == 3, "VDS_PK_LH_CORE");
+static_assert(GBS::VDS_PK_LH_GAIN::segment == 0x03 && GBS::VDS_PK_LH_GAIN::byteOffset == 0x47 && GBS::VDS_PK_LH_GAIN::bitOffset == 0 && GBS::VDS_PK_LH_GAIN::bitWidth == 6, "VDS_PK_LH_GAIN");
+static_assert(GBS::VDS_PK_LINE_BUF_SP::segment == 0x03 && GBS::VDS_PK_LINE_BUF_SP::byteOffset == 0x41 && GBS::VDS_PK_LINE_BUF_SP::bitOffset == 0 && GBS::VDS_PK_LINE_BUF_SP::bitWidth == 10, "VDS_PK_LINE_BUF_SP");
+static_assert(GBS::VDS_PK_RAM_BYPS::segment == 0x03 && GBS::VDS_PK_RAM_BYPS::byteOffset == 0x42 && GBS::VDS_PK_RAM_BYPS::bitOffset == 6 && GBS::VDS_PK_RAM_BYPS::bitWidth == 1, "VDS_PK_RAM_BYPS");
+static_assert(GBS::VDS_PK_VH_HH_SEL::segment == 0x03 && GBS::VDS_PK_VH_HH_SEL::byteOffset == 0x43 && GBS::VDS_PK_VH_HH_SEL::bitOffset == 3 && GBS::VDS_PK_VH_HH_SEL::bitWidth == 1, "VDS_PK_VH_HH_SEL");
+static_assert(GBS::VDS_PK_VH_HL_SEL::segment == 0x03 && GBS::VDS_PK_VH_HL_SEL::byteOffset == 0x43 && GBS::VDS_PK_VH_HL_SEL::bitOffset == 2 && GBS::VDS_PK_VH_HL_SEL::bitWidth == 1, "VDS_PK_VH_HL_SEL");
+static_assert(GBS::VDS_PK_VL_HH_SEL::segment == 0x03 && GBS::VDS_PK_VL_HH_SEL::byteOffset == 0x43 && GBS::VDS_PK_VL_HH_SEL::bitOffset == 1 && GBS::VDS_PK_VL_HH_SEL::bitWidth == 1, "VDS_PK_VL_HH_SEL");
+static_assert(GBS::VDS_PK_VL_HL_SEL::segment == 0x03 && GBS::VDS_PK_VL_HL_SEL::byteOffset == 0x43 && GBS::VDS_PK_VL_HL_SEL::bitOffset == 0 && GBS::VDS_PK_VL_HL_SEL::bitWidth == 1, "VDS_PK_VL_HL_SEL");
+static_assert(GBS::VDS_PK_Y_H_BYPS::segment == 0x03 && GBS::VDS_PK_Y_H_BYPS::byteOffset == 0x4E && GBS::VDS_PK_Y_H_BYPS::bitOffset == 0 && GBS::VDS_PK_Y_H_BYPS::bitWidth == 1, "VDS_PK_Y_H_BYPS");
+static_assert(GBS::VDS_PK_Y_V_BYPS::segment == 0x03 && GBS::VDS_PK_Y_V_BYPS::byteOffset == 0x4E && GBS::VDS_PK_Y_V_BYPS::bitOffset == 1 && GBS::VDS_PK_Y_V_BYPS::bitWidth == 1, "VDS_PK_Y_V_BYPS");
+static_assert(GBS::VDS_SK_BYPS::segment == 0x03 && GBS::VDS_SK_BYPS::byteOffset == 0x31 && GBS::VDS_SK_BYPS::bitOffset == 5 && GBS::VDS_SK_BYPS::bitWidth == 1, "VDS_SK_BYPS");
+static_assert(GBS::VDS_SK_GAIN::segment == 0x03 && GBS::VDS_SK_GAIN::byteOffset == 0x31 && GBS::VDS_SK_GAIN::bitOffset == 0 && GBS::VDS_SK_GAIN::bitWidth == 4, "VDS_SK_GAIN");
+static_assert(GBS::VDS_SK_RANGE::segment == 0x03 && GBS::VDS_SK_RANGE::byteOffset == 0x30 && GBS::VDS_SK_RANGE::bitOffset == 0 && GBS::VDS_SK_RANGE::bitWidth == 8, "VDS_SK_RANGE");
+static_assert(GBS::VDS_SK_U_CENTER::segment == 0x03 && GBS::VDS_SK_U_CENTER::byteOffset == 0x2C && GBS::VDS_SK_U_CENTER::bitOffset == 0 && GBS::VDS_SK_U_CENTER::bitWidth == 8, "VDS_SK_U_CENTER");
+static_assert(GBS::VDS_SK_V_CENTER::segment == 0x03 && GBS::VDS_SK_V_CENTER::byteOffset == 0x2D && GBS::VDS_SK_V_CENTER::bitOffset == 0 && GBS::VDS_SK_V_CENTER::bitWidth == 8, "VDS_SK_V_CENTER");
+static_assert(GBS::VDS_SK_Y_EN::segment == 0x03 && GBS::VDS_SK_Y_EN::byteOffset == 0x31 && GBS::VDS_SK_Y_EN::bitOffset == 4 && GBS::VDS_SK_Y_EN::bitWidth == 1, "VDS_SK_Y_EN");
+static_assert(GBS::VDS_SK_Y_HIGH_TH::segment == 0x03 && GBS::VDS_SK_Y_HIGH_TH::byteOffset == 0x2F && GBS::VDS_SK_Y_HIGH_TH::bitOffset == 0 && GBS::VDS_SK_Y_HIGH_TH::bitWidth == 8, "VDS_SK_Y_HIGH_TH");
+static_assert(GBS::VDS_SK_Y_LOW_TH::segment == 0x03 && GBS::VDS_SK_Y_LOW_TH::byteOffset == 0x2E && GBS::VDS_SK_Y_LOW_TH::bitOffset == 0 && GBS::VDS_SK_Y_LOW_TH::bitWidth == 8, "VDS_SK_Y_LOW_TH");
+static_assert(GBS::VDS_SRESET::segment == 0x03 && GBS::VDS_SRESET::byteOffset == 0x00 && GBS::VDS_SRESET::bitOffset == 7 && GBS::VDS_SRESET::bitWidth == 1, "VDS_SRESET");
+static_assert(GBS::VDS_STEP_CLIP::segment == 0x03 && GBS::VDS_STEP_CLIP::byteOffset == 0x2B && GBS::VDS_STEP_CLIP::bitOffset == 4 && GBS::VDS_STEP_CLIP::bitWidth == 3, "VDS_STEP_CLIP");
+static_assert(GBS::VDS_STEP_DLY_CNTRL::segment == 0x03 && GBS::VDS_STEP_DLY_CNTRL::byteOffset == 0x2A && GBS::VDS_STEP_DLY_CNTRL::bitOffset == 4 && GBS::VDS_STEP_DLY_CNTRL::bitWidth == 2, "VDS_STEP_DLY_CNTRL");
+static_assert(GBS::VDS_STEP_GAIN::segment == 0x03 && GBS::VDS_STEP_GAIN::byteOffset == 0x2B && GBS::VDS_STEP_GAIN::bitOffset == 0 && GBS::VDS_STEP_GAIN::bitWidth == 4, "VDS_STEP_GAIN");
+static_assert(GBS::VDS_SVM_2ND_BYPS::segment == 0x03 && GBS::VDS_SVM_2ND_BYPS::byteOffset == 0x32 && GBS::VDS_SVM_2ND_BYPS::bitOffset == 3 && GBS::VDS_SVM_2ND_BYPS::bitWidth == 1, "VDS_SVM_2ND_BYPS");
+static_assert(GBS::VDS_SVM_BPF_CNTRL::segment == 0x03 && GBS::VDS_SVM_BPF_CNTRL::byteOffset == 0x32 && GBS::VDS_SVM_BPF_CNTRL::bitOffset == 0 && GBS::VDS_SVM_BPF_CNTRL::bitWidth == 2, "VDS_SVM_BPF_CNTRL");
+static_assert(GBS::VDS_SVM_GAIN::segment == 0x03 && GBS::VDS_SVM_GAIN::byteOffset == 0x33 && GBS::VDS_SVM_GAIN::bitOffset == 0 && GBS::VDS_SVM_GAIN::bitWidth == 8, "VDS_SVM_GAIN");
+static_assert(GBS::VDS_SVM_OFFSET::segment == 0x03 && GBS::VDS_SVM_OFFSET::byteOffset == 0x34 && GBS::VDS_SVM_OFFSET::bitOffset == 0 && GBS::VDS_SVM_OFFSET::bitWidth == 8, "VDS_SVM_OFFSET");
+static_assert(GBS::VDS_SVM_POL_FLIP::segment == 0x03 && GBS::VDS_SVM_POL_FLIP::byteOffset == 0x32 && GBS::VDS_SVM_POL_FLIP::bitOffset == 2 && GBS::VDS_SVM_POL_FLIP::bitWidth == 1, "VDS_SVM_POL_FLIP");
+static_assert(GBS::VDS_SVM_SIGMOID_BYPS::segment == 0x03 && GBS::VDS_SVM_SIGMOID_BYPS::byteOffset == 0x32 && GBS::VDS_SVM_SIGMOID_BYPS::bitOffset == 7 && GBS::VDS_SVM_SIGMOID_BYPS::bitWidth == 1, "VDS_SVM_SIGMOID_BYPS");
+static_assert(GBS::VDS_SVM_V4CLK_DELAY::segment == 0x03 && GBS::VDS_SVM_V4CLK_DELAY::byteOffset == 0x40 && GBS::VDS_SVM_V4CLK_DELAY::bitOffset == 4 && GBS::VDS_SVM_V4CLK_DELAY::bitWidth == 2, "VDS_SVM_V4CLK_DELAY");
+static_assert(GBS::VDS_SVM_VCLK_DELAY::segment == 0x03 && GBS::VDS_SVM_VCLK_DELAY::byteOffset == 0x32 && GBS::VDS_SVM_VCLK_DELAY::bitOffset == 4 && GBS::VDS_SVM_VCLK_DELAY::bitWidth == 3, "VDS_SVM_VCLK_DELAY");
+static_assert(GBS::VDS_SYNC_EN::segment == 0x03 && GBS::VDS_SYNC_EN::byteOffset == 0x00 && GBS::VDS_SYNC_EN::bitOffset == 0 && GBS::VDS_SYNC_EN::bitWidth == 1, "VDS_SYNC_EN");
+static_assert(GBS::VDS_SYNC_IN_SEL::segment == 0x03 && GBS::VDS_SYNC_IN_SEL::byteOffset == 0x72 && GBS::VDS_SYNC_IN_SEL::bitOffset == 7 && GBS::VDS_SYNC_IN_SEL::bitWidth == 1, "VDS_SYNC_IN_SEL");
+static_assert(GBS::VDS_SYNC_LEV::segment == 0x03 && GBS::VDS_SYNC_LEV::byteOffset == 0x3D && GBS::VDS_SYNC_LEV::bitOffset == 0 && GBS::VDS_SYNC_LEV::bitWidth == 9, "VDS_SYNC_LEV");
+static_assert(GBS::VDS_TAP6_BYPS::segment == 0x03 && GBS::VDS_TAP6_BYPS::byteOffset == 0x24 && GBS::VDS_TAP6_BYPS::bitOffset == 3 && GBS::VDS_TAP6_BYPS::bitWidth == 1, "VDS_TAP6_BYPS");
+static_assert(GBS::VDS_TEST_BUS_SEL::segment == 0x03 && GBS::VDS_TEST_BUS_SEL::byteOffset == 0x50 && GBS::VDS_TEST_BUS_SEL::bitOffset == 0 && GBS::VDS_TEST_BUS_SEL::bitWidth == 4, "VDS_TEST_BUS_SEL");
+static_assert(GBS::VDS_TEST_EN::segment == 0x03 && GBS::VDS_TEST_EN::byteOffset == 0x50 && GBS::VDS_TEST_EN::bitOffset == 4 && GBS::VDS_TEST_EN::bitWidth == 1, "VDS_TEST_EN");
+static_assert(GBS::VDS_UCOS_GAIN::segment == 0x03 && GBS::VDS_UCOS_GAIN::byteOffset == 0x36 && GBS::VDS_UCOS_GAIN::bitOffset == 0 && GBS::VDS_UCOS_GAIN::bitWidth == 8, "VDS_UCOS_GAIN");
+static_assert(GBS::VDS_USER_MAX::segment == 0x03 && GBS::VDS_USER_MAX::byteOffset == 0x27 && GBS::VDS_USER_MAX::bitOffset == 4 && GBS::VDS_USER_MAX::bitWidth == 4, "VDS_USER_MAX");
+static_assert(GBS::VDS_USER_MIN::segment == 0x03 && GBS::VDS_USER_MIN::byteOffset == 0x27 && GBS::VDS_USER_MIN::bitOffset == 0 && GBS::VDS_USER_MIN::bitWidth == 4, "VDS_USER_MIN");
+static_assert(GBS::VDS_USIN_GAIN::segment == 0x03 && GBS::VDS_USIN_GAIN::byteOffset == 0x38 && GBS::VDS_USIN_GAIN::bitOffset == 0 && GBS::VDS_USIN_GAIN::bitWidth == 8, "VDS_USIN_GAIN");
+static_assert(GBS::VDS_UV_BLK_VAL::segment == 0x03 && GBS::VDS_UV_BLK_VAL::byteOffset == 0x3F && GBS::VDS_UV_BLK_VAL::bitOffset == 0 && GBS::VDS_UV_BLK_VAL::bitWidth == 8, "VDS_UV_BLK_VAL");
+static_assert(GBS::VDS_UV_FLIP::segment == 0x03 && GBS::VDS_UV_FLIP::byteOffset == 0x24 && GBS::VDS_UV_FLIP::bitOffset == 0 && GBS::VDS_UV_FLIP::bitWidth == 1, "VDS_UV_FLIP");
+static_assert(GBS::VDS_UV_STEP_BYPS::segment == 0x03 && GBS::VDS_UV_STEP_BYPS::byteOffset == 0x2B && GBS::VDS_UV_STEP_BYPS::bitOffset == 7 && GBS::VDS_UV_STEP_BYPS::bitWidth == 1, "VDS_UV_STEP_BYPS");
+static_assert(GBS::VDS_U_DELAY::segment == 0x03 && GBS::VDS_U_DELAY::byteOffset == 0x24 && GBS::VDS_U_DELAY::bitOffset == 1 && GBS::VDS_U_DELAY::bitWidth == 1, "VDS_U_DELAY");
+static_assert(GBS::VDS_U_OFST::segment == 0x03 && GBS::VDS_U_OFST::byteOffset == 0x3B && GBS::VDS_U_OFST::bitOffset == 0 && GBS::VDS_U_OFST::bitWidth == 8, "VDS_U_OFST");
+static_assert(GBS::VDS_VB_SP::segment == 0x03 && GBS::VDS_VB_SP::byteOffset == 0x08 && GBS::VDS_VB_SP::bitOffset == 4 && GBS::VDS_VB_SP::bitWidth == 11, "VDS_VB_SP");
+static_assert(GBS::VDS_VB_ST::segment == 0x03 && GBS::VDS_VB_ST::byteOffset == 0x07 && GBS::VDS_VB_ST::bitOffset == 0 && GBS::VDS_VB_ST::bitWidth == 11, "VDS_VB_ST");
+static_assert(GBS::VDS_VCOS_GAIN::segment == 0x03 && GBS::VDS_VCOS_GAIN::byteOffset == 0x37 && GBS::VDS_VCOS_GAIN::bitOffset == 0 && GBS::VDS_VCOS_GAIN::bitWidth == 8, "VDS_VCOS_GAIN");
+static_assert(GBS::VDS_VSCALE::segment == 0x03 && GBS::VDS_VSCALE::byteOffset == 0x17 && GBS::VDS_VSCALE::bitOffset == 4 && GBS::VDS_VSCALE::bitWidth == 10, "VDS_VSCALE");
+static_assert(GBS::VDS_VSCALE_BYPS::segment == 0x03 && GBS::VDS_VSCALE_BYPS::byteOffset == 0x00 && GBS::VDS_VSCALE_BYPS::bitOffset == 5 && GBS::VDS_VSCALE_BYPS::bitWidth == 1, "VDS_VSCALE_BYPS");
+static_assert(GBS::VDS_VSIN_GAIN::segment == 0x03 && GBS::VDS_VSIN_GAIN::byteOffset == 0x39 && GBS::VDS_VSIN_GAIN::bitOffset == 0 && GBS::VDS_VSIN_GAIN::bitWidth == 8, "VDS_VSIN_GAIN");
+static_assert(GBS::VDS_VSYNC_RST::segment == 0x03 && GBS::VDS_VSYNC_RST::byteOffset == 0x02 && GBS::VDS_VSYNC_RST::bitOffset == 4 && GBS::VDS_VSYNC_RST::bitWidth == 11, "VDS_VSYNC_RST");
+static_assert(GBS::VDS_VSYN_SIZE1::segment == 0x03 && GBS::VDS_VSYN_SIZE1::byteOffset == 0x20 && GBS::VDS_VSYN_SIZE1::bitOffset == 0 && GBS::VDS_VSYN_SIZE1::bitWidth == 11, "VDS_VSYN_SIZE1");
+static_assert(GBS::VDS_VSYN_SIZE2::segment == 0x03 && GBS::VDS_VSYN_SIZE2::byteOffset == 0x22 && GBS::VDS_VSYN_SIZE2::bitOffset == 0 && GBS::VDS_VSYN_SIZE2::bitWidth == 11, "VDS_VSYN_SIZE2");
+static_assert(GBS::VDS_VS_SP::segment == 0x03 && GBS::VDS_VS_SP::byteOffset == 0x0E && GBS::VDS_VS_SP::bitOffset == 4 && GBS::VDS_VS_SP::bitWidth == 11, "VDS_VS_SP");
+static_assert(GBS::VDS_VS_ST::segment == 0x03 && GBS::VDS_VS_ST::byteOffset == 0x0D && GBS::VDS_VS_ST::bitOffset == 0 && GBS::VDS_VS_ST::bitWidth == 11, "VDS_VS_ST");
+static_assert(GBS::VDS_V_DELAY::segment == 0x03 && GBS::VDS_V_DELAY::byteOffset == 0x24 && GBS::VDS_V_DELAY::bitOffset == 2 && GBS::VDS_V_DELAY::bitWidth == 1, "VDS_V_DELAY");
+static_assert(GBS::VDS_V_OFST::segment == 0x03 && GBS::VDS_V_OFST::byteOffset == 0x3C && GBS::VDS_V_OFST::bitOffset == 0 && GBS::VDS_V_OFST::bitWidth == 8, "VDS_V_OFST");
+static_assert(GBS::VDS_WEN_DELAY::segment == 0x03 && GBS::VDS_WEN_DELAY::byteOffset == 0x24 && GBS::VDS_WEN_DELAY::bitOffset == 6 && GBS::VDS_WEN_DELAY::bitWidth == 2, "VDS_WEN_DELAY");
+static_assert(GBS::VDS_WLEV_GAIN::segment == 0x03 && GBS::VDS_WLEV_GAIN::byteOffset == 0x58 && GBS::VDS_WLEV_GAIN::bitOffset == 0 && GBS::VDS_WLEV_GAIN::bitWidth == 8, "VDS_WLEV_GAIN");
+static_assert(GBS::VDS_W_LEV::segment == 0x03 && GBS::VDS_W_LEV::byteOffset == 0x57 && GBS::VDS_W_LEV::bitOffset == 0 && GBS::VDS_W_LEV::bitWidth == 8, "VDS_W_LEV");
+static_assert(GBS::VDS_W_LEV_BYPS::segment == 0x03 && GBS::VDS_W_LEV_BYPS::byteOffset == 0x56 && GBS::VDS_W_LEV_BYPS::bitOffset == 7 && GBS::VDS_W_LEV_BYPS::bitWidth == 1, "VDS_W_LEV_BYPS");
+static_assert(GBS::VDS_Y_DELAY::segment == 0x03 && GBS::VDS_Y_DELAY::byteOffset == 0x24 && GBS::VDS_Y_DELAY::bitOffset == 4 && GBS::VDS_Y_DELAY::bitWidth == 2, "VDS_Y_DELAY");
+static_assert(GBS::VDS_Y_GAIN::segment == 0x03 && GBS::VDS_Y_GAIN::byteOffset == 0x35 && GBS::VDS_Y_GAIN::bitOffset == 0 && GBS::VDS_Y_GAIN::bitWidth == 8, "VDS_Y_GAIN");
+static_assert(GBS::VDS_Y_OFST::segment == 0x03 && GBS::VDS_Y_OFST::byteOffset == 0x3A && GBS::VDS_Y_OFST::bitOffset == 0 && GBS::VDS_Y_OFST::bitWidth == 8, "VDS_Y_OFST");
+static_assert(GBS::VERYWIDEDUMMYREG::segment == 0x05 && GBS::VERYWIDEDUMMYREG::byteOffset == 0xD0 && GBS::VERYWIDEDUMMYREG::bitOffset == 0 && GBS::VERYWIDEDUMMYREG::bitWidth == 32, "VERYWIDEDUMMYREG");
+static_assert(GBS::VPERIOD_IF::segment == 0x00 && GBS::VPERIOD_IF::byteOffset == 0x07 && GBS::VPERIOD_IF::bitOffset == 1 && GBS::VPERIOD_IF::bitWidth == 11, "VPERIOD_IF");
+static_assert(GBS::WFF_ADR_ADD_2::segment == 0x04 && GBS::WFF_ADR_ADD_2::byteOffset == 0x42 && GBS::WFF_ADR_ADD_2::bitOffset == 5 && GBS::WFF_ADR_ADD_2::bitWidth == 1, "WFF_ADR_ADD_2");
+static_assert(GBS::WFF_ENABLE::segment == 0x04 && GBS::WFF_ENABLE::byteOffset == 0x42 && GBS::WFF_ENABLE::bitOffset == 0 && GBS::WFF_ENABLE::bitWidth == 1, "WFF_ENABLE");
+static_assert(GBS::WFF_FF_STATUS_SEL::segment == 0x04 && GBS::WFF_FF_STATUS_SEL::byteOffset == 0x42 && GBS::WFF_FF_STATUS_SEL::bitOffset == 7 && GBS::WFF_FF_STATUS_SEL::bitWidth == 1, "WFF_FF_STATUS_SEL");
+static_assert(GBS::WFF_FF_STA_INV::segment == 0x04 && GBS::WFF_FF_STA_INV::byteOffset == 0x42 && GBS::WFF_FF_STA_INV::bitOffset == 2 && GBS::WFF_FF_STA_INV::bitWidth == 1, "WFF_FF_STA_INV");
+static_assert(GBS::WFF_HB_DELAY::segment == 0x04 && GBS::WFF_HB_DELAY::byteOffset == 0x4B && GBS::WFF_HB_DELAY::bitOffset == 0 && GBS::WFF_HB_DELAY::bitWidth == 3, "WFF_HB_DELAY");
+static_assert(GBS::WFF_LINE_FLIP::segment == 0x04 && GBS::WFF_LINE_FLIP::byteOffset == 0x4A && GBS::WFF_LINE_FLIP::bitOffset == 4 && GBS::WFF_LINE_FLIP::bitWidth == 1, "WFF_LINE_FLIP");
+static_assert(GBS::WFF_SAFE_GUARD::segment == 0x04 && GBS::WFF_SAFE_GUARD::byteOffset == 0x42 && GBS::WFF_SAFE_GUARD::bitOffset == 3 && GBS::WFF_SAFE_GUARD::bitWidth == 1, "WFF_SAFE_GUARD");
+static_assert(GBS::WFF_SAFE_GUARD_A::segment == 0x04 && GBS::WFF_SAFE_GUARD_A::byteOffset == 0x44 && GBS::WFF_SAFE_GUARD_A::bitOffset == 0 && GBS::WFF_SAFE_GUARD_A::bitWidth == 21, "WFF_SAFE_GUARD_A");
+static_assert(GBS::WFF_SAFE_GUARD_B::segment == 0x04 && GBS::WFF_SAFE_GUARD_B::byteOffset == 0x47 && GBS::WFF_SAFE_GUARD_B::bitOffset == 0 && GBS::WFF_SAFE_GUARD_B::bitWidth == 21, "WFF_SAFE_GUARD_B");
+static_assert(GBS::WFF_VB_DELAY::segment == 0x04 && GBS::WFF_VB_DELAY::byteOffset == 0x4B && GBS::WFF_VB_DELAY::bitOffset == 4 && GBS::WFF_VB_DELAY::bitWidth == 3, "WFF_VB_DELAY");
+static_assert(GBS::WFF_YUV_DEINTERLACE::segment == 0x04 && GBS::WFF_YUV_DEINTERLACE::byteOffset == 0x4A && GBS::WFF_YUV_DEINTERLACE::bitOffset == 0 && GBS::WFF_YUV_DEINTERLACE::bitWidth == 1, "WFF_YUV_DEINTERLACE");
+#endif
+
+#endif
@@ -63,8 +63,24 @@ namespace tw
         template <uint8_t BitWidth, Signage Signed>
         using RegValue = typename RegValue_<BitWidth, Signed>::Type;
 
+        // transfers since boot, profilers take differences
+        struct BusCounters
+        {
+            uint32_t reads;
+            uint32_t writes;
+            uint32_t bytes; // payload, without addressing
+        };
+
+        inline BusCounters &busCounters()
+        {
+            static BusCounters counters;
+            return counters;
+        }
+
         inline void rawRead(uint8_t addr, uint8_t reg, uint8_t *output, uint8_t size)
         {
+            busCounters().reads++;
+            busCounters().bytes += size;
             Wire.beginTransmission(addr);
             Wire.write(reg);
             Wire.endTransmission();
@@ -92,6 +108,8 @@ namespace tw
   }
   Serial.println();
 #endif
+            busCounters().writes++;
+            busCounters().bytes += size;
             Wire.beginTransmission(addr);
             Wire.write(reg);
             Wire.write(input, size);
@@ -238,6 +256,9 @@ namespace tw
 
     } // namespace detail
 
+    using detail::BusCounters;
+    using detail::busCounters;
+
     template <uint8_t Addr>
     class Slave
     {